@@ -23,6 +23,15 @@ enum class MessageLoopBehavior : bool {
   kWaitForWork = true
 };
 
+enum class PriorityMode : bool {
+  // Tasks of all priorities share a single pool of worker threads.
+  kDontApply,
+  // Tasks are posted to a separate pool of worker threads per TaskPriority,
+  // and the worker threads of each pool get a matching OS thread priority
+  // where the platform supports it.
+  kApply
+};
+
 /**
  * Returns a new instance of the default v8::Platform implementation.
  *
@@ -35,13 +44,17 @@ enum class MessageLoopBehavior : bool {
  * calling v8::platform::RunIdleTasks to process the idle tasks.
  * If |tracing_controller| is nullptr, the default platform will create a
  * v8::platform::TracingController instance and use it.
+ * If |priority_mode| is PriorityMode::kApply, the default platform will use
+ * multiple task queues executed by threads with different OS priorities, so
+ * that best effort tasks cannot delay user blocking ones.
  */
 V8_PLATFORM_EXPORT std::unique_ptr<v8::Platform> NewDefaultPlatform(
     int thread_pool_size = 0,
     IdleTaskSupport idle_task_support = IdleTaskSupport::kDisabled,
     InProcessStackDumping in_process_stack_dumping =
         InProcessStackDumping::kDisabled,
-    std::unique_ptr<v8::TracingController> tracing_controller = {});
+    std::unique_ptr<v8::TracingController> tracing_controller = {},
+    PriorityMode priority_mode = PriorityMode::kDontApply);
 
 /**
  * The same as NewDefaultPlatform but disables the worker thread pool.
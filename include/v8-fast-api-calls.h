@@ -180,6 +180,12 @@
  *  - TypedArrays and ArrayBuffers
  *  - arrays of embedder types
  *
+ * An argument of type `const FastApiTypedArray<double>&` that is declared with
+ * CTypeInfo::Flags::kAllowJSArrayBit also accepts a JavaScript array with
+ * packed double elements. The fast call then reads the elements of the array
+ * in place, without copying them. Any other array takes the slow callback,
+ * which thus has to handle both JavaScript arrays and the TypedArray.
+ *
  *
  * The API offers a limited support for function overloads:
  *
@@ -282,6 +288,7 @@ class CTypeInfo {
     kEnforceRangeBit = 1 << 1,  // T must be integral
     kClampBit = 1 << 2,         // T must be integral
     kIsRestrictedBit = 1 << 3,  // T must be float or double
+    kAllowJSArrayBit = 1 << 4,  // Must be a TypedArray of double
   };
 
   explicit constexpr CTypeInfo(
@@ -792,6 +799,11 @@ class V8_EXPORT CTypeInfoBuilder {
         uint8_t(kFlags) & uint8_t(CTypeInfo::Flags::kIsRestrictedBit),
         CTypeInfo::IsFloatingPointType(kType),
         "kIsRestrictedBit is only allowed for floating point types.");
+    STATIC_ASSERT_IMPLIES(
+        uint8_t(kFlags) & uint8_t(CTypeInfo::Flags::kAllowJSArrayBit),
+        kSequenceType == CTypeInfo::SequenceType::kIsTypedArray &&
+            kType == CTypeInfo::Type::kFloat64,
+        "kAllowJSArrayBit is only allowed for TypedArrays of double.");
     STATIC_ASSERT_IMPLIES(kSequenceType == CTypeInfo::SequenceType::kIsSequence,
                           kType == CTypeInfo::Type::kVoid,
                           "Sequences are only supported from void type.");
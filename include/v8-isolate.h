@@ -10,6 +10,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "cppgc/common.h"
 #include "v8-array-buffer.h"       // NOLINT(build/include_directory)
@@ -38,6 +39,7 @@ class SharedArrayBuffer;
 
 namespace internal {
 class MicrotaskQueue;
+class SharedHeapBudget;
 class ThreadLocalTop;
 }  // namespace internal
 
@@ -162,6 +164,46 @@ class V8_EXPORT ResourceConstraints {
   uint32_t* stack_limit_ = nullptr;
 };
 
+/**
+ * A memory budget shared by all isolates that are created with it via
+ * Isolate::CreateParams::heap_budget, e.g. all isolates of a container.
+ *
+ * After every full garbage collection an isolate reports its old generation
+ * size and allocation rate to the budget. The part of the budget that is not
+ * used by live objects is split between the isolates in proportion to their
+ * smoothed allocation rates, and each isolate caps its old generation
+ * allocation limit at its share. This makes isolates that share a budget
+ * collect garbage earlier instead of growing independently. The budget does
+ * not change the hard limits configured via ResourceConstraints.
+ */
+class V8_EXPORT HeapBudget {
+ public:
+  static std::shared_ptr<HeapBudget> New(size_t budget_in_bytes);
+
+  virtual ~HeapBudget() = default;
+
+  HeapBudget(const HeapBudget&) = delete;
+  HeapBudget& operator=(const HeapBudget&) = delete;
+
+  /**
+   * Changes the budget. Takes effect for each isolate at its next full
+   * garbage collection.
+   */
+  void SetBudgetInBytes(size_t budget_in_bytes);
+  size_t GetBudgetInBytes() const;
+
+  /**
+   * Returns the sum of the old generation sizes the isolates sharing this
+   * budget reported after their last full garbage collection.
+   */
+  size_t GetUsedBytes() const;
+
+ private:
+  HeapBudget() = default;
+
+  friend class internal::SharedHeapBudget;
+};
+
 /**
  * Option flags passed to the SetRAILMode function.
  * See documentation https://developers.google.com/web/tools/chrome-devtools/
@@ -294,6 +336,12 @@ class V8_EXPORT Isolate {
      */
     FatalErrorCallback fatal_error_callback = nullptr;
     OOMErrorCallback oom_error_callback = nullptr;
+
+    /**
+     * An optional memory budget that this isolate shares with other isolates
+     * of the process. See HeapBudget.
+     */
+    std::shared_ptr<HeapBudget> heap_budget;
   };
 
   /**
@@ -811,6 +859,49 @@ class V8_EXPORT Isolate {
       std::unique_ptr<MeasureMemoryDelegate> delegate,
       MeasureMemoryExecution execution = MeasureMemoryExecution::kDefault);
 
+  /**
+   * This API is experimental and may change significantly.
+   *
+   * Returns an opaque blob describing the object and array literals that this
+   * isolate currently allocates directly in old space. The blob can be passed
+   * to SeedPretenuringDecisions() of an isolate in a later process so that
+   * it does not have to learn the decisions again.
+   */
+  std::vector<uint8_t> GetPretenuringDecisions();
+
+  /**
+   * This API is experimental and may change significantly.
+   *
+   * Seeds pretenuring decisions from a blob returned by
+   * GetPretenuringDecisions(). Decisions apply to literals that are
+   * instantiated for the first time after this call in scripts with the same
+   * name and source. Returns false if the blob is malformed.
+   */
+  bool SeedPretenuringDecisions(const uint8_t* data, size_t length);
+
+  /**
+   * This API is experimental and may change significantly.
+   *
+   * Starts attributing a random sample of allocations to the native context
+   * that is current at allocation time. On average one sample is taken every
+   * |sample_interval| allocated bytes. Samples are dropped when the garbage
+   * collector reclaims the sampled object, so no additional GC work is needed
+   * to keep the numbers up to date. Restarting discards all samples.
+   */
+  void StartContextMemorySampling(size_t sample_interval = 512 * 1024);
+
+  /**
+   * Stops context memory sampling and discards all samples.
+   */
+  void StopContextMemorySampling();
+
+  /**
+   * Returns the estimated number of live bytes that were allocated while
+   * |context| was the current context. Returns 0 if context memory sampling
+   * is not running.
+   */
+  size_t GetSampledContextMemoryUsage(Local<Context> context);
+
   /**
    * Get a call stack sample from the isolate.
    * \param state Execution state.
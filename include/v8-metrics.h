@@ -155,6 +155,33 @@ struct WasmModulesPerIsolate {
   size_t count = 0;
 };
 
+struct Deoptimization {
+  // Static string naming the deoptimization reason, as printed by
+  // --trace-deopt.
+  const char* reason = nullptr;
+  bool lazy = false;
+  // Whether the deoptimized code was compiled for on-stack replacement.
+  bool osr = false;
+  int script_id = -1;
+  // Source position of the start of the deoptimized function.
+  int function_start_position = -1;
+  // Bytecode offset in the outermost frame at which execution resumes.
+  int bytecode_offset = -1;
+};
+
+struct OptimizedCompilation {
+  // Static string naming the tier the function was compiled for.
+  const char* tier = nullptr;
+  bool concurrent = false;
+  bool osr = false;
+  int script_id = -1;
+  int function_start_position = -1;
+  int64_t prepare_duration_in_us = -1;
+  int64_t execute_duration_in_us = -1;
+  int64_t finalize_duration_in_us = -1;
+  int64_t wall_clock_duration_in_us = -1;
+};
+
 /**
  * This class serves as a base class for recording event-based metrics in V8.
  * There a two kinds of metrics, those which are expected to be thread-safe and
@@ -207,6 +234,8 @@ class V8_EXPORT Recorder {
   ADD_MAIN_THREAD_EVENT(WasmModuleDecoded)
   ADD_MAIN_THREAD_EVENT(WasmModuleCompiled)
   ADD_MAIN_THREAD_EVENT(WasmModuleInstantiated)
+  ADD_MAIN_THREAD_EVENT(Deoptimization)
+  ADD_MAIN_THREAD_EVENT(OptimizedCompilation)
 #undef ADD_MAIN_THREAD_EVENT
 
   // Thread-safe events are not allowed to access the context and therefore do
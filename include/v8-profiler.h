@@ -631,7 +631,8 @@ class V8_EXPORT HeapGraphNode {
 class V8_EXPORT HeapSnapshot {
  public:
   enum SerializationFormat {
-    kJSON = 0  // See format description near 'Serialize' method.
+    kJSON = 0,   // See format description near 'Serialize' method.
+    kBinary = 1  // See format description near 'Serialize' method.
   };
 
   /** Returns the root node of the heap graph. */
@@ -681,6 +682,12 @@ class V8_EXPORT HeapSnapshot {
    *
    * Nodes reference strings, other nodes, and edges by their indexes
    * in corresponding arrays.
+   *
+   * The binary format carries the same data, encoded as varints and
+   * length-prefixed strings, and is typically several times smaller. Its
+   * bytes are passed to OutputStream::WriteAsciiChunk as they are and may
+   * include '\0'. tools/heap-snapshot-binary-to-json.py converts it into
+   * the JSON format.
    */
   void Serialize(OutputStream* stream,
                  SerializationFormat format = kJSON) const;
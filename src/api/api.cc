@@ -61,6 +61,7 @@
 #include "src/handles/persistent-handles.h"
 #include "src/handles/shared-object-conveyor-handles.h"
 #include "src/handles/traced-handles.h"
+#include "src/heap/context-memory-sampler.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-write-barrier.h"
 #include "src/heap/safepoint.h"
@@ -124,10 +125,12 @@
 #include "src/snapshot/startup-serializer.h"  // For SerializedHandleChecker.
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
+#include "src/strings/string-simd.h"
 #include "src/strings/unicode-inl.h"
 #include "src/tracing/trace-event.h"
 #include "src/utils/detachable-vector.h"
 #include "src/utils/identity-map.h"
+#include "src/utils/memcopy.h"
 #include "src/utils/version.h"
 
 #if V8_ENABLE_WEBASSEMBLY
@@ -5874,28 +5877,41 @@ static int WriteUtf8Impl(base::Vector<const Char> string, char* write_start,
     }
     // Write the characters to the stream.
     if (sizeof(Char) == 1) {
-      // Simply memcpy if we only have ASCII characters.
-      uint8_t char_mask = 0;
-      for (int i = read_index; i < up_to; i++) char_mask |= read_start[i];
-      if ((char_mask & 0x80) == 0) {
-        int copy_length = up_to - read_index;
-        memcpy(current_write, read_start + read_index, copy_length);
-        current_write += copy_length;
-        read_index = up_to;
-      } else {
-        for (; read_index < up_to; read_index++) {
+      // Copy ASCII runs in bulk and widen the Latin-1 characters in between.
+      while (read_index < up_to) {
+        int ascii_length = i::AsciiPrefixLength(read_start + read_index,
+                                                up_to - read_index);
+        memcpy(current_write, read_start + read_index, ascii_length);
+        current_write += ascii_length;
+        read_index += ascii_length;
+        for (; read_index < up_to &&
+               read_start[read_index] > unibrow::Utf8::kMaxOneByteChar;
+             read_index++) {
           current_write += unibrow::Utf8::EncodeOneByte(
               current_write, static_cast<uint8_t>(read_start[read_index]));
-          DCHECK(write_capacity == -1 ||
-                 (current_write - write_start) <= write_capacity);
         }
+        DCHECK(write_capacity == -1 ||
+               (current_write - write_start) <= write_capacity);
       }
     } else {
-      for (; read_index < up_to; read_index++) {
+      while (read_index < up_to) {
         uint16_t character = read_start[read_index];
-        current_write += unibrow::Utf8::Encode(current_write, character,
-                                               prev_char, replace_invalid_utf8);
-        prev_char = character;
+        if (character <= unibrow::Utf8::kMaxOneByteChar) {
+          // ASCII characters are never part of a surrogate pair, so a run of
+          // them can be narrowed in bulk.
+          int ascii_length = i::AsciiPrefixLength(read_start + read_index,
+                                                  up_to - read_index);
+          i::CopyChars(reinterpret_cast<uint8_t*>(current_write),
+                       read_start + read_index, ascii_length);
+          current_write += ascii_length;
+          read_index += ascii_length;
+          prev_char = read_start[read_index - 1];
+        } else {
+          current_write += unibrow::Utf8::Encode(
+              current_write, character, prev_char, replace_invalid_utf8);
+          prev_char = character;
+          read_index++;
+        }
         DCHECK(write_capacity == -1 ||
                (current_write - write_start) <= write_capacity);
       }
@@ -9415,6 +9431,9 @@ void Isolate::Initialize(Isolate* v8_isolate,
   i_isolate->set_allow_atomics_wait(params.allow_atomics_wait);
 
   i_isolate->heap()->ConfigureHeap(params.constraints);
+  if (params.heap_budget) {
+    i_isolate->heap()->SetHeapBudget(params.heap_budget);
+  }
   if (params.constraints.stack_limit() != nullptr) {
     uintptr_t limit =
         reinterpret_cast<uintptr_t>(params.constraints.stack_limit());
@@ -9770,6 +9789,41 @@ bool Isolate::MeasureMemory(std::unique_ptr<MeasureMemoryDelegate> delegate,
   return i_isolate->heap()->MeasureMemory(std::move(delegate), execution);
 }
 
+std::vector<uint8_t> Isolate::GetPretenuringDecisions() {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  return i_isolate->heap()->pretenuring_handler()->SerializeTenureDecisions();
+}
+
+bool Isolate::SeedPretenuringDecisions(const uint8_t* data, size_t length) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  return i_isolate->heap()->pretenuring_handler()->DeserializeTenureDecisions(
+      data, length);
+}
+
+void Isolate::StartContextMemorySampling(size_t sample_interval) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  i_isolate->heap()->StartContextMemorySampling(sample_interval);
+}
+
+void Isolate::StopContextMemorySampling() {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  i_isolate->heap()->StopContextMemorySampling();
+}
+
+size_t Isolate::GetSampledContextMemoryUsage(Local<Context> context) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i::ContextMemorySampler* sampler =
+      i_isolate->heap()->context_memory_sampler();
+  if (!sampler) return 0;
+  i::DisallowGarbageCollection no_gc;
+  return sampler->SampledBytes(
+      Utils::OpenHandle(*context)->native_context());
+}
+
 std::unique_ptr<MeasureMemoryDelegate> MeasureMemoryDelegate::Default(
     Isolate* v8_isolate, Local<Context> context,
     Local<Promise::Resolver> promise_resolver, MeasureMemoryMode mode) {
@@ -10950,10 +11004,16 @@ SnapshotObjectId HeapSnapshot::GetMaxSnapshotJSObjectId() const {
 
 void HeapSnapshot::Serialize(OutputStream* stream,
                              HeapSnapshot::SerializationFormat format) const {
-  Utils::ApiCheck(format == kJSON, "v8::HeapSnapshot::Serialize",
+  Utils::ApiCheck(format == kJSON || format == kBinary,
+                  "v8::HeapSnapshot::Serialize",
                   "Unknown serialization format");
   Utils::ApiCheck(stream->GetChunkSize() > 0, "v8::HeapSnapshot::Serialize",
                   "Invalid stream chunk size");
+  if (format == kBinary) {
+    i::HeapSnapshotBinarySerializer serializer(ToInternal(this));
+    serializer.Serialize(stream);
+    return;
+  }
   i::HeapSnapshotJSONSerializer serializer(ToInternal(this));
   serializer.Serialize(stream);
 }
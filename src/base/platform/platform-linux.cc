@@ -47,6 +47,14 @@
 namespace v8 {
 namespace base {
 
+bool OS::AdviseHugePages(void* address, size_t size) {
+#if defined(MADV_HUGEPAGE)
+  return madvise(address, size, MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif  // defined(MADV_HUGEPAGE)
+}
+
 TimezoneCache* OS::CreateTimezoneCache() {
   return new PosixDefaultTimezoneCache();
 }
@@ -813,6 +813,17 @@ int OS::GetCurrentThreadId() {
 #endif
 }
 
+int OS::GetCurrentNumaNode() {
+#if V8_OS_LINUX && defined(__NR_getcpu)
+  unsigned cpu = 0;
+  unsigned node = 0;
+  if (syscall(__NR_getcpu, &cpu, &node, nullptr) == 0) {
+    return static_cast<int>(node);
+  }
+#endif
+  return -1;
+}
+
 void OS::ExitProcess(int exit_code) {
   // Use _exit instead of exit to avoid races between isolate
   // threads and static destructors.
@@ -1074,6 +1085,7 @@ class Thread::PlatformData {
 Thread::Thread(const Options& options)
     : data_(new PlatformData),
       stack_size_(options.stack_size()),
+      priority_(options.priority()),
       start_semaphore_(nullptr) {
   const int min_stack_size = static_cast<int>(PTHREAD_STACK_MIN);
   if (stack_size_ > 0) stack_size_ = std::max(stack_size_, min_stack_size);
@@ -1112,6 +1124,33 @@ static void SetThreadName(const char* name) {
 }
 
 
+static void SetThreadPriority(Thread::Priority priority) {
+#if V8_OS_DARWIN
+  switch (priority) {
+    case Thread::Priority::kBestEffort:
+      pthread_set_qos_class_self_np(QOS_CLASS_BACKGROUND, 0);
+      break;
+    case Thread::Priority::kUserVisible:
+      pthread_set_qos_class_self_np(QOS_CLASS_USER_INITIATED, 0);
+      break;
+    case Thread::Priority::kUserBlocking:
+      pthread_set_qos_class_self_np(QOS_CLASS_USER_INTERACTIVE, 0);
+      break;
+    case Thread::Priority::kDefault:
+      break;
+  }
+#elif V8_OS_LINUX
+  // Raising the priority of a thread needs privileges, so only best effort
+  // threads are lowered. With a |who| of 0, setpriority() applies to the
+  // calling thread only.
+  if (priority == Thread::Priority::kBestEffort) {
+    setpriority(PRIO_PROCESS, 0, 10);
+  }
+#else
+  USE(priority);
+#endif
+}
+
 static void* ThreadEntry(void* arg) {
   Thread* thread = reinterpret_cast<Thread*>(arg);
   // We take the lock here to make sure that pthread_create finished first since
@@ -1119,6 +1158,7 @@ static void* ThreadEntry(void* arg) {
   // one).
   { MutexGuard lock_guard(&thread->data()->thread_creation_mutex_); }
   SetThreadName(thread->name());
+  SetThreadPriority(thread->priority());
   DCHECK_NE(thread->data()->thread_, kNoThread);
   thread->NotifyStartedAndRun();
   return nullptr;
@@ -277,6 +277,8 @@ int OS::GetCurrentProcessId() {
 
 int OS::GetCurrentThreadId() { return SbThreadGetId(); }
 
+int OS::GetCurrentNumaNode() { return -1; }
+
 int OS::GetLastError() { return SbSystemGetLastError(); }
 
 // ----------------------------------------------------------------------------
@@ -382,6 +384,7 @@ class Thread::PlatformData {
 Thread::Thread(const Options& options)
     : data_(new PlatformData),
       stack_size_(options.stack_size()),
+      priority_(options.priority()),
       start_semaphore_(nullptr) {
   set_name(options.name());
 }
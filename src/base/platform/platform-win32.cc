@@ -534,6 +534,14 @@ int OS::GetCurrentThreadId() {
   return static_cast<int>(::GetCurrentThreadId());
 }
 
+int OS::GetCurrentNumaNode() {
+  PROCESSOR_NUMBER processor;
+  ::GetCurrentProcessorNumberEx(&processor);
+  USHORT node = 0;
+  if (!::GetNumaProcessorNodeEx(&processor, &node)) return -1;
+  return static_cast<int>(node);
+}
+
 void OS::ExitProcess(int exit_code) {
   // Use TerminateProcess to avoid races between isolate threads and
   // static destructors.
@@ -1636,7 +1644,9 @@ class Thread::PlatformData {
 // handle until it is started.
 
 Thread::Thread(const Options& options)
-    : stack_size_(options.stack_size()), start_semaphore_(nullptr) {
+    : stack_size_(options.stack_size()),
+      priority_(options.priority()),
+      start_semaphore_(nullptr) {
   data_ = new PlatformData(kNoThread);
   set_name(options.name());
 }
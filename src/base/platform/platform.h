@@ -296,6 +296,10 @@ class V8_BASE_EXPORT OS {
 
   static int GetCurrentThreadId();
 
+  // Returns the NUMA node the calling thread is currently running on, or -1
+  // if the node cannot be determined on this platform.
+  static int GetCurrentNumaNode();
+
   static void AdjustSchedulingParams();
 
   using Address = uintptr_t;
@@ -313,6 +317,14 @@ class V8_BASE_EXPORT OS {
 
   [[noreturn]] static void ExitProcess(int exit_code);
 
+#if V8_OS_LINUX
+  // Advises the kernel to back the given range with transparent huge pages
+  // once it is committed. Returns false if the advice was rejected, e.g.
+  // because the kernel does not support transparent huge pages.
+  V8_WARN_UNUSED_RESULT static bool AdviseHugePages(void* address,
+                                                    size_t size);
+#endif  // V8_OS_LINUX
+
   // Whether the platform supports mapping a given address in another location
   // in the address space.
   V8_WARN_UNUSED_RESULT static constexpr bool IsRemapPageSupported() {
@@ -519,18 +531,32 @@ class V8_BASE_EXPORT Thread {
   using LocalStorageKey = int32_t;
 #endif
 
+  // Scheduling hint for the OS. Only some platforms map it to an actual thread
+  // priority, everywhere else it is ignored.
+  enum class Priority {
+    kBestEffort,
+    kUserVisible,
+    kUserBlocking,
+    kDefault,
+  };
+
   class Options {
    public:
-    Options() : name_("v8:<unknown>"), stack_size_(0) {}
+    Options()
+        : name_("v8:<unknown>"), stack_size_(0), priority_(Priority::kDefault) {}
     explicit Options(const char* name, int stack_size = 0)
-        : name_(name), stack_size_(stack_size) {}
+        : name_(name), stack_size_(stack_size), priority_(Priority::kDefault) {}
+    Options(const char* name, Priority priority, int stack_size = 0)
+        : name_(name), stack_size_(stack_size), priority_(priority) {}
 
     const char* name() const { return name_; }
     int stack_size() const { return stack_size_; }
+    Priority priority() const { return priority_; }
 
    private:
     const char* name_;
     int stack_size_;
+    Priority priority_;
   };
 
   // Create new thread.
@@ -559,6 +585,8 @@ class V8_BASE_EXPORT Thread {
     return name_;
   }
 
+  Priority priority() const { return priority_; }
+
   // Abstract method for run handler.
   virtual void Run() = 0;
 
@@ -603,6 +631,7 @@ class V8_BASE_EXPORT Thread {
 
   char name_[kMaxThreadNameLength];
   int stack_size_;
+  Priority priority_;
   Semaphore* start_semaphore_;
 };
 
@@ -24,6 +24,12 @@ constexpr int kNewtonInversionThreshold = 50;
 constexpr int kToStringFastThreshold = 43;
 constexpr int kFromStringLargeThreshold = 300;
 
+// Inputs of up to this many bits share cached radix powers for fast to-string
+// conversion, see tostring.cc.
+constexpr int kToStringCacheMaxBitLength = 1 << 18;
+
+class RecursionLevel;
+
 class ProcessorImpl : public Processor {
  public:
   explicit ProcessorImpl(Platform* platform);
@@ -68,6 +74,16 @@ class ProcessorImpl : public Processor {
   void ToStringImpl(char* out, int* out_length, Digits X, int radix, bool sign,
                     bool use_fast_algorithm);
 
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+  // Returns the cached powers of {radix} for formatting a number with
+  // {target_bit_length} bits, computing any that are missing. Returns nullptr
+  // if the number is too large to be cached, or when interrupted.
+  RecursionLevel* GetToStringLevels(int radix, digit_t base_divisor,
+                                    int base_char_count,
+                                    int target_bit_length);
+  void ClearToStringLevels();
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
+
   void FromString(RWDigits Z, FromStringAccumulator* accumulator);
   void FromStringClassic(RWDigits Z, FromStringAccumulator* accumulator);
   void FromStringLarge(RWDigits Z, FromStringAccumulator* accumulator);
@@ -96,6 +112,10 @@ class ProcessorImpl : public Processor {
   uintptr_t work_estimate_{0};
   Status status_{Status::kOk};
   Platform* platform_;
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+  static constexpr int kMaxRadix = 36;
+  RecursionLevel* to_string_levels_[kMaxRadix + 1] = {};
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
 };
 
 // These constants are primarily needed for Barrett division in div-barrett.cc,
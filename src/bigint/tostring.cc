@@ -106,7 +106,7 @@ char* DivideByMagic(RWDigits rest, Digits input, char* output) {
   return output;
 }
 
-class RecursionLevel;
+}  // namespace
 
 // The classic algorithm must check for interrupt requests if no faster
 // algorithm is available.
@@ -316,19 +316,40 @@ void ToStringFormatter::BasePowerOfTwo() {
 
 // TODO(jkummerow): Investigate whether it is beneficial to build one or two
 // fewer RecursionLevels, and use the topmost level for more than one division.
+//
+// The levels only depend on the radix, and levels built for a larger input
+// also work for smaller ones (the chunks just fall through the upper levels).
+// So the ProcessorImpl keeps one list of levels per radix around, including
+// the top level's full inverse, and adds levels on top of it whenever a
+// larger input comes along, up to kToStringCacheMaxBitLength.
 
 class RecursionLevel {
  public:
   static RecursionLevel* CreateLevels(digit_t base_divisor, int base_char_count,
                                       int target_bit_length,
                                       ProcessorImpl* processor);
+  // Adds levels on top of {top}, which must have been created by
+  // {CreateLevels}, until they suffice for {target_bit_length}. Returns the
+  // new top level, or nullptr (having deleted all levels) when interrupted.
+  static RecursionLevel* AddLevels(RecursionLevel* top, int target_bit_length,
+                                   ProcessorImpl* processor);
   ~RecursionLevel() { delete next_; }
 
   void ComputeInverse(ProcessorImpl* proc, int dividend_length = 0);
   Digits GetInverse(int dividend_length);
 
+  // Whether the levels up to this one suffice for {target_bit_length}.
+  bool Covers(int target_bit_length) {
+    return (BitLength(divisor_) - leading_zero_shift_) * 2 - 1 >
+           target_bit_length;
+  }
+  bool has_inverse() { return inverse_.len() != 0; }
+
  private:
   friend class ToStringFormatter;
+  static RecursionLevel* GrowLevels(RecursionLevel* level,
+                                    int target_bit_length,
+                                    ProcessorImpl* processor);
   RecursionLevel(digit_t base_divisor, int base_char_count)
       : char_count_(base_char_count), divisor_(1) {
     divisor_[0] = base_divisor;
@@ -344,6 +365,10 @@ class RecursionLevel {
     leading_zero_shift_ = CountLeadingZeros(divisor_.msd());
     LeftShift(divisor_, divisor_, leading_zero_shift_);
   }
+  void UndoLeftShiftDivisor() {
+    RightShift(divisor_, divisor_, leading_zero_shift_);
+    leading_zero_shift_ = 0;
+  }
 
   int leading_zero_shift_{0};
   // The number of characters generated by *each half* of this level.
@@ -361,6 +386,23 @@ RecursionLevel* RecursionLevel::CreateLevels(digit_t base_divisor,
                                              int target_bit_length,
                                              ProcessorImpl* processor) {
   RecursionLevel* level = new RecursionLevel(base_divisor, base_char_count);
+  return GrowLevels(level, target_bit_length, processor);
+}
+
+// static
+RecursionLevel* RecursionLevel::AddLevels(RecursionLevel* top,
+                                          int target_bit_length,
+                                          ProcessorImpl* processor) {
+  DCHECK(!top->Covers(target_bit_length));
+  // The next level's divisor is the square of the unshifted one.
+  top->UndoLeftShiftDivisor();
+  return GrowLevels(top, target_bit_length, processor);
+}
+
+// static
+RecursionLevel* RecursionLevel::GrowLevels(RecursionLevel* level,
+                                           int target_bit_length,
+                                           ProcessorImpl* processor) {
   // We can stop creating levels when the next level's divisor, which is the
   // square of the current level's divisor, would be strictly bigger (in terms
   // of its numeric value) than the input we're formatting. Since computing that
@@ -418,11 +460,50 @@ Digits RecursionLevel::GetInverse(int dividend_length) {
   return inverse_ + (inverse_.len() - inverse_len);
 }
 
+RecursionLevel* ProcessorImpl::GetToStringLevels(int radix,
+                                                 digit_t base_divisor,
+                                                 int base_char_count,
+                                                 int target_bit_length) {
+  DCHECK(2 <= radix && radix <= kMaxRadix);
+  if (target_bit_length > kToStringCacheMaxBitLength) return nullptr;
+  RecursionLevel*& levels = to_string_levels_[radix];
+  if (levels != nullptr && levels->Covers(target_bit_length)) return levels;
+  if (levels == nullptr) {
+    levels = RecursionLevel::CreateLevels(base_divisor, base_char_count,
+                                          target_bit_length, this);
+  } else {
+    levels = RecursionLevel::AddLevels(levels, target_bit_length, this);
+  }
+  if (levels == nullptr) return nullptr;
+  levels->ComputeInverse(this);
+  if (should_terminate()) {
+    delete levels;
+    levels = nullptr;
+  }
+  return levels;
+}
+
+void ProcessorImpl::ClearToStringLevels() {
+  for (RecursionLevel*& levels : to_string_levels_) {
+    delete levels;
+    levels = nullptr;
+  }
+}
+
 void ToStringFormatter::Fast() {
-  std::unique_ptr<RecursionLevel> recursion_levels(RecursionLevel::CreateLevels(
-      chunk_divisor_, chunk_chars_, BitLength(digits_), processor_));
+  const int target_bit_length = BitLength(digits_);
+  RecursionLevel* recursion_levels = processor_->GetToStringLevels(
+      radix_, chunk_divisor_, chunk_chars_, target_bit_length);
   if (processor_->should_terminate()) return;
-  out_ = ProcessLevel(recursion_levels.get(), digits_, out_, true);
+  // Inputs that are too large for the cache get levels of their own.
+  std::unique_ptr<RecursionLevel> uncached_levels;
+  if (recursion_levels == nullptr) {
+    uncached_levels.reset(RecursionLevel::CreateLevels(
+        chunk_divisor_, chunk_chars_, target_bit_length, processor_));
+    if (processor_->should_terminate()) return;
+    recursion_levels = uncached_levels.get();
+  }
+  out_ = ProcessLevel(recursion_levels, digits_, out_, true);
 }
 
 // Writes '0' characters right-to-left, starting at {out}-1, until the distance
@@ -511,9 +592,9 @@ char* ToStringFormatter::ProcessLevel(RecursionLevel* level, Digits chunk,
     for (int i = 1; i < right.len(); i++) right[i] = 0;
   } else {
     ScratchDigits scratch(DivideBarrettScratchSpace(chunk.len()));
-    // The top level only computes its inverse when {chunk.len()} is
-    // available. Other levels have precomputed theirs.
-    if (level->is_toplevel_) {
+    // Unless it is cached, the top level only computes its inverse when
+    // {chunk.len()} is available. Other levels have precomputed theirs.
+    if (level->is_toplevel_ && !level->has_inverse()) {
       level->ComputeInverse(processor_, chunk.len());
       if (processor_->should_terminate()) return out;
     }
@@ -544,8 +625,6 @@ char* ToStringFormatter::ProcessLevel(RecursionLevel* level, Digits chunk,
 
 #endif  // V8_ADVANCED_BIGINT_ALGORITHMS
 
-}  // namespace
-
 void ProcessorImpl::ToString(char* out, int* out_length, Digits X, int radix,
                              bool sign) {
   const bool use_fast_algorithm = X.len() >= kToStringFastThreshold;
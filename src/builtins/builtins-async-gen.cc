@@ -29,6 +29,57 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
     TNode<SharedFunctionInfo> on_reject_sfi,
     TNode<Oddball> is_predicted_as_caught) {
   const TNode<NativeContext> native_context = LoadNativeContext(context);
+  const TNode<Uint32T> promiseHookFlags = PromiseHookFlags();
+
+  // Without promise hooks, debugger or async event delegate nothing observes
+  // the wrapper promise or the reject handler of an await on a value that is
+  // fulfilled already. This holds for primitives, which are never thenable,
+  // and for native promises in the fulfilled state that PromiseResolve would
+  // return as is. Their resume job is enqueued directly in that case.
+  TVARIABLE(Object, var_fulfilled_promise, UndefinedConstant());
+  TVARIABLE(Object, var_fulfilled_value, value);
+  TVARIABLE(Object, var_result);
+  Label if_fulfilled(this), if_not_fulfilled(this), done(this);
+  {
+    Label if_promise(this);
+    GotoIf(NeedsAnyPromiseHooks(promiseHookFlags), &if_not_fulfilled);
+    GotoIf(TaggedIsSmi(value), &if_fulfilled);
+    const TNode<Map> value_map = LoadMap(CAST(value));
+    GotoIf(IsJSPromiseMap(value_map), &if_promise);
+    Branch(IsJSReceiverMap(value_map), &if_not_fulfilled, &if_fulfilled);
+
+    BIND(&if_promise);
+    const TNode<Object> promise_prototype =
+        LoadContextElement(native_context, Context::PROMISE_PROTOTYPE_INDEX);
+    GotoIfNot(TaggedEqual(LoadMapPrototype(value_map), promise_prototype),
+              &if_not_fulfilled);
+    GotoIf(IsPromiseSpeciesProtectorCellInvalid(), &if_not_fulfilled);
+    const TNode<JSPromise> promise = CAST(value);
+    const TNode<Uint32T> status = DecodeWord32<JSPromise::StatusBits>(
+        SmiToInt32(LoadObjectField<Smi>(promise, JSPromise::kFlagsOffset)));
+    GotoIfNot(Word32Equal(status, Int32Constant(Promise::kFulfilled)),
+              &if_not_fulfilled);
+    var_fulfilled_promise = promise;
+    var_fulfilled_value =
+        LoadObjectField(promise, JSPromise::kReactionsOrResultOffset);
+    Goto(&if_fulfilled);
+  }
+
+  BIND(&if_fulfilled);
+  {
+    const TNode<Context> closure_context =
+        AllocateAwaitContext(native_context, generator);
+    TNode<HeapObject> on_resolve =
+        AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
+    InitializeNativeClosure(closure_context, native_context, on_resolve,
+                            on_resolve_sfi);
+    var_result = CallBuiltin(Builtin::kEnqueueAwaitFulfillReaction,
+                             native_context, var_fulfilled_promise.value(),
+                             var_fulfilled_value.value(), on_resolve);
+    Goto(&done);
+  }
+
+  BIND(&if_not_fulfilled);
 
   // We do the `PromiseResolve(%Promise%,value)` avoiding to unnecessarily
   // create wrapper promises. Now if {value} is already a promise with the
@@ -82,27 +133,8 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
     value = var_value.value();
   }
 
-  static const int kClosureContextSize =
-      FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
-  TNode<Context> closure_context =
-      UncheckedCast<Context>(AllocateInNewSpace(kClosureContextSize));
-  {
-    // Initialize the await context, storing the {generator} as extension.
-    TNode<Map> map = CAST(
-        LoadContextElement(native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
-    StoreMapNoWriteBarrier(closure_context, map);
-    StoreObjectFieldNoWriteBarrier(
-        closure_context, Context::kLengthOffset,
-        SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
-    const TNode<Object> empty_scope_info =
-        LoadContextElement(native_context, Context::SCOPE_INFO_INDEX);
-    StoreContextElementNoWriteBarrier(
-        closure_context, Context::SCOPE_INFO_INDEX, empty_scope_info);
-    StoreContextElementNoWriteBarrier(closure_context, Context::PREVIOUS_INDEX,
-                                      native_context);
-    StoreContextElementNoWriteBarrier(closure_context, Context::EXTENSION_INDEX,
-                                      generator);
-  }
+  const TNode<Context> closure_context =
+      AllocateAwaitContext(native_context, generator);
 
   // Allocate and initialize resolve handler
   TNode<HeapObject> on_resolve =
@@ -122,7 +154,6 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
   TVARIABLE(Object, var_throwaway, UndefinedConstant());
   Label if_instrumentation(this, Label::kDeferred),
       if_instrumentation_done(this);
-  TNode<Uint32T> promiseHookFlags = PromiseHookFlags();
   GotoIf(IsIsolatePromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(
              promiseHookFlags),
          &if_instrumentation);
@@ -145,8 +176,36 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
   }
   BIND(&if_instrumentation_done);
 
-  return CallBuiltin(Builtin::kPerformPromiseThen, native_context, value,
-                     on_resolve, on_reject, var_throwaway.value());
+  var_result = CallBuiltin(Builtin::kPerformPromiseThen, native_context, value,
+                           on_resolve, on_reject, var_throwaway.value());
+  Goto(&done);
+
+  BIND(&done);
+  return var_result.value();
+}
+
+TNode<Context> AsyncBuiltinsAssembler::AllocateAwaitContext(
+    TNode<NativeContext> native_context, TNode<JSGeneratorObject> generator) {
+  static const int kClosureContextSize =
+      FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
+  TNode<Context> closure_context =
+      UncheckedCast<Context>(AllocateInNewSpace(kClosureContextSize));
+  // Initialize the await context, storing the {generator} as extension.
+  TNode<Map> map = CAST(
+      LoadContextElement(native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
+  StoreMapNoWriteBarrier(closure_context, map);
+  StoreObjectFieldNoWriteBarrier(
+      closure_context, Context::kLengthOffset,
+      SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
+  const TNode<Object> empty_scope_info =
+      LoadContextElement(native_context, Context::SCOPE_INFO_INDEX);
+  StoreContextElementNoWriteBarrier(closure_context, Context::SCOPE_INFO_INDEX,
+                                    empty_scope_info);
+  StoreContextElementNoWriteBarrier(closure_context, Context::PREVIOUS_INDEX,
+                                    native_context);
+  StoreContextElementNoWriteBarrier(closure_context, Context::EXTENSION_INDEX,
+                                    generator);
+  return closure_context;
 }
 
 void AsyncBuiltinsAssembler::InitializeNativeClosure(
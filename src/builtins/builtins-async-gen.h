@@ -43,6 +43,8 @@ class AsyncBuiltinsAssembler : public PromiseBuiltinsAssembler {
                                         TNode<Oddball> done);
 
  private:
+  TNode<Context> AllocateAwaitContext(TNode<NativeContext> native_context,
+                                      TNode<JSGeneratorObject> generator);
   void InitializeNativeClosure(TNode<Context> context,
                                TNode<NativeContext> native_context,
                                TNode<HeapObject> function,
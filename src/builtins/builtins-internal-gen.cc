@@ -235,6 +235,10 @@ class WriteBarrierCodeStubAssembler : public CodeStubAssembler {
         Load(MachineType::Pointer(), slot_set,
              WordShl(bucket_index, kSystemPointerSizeLog2)));
     GotoIf(WordEqual(bucket, IntPtrConstant(0)), slow_path);
+    // Inline buckets are updated in the runtime.
+    GotoIf(WordNotEqual(WordAnd(bucket, IntPtrConstant(SlotSet::kInlineTag)),
+                        IntPtrConstant(0)),
+           slow_path);
     return bucket;
   }
 
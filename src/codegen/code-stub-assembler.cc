@@ -3906,6 +3906,65 @@ TNode<NameDictionary> CodeStubAssembler::CopyNameDictionary(
   return properties;
 }
 
+TNode<NameDictionary> CodeStubAssembler::GrowNameDictionary(
+    TNode<NameDictionary> dictionary, Label* bailout) {
+  Comment("Grow property dict");
+  TNode<IntPtrT> capacity = SmiUntag(GetCapacity<NameDictionary>(dictionary));
+  // Larger dictionaries may get pretenured, see HashTable::EnsureCapacity.
+  TNode<IntPtrT> max_young_capacity =
+      IntPtrConstant(NameDictionary::kMinCapacityForPretenure);
+  GotoIf(UintPtrGreaterThan(capacity, max_young_capacity), bailout);
+  TNode<IntPtrT> nof =
+      SmiUntag(GetNumberOfElements<NameDictionary>(dictionary));
+  TNode<IntPtrT> new_capacity =
+      HashTableComputeCapacity(IntPtrAdd(nof, IntPtrConstant(1)));
+  static_assert(NameDictionary::kMinCapacityForPretenure * 4 <=
+                NameDictionary::kMaxRegularCapacity);
+  TNode<NameDictionary> new_dictionary =
+      AllocateNameDictionaryWithCapacity(new_capacity);
+
+  // The new dictionary is in young space and nothing allocates below, so the
+  // stores can skip the write barrier.
+  for (int i = NameDictionary::kPrefixStartIndex;
+       i < NameDictionary::kElementsStartIndex; i++) {
+    StoreFixedArrayElement(new_dictionary, i,
+                           LoadFixedArrayElement(dictionary, i),
+                           SKIP_WRITE_BARRIER);
+  }
+
+  // Rehash the keys, skipping empty and deleted entries.
+  TNode<IntPtrT> start_index =
+      IntPtrConstant(NameDictionary::kElementsStartIndex);
+  TNode<IntPtrT> end_index = EntryToIndex<NameDictionary>(capacity);
+  BuildFastLoop<IntPtrT>(
+      start_index, end_index,
+      [&](TNode<IntPtrT> from_index) {
+        Label next(this);
+        TNode<Object> key = UnsafeLoadFixedArrayElement(dictionary, from_index);
+        GotoIf(TaggedEqual(key, UndefinedConstant()), &next);
+        GotoIf(TaggedEqual(key, TheHoleConstant()), &next);
+        TVARIABLE(IntPtrT, var_to_index);
+        Label insert(this);
+        NameDictionaryLookup<NameDictionary>(new_dictionary, CAST(key), nullptr,
+                                             &var_to_index, &insert,
+                                             kFindInsertionIndex);
+        BIND(&insert);
+        for (int j = 0; j < NameDictionary::kEntrySize; j++) {
+          TNode<IntPtrT> offset = IntPtrConstant(j);
+          StoreFixedArrayElement(
+              new_dictionary, IntPtrAdd(var_to_index.value(), offset),
+              LoadFixedArrayElement(dictionary, IntPtrAdd(from_index, offset)),
+              SKIP_WRITE_BARRIER);
+        }
+        Goto(&next);
+        BIND(&next);
+      },
+      NameDictionary::kEntrySize, LoopUnrollingMode::kNo,
+      IndexAdvanceMode::kPost);
+  SetNumberOfElements<NameDictionary>(new_dictionary, SmiTag(nof));
+  return new_dictionary;
+}
+
 template <typename CollectionType>
 TNode<CollectionType> CodeStubAssembler::AllocateOrderedHashTable(
     TNode<IntPtrT> capacity) {
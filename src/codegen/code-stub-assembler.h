@@ -1942,6 +1942,11 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
       TNode<IntPtrT> capacity, AllocationFlags = AllocationFlag::kNone);
   TNode<NameDictionary> CopyNameDictionary(TNode<NameDictionary> dictionary,
                                            Label* large_object_fallback);
+  // Allocates a rehashed copy of {dictionary} with room for one more entry,
+  // like HashTable::EnsureCapacity. Jumps to {bailout} for dictionaries that
+  // the runtime would allocate in old space.
+  TNode<NameDictionary> GrowNameDictionary(TNode<NameDictionary> dictionary,
+                                           Label* bailout);
 
   TNode<OrderedHashSet> AllocateOrderedHashSet();
 
@@ -47,6 +47,7 @@
 #include "src/interpreter/interpreter.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/log-inl.h"
+#include "src/logging/metrics.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/feedback-cell-inl.h"
 #include "src/objects/js-function-inl.h"
@@ -309,6 +310,13 @@ class CompilerTracer : public AllStatic {
 
 }  // namespace
 
+// static
+bool Compiler::IsLoggingFunctionCompilation(Isolate* isolate) {
+  return isolate->v8_file_logger()->is_listening_to_code_events() ||
+         isolate->is_profiling() || v8_flags.log_function_events ||
+         isolate->logger()->is_listening_to_code_events();
+}
+
 // static
 void Compiler::LogFunctionCompilation(Isolate* isolate,
                                       LogEventListener::CodeTag code_type,
@@ -323,11 +331,7 @@ void Compiler::LogFunctionCompilation(Isolate* isolate,
   // Log the code generation. If source information is available include
   // script name and line number. Check explicitly whether logging is
   // enabled as finding the line number is not free.
-  if (!isolate->v8_file_logger()->is_listening_to_code_events() &&
-      !isolate->is_profiling() && !v8_flags.log_function_events &&
-      !isolate->logger()->is_listening_to_code_events()) {
-    return;
-  }
+  if (!IsLoggingFunctionCompilation(isolate)) return;
 
   int line_num = Script::GetLineNumber(script, shared->StartPosition()) + 1;
   int column_num = Script::GetColumnNumber(script, shared->StartPosition()) + 1;
@@ -589,6 +593,27 @@ void TurbofanCompilationJob::RecordCompilationStats(ConcurrencyMode mode,
     counters->turbofan_ticks()->AddSample(static_cast<int>(
         compilation_info()->tick_counter().CurrentTicks() / 1000));
   }
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      isolate->metrics_recorder();
+  if (V8_UNLIKELY(recorder->ShouldSampleJitEvent(
+          isolate->random_number_generator()))) {
+    v8::metrics::OptimizedCompilation event;
+    event.tier = CodeKindToString(compilation_info()->code_kind());
+    event.concurrent = mode == ConcurrencyMode::kConcurrent;
+    event.osr = compilation_info()->is_osr();
+    SharedFunctionInfo shared = function->shared();
+    if (shared.script().IsScript()) {
+      event.script_id = Script::cast(shared.script()).id();
+    }
+    event.function_start_position = shared.StartPosition();
+    event.prepare_duration_in_us = time_taken_to_prepare_.InMicroseconds();
+    event.execute_duration_in_us = time_taken_to_execute_.InMicroseconds();
+    event.finalize_duration_in_us = time_taken_to_finalize_.InMicroseconds();
+    event.wall_clock_duration_in_us = ElapsedTime().InMicroseconds();
+    Handle<NativeContext> native_context(function->native_context(), isolate);
+    recorder->DelayMainThreadEvent(
+        event, isolate->GetOrRegisterRecorderContextId(native_context));
+  }
 }
 
 void TurbofanCompilationJob::RecordFunctionCompilation(
@@ -1063,7 +1088,8 @@ bool CompileTurbofan_Concurrent(Isolate* isolate,
   DCHECK_EQ(compilation_info->code_kind(), CodeKind::TURBOFAN);
   Handle<JSFunction> function = compilation_info->closure();
 
-  if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable()) {
+  if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailableFor(
+          *function)) {
     if (v8_flags.trace_concurrent_recompilation) {
       PrintF("  ** Compilation queue full, will retry optimizing ");
       function->ShortPrint();
@@ -1389,6 +1415,15 @@ void FinalizeUnoptimizedCompilation(
                                (!flags.collect_source_positions() &&
                                 isolate->NeedsSourcePositionsForProfiling());
 
+  // In the common case, nothing below applies, so don't visit every function
+  // of the script on the main thread. Coverage info is only allocated with
+  // block coverage enabled.
+  if (!need_source_positions && !v8_flags.interpreted_frames_native_stack &&
+      !flags.block_coverage_enabled() &&
+      !Compiler::IsLoggingFunctionCompilation(isolate)) {
+    return;
+  }
+
   for (const auto& finalize_data : finalize_unoptimized_compilation_data_list) {
     Handle<SharedFunctionInfo> shared_info = finalize_data.function_handle();
     // It's unlikely, but possible, that the bytecode was flushed between being
@@ -231,6 +231,9 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
                                                           Handle<Script> script,
                                                           IsolateT* isolate);
 
+  // Whether LogFunctionCompilation would log anything.
+  static bool IsLoggingFunctionCompilation(Isolate* isolate);
+
   static void LogFunctionCompilation(Isolate* isolate,
                                      LogEventListener::CodeTag code_type,
                                      Handle<Script> script,
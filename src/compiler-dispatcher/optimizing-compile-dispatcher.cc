@@ -15,7 +15,7 @@
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
-#include "src/objects/js-function.h"
+#include "src/objects/js-function-inl.h"
 #include "src/tasks/cancelable-task.h"
 #include "src/tracing/trace-event.h"
 
@@ -89,13 +89,93 @@ TurbofanCompilationJob* OptimizingCompileDispatcher::NextInput(
     LocalIsolate* local_isolate) {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
   if (input_queue_length_ == 0) return nullptr;
-  TurbofanCompilationJob* job = input_queue_[InputQueueIndex(0)];
+  int index = 0;
+  if (use_priority_queue_) {
+    for (int i = 1; i < input_queue_length_; i++) {
+      if (input_queue_[InputQueueIndex(i)].priority >
+          input_queue_[InputQueueIndex(index)].priority) {
+        index = i;
+      }
+    }
+  }
+  return RemoveInputAt(index);
+}
+
+TurbofanCompilationJob* OptimizingCompileDispatcher::RemoveInputAt(int i) {
+  DCHECK_LE(0, i);
+  DCHECK_LT(i, input_queue_length_);
+  TurbofanCompilationJob* job = input_queue_[InputQueueIndex(i)].job;
   DCHECK_NOT_NULL(job);
-  input_queue_shift_ = InputQueueIndex(1);
+  if (i == 0) {
+    input_queue_shift_ = InputQueueIndex(1);
+  } else {
+    for (int j = i + 1; j < input_queue_length_; j++) {
+      input_queue_[InputQueueIndex(j - 1)] = input_queue_[InputQueueIndex(j)];
+    }
+  }
   input_queue_length_--;
   return job;
 }
 
+int OptimizingCompileDispatcher::ColdestInputIndex() {
+  DCHECK_LT(0, input_queue_length_);
+  int index = 0;
+  for (int i = 1; i < input_queue_length_; i++) {
+    // Prefer evicting the most recently queued job among equally hot ones.
+    if (input_queue_[InputQueueIndex(i)].priority <=
+        input_queue_[InputQueueIndex(index)].priority) {
+      index = i;
+    }
+  }
+  return index;
+}
+
+// static
+uint64_t OptimizingCompileDispatcher::ComputePriority(JSFunction function) {
+  if (!function.has_feedback_vector()) return 0;
+  FeedbackVector vector = function.feedback_vector();
+  // Order by the profiler ticks the TieringManager based its decision on and
+  // break ties with the invocation count.
+  return (static_cast<uint64_t>(vector.profiler_ticks()) << 32) |
+         static_cast<uint32_t>(vector.invocation_count());
+}
+
+void OptimizingCompileDispatcher::EvictStaleInputs() {
+  DCHECK_EQ(ThreadId::Current(), isolate_->thread_id());
+  base::MutexGuard access_input_queue(&input_queue_mutex_);
+  for (int i = 0; i < input_queue_length_;) {
+    OptimizedCompilationInfo* info =
+        input_queue_[InputQueueIndex(i)].job->compilation_info();
+    // These are the jobs that InstallOptimizedFunctions() would throw out or
+    // that cannot produce code anymore.
+    bool is_stale = info->shared_info()->optimization_disabled() ||
+                    (!info->is_osr() &&
+                     info->closure()->HasAvailableCodeKind(info->code_kind()));
+    if (!is_stale) {
+      i++;
+      continue;
+    }
+    std::unique_ptr<TurbofanCompilationJob> job(RemoveInputAt(i));
+    isolate_->counters()->turbofan_queue_evictions()->Increment();
+    if (v8_flags.trace_concurrent_recompilation) {
+      PrintF("  ** Evicting stale job for ");
+      info->closure()->ShortPrint();
+      PrintF(" from the compilation queue.\n");
+    }
+    Compiler::DisposeTurbofanCompilationJob(job.get(), false);
+  }
+}
+
+bool OptimizingCompileDispatcher::IsQueueAvailableFor(JSFunction function) {
+  if (!use_priority_queue_) return IsQueueAvailable();
+  if (IsQueueAvailable()) return true;
+  EvictStaleInputs();
+  base::MutexGuard access_input_queue(&input_queue_mutex_);
+  if (input_queue_length_ < input_queue_capacity_) return true;
+  return input_queue_[InputQueueIndex(ColdestInputIndex())].priority <
+         ComputePriority(function);
+}
+
 void OptimizingCompileDispatcher::CompileNext(TurbofanCompilationJob* job,
                                               LocalIsolate* local_isolate) {
   if (!job) return;
@@ -133,11 +213,7 @@ void OptimizingCompileDispatcher::FlushOutputQueue(bool restore_function_code) {
 void OptimizingCompileDispatcher::FlushInputQueue() {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
   while (input_queue_length_ > 0) {
-    std::unique_ptr<TurbofanCompilationJob> job(
-        input_queue_[InputQueueIndex(0)]);
-    DCHECK_NOT_NULL(job);
-    input_queue_shift_ = InputQueueIndex(1);
-    input_queue_length_--;
+    std::unique_ptr<TurbofanCompilationJob> job(RemoveInputAt(0));
     Compiler::DisposeTurbofanCompilationJob(job.get(), true);
   }
 }
@@ -223,13 +299,31 @@ bool OptimizingCompileDispatcher::HasJobs() {
 
 void OptimizingCompileDispatcher::QueueForOptimization(
     TurbofanCompilationJob* job) {
-  DCHECK(IsQueueAvailable());
+  const uint64_t priority =
+      use_priority_queue_ ? ComputePriority(*job->compilation_info()->closure())
+                          : 0;
   {
-    // Add job to the back of the input queue.
     base::MutexGuard access_input_queue(&input_queue_mutex_);
+    if (use_priority_queue_ && input_queue_length_ == input_queue_capacity_) {
+      // Make room by evicting the coldest job. Its compile task will find
+      // either another job or an empty queue.
+      int coldest = ColdestInputIndex();
+      DCHECK_LT(input_queue_[InputQueueIndex(coldest)].priority, priority);
+      std::unique_ptr<TurbofanCompilationJob> evicted(RemoveInputAt(coldest));
+      isolate_->counters()->turbofan_queue_evictions()->Increment();
+      if (v8_flags.trace_concurrent_recompilation) {
+        PrintF("  ** Evicting ");
+        evicted->compilation_info()->closure()->ShortPrint();
+        PrintF(" from the compilation queue for a hotter function.\n");
+      }
+      Compiler::DisposeTurbofanCompilationJob(evicted.get(), false);
+    }
+    // Add job to the back of the input queue.
     DCHECK_LT(input_queue_length_, input_queue_capacity_);
-    input_queue_[InputQueueIndex(input_queue_length_)] = job;
+    input_queue_[InputQueueIndex(input_queue_length_)] = {job, priority};
     input_queue_length_++;
+    isolate_->counters()->turbofan_queue_length()->AddSample(
+        input_queue_length_);
   }
   V8::GetCurrentPlatform()->CallOnWorkerThread(
       std::make_unique<CompileTask>(isolate_, this));
@@ -18,6 +18,7 @@
 namespace v8 {
 namespace internal {
 
+class JSFunction;
 class LocalHeap;
 class TurbofanCompilationJob;
 class RuntimeCallStats;
@@ -31,8 +32,10 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
         input_queue_length_(0),
         input_queue_shift_(0),
         ref_count_(0),
-        recompilation_delay_(v8_flags.concurrent_recompilation_delay) {
-    input_queue_ = NewArray<TurbofanCompilationJob*>(input_queue_capacity_);
+        recompilation_delay_(v8_flags.concurrent_recompilation_delay),
+        use_priority_queue_(
+            v8_flags.concurrent_recompilation_priority_queue) {
+    input_queue_ = NewArray<QueuedJob>(input_queue_capacity_);
   }
 
   ~OptimizingCompileDispatcher();
@@ -49,6 +52,12 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
     return input_queue_length_ < input_queue_capacity_;
   }
 
+  // Like IsQueueAvailable() but with --concurrent-recompilation-priority-queue
+  // also returns true if a queued job that is colder than |function| or stale
+  // can be evicted to make room. This method must be called on the main
+  // thread.
+  bool IsQueueAvailableFor(JSFunction function);
+
   static bool Enabled() { return v8_flags.concurrent_recompilation; }
 
   // This method must be called on the main thread.
@@ -68,6 +77,15 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   enum ModeFlag { COMPILE, FLUSH };
 
+  struct QueuedJob {
+    TurbofanCompilationJob* job;
+    // Hotness of the function at the time it was queued. Only used with
+    // --concurrent-recompilation-priority-queue.
+    uint64_t priority;
+  };
+
+  static uint64_t ComputePriority(JSFunction function);
+
   void FlushQueues(BlockingBehavior blocking_behavior,
                    bool restore_function_code);
   void FlushInputQueue();
@@ -75,6 +93,15 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   void CompileNext(TurbofanCompilationJob* job, LocalIsolate* local_isolate);
   TurbofanCompilationJob* NextInput(LocalIsolate* local_isolate);
 
+  // Removes the job at logical position |i| from the input queue. The input
+  // queue mutex must be held.
+  TurbofanCompilationJob* RemoveInputAt(int i);
+  // Returns the logical position of the queued job with the lowest priority.
+  // The input queue mutex must be held.
+  int ColdestInputIndex();
+  // Disposes queued jobs whose result would be thrown away on installation.
+  void EvictStaleInputs();
+
   inline int InputQueueIndex(int i) {
     int result = (i + input_queue_shift_) % input_queue_capacity_;
     DCHECK_LE(0, result);
@@ -85,7 +112,7 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   Isolate* isolate_;
 
   // Circular queue of incoming recompilation tasks (including OSR).
-  TurbofanCompilationJob** input_queue_;
+  QueuedJob* input_queue_;
   int input_queue_capacity_;
   int input_queue_length_;
   int input_queue_shift_;
@@ -108,6 +135,10 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   // is not safe to access them directly.
   int recompilation_delay_;
 
+  // Copy of v8_flags.concurrent_recompilation_priority_queue for the same
+  // reason.
+  const bool use_priority_queue_;
+
   bool finalize_ = true;
 };
 }  // namespace internal
@@ -220,6 +220,8 @@ class EffectControlLinearizer {
   void LowerTransitionElementsKind(Node* node);
   Node* LowerLoadFieldByIndex(Node* node);
   Node* LowerLoadMessage(Node* node);
+  Node* AdaptFastCallDoubleArrayArgument(Node* node,
+                                         GraphAssemblerLabel<0>* bailout);
   Node* AdaptFastCallTypedArrayArgument(Node* node,
                                         ElementsKind expected_elements_kind,
                                         GraphAssemblerLabel<0>* bailout);
@@ -6306,6 +6308,47 @@ void EffectControlLinearizer::LowerStoreMessage(Node* node) {
   __ StoreField(AccessBuilder::ForExternalIntPtr(), offset, object_pattern);
 }
 
+Node* EffectControlLinearizer::AdaptFastCallDoubleArrayArgument(
+    Node* node, GraphAssemblerLabel<0>* bailout) {
+  Node* value_map = __ LoadField(AccessBuilder::ForMap(), node);
+  Node* value_instance_type =
+      __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
+  Node* value_is_js_array =
+      __ Word32Equal(value_instance_type, __ Int32Constant(JS_ARRAY_TYPE));
+  __ GotoIfNot(value_is_js_array, bailout);
+
+  // Holey arrays would expose the hole NaN, so only packed double arrays are
+  // passed in place.
+  Node* bit_field2 = __ LoadField(AccessBuilder::ForMapBitField2(), value_map);
+  Node* kind = __ Word32Shr(
+      __ Word32And(bit_field2,
+                   __ Int32Constant(Map::Bits2::ElementsKindBits::kMask)),
+      __ Int32Constant(Map::Bits2::ElementsKindBits::kShift));
+  __ GotoIfNot(__ Word32Equal(kind, __ Int32Constant(PACKED_DOUBLE_ELEMENTS)),
+               bailout);
+
+  // The fast call cannot trigger a GC, so the elements stay in place until it
+  // returns.
+  Node* elements = __ LoadField(AccessBuilder::ForJSObjectElements(), node);
+  Node* data_ptr =
+      __ IntPtrAdd(__ BitcastTaggedToWord(elements),
+                   __ IntPtrConstant(FixedDoubleArray::kHeaderSize -
+                                     kHeapObjectTag));
+  Node* length = ChangeSmiToIntPtr(__ LoadField(
+      AccessBuilder::ForJSArrayLength(PACKED_DOUBLE_ELEMENTS), node));
+
+  // Same layout as FastApiTypedArray, see AdaptFastCallTypedArrayArgument.
+  Node* stack_slot = __ StackSlot(sizeof(FastApiTypedArray<double>),
+                                  alignof(FastApiTypedArray<double>));
+  __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                               kNoWriteBarrier),
+           stack_slot, 0, length);
+  __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                               kNoWriteBarrier),
+           stack_slot, sizeof(size_t), data_ptr);
+  return stack_slot;
+}
+
 Node* EffectControlLinearizer::AdaptFastCallTypedArrayArgument(
     Node* node, ElementsKind expected_elements_kind,
     GraphAssemblerLabel<0>* bailout) {
@@ -6647,6 +6690,21 @@ Node* EffectControlLinearizer::AdaptFastCallArgument(
       Node* value_is_smi = ObjectIsSmi(node);
       __ GotoIf(value_is_smi, if_error);
 
+      if (uint8_t(arg_type.GetFlags()) &
+          uint8_t(CTypeInfo::Flags::kAllowJSArrayBit)) {
+        DCHECK_EQ(arg_type.GetType(), CTypeInfo::Type::kFloat64);
+        auto done = __ MakeLabel(MachineType::PointerRepresentation());
+        auto if_not_double_array = __ MakeLabel();
+        __ Goto(&done, AdaptFastCallDoubleArrayArgument(node,
+                                                        &if_not_double_array));
+        __ Bind(&if_not_double_array);
+        __ Goto(&done,
+                AdaptFastCallTypedArrayArgument(node, FLOAT64_ELEMENTS,
+                                                if_error));
+        __ Bind(&done);
+        return done.PhiAt(0);
+      }
+
       return AdaptFastCallTypedArrayArgument(
           node, fast_api_call::GetTypedArrayElementsKind(arg_type.GetType()),
           if_error);
@@ -109,6 +109,17 @@ Reduction EscapeAnalysisReducer::Reduce(Node* node) {
     case IrOpcode::kNewArgumentsElements:
       arguments_elements_.insert(node);
       return NoChange();
+    case IrOpcode::kJSStackCheck: {
+      Node* context = NodeProperties::GetContextInput(node);
+      Node* outer = analysis_result().GetOutermostMaterializedContext(
+          context, NodeProperties::GetEffectInput(node));
+      ReduceFrameStateInputs(node);
+      if (outer != context) {
+        NodeProperties::ReplaceContextInput(node, outer);
+        return Changed(node);
+      }
+      return NoChange();
+    }
     default: {
       // TODO(sigurds): Change this to GetFrameStateInputCount once
       // it is working. For now we use EffectInputCount > 0 to determine
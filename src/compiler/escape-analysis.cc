@@ -592,6 +592,41 @@ Node* LowerCompareMapsWithoutLoad(Node* checked_map,
   return replacement;
 }
 
+// Returns true if {map} is known to be the map of a Context.
+bool IsContextMap(Node* map) {
+  Type const map_type = NodeProperties::GetType(map);
+  if (!map_type.IsHeapConstant()) return false;
+  HeapObjectRef ref = map_type.AsHeapConstant()->Ref();
+  return ref.IsMap() &&
+         InstanceTypeChecker::IsContext(ref.AsMap().instance_type());
+}
+
+// Walks up the chain of non-escaping virtual contexts starting at {context}
+// and returns the first context that will be materialized, or nullptr if the
+// analysis has not reached the fixed-point for the chain yet.
+Node* OutermostMaterializedContext(Node* context,
+                                   EscapeAnalysisTracker::Scope* current) {
+  while (const VirtualObject* vobject = current->GetVirtualObject(context)) {
+    if (vobject->HasEscaped()) break;
+    Variable map_field, previous_field;
+    Node* map;
+    Node* previous;
+    if (!vobject->FieldAt(HeapObject::kMapOffset).To(&map_field) ||
+        !current->Get(map_field).To(&map) ||
+        !vobject->FieldAt(Context::OffsetOfElementAt(Context::PREVIOUS_INDEX))
+             .To(&previous_field) ||
+        !current->Get(previous_field).To(&previous)) {
+      break;
+    }
+    // If the variables have no values, we have not reached the fixed-point
+    // yet.
+    if (map == nullptr || previous == nullptr) return nullptr;
+    if (!IsContextMap(map)) break;
+    context = previous;
+  }
+  return context;
+}
+
 void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
                 JSGraph* jsgraph) {
   switch (op->opcode()) {
@@ -866,6 +901,19 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
       }
       break;
     }
+    case IrOpcode::kJSStackCheck: {
+      // The stack check only passes its context on to the runtime, which
+      // cannot tell it apart from any other context of the same native
+      // context. The reducer therefore rewires it to the closest context that
+      // is materialized anyway, so that function contexts of inlined
+      // callbacks don't escape through the inlinee's stack checks. The frame
+      // state still refers to the original context for deoptimization.
+      if (Node* outer =
+              OutermostMaterializedContext(current->ContextInput(), current)) {
+        current->SetEscaped(outer);
+      }
+      break;
+    }
     default: {
       // For unknown nodes, treat all value inputs as escaping.
       int value_input_count = op->ValueInputCount();
@@ -919,6 +967,26 @@ const VirtualObject* EscapeAnalysisResult::GetVirtualObject(Node* node) {
   return tracker_->virtual_objects_.Get(node);
 }
 
+Node* EscapeAnalysisResult::GetOutermostMaterializedContext(Node* context,
+                                                            Node* effect) {
+  while (const VirtualObject* vobject = GetVirtualObject(context)) {
+    if (vobject->HasEscaped() ||
+        vobject->FieldAt(HeapObject::kMapOffset).IsNothing() ||
+        vobject->FieldAt(Context::OffsetOfElementAt(Context::PREVIOUS_INDEX))
+            .IsNothing()) {
+      break;
+    }
+    Node* map = GetVirtualObjectField(vobject, HeapObject::kMapOffset, effect);
+    if (map == nullptr || !IsContextMap(map)) break;
+    Node* previous = GetVirtualObjectField(
+        vobject, Context::OffsetOfElementAt(Context::PREVIOUS_INDEX), effect);
+    if (previous == nullptr || previous->opcode() == IrOpcode::kDead) break;
+    if (Node* replacement = GetReplacementOf(previous)) previous = replacement;
+    context = previous;
+  }
+  return context;
+}
+
 VirtualObject::VirtualObject(VariableTracker* var_states, VirtualObject::Id id,
                              int size)
     : Dependable(var_states->zone()), id_(id), fields_(var_states->zone()) {
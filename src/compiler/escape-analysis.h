@@ -167,6 +167,9 @@ class EscapeAnalysisResult {
   const VirtualObject* GetVirtualObject(Node* node);
   Node* GetVirtualObjectField(const VirtualObject* vobject, int field,
                               Node* effect);
+  // Returns the first context in the chain of {context} that is not scalar
+  // replaced.
+  Node* GetOutermostMaterializedContext(Node* context, Node* effect);
   Node* GetReplacementOf(Node* node);
 
  private:
@@ -406,6 +406,11 @@ class V8_EXPORT_PRIVATE GraphAssembler {
   Node* Store(StoreRepresentation rep, Node* object, int offset, Node* value);
   Node* Load(MachineType type, Node* object, Node* offset);
   Node* Load(MachineType type, Node* object, int offset);
+  // Loads from memory that does not change during the lifetime of the
+  // generated code; the load is pure and therefore subject to value numbering
+  // and loop-invariant hoisting.
+  Node* LoadImmutable(LoadRepresentation rep, Node* object, Node* offset);
+  Node* LoadImmutable(LoadRepresentation rep, Node* object, int offset);
 
   Node* StoreUnaligned(MachineRepresentation rep, Node* object, Node* offset,
                        Node* value);
@@ -21,6 +21,7 @@
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/literal-objects-inl.h"
 #include "src/objects/property-cell.h"
+#include "src/objects/script-inl.h"
 #include "src/objects/template-objects-inl.h"
 
 namespace v8 {
@@ -1599,6 +1600,13 @@ BytecodeArrayRef SharedFunctionInfoRef::GetBytecodeArray(
   return MakeRefAssumeMemoryFence(broker, bytecode_array);
 }
 
+int SharedFunctionInfoRef::script_id() const {
+  // The script is read with acquire semantics and its id never changes.
+  HeapObject script = object()->script();
+  if (!script.IsScript()) return v8::UnboundScript::kNoScriptId;
+  return Script::cast(script).id();
+}
+
 #define DEF_SFI_ACCESSOR(type, name) \
   HEAP_ACCESSOR_C(SharedFunctionInfo, type, name)
 BROKER_SFI_FIELDS(DEF_SFI_ACCESSOR)
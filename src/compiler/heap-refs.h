@@ -1000,6 +1000,10 @@ class V8_EXPORT_PRIVATE SharedFunctionInfoRef : public HeapObjectRef {
       JSHeapBroker* broker) const;
   ScopeInfoRef scope_info(JSHeapBroker* broker) const;
 
+  // The id of the Script this function belongs to, or
+  // v8::UnboundScript::kNoScriptId if it has none.
+  int script_id() const;
+
 #define DECL_ACCESSOR(type, name) type name() const;
   BROKER_SFI_FIELDS(DECL_ACCESSOR)
 #undef DECL_ACCESSOR
@@ -7,6 +7,7 @@
 #include "src/compiler/common-operator.h"
 #include "src/compiler/compiler-source-position-table.h"
 #include "src/compiler/js-heap-broker.h"
+#include "src/compiler/js-inlining-profile.h"
 #include "src/compiler/node-matchers.h"
 #include "src/compiler/simplified-operator.h"
 
@@ -247,6 +248,30 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
     candidate.frequency = p.frequency();
   }
 
+  // Call site frequencies from earlier runs take precedence over the feedback
+  // of this run, which may only reflect the warmup phase.
+  if (v8_flags.turbo_inlining_profile_log ||
+      v8_flags.turbo_inlining_profile_input != nullptr) {
+    Handle<SharedFunctionInfo> caller;
+    if (frame_info.shared_info().ToHandle(&caller)) {
+      std::string key =
+          JSInliningProfile::CallSiteKey(broker(), MakeRef(broker(), caller),
+                                         frame_info.bailout_id().ToInt());
+      if (v8_flags.turbo_inlining_profile_log &&
+          candidate.frequency.IsKnown()) {
+        JSInliningProfile::Log(key, candidate.frequency.value());
+      }
+      if (const JSInliningProfile* profile = JSInliningProfile::Get()) {
+        if (base::Optional<float> frequency = profile->Lookup(key)) {
+          TRACE("Using profiled frequency " << *frequency << " for call site #"
+                                            << node->id() << ":"
+                                            << node->op()->mnemonic());
+          candidate.frequency = CallFrequency(*frequency);
+        }
+      }
+    }
+  }
+
   // Don't consider a {candidate} whose frequency is below the
   // threshold, i.e. a call site that is only hit once every N
   // invocations of the caller.
@@ -0,0 +1,167 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/js-inlining-profile.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <utility>
+
+#include "include/v8-script.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
+#include "src/compiler/js-heap-broker.h"
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/objects/string-inl.h"
+#include "src/utils/ostreams.h"
+#include "src/utils/utils.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// static
+const JSInliningProfile* JSInliningProfile::Get() {
+  if (v8_flags.turbo_inlining_profile_input == nullptr) return nullptr;
+  // Function-local statics are initialized thread-safely, which matters since
+  // this is first called from concurrent compile jobs.
+  static base::LeakyObject<JSInliningProfile> profile(
+      v8_flags.turbo_inlining_profile_input.value());
+  return profile.get();
+}
+
+namespace {
+
+// Source hashes keyed by isolate id and script id. Isolate ids are never
+// reused, so entries of disposed isolates cannot be hit by mistake.
+struct ScriptSourceHashes {
+  base::Mutex mutex;
+  std::map<std::pair<int, int>, uint64_t> hashes;
+};
+
+base::LazyInstance<ScriptSourceHashes>::type script_source_hashes =
+    LAZY_INSTANCE_INITIALIZER;
+
+// 64-bit FNV-1a, which does not depend on the hash seed of the isolate.
+uint64_t HashSource(const base::uc16* chars, int length) {
+  uint64_t hash = 0xcbf29ce484222325;
+  for (int i = 0; i < length; i++) {
+    hash = (hash ^ chars[i]) * 0x100000001b3;
+  }
+  return hash;
+}
+
+}  // namespace
+
+// static
+uint64_t JSInliningProfile::ScriptSourceHash(JSHeapBroker* broker,
+                                             SharedFunctionInfoRef shared) {
+  int script_id = shared.script_id();
+  if (script_id == v8::UnboundScript::kNoScriptId) return 0;
+  const std::pair<int, int> cache_key(broker->isolate()->id(), script_id);
+  ScriptSourceHashes* cache = script_source_hashes.Pointer();
+  {
+    base::MutexGuard guard(&cache->mutex);
+    auto it = cache->hashes.find(cache_key);
+    if (it != cache->hashes.end()) return it->second;
+  }
+
+  // The script is read with acquire semantics and its source never changes.
+  // The source string may still be in-place internalized or externalized by
+  // the main thread, which the access guard protects against.
+  Script script = Script::cast(shared.object()->script());
+  Object source = script.source();
+  uint64_t hash = 0;
+  if (source.IsString()) {
+    String string = String::cast(source);
+    int length = string.length();
+    std::unique_ptr<base::uc16[]> chars(new base::uc16[length]);
+    {
+      SharedStringAccessGuardIfNeeded access_guard(string);
+      String::WriteToFlat(string, chars.get(), 0, length,
+                          GetPtrComprCageBase(string), access_guard);
+    }
+    hash = HashSource(chars.get(), length);
+  }
+
+  base::MutexGuard guard(&cache->mutex);
+  cache->hashes.emplace(cache_key, hash);
+  return hash;
+}
+
+// static
+std::string JSInliningProfile::CallSiteKey(JSHeapBroker* broker,
+                                           SharedFunctionInfoRef caller,
+                                           int bytecode_offset) {
+  std::ostringstream key;
+  key << std::hex << ScriptSourceHash(broker, caller) << std::dec << ','
+      << caller.StartPosition() << ',' << bytecode_offset;
+  return key.str();
+}
+
+// static
+void JSInliningProfile::Log(const std::string& key, float frequency) {
+  StdoutStream os;
+  os << kMarker << ',' << key << ',' << frequency << std::endl;
+}
+
+JSInliningProfile::JSInliningProfile(const char* filename) {
+  std::ifstream file(filename);
+  CHECK_WITH_MSG(file.good(), "Can't read inlining profile");
+  Read(file);
+}
+
+JSInliningProfile::JSInliningProfile(std::istream& input) { Read(input); }
+
+void JSInliningProfile::Read(std::istream& input) {
+  const std::string prefix = std::string(kMarker) + ',';
+  for (std::string line; std::getline(input, line);) {
+    if (!line.empty() && line.back() == '\r') line.pop_back();
+    // Anything but profile lines, e.g. other output of the logged runs, is
+    // ignored.
+    if (line.compare(0, prefix.size(), prefix) != 0) continue;
+    size_t last = line.rfind(',');
+    if (last == std::string::npos || last <= prefix.size()) {
+      PrintF(stderr, "Ignoring malformed inlining profile line: %s\n",
+             line.c_str());
+      continue;
+    }
+    std::string key = line.substr(prefix.size(), last - prefix.size());
+    const char* start = line.c_str() + last + 1;
+    char* end = nullptr;
+    errno = 0;
+    float frequency = std::strtof(start, &end);
+    if (errno != 0 || end == start || *end != '\0' ||
+        !std::isfinite(frequency) || frequency < 0) {
+      PrintF(stderr, "Ignoring malformed inlining profile line: %s\n",
+             line.c_str());
+      continue;
+    }
+    auto it = frequencies_.find(key);
+    if (it == frequencies_.end()) {
+      frequencies_.emplace(std::move(key), frequency);
+    } else {
+      it->second = std::max(it->second, frequency);
+    }
+  }
+}
+
+base::Optional<float> JSInliningProfile::Lookup(const std::string& key) const {
+  auto it = frequencies_.find(key);
+  if (it == frequencies_.end()) return {};
+  return it->second;
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
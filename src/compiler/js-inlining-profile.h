@@ -0,0 +1,72 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_JS_INLINING_PROFILE_H_
+#define V8_COMPILER_JS_INLINING_PROFILE_H_
+
+#include <istream>
+#include <string>
+#include <unordered_map>
+
+#include "src/base/optional.h"
+#include "src/compiler/heap-refs.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Call site frequencies collected in earlier runs with
+// --turbo-inlining-profile-log and read back from the file given by
+// --turbo-inlining-profile-input. The inlining heuristic prefers these over
+// the feedback of the current run, so that the cumulative inlining budget is
+// spent on the call sites that are hot over the lifetime of the application
+// rather than on the ones that happened to be hot during warmup.
+//
+// Each line of the file has the format
+//   literal kMarker , script source hash , caller start position ,
+//   bytecode offset , frequency
+// The hash is computed from the source text of the caller's script, so
+// profiles carry over between runs regardless of the order in which scripts
+// are loaded. Lines recorded for a different version of a script have a
+// different hash and are never looked up. If a call site is listed several
+// times, e.g. because the logs of several runs were concatenated, the highest
+// frequency is used. Malformed lines are reported and skipped.
+class JSInliningProfile final {
+ public:
+  static constexpr char kMarker[] = "inlining_frequency";
+
+  // Returns the profile read from --turbo-inlining-profile-input, or nullptr
+  // if the flag is not set.
+  static const JSInliningProfile* Get();
+
+  // Returns a key identifying the call site at {bytecode_offset} in {caller}
+  // that is stable across runs that load the same scripts.
+  static std::string CallSiteKey(JSHeapBroker* broker,
+                                 SharedFunctionInfoRef caller,
+                                 int bytecode_offset);
+
+  // Prints a profile line for the call site to stdout.
+  static void Log(const std::string& key, float frequency);
+
+  explicit JSInliningProfile(const char* filename);
+  explicit JSInliningProfile(std::istream& input);
+
+  base::Optional<float> Lookup(const std::string& key) const;
+
+ private:
+  void Read(std::istream& input);
+
+  // Returns the hash of the source of {shared}'s script. Each script is only
+  // hashed once per isolate.
+  static uint64_t ScriptSourceHash(JSHeapBroker* broker,
+                                   SharedFunctionInfoRef shared);
+
+  std::unordered_map<std::string, float> frequencies_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_JS_INLINING_PROFILE_H_
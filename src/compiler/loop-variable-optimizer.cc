@@ -345,6 +345,47 @@ void LoopVariableOptimizer::ChangeToPhisAndInsertGuards() {
   }
 }
 
+void LoopVariableOptimizer::EliminateRedundantBoundsChecks() {
+  for (auto entry : induction_vars_) {
+    Node* phi = entry.second->phi();
+    if (phi->opcode() != IrOpcode::kPhi) continue;
+    // Together with {phi < length}, this guarantees that the check passes.
+    if (!NodeProperties::GetType(phi).Is(Type::Unsigned32())) continue;
+
+    ZoneVector<Node*> checks(zone());
+    for (Edge edge : phi->use_edges()) {
+      if (edge.from()->opcode() == IrOpcode::kCheckBounds &&
+          edge.index() == 0) {
+        checks.push_back(edge.from());
+      }
+    }
+    for (Node* check : checks) {
+      Node* length = NodeProperties::GetValueInput(check, 1);
+      Node* control = NodeProperties::GetControlInput(check);
+      if (!reduced_.Get(control)) continue;
+      bool in_bounds = false;
+      for (Constraint constraint : limits_.Get(control)) {
+        if (constraint.left == phi && constraint.right == length &&
+            constraint.kind == InductionVariable::kStrict) {
+          in_bounds = true;
+          break;
+        }
+      }
+      if (!in_bounds) continue;
+      TRACE("Removing bounds check %d of induction variable %d\n", check->id(),
+            phi->id());
+      // Keep the narrower type of the check for the uses of its value.
+      Type type = NodeProperties::GetType(check);
+      Node* guard =
+          graph()->NewNode(common()->TypeGuard(type), phi,
+                           NodeProperties::GetEffectInput(check), control);
+      NodeProperties::SetType(guard, type);
+      check->ReplaceUses(guard);
+      check->Kill();
+    }
+  }
+}
+
 #undef TRACE
 
 }  // namespace compiler
@@ -81,6 +81,11 @@ class LoopVariableOptimizer {
   void ChangeToInductionVariablePhis();
   void ChangeToPhisAndInsertGuards();
 
+  // Removes CheckBounds nodes whose index is a non-negative integral induction
+  // variable that is known to be strictly less than the length by the loop
+  // condition. Requires typed nodes.
+  void EliminateRedundantBoundsChecks();
+
  private:
   const int kAssumedLoopEntryIndex = 0;
   const int kFirstBackedge = 1;
@@ -471,19 +471,23 @@ Reduction MemoryLowering::ReduceLoadExternalPointerField(Node* node) {
   // that the generated code is never executed under a different Isolate, as
   // that would allow access to external objects from different Isolates. It
   // also would break if the code is serialized/deserialized at some point.
+  //
+  // Neither the location of the shared table nor the table's buffer ever
+  // change while code runs (the table grows in place inside its reservation),
+  // so both loads are immutable and can be shared and hoisted out of loops.
   Node* table_address =
       IsSharedExternalPointerType(tag)
-          ? __
-            Load(MachineType::Pointer(),
-                 __ ExternalConstant(
-                     ExternalReference::
-                         shared_external_pointer_table_address_address(
-                             isolate())),
-                 __ IntPtrConstant(0))
+          ? __ LoadImmutable(
+                MachineType::Pointer(),
+                __ ExternalConstant(
+                    ExternalReference::
+                        shared_external_pointer_table_address_address(
+                            isolate())),
+                __ IntPtrConstant(0))
           : __ ExternalConstant(
                 ExternalReference::external_pointer_table_address(isolate()));
-  Node* table = __ Load(MachineType::Pointer(), table_address,
-                        Internals::kExternalPointerTableBufferOffset);
+  Node* table = __ LoadImmutable(MachineType::Pointer(), table_address,
+                                 Internals::kExternalPointerTableBufferOffset);
   Node* pointer =
       __ Load(MachineType::Pointer(), table, __ ChangeUint32ToUint64(offset));
   pointer = __ WordAnd(pointer, __ IntPtrConstant(~tag));
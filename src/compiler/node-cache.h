@@ -7,6 +7,7 @@
 
 #include "src/base/export-template.h"
 #include "src/base/functional.h"
+#include "src/base/hashmap.h"
 #include "src/base/macros.h"
 #include "src/zone/zone-containers.h"
 
@@ -26,12 +27,15 @@ class Node;
 
 
 // A cache for nodes based on a key. Useful for implementing canonicalization of
-// nodes such as constants, parameters, etc.
+// nodes such as constants, parameters, etc. The cache is an open-addressing
+// hash map in the zone, which avoids a node allocation per cached constant.
 template <typename Key, typename Hash = base::hash<Key>,
           typename Pred = std::equal_to<Key> >
 class EXPORT_TEMPLATE_DECLARE(V8_EXPORT_PRIVATE) NodeCache final {
  public:
-  explicit NodeCache(Zone* zone) : map_(zone) {}
+  explicit NodeCache(Zone* zone)
+      : map_(Map::kDefaultHashMapCapacity, Matcher(),
+             ZoneAllocationPolicy(zone)) {}
   ~NodeCache() = default;
   NodeCache(const NodeCache&) = delete;
   NodeCache& operator=(const NodeCache&) = delete;
@@ -40,18 +44,32 @@ class EXPORT_TEMPLATE_DECLARE(V8_EXPORT_PRIVATE) NodeCache final {
   // location in this cache that stores an entry for the key. If the location
   // returned by this method contains a non-nullptr node, the caller can use
   // that node. Otherwise it is the responsibility of the caller to fill the
-  // entry with a new node.
-  Node** Find(Key key) { return &(map_[key]); }
+  // entry with a new node. The returned location is only valid until the next
+  // call to {Find}.
+  Node** Find(Key key) {
+    return &map_.LookupOrInsert(key, static_cast<uint32_t>(Hash()(key)))
+                ->value;
+  }
 
   // Appends all nodes from this cache to {nodes}.
   void GetCachedNodes(ZoneVector<Node*>* nodes) {
-    for (const auto& entry : map_) {
-      if (entry.second) nodes->push_back(entry.second);
+    for (auto* entry = map_.Start(); entry != nullptr;
+         entry = map_.Next(entry)) {
+      if (entry->value) nodes->push_back(entry->value);
     }
   }
 
  private:
-  ZoneUnorderedMap<Key, Node*, Hash, Pred> map_;
+  struct Matcher {
+    bool operator()(uint32_t hash1, uint32_t hash2, const Key& key1,
+                    const Key& key2) const {
+      return Pred()(key1, key2);
+    }
+  };
+  using Map =
+      base::TemplateHashMapImpl<Key, Node*, Matcher, ZoneAllocationPolicy>;
+
+  Map map_;
 };
 
 // Various default cache types.
@@ -89,6 +89,7 @@
 #include "src/compiler/turboshaft/graph.h"
 #include "src/compiler/turboshaft/index.h"
 #include "src/compiler/turboshaft/late-escape-analysis-reducer.h"
+#include "src/compiler/turboshaft/load-elimination-reducer.h"
 #include "src/compiler/turboshaft/machine-lowering-reducer.h"
 #include "src/compiler/turboshaft/machine-optimization-reducer.h"
 #include "src/compiler/turboshaft/memory-optimization.h"
@@ -2002,6 +2003,17 @@ struct LoadEliminationPhase {
   }
 };
 
+struct LoopBoundsCheckEliminationPhase {
+  DECL_PIPELINE_PHASE_CONSTANTS(LoopBoundsCheckElimination)
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    LoopVariableOptimizer induction_vars(data->jsgraph()->graph(),
+                                         data->common(), temp_zone);
+    induction_vars.Run();
+    induction_vars.EliminateRedundantBoundsChecks();
+  }
+};
+
 struct MemoryOptimizationPhase {
   DECL_PIPELINE_PHASE_CONSTANTS(MemoryOptimization)
 
@@ -2182,7 +2194,7 @@ struct OptimizeTurboshaftPhase {
         turboshaft::LateEscapeAnalysisReducer,
         turboshaft::MemoryOptimizationReducer, turboshaft::VariableReducer,
         turboshaft::MachineOptimizationReducerSignallingNanImpossible,
-        turboshaft::ValueNumberingReducer>::
+        turboshaft::LoadEliminationReducer, turboshaft::ValueNumberingReducer>::
         Run(data->isolate(), &data->turboshaft_graph(), temp_zone,
             data->node_origins(),
             std::tuple{
@@ -3150,6 +3162,11 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     Run<LoadEliminationPhase>();
     RunPrintAndVerify(LoadEliminationPhase::phase_name());
   }
+  if (v8_flags.turbo_loop_variable &&
+      v8_flags.turbo_loop_bounds_check_elimination) {
+    Run<LoopBoundsCheckEliminationPhase>();
+    RunPrintAndVerify(LoopBoundsCheckEliminationPhase::phase_name());
+  }
   data->DeleteTyper();
 
   if (v8_flags.turbo_escape) {
@@ -0,0 +1,168 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_LOAD_ELIMINATION_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_LOAD_ELIMINATION_REDUCER_H_
+
+#include <algorithm>
+#include <type_traits>
+
+#include "src/base/logging.h"
+#include "src/base/optional.h"
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/graph.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/representations.h"
+#include "src/flags/flags.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+namespace turboshaft {
+
+// Removes redundant loads from tagged objects within a basic block. A load of
+// a field that was already loaded, or that was just stored to, is replaced by
+// the known value:
+//
+//   x = Load[base + 8]
+//   Store[base + 16] = v
+//   y = Load[base + 8]    =>  x
+//   z = Load[base + 16]   =>  v
+//
+// Fields are identified by their base and offset in the output graph. Two
+// different bases can refer to the same object, so a store invalidates the
+// known values of all fields overlapping with it, whatever their base. Any
+// other operation that can write to memory invalidates everything. Since the
+// state is reset at the beginning of every block, no merging is required.
+template <class Next>
+class LoadEliminationReducer : public Next {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE()
+
+  template <class... Args>
+  explicit LoadEliminationReducer(const std::tuple<Args...>& args)
+      : Next(args), known_fields_(Asm().phase_zone()) {}
+
+  void Bind(Block* block, const Block* origin = nullptr) {
+    Next::Bind(block, origin);
+    known_fields_.clear();
+  }
+
+#define EMIT_OP(Name)                                                 \
+  template <class... Args>                                            \
+  OpIndex Reduce##Name(Args... args) {                                \
+    OpIndex next_index = Asm().output_graph().next_operation_index(); \
+    OpIndex result = Next::Reduce##Name(args...);                     \
+    if (!v8_flags.turboshaft_load_elimination || !result.valid()) {   \
+      return result;                                                  \
+    }                                                                 \
+    return Track<Name##Op>(result, next_index);                       \
+  }
+  TURBOSHAFT_OPERATION_LIST(EMIT_OP)
+#undef EMIT_OP
+
+ private:
+  struct KnownField {
+    OpIndex base;
+    int32_t offset;
+    MemoryRepresentation rep;
+    OpIndex value;
+  };
+
+  template <class Op>
+  OpIndex Track(OpIndex op_idx, OpIndex next_index) {
+    const Operation& op = Asm().output_graph().Get(op_idx);
+    if constexpr (std::is_same_v<Op, LoadOp>) {
+      // Only a freshly emitted load can be removed again.
+      if (op_idx != next_index) return op_idx;
+      const LoadOp* load = op.TryCast<LoadOp>();
+      if (load == nullptr || !IsTrackedField(load->kind, load->index())) {
+        return op_idx;
+      }
+      for (const KnownField& field : known_fields_) {
+        if (field.base == load->base() && field.offset == load->offset &&
+            field.rep == load->loaded_rep &&
+            OutputRep(field.value) == load->result_rep) {
+          Next::RemoveLast(op_idx);
+          return field.value;
+        }
+      }
+      Record(load->base(), load->offset, load->loaded_rep, op_idx);
+    } else if constexpr (std::is_same_v<Op, StoreOp>) {
+      const StoreOp* store = op.TryCast<StoreOp>();
+      if (store == nullptr || !IsTrackedField(store->kind, store->index())) {
+        // An untagged or indexed store can write anywhere.
+        known_fields_.clear();
+        return op_idx;
+      }
+      Invalidate(store->offset, store->stored_rep.SizeInBytes());
+      // Narrow stores truncate the value, so reloading the field doesn't
+      // produce the stored value.
+      if (IsFullWidth(store->stored_rep)) {
+        Record(store->base(), store->offset, store->stored_rep,
+               store->value());
+      }
+    } else if (op.Properties().can_write) {
+      known_fields_.clear();
+    }
+    return op_idx;
+  }
+
+  // Bounds the cost of the linear lookups in very long blocks.
+  static constexpr size_t kMaxKnownFields = 32;
+
+  template <class Kind>
+  static bool IsTrackedField(Kind kind, OpIndex index) {
+    return kind.tagged_base && !kind.maybe_unaligned &&
+           !kind.with_trap_handler && !index.valid();
+  }
+
+  static bool IsFullWidth(MemoryRepresentation rep) {
+    switch (rep) {
+      case MemoryRepresentation::Int8():
+      case MemoryRepresentation::Uint8():
+      case MemoryRepresentation::Int16():
+      case MemoryRepresentation::Uint16():
+      case MemoryRepresentation::SandboxedPointer():
+        return false;
+      default:
+        return true;
+    }
+  }
+
+  base::Optional<RegisterRepresentation> OutputRep(OpIndex value) {
+    base::Vector<const RegisterRepresentation> reps =
+        Asm().output_graph().Get(value).outputs_rep();
+    if (reps.size() != 1) return {};
+    return reps[0];
+  }
+
+  void Invalidate(int32_t offset, int size) {
+    auto overlaps = [=](const KnownField& field) {
+      return field.offset < offset + size &&
+             offset < field.offset + field.rep.SizeInBytes();
+    };
+    known_fields_.erase(
+        std::remove_if(known_fields_.begin(), known_fields_.end(), overlaps),
+        known_fields_.end());
+  }
+
+  void Record(OpIndex base, int32_t offset, MemoryRepresentation rep,
+              OpIndex value) {
+    if (known_fields_.size() >= kMaxKnownFields) {
+      known_fields_.erase(known_fields_.begin());
+    }
+    known_fields_.push_back({base, offset, rep, value});
+  }
+
+  ZoneVector<KnownField> known_fields_;
+};
+
+}  // namespace turboshaft
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_TURBOSHAFT_LOAD_ELIMINATION_REDUCER_H_
@@ -2975,13 +2975,6 @@ Node* WasmGraphBuilder::BuildIndirectCall(uint32_t table_index,
       // In absence of subtyping, we just need to check for type equality.
       TrapIfFalse(wasm::kTrapFuncSigMismatch, sig_match, position);
     }
-  } else if (needs_null_check) {
-    Node* int32_scaled_key = gasm_->BuildChangeUint32ToUintPtr(
-        gasm_->Word32Shl(key, Int32Constant(2)));
-    Node* loaded_sig = gasm_->LoadFromObject(MachineType::Int32(), ift_sig_ids,
-                                             int32_scaled_key);
-    TrapIfTrue(wasm::kTrapFuncSigMismatch,
-               gasm_->Word32Equal(loaded_sig, Int32Constant(-1)), position);
   }
 
   Node* key_intptr = gasm_->BuildChangeUint32ToUintPtr(key);
@@ -2989,6 +2982,13 @@ Node* WasmGraphBuilder::BuildIndirectCall(uint32_t table_index,
   Node* target_instance = gasm_->LoadFixedArrayElement(
       ift_instances, key_intptr, MachineType::TaggedPointer());
 
+  // Without a signature check, check for null entries on the instance, which
+  // is undefined for them, instead of loading the signature id.
+  if (!needs_type_check && needs_null_check) {
+    TrapIfTrue(wasm::kTrapFuncSigMismatch,
+               gasm_->TaggedEqual(target_instance, UndefinedValue()), position);
+  }
+
   Node* intptr_scaled_key =
       gasm_->IntMul(key_intptr, gasm_->IntPtrConstant(kSystemPointerSize));
 
@@ -3097,6 +3097,43 @@ void WasmGraphBuilder::CompareToInternalFunctionAtIndex(Node* func_ref,
                 success_control, failure_control, hint);
 }
 
+void WasmGraphBuilder::CompareTableEntryToFunctionAtIndex(
+    uint32_t table_index, Node* key, uint32_t function_index,
+    Node** success_control, Node** failure_control, bool is_last_case,
+    wasm::WasmCodePosition position) {
+  DCHECK_GE(function_index, env_->module->num_imported_functions);
+  Node* ift_size;
+  Node* ift_sig_ids;
+  Node* ift_targets;
+  Node* ift_instances;
+  LoadIndirectFunctionTable(table_index, &ift_size, &ift_sig_ids, &ift_targets,
+                            &ift_instances);
+
+  // The indirect call would trap for an out-of-bounds {key} as well, so we can
+  // trap right away instead of falling back to it.
+  TrapIfFalse(wasm::kTrapTableOutOfBounds, gasm_->Uint32LessThan(key, ift_size),
+              position);
+
+  Node* key_intptr = gasm_->BuildChangeUint32ToUintPtr(key);
+  Node* target_instance = gasm_->LoadFixedArrayElement(
+      ift_instances, key_intptr, MachineType::TaggedPointer());
+  Node* target = gasm_->LoadFromObject(
+      MachineType::Pointer(), ift_targets,
+      gasm_->IntMul(key_intptr, gasm_->IntPtrConstant(kSystemPointerSize)));
+
+  // Functions of this module are called through their jump table slot, which
+  // identifies them together with the instance.
+  Node* expected_target = gasm_->IntAdd(
+      LOAD_INSTANCE_FIELD(JumpTableStart, MachineType::Pointer()),
+      gasm_->IntPtrConstant(
+          wasm::JumpTableOffset(env_->module, function_index)));
+  Node* is_match =
+      gasm_->Word32And(gasm_->TaggedEqual(target_instance, GetInstance()),
+                       gasm_->WordEqual(target, expected_target));
+  BranchHint hint = is_last_case ? BranchHint::kTrue : BranchHint::kNone;
+  gasm_->Branch(is_match, success_control, failure_control, hint);
+}
+
 Node* WasmGraphBuilder::CallRef(const wasm::FunctionSig* sig,
                                 base::Vector<Node*> args,
                                 base::Vector<Node*> rets,
@@ -5872,7 +5909,7 @@ Node* WasmGraphBuilder::ArrayLen(Node* array_object, CheckForNull null_check,
 void WasmGraphBuilder::ArrayCopy(Node* dst_array, Node* dst_index,
                                  CheckForNull dst_null_check, Node* src_array,
                                  Node* src_index, CheckForNull src_null_check,
-                                 Node* length,
+                                 Node* length, const wasm::ArrayType* type,
                                  wasm::WasmCodePosition position) {
   BoundsCheckArrayWithLength(dst_array, dst_index, length, dst_null_check,
                              position);
@@ -5884,6 +5921,50 @@ void WasmGraphBuilder::ArrayCopy(Node* dst_array, Node* dst_index,
   gasm_->GotoIf(gasm_->Word32Equal(length, Int32Constant(0)), &skip,
                 BranchHint::kFalse);
 
+  // Copy short ranges with a loop instead of calling out. The source element
+  // type is a subtype of the destination's, so {type} describes both arrays.
+  if (type != nullptr) {
+    constexpr uint32_t kArrayCopyMaximumSizeForLoop = 16;
+    auto call = gasm_->MakeLabel();
+    auto forward = gasm_->MakeLoopLabel(MachineRepresentation::kWord32);
+    auto backward = gasm_->MakeLoopLabel(MachineRepresentation::kWord32);
+    gasm_->GotoIfNot(gasm_->Uint32LessThan(
+                         length, Int32Constant(kArrayCopyMaximumSizeForLoop)),
+                     &call, BranchHint::kNone);
+    // Within the same array, copying backwards only matters if the
+    // destination range starts after the source range.
+    Node* copy_backward =
+        gasm_->Word32And(gasm_->TaggedEqual(dst_array, src_array),
+                         gasm_->Uint32LessThan(src_index, dst_index));
+    gasm_->GotoIf(copy_backward, &backward, BranchHint::kFalse, length);
+    gasm_->Goto(&forward, Int32Constant(0));
+
+    gasm_->Bind(&forward);
+    {
+      Node* i = forward.PhiAt(0);
+      Node* value =
+          gasm_->ArrayGet(src_array, gasm_->Int32Add(src_index, i), type, true);
+      gasm_->ArraySet(dst_array, gasm_->Int32Add(dst_index, i), value, type);
+      Node* next = gasm_->Int32Add(i, Int32Constant(1));
+      gasm_->GotoIf(gasm_->Uint32LessThan(next, length), &forward,
+                    BranchHint::kTrue, next);
+      gasm_->Goto(&skip);
+    }
+
+    gasm_->Bind(&backward);
+    {
+      Node* i = gasm_->Int32Sub(backward.PhiAt(0), Int32Constant(1));
+      Node* value =
+          gasm_->ArrayGet(src_array, gasm_->Int32Add(src_index, i), type, true);
+      gasm_->ArraySet(dst_array, gasm_->Int32Add(dst_index, i), value, type);
+      gasm_->GotoIf(gasm_->Word32Equal(i, Int32Constant(0)), &skip,
+                    BranchHint::kFalse);
+      gasm_->Goto(&backward, i);
+    }
+
+    gasm_->Bind(&call);
+  }
+
   Node* function =
       gasm_->ExternalConstant(ExternalReference::wasm_array_copy());
   MachineType arg_types[]{
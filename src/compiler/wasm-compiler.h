@@ -360,6 +360,15 @@ class WasmGraphBuilder {
                                         Node** failure_control,
                                         bool is_last_case);
 
+  // Checks whether entry {key} of table {table_index} holds the function at
+  // {function_index} of this instance. Traps if {key} is out of bounds.
+  void CompareTableEntryToFunctionAtIndex(uint32_t table_index, Node* key,
+                                          uint32_t function_index,
+                                          Node** success_control,
+                                          Node** failure_control,
+                                          bool is_last_case,
+                                          wasm::WasmCodePosition position);
+
   void BrOnNull(Node* ref_object, wasm::ValueType type, Node** non_null_node,
                 Node** null_node);
 
@@ -491,7 +500,8 @@ class WasmGraphBuilder {
                  wasm::WasmCodePosition position);
   void ArrayCopy(Node* dst_array, Node* dst_index, CheckForNull dst_null_check,
                  Node* src_array, Node* src_index, CheckForNull src_null_check,
-                 Node* length, wasm::WasmCodePosition position);
+                 Node* length, const wasm::ArrayType* type,
+                 wasm::WasmCodePosition position);
   void ArrayFill(Node* array, Node* index, Node* value, Node* length,
                  const wasm::ArrayType* type, CheckForNull null_check,
                  wasm::WasmCodePosition position);
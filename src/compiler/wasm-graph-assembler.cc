@@ -184,17 +184,19 @@ Node* WasmGraphAssembler::BuildLoadExternalPointerFromObject(
       Int32Constant(kExternalPointerIndexShift - kSystemPointerSizeLog2);
   Node* scaled_index =
       ChangeUint32ToUint64(Word32Shr(external_pointer, shift_amount));
+  // The table locations never change while code runs, so these loads can be
+  // shared and hoisted out of loops.
   Node* table;
   if (IsSharedExternalPointerType(tag)) {
     Node* table_address =
-        Load(MachineType::Pointer(), isolate_root,
-             IsolateData::shared_external_pointer_table_offset());
-    table = Load(MachineType::Pointer(), table_address,
-                 Internals::kExternalPointerTableBufferOffset);
+        LoadImmutable(MachineType::Pointer(), isolate_root,
+                      IsolateData::shared_external_pointer_table_offset());
+    table = LoadImmutable(MachineType::Pointer(), table_address,
+                          Internals::kExternalPointerTableBufferOffset);
   } else {
-    table = Load(MachineType::Pointer(), isolate_root,
-                 IsolateData::external_pointer_table_offset() +
-                     Internals::kExternalPointerTableBufferOffset);
+    table = LoadImmutable(MachineType::Pointer(), isolate_root,
+                          IsolateData::external_pointer_table_offset() +
+                              Internals::kExternalPointerTableBufferOffset);
   }
   Node* decoded_ptr = Load(MachineType::Pointer(), table, scaled_index);
   return WordAnd(decoded_ptr, IntPtrConstant(~tag));
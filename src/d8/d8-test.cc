@@ -451,6 +451,32 @@ class FastCApiObject {
     }
   }
 
+  static void AddAllDoubleArraySlowCallback(
+      const FunctionCallbackInfo<Value>& args) {
+    if (args.Length() < 2 || !args[1]->IsArray()) {
+      AddAllTypedArraySlowCallback(args);
+      return;
+    }
+    Isolate* isolate = args.GetIsolate();
+
+    FastCApiObject* self = UnwrapObject(args.This());
+    CHECK_SELF_OR_THROW();
+    self->slow_call_count_++;
+
+    HandleScope handle_scope(isolate);
+    Local<Context> context = isolate->GetCurrentContext();
+    Local<Array> array_arg = args[1].As<Array>();
+    double sum = 0;
+    for (uint32_t i = 0; i < array_arg->Length(); ++i) {
+      Local<Value> element;
+      if (!array_arg->Get(context, i).ToLocal(&element)) return;
+      double value;
+      if (!element->NumberValue(context).To(&value)) return;
+      sum += value;
+    }
+    args.GetReturnValue().Set(Number::New(isolate, sum));
+  }
+
   static int32_t AddAllIntInvalidCallback(Local<Object> receiver,
                                           bool should_fallback, int32_t arg_i32,
                                           FastApiCallbackOptions& options) {
@@ -1367,6 +1393,21 @@ Local<FunctionTemplate> Shell::CreateTestFastCApiTemplate(Isolate* isolate) {
             SideEffectType::kHasSideEffect,
             &add_all_float64_typed_array_c_func));
 
+    CFunction add_all_float64_array_c_func =
+        CFunctionBuilder()
+            .Fn(FastCApiObject::AddAllTypedArrayFastCallback<double>)
+            .Arg<2, v8::CTypeInfo::Flags::kAllowJSArrayBit>()
+#ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+            .Patch(FastCApiObject::AddAllTypedArrayFastCallbackPatch<double>)
+#endif  // V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+            .Build();
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "add_all_float64_array",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::AddAllDoubleArraySlowCallback,
+            Local<Value>(), signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &add_all_float64_array_c_func));
+
     const CFunction add_all_overloads[] = {
         add_all_uint32_typed_array_c_func,
         add_all_seq_c_func,
@@ -37,6 +37,7 @@
 
 #if V8_ENABLE_WEBASSEMBLY
 #include "src/wasm/wasm-debug.h"
+#include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-objects-inl.h"
 #endif  // V8_ENABLE_WEBASSEMBLY
 
@@ -2573,6 +2574,13 @@ void Debug::UpdateHookOnFunctionCall() {
       thread_local_.last_step_action_ == StepInto ||
       isolate_->debug_execution_mode() == DebugInfo::kSideEffects ||
       thread_local_.break_on_next_function_call_;
+#if V8_ENABLE_WEBASSEMBLY
+  // Only debug code checks the hook, so Wasm code kept when entering debugging
+  // has to go now.
+  if (v8_flags.wasm_lazy_debug_tier_down && hook_on_function_call_) {
+    wasm::GetWasmEngine()->TierDownForStepping(isolate_);
+  }
+#endif  // V8_ENABLE_WEBASSEMBLY
 }
 
 void Debug::HandleDebugBreak(IgnoreBreakMode ignore_break_mode,
@@ -4,6 +4,9 @@
 
 #include "src/deoptimizer/materialized-object-store.h"
 
+#include <algorithm>
+#include <functional>
+
 #include "src/execution/isolate.h"
 #include "src/heap/heap-inl.h"
 #include "src/objects/fixed-array-inl.h"
@@ -24,22 +27,28 @@ Handle<FixedArray> MaterializedObjectStore::Get(Address fp) {
 
 void MaterializedObjectStore::Set(Address fp,
                                   Handle<FixedArray> materialized_objects) {
-  int index = StackIdToIndex(fp);
-  if (index == -1) {
-    index = static_cast<int>(frame_fps_.size());
-    frame_fps_.push_back(fp);
+  auto it = LowerBound(fp);
+  int index = static_cast<int>(std::distance(frame_fps_.begin(), it));
+  if (it != frame_fps_.end() && *it == fp) {
+    GetStackEntries()->set(index, *materialized_objects);
+    return;
   }
 
-  Handle<FixedArray> array = EnsureStackEntries(index + 1);
+  // Insert at the sorted position, shifting the entries of inner frames up.
+  int fps_size = static_cast<int>(frame_fps_.size());
+  frame_fps_.insert(it, fp);
+  Handle<FixedArray> array = EnsureStackEntries(fps_size + 1);
+  for (int i = fps_size; i > index; i--) {
+    array->set(i, array->get(i - 1));
+  }
   array->set(index, *materialized_objects);
 }
 
 bool MaterializedObjectStore::Remove(Address fp) {
-  auto it = std::find(frame_fps_.begin(), frame_fps_.end(), fp);
-  if (it == frame_fps_.end()) return false;
-  int index = static_cast<int>(std::distance(frame_fps_.begin(), it));
+  int index = StackIdToIndex(fp);
+  if (index == -1) return false;
 
-  frame_fps_.erase(it);
+  frame_fps_.erase(frame_fps_.begin() + index);
   FixedArray array = isolate()->heap()->materialized_objects();
 
   CHECK_LT(index, array.length());
@@ -51,9 +60,15 @@ bool MaterializedObjectStore::Remove(Address fp) {
   return true;
 }
 
+std::vector<Address>::iterator MaterializedObjectStore::LowerBound(
+    Address fp) {
+  return std::lower_bound(frame_fps_.begin(), frame_fps_.end(), fp,
+                          std::greater<Address>());
+}
+
 int MaterializedObjectStore::StackIdToIndex(Address fp) {
-  auto it = std::find(frame_fps_.begin(), frame_fps_.end(), fp);
-  return it == frame_fps_.end()
+  auto it = LowerBound(fp);
+  return it == frame_fps_.end() || *it != fp
              ? -1
              : static_cast<int>(std::distance(frame_fps_.begin(), it));
 }
@@ -28,9 +28,14 @@ class MaterializedObjectStore {
   Handle<FixedArray> GetStackEntries();
   Handle<FixedArray> EnsureStackEntries(int size);
 
+  std::vector<Address>::iterator LowerBound(Address fp);
   int StackIdToIndex(Address fp);
 
   Isolate* isolate_;
+  // Frame pointers sorted in decreasing order, i.e. outermost frame first
+  // on downward-growing stacks. Frames deoptimize innermost first, so
+  // removal usually drops the last entry without shifting the rest, and
+  // lookups on every deopt are a binary search rather than a linear scan.
   std::vector<Address> frame_fps_;
 };
 
@@ -42,6 +42,7 @@
 #include "src/codegen/assembler.h"
 #include "src/codegen/source-position-table.h"
 #include "src/diagnostics/eh-frame.h"
+#include "src/heap/marking-state-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/shared-function-info.h"
 #include "src/snapshot/embedded/embedded-data.h"
@@ -96,6 +97,16 @@ struct PerfJitCodeLoad : PerfJitBase {
   uint64_t code_id_;
 };
 
+struct PerfJitCodeMove : PerfJitBase {
+  uint32_t process_id_;
+  uint32_t thread_id_;
+  uint64_t vma_;
+  uint64_t old_code_address_;
+  uint64_t new_code_address_;
+  uint64_t code_size_;
+  uint64_t code_id_;
+};
+
 struct PerfJitDebugEntry {
   uint64_t address_;
   int line_number_;
@@ -129,6 +140,8 @@ int LinuxPerfJitLogger::process_id_ = 0;
 uint64_t LinuxPerfJitLogger::reference_count_ = 0;
 void* LinuxPerfJitLogger::marker_address_ = nullptr;
 uint64_t LinuxPerfJitLogger::code_index_ = 0;
+std::unordered_map<Address, LinuxPerfJitLogger::LoggedCode>*
+    LinuxPerfJitLogger::code_indices_ = nullptr;
 FILE* LinuxPerfJitLogger::perf_output_handle_ = nullptr;
 
 void LinuxPerfJitLogger::OpenJitDumpFile() {
@@ -156,12 +169,15 @@ void LinuxPerfJitLogger::OpenJitDumpFile() {
   if (perf_output_handle_ == nullptr) return;
 
   setvbuf(perf_output_handle_, nullptr, _IOFBF, kLogBufferSize);
+  code_indices_ = new std::unordered_map<Address, LoggedCode>();
 }
 
 void LinuxPerfJitLogger::CloseJitDumpFile() {
   if (perf_output_handle_ == nullptr) return;
   base::Fclose(perf_output_handle_);
   perf_output_handle_ = nullptr;
+  delete code_indices_;
+  code_indices_ = nullptr;
 }
 
 void* LinuxPerfJitLogger::OpenMarkerFile(int fd) {
@@ -200,6 +216,17 @@ LinuxPerfJitLogger::LinuxPerfJitLogger(Isolate* isolate)
 LinuxPerfJitLogger::~LinuxPerfJitLogger() {
   base::LockGuard<base::RecursiveMutex> guard_file(GetFileMutex().Pointer());
 
+  // The code of this isolate is about to be freed.
+  if (code_indices_ != nullptr) {
+    for (auto it = code_indices_->begin(); it != code_indices_->end();) {
+      if (it->second.isolate == isolate_) {
+        it = code_indices_->erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
   reference_count_--;
   // If this was the last logger, close the file.
   if (reference_count_ == 0) {
@@ -220,15 +247,6 @@ void LinuxPerfJitLogger::LogRecordedBuffer(
     AbstractCode abstract_code, MaybeHandle<SharedFunctionInfo> maybe_shared,
     const char* name, int length) {
   DisallowGarbageCollection no_gc;
-  if (v8_flags.perf_basic_prof_only_functions) {
-    CodeKind code_kind = abstract_code.kind(isolate_);
-    if (code_kind != CodeKind::INTERPRETED_FUNCTION &&
-        code_kind != CodeKind::TURBOFAN && code_kind != CodeKind::MAGLEV &&
-        code_kind != CodeKind::BASELINE) {
-      return;
-    }
-  }
-
   base::LockGuard<base::RecursiveMutex> guard_file(GetFileMutex().Pointer());
 
   if (perf_output_handle_ == nullptr) return;
@@ -237,6 +255,18 @@ void LinuxPerfJitLogger::LogRecordedBuffer(
   if (!abstract_code.IsCode(isolate_)) return;
   Code code = Code::cast(abstract_code);
 
+  if (v8_flags.perf_basic_prof_only_functions) {
+    CodeKind code_kind = code.kind();
+    if (code_kind != CodeKind::INTERPRETED_FUNCTION &&
+        code_kind != CodeKind::TURBOFAN && code_kind != CodeKind::MAGLEV &&
+        code_kind != CodeKind::BASELINE) {
+      // The code may reuse the address of dead code that was logged, which
+      // must not be moved along with it.
+      code_indices_->erase(code.InstructionStart());
+      return;
+    }
+  }
+
   // Debug info has to be emitted first.
   Handle<SharedFunctionInfo> shared;
   if (v8_flags.perf_prof && maybe_shared.ToHandle(&shared)) {
@@ -255,7 +285,10 @@ void LinuxPerfJitLogger::LogRecordedBuffer(
   if (v8_flags.perf_prof_unwinding_info) LogWriteUnwindingInfo(code);
 
   WriteJitCodeLoadEntry(code_pointer, code.InstructionSize(), code_name,
-                        length);
+                        length,
+                        code.has_instruction_stream()
+                            ? code.instruction_stream().address()
+                            : kNullAddress);
 }
 
 #if V8_ENABLE_WEBASSEMBLY
@@ -268,14 +301,16 @@ void LinuxPerfJitLogger::LogRecordedBuffer(const wasm::WasmCode* code,
   if (v8_flags.perf_prof_annotate_wasm) LogWriteDebugInfo(code);
 
   WriteJitCodeLoadEntry(code->instructions().begin(),
-                        code->instructions().length(), name, length);
+                        code->instructions().length(), name, length,
+                        kNullAddress);
 }
 #endif  // V8_ENABLE_WEBASSEMBLY
 
 void LinuxPerfJitLogger::WriteJitCodeLoadEntry(const uint8_t* code_pointer,
                                                uint32_t code_size,
                                                const char* name,
-                                               int name_length) {
+                                               int name_length,
+                                               Address instruction_stream) {
   PerfJitCodeLoad code_load;
   code_load.event_ = PerfJitCodeLoad::kLoad;
   code_load.size_ = sizeof(code_load) + name_length + 1 + code_size;
@@ -287,6 +322,9 @@ void LinuxPerfJitLogger::WriteJitCodeLoadEntry(const uint8_t* code_pointer,
   code_load.code_size_ = code_size;
   code_load.code_id_ = code_index_;
 
+  // Replaces the entry of any dead code that was logged at the same address.
+  (*code_indices_)[reinterpret_cast<Address>(code_pointer)] = {
+      code_index_, isolate_, instruction_stream};
   code_index_++;
 
   LogWriteBytes(reinterpret_cast<const char*>(&code_load), sizeof(code_load));
@@ -295,6 +333,66 @@ void LinuxPerfJitLogger::WriteJitCodeLoadEntry(const uint8_t* code_pointer,
   LogWriteBytes(reinterpret_cast<const char*>(code_pointer), code_size);
 }
 
+void LinuxPerfJitLogger::CodeMoveEvent(InstructionStream from,
+                                       InstructionStream to) {
+  base::LockGuard<base::RecursiveMutex> guard_file(GetFileMutex().Pointer());
+
+  if (perf_output_handle_ == nullptr) return;
+
+  WriteJitCodeMoveEntry(from.instruction_start(), to.instruction_start(),
+                        from.instruction_size(), to.address());
+}
+
+void LinuxPerfJitLogger::WeakCodeClearEvent() {
+  base::LockGuard<base::RecursiveMutex> guard_file(GetFileMutex().Pointer());
+
+  if (perf_output_handle_ == nullptr) return;
+
+  // Marking is complete but dead code has not been swept yet. Drop its
+  // entries, since new code may be allocated at the same addresses.
+  NonAtomicMarkingState* marking_state =
+      isolate_->heap()->non_atomic_marking_state();
+  for (auto it = code_indices_->begin(); it != code_indices_->end();) {
+    const LoggedCode& logged = it->second;
+    if (logged.isolate == isolate_ &&
+        logged.instruction_stream != kNullAddress &&
+        marking_state->IsWhite(
+            HeapObject::FromAddress(logged.instruction_stream))) {
+      it = code_indices_->erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void LinuxPerfJitLogger::WriteJitCodeMoveEntry(Address from, Address to,
+                                               uint32_t code_size,
+                                               Address to_instruction_stream) {
+  // Code that was filtered out when it was created has no load record to
+  // move.
+  auto it = code_indices_->find(from);
+  if (it == code_indices_->end()) return;
+  LoggedCode logged = it->second;
+  code_indices_->erase(it);
+  uint64_t code_id = logged.code_index;
+  logged.instruction_stream = to_instruction_stream;
+  (*code_indices_)[to] = logged;
+
+  PerfJitCodeMove code_move;
+  code_move.event_ = PerfJitCodeLoad::kMove;
+  code_move.size_ = sizeof(code_move);
+  code_move.time_stamp_ = GetTimestamp();
+  code_move.process_id_ = static_cast<uint32_t>(process_id_);
+  code_move.thread_id_ = static_cast<uint32_t>(base::OS::GetCurrentThreadId());
+  code_move.vma_ = static_cast<uint64_t>(to);
+  code_move.old_code_address_ = static_cast<uint64_t>(from);
+  code_move.new_code_address_ = static_cast<uint64_t>(to);
+  code_move.code_size_ = code_size;
+  code_move.code_id_ = code_id;
+
+  LogWriteBytes(reinterpret_cast<const char*>(&code_move), sizeof(code_move));
+}
+
 namespace {
 
 constexpr char kUnknownScriptNameString[] = "<unknown>";
@@ -33,6 +33,8 @@
 // {LinuxPerfJitLogger} is only implemented on Linux.
 #if V8_OS_LINUX
 
+#include <unordered_map>
+
 #include "src/logging/log.h"
 
 namespace v8 {
@@ -44,12 +46,11 @@ class LinuxPerfJitLogger : public CodeEventLogger {
   explicit LinuxPerfJitLogger(Isolate* isolate);
   ~LinuxPerfJitLogger() override;
 
-  void CodeMoveEvent(InstructionStream from, InstructionStream to) override {
-    UNREACHABLE();  // Unsupported.
-  }
+  void CodeMoveEvent(InstructionStream from, InstructionStream to) override;
   void BytecodeMoveEvent(BytecodeArray from, BytecodeArray to) override {}
   void CodeDisableOptEvent(Handle<AbstractCode> code,
                            Handle<SharedFunctionInfo> shared) override {}
+  void WeakCodeClearEvent() override;
 
  private:
   void OpenJitDumpFile();
@@ -75,7 +76,10 @@ class LinuxPerfJitLogger : public CodeEventLogger {
   static const int kLogBufferSize = 2 * MB;
 
   void WriteJitCodeLoadEntry(const uint8_t* code_pointer, uint32_t code_size,
-                             const char* name, int name_length);
+                             const char* name, int name_length,
+                             Address instruction_stream);
+  void WriteJitCodeMoveEntry(Address from, Address to, uint32_t code_size,
+                             Address to_instruction_stream);
 
   void LogWriteBytes(const char* bytes, int size);
   void LogWriteHeader();
@@ -134,6 +138,17 @@ class LinuxPerfJitLogger : public CodeEventLogger {
   static uint64_t reference_count_;
   static void* marker_address_;
   static uint64_t code_index_;
+  // The load record of a logged instruction start, so that move records can
+  // refer to it.
+  struct LoggedCode {
+    uint64_t code_index;
+    // The isolate and the InstructionStream of on-heap code, used to drop the
+    // entry once the code is dead. kNullAddress for off-heap and wasm code,
+    // which is never moved.
+    Isolate* isolate;
+    Address instruction_stream;
+  };
+  static std::unordered_map<Address, LoggedCode>* code_indices_;
   static int process_id_;
 };
 
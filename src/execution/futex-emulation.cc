@@ -5,6 +5,7 @@
 #include "src/execution/futex-emulation.h"
 
 #include <limits>
+#include <unordered_map>
 
 #include "src/api/api-inl.h"
 #include "src/base/logging.h"
@@ -91,8 +92,9 @@ class FutexWaitList {
     FutexWaitListNode* tail;
   };
   // Location inside a shared buffer -> linked list of Nodes waiting on that
-  // location.
-  std::map<int8_t*, HeadAndTail> location_lists_;
+  // location. Looked up on every wait and notify while holding `g_mutex`, so
+  // use a hash map to keep those critical sections short with many waiters.
+  std::unordered_map<int8_t*, HeadAndTail> location_lists_;
 
   // Isolate* -> linked list of Nodes which are waiting for their Promises to
   // be resolved.
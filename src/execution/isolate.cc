@@ -4710,6 +4710,10 @@ CodeTracer* Isolate::GetCodeTracer() {
 
 bool Isolate::use_optimizer() {
   // TODO(v8:7700): Update this predicate for a world with multiple tiers.
+  // Precise count coverage takes function counts from the invocation count in
+  // the feedback vector, which optimized and inlined code does not increment.
+  // Block count coverage instead uses the function-scope block counter, whose
+  // IncBlockCounter is kept by all tiers, and thus leaves the optimizer on.
   return (v8_flags.turbofan || v8_flags.maglev) && !serializer_enabled_ &&
          CpuFeatures::SupportsOptimizer() && !is_precise_count_code_coverage();
 }
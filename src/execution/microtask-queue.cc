@@ -214,13 +214,12 @@ void MicrotaskQueue::IterateMicrotasks(RootVisitor* visitor) {
     return;
   }
 
-  intptr_t new_capacity = capacity_;
-  while (new_capacity > 2 * size_) {
-    new_capacity >>= 1;
-  }
-  new_capacity = std::max(new_capacity, kMinimumCapacity);
-  if (new_capacity < capacity_) {
-    ResizeBuffer(new_capacity);
+  // Shrink by at most half per GC, and only when a quarter of the buffer is in
+  // use or less. Queues are usually empty when a GC happens, so shrinking to
+  // fit would make every burst of promise jobs grow the buffer again from
+  // kMinimumCapacity, one doubling and copy at a time.
+  if (capacity_ > 4 * size_) {
+    ResizeBuffer(std::max(capacity_ >> 1, kMinimumCapacity));
   }
 }
 
@@ -260,8 +259,12 @@ Microtask MicrotaskQueue::get(intptr_t index) const {
 void MicrotaskQueue::ResizeBuffer(intptr_t new_capacity) {
   DCHECK_LE(size_, new_capacity);
   Address* new_ring_buffer = new Address[new_capacity];
-  for (intptr_t i = 0; i < size_; ++i) {
-    new_ring_buffer[i] = ring_buffer_[(start_ + i) % capacity_];
+  if (size_ > 0) {
+    // The pending microtasks are at most two contiguous runs: from |start_| to
+    // the end of the buffer, and from the beginning of the buffer on.
+    intptr_t first_run = std::min(size_, capacity_ - start_);
+    std::copy_n(ring_buffer_ + start_, first_run, new_ring_buffer);
+    std::copy_n(ring_buffer_, size_ - first_run, new_ring_buffer + first_run);
   }
 
   delete[] ring_buffer_;
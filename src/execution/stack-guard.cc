@@ -338,7 +338,8 @@ Object StackGuard::HandleInterrupts() {
   if (TestAndClear(&interrupt_flags, INSTALL_MAGLEV_CODE)) {
     TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                  "V8.FinalizeMaglevConcurrentCompilation");
-    isolate_->maglev_concurrent_dispatcher()->FinalizeFinishedJobs();
+    isolate_->maglev_concurrent_dispatcher()->FinalizeFinishedJobs(
+        /*use_time_budget*/ true);
   }
 #endif  // V8_ENABLE_MAGLEV
 
@@ -4,6 +4,8 @@
 
 #include "src/execution/tiering-manager.h"
 
+#include <algorithm>
+
 #include "src/base/platform/platform.h"
 #include "src/baseline/baseline-batch-compiler.h"
 #include "src/baseline/baseline.h"
@@ -263,6 +265,13 @@ bool ShouldOptimizeAsSmallFunction(int bytecode_size, bool any_ic_changed) {
          bytecode_size < v8_flags.max_bytecode_size_for_early_opt;
 }
 
+int DeoptBackoff(JSFunction function) {
+  if (!v8_flags.tiering_deopt_backoff) return 0;
+  return std::min<int>(function.feedback_vector().deopt_count(),
+                       std::clamp(v8_flags.max_tiering_deopt_backoff.value(),
+                                  0, 16));
+}
+
 }  // namespace
 
 void TieringManager::RequestOsrAtNextOpportunity(JSFunction function) {
@@ -359,12 +368,19 @@ OptimizationDecision TieringManager::ShouldOptimize(
     return OptimizationDecision::DoNotOptimize();
   }
   const int ticks = function.feedback_vector().profiler_ticks();
-  const int ticks_for_optimization =
+  const int deopt_count = DeoptBackoff(function);
+  const int base_ticks_for_optimization =
       v8_flags.ticks_before_optimization +
       (bytecode.length() / v8_flags.bytecode_size_allowance_per_tick);
+  // Functions which keep deoptimizing have to stay hot for longer before they
+  // are optimized again, to avoid deopt loops. The shifted value can exceed
+  // the int range, so it saturates.
+  const int ticks_for_optimization = static_cast<int>(std::min<int64_t>(
+      int64_t{base_ticks_for_optimization} << deopt_count, kMaxInt));
   if (ticks >= ticks_for_optimization) {
     return OptimizationDecision::TurbofanHotAndStable();
-  } else if (ShouldOptimizeAsSmallFunction(bytecode.length(),
+  } else if (deopt_count == 0 &&
+             ShouldOptimizeAsSmallFunction(bytecode.length(),
                                            any_ic_changed_)) {
     // If no IC was patched since the last tick and this function is very
     // small, optimistically optimize it now.
@@ -374,6 +390,8 @@ OptimizationDecision TieringManager::ShouldOptimize(
            function.DebugNameCStr().get(), ticks, ticks_for_optimization);
     if (any_ic_changed_) {
       PrintF("ICs changed]\n");
+    } else if (deopt_count > 0) {
+      PrintF("backing off after %d deopts]\n", deopt_count);
     } else {
       PrintF(" too large for small function optimization: %d/%d]\n",
              bytecode.length(),
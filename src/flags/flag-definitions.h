@@ -483,6 +483,11 @@ DEFINE_FLOAT(min_maglev_inlining_frequency, 0.10,
              "minimum frequency for inlining")
 DEFINE_BOOL(maglev_reuse_stack_slots, true,
             "reuse stack slots in the maglev optimizing compiler")
+DEFINE_INT(maglev_finalization_budget_ms, 0,
+           "maximum time spent finalizing concurrent maglev jobs in one "
+           "interrupt, the rest is left to the next one (0 means unlimited)")
+DEFINE_BOOL(maglev_licm, false,
+            "hoist loop invariant nodes in the maglev optimizing compiler")
 
 // We stress maglev by setting a very low interrupt budget for maglev. This
 // way, we still gather *some* feedback before compiling optimized code.
@@ -511,6 +516,7 @@ DEFINE_BOOL(trace_maglev_inlining, false, "trace maglev inlining")
 DEFINE_BOOL(trace_maglev_inlining_verbose, false,
             "trace maglev inlining (verbose)")
 DEFINE_IMPLICATION(trace_maglev_inlining_verbose, trace_maglev_inlining)
+DEFINE_BOOL(trace_maglev_licm, false, "trace maglev loop invariant code motion")
 
 // TODO(v8:7700): Remove once stable.
 DEFINE_BOOL(maglev_function_context_specialization, true,
@@ -655,6 +661,12 @@ DEFINE_INT(bytecode_size_allowance_per_tick, 150,
 DEFINE_INT(
     max_bytecode_size_for_early_opt, 81,
     "Maximum bytecode length for a function to be optimized on the first tick")
+DEFINE_BOOL(tiering_deopt_backoff, false,
+            "double the number of ticks required for optimization every time "
+            "the optimized code of a function is thrown away by a deopt")
+DEFINE_INT(max_tiering_deopt_backoff, 4,
+           "maximum number of times the ticks required for optimization are "
+           "doubled by --tiering-deopt-backoff")
 DEFINE_BOOL(global_ic_updated_flag, true,
             "Track, globally, whether any IC changed, and use this in tierup "
             "heuristics.")
@@ -764,6 +776,9 @@ DEFINE_BOOL(trace_baseline_concurrent_compilation, false,
 // Internalize into a shared string table in the shared isolate
 DEFINE_BOOL(shared_string_table, false, "internalize strings into shared table")
 DEFINE_IMPLICATION(harmony_struct, shared_string_table)
+DEFINE_BOOL(concurrent_string_table_insertion, true,
+            "insert strings into the string table without excluding other "
+            "insertions, unless the table needs to be resized")
 DEFINE_BOOL(
     always_use_string_forwarding_table, false,
     "use string forwarding table instead of thin strings for all strings")
@@ -796,6 +811,9 @@ DEFINE_BOOL(trace_concurrent_recompilation, false,
             "track concurrent recompilation")
 DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
+DEFINE_BOOL(concurrent_recompilation_priority_queue, false,
+            "compile the hottest queued functions first and let hot functions "
+            "evict colder ones from a full concurrent compilation queue")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
 DEFINE_BOOL(
@@ -931,6 +949,12 @@ DEFINE_VALUE_IMPLICATION(stress_inline, max_inlined_bytecode_size_absolute,
 DEFINE_VALUE_IMPLICATION(stress_inline, min_inlining_frequency, 0.)
 DEFINE_IMPLICATION(stress_inline, polymorphic_inlining)
 DEFINE_BOOL(trace_turbo_inlining, false, "trace TurboFan inlining")
+DEFINE_STRING(turbo_inlining_profile_input, nullptr,
+              "path of a file with call site frequencies from earlier runs "
+              "that guide the TurboFan inlining budget")
+DEFINE_BOOL(turbo_inlining_profile_log, false,
+            "print the call site frequencies seen by TurboFan inlining in the "
+            "format read by --turbo-inlining-profile-input")
 DEFINE_BOOL(turbo_inline_array_builtins, true,
             "inline array builtins in TurboFan code")
 DEFINE_BOOL(use_osr, true, "use on-stack replacement")
@@ -975,6 +999,9 @@ DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "TurboFan loop variable optimization")
+DEFINE_BOOL(turbo_loop_bounds_check_elimination, false,
+            "remove bounds checks of induction variables that are implied by "
+            "the loop condition")
 DEFINE_BOOL(turbo_loop_rotation, true, "TurboFan loop rotation")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
@@ -1030,6 +1057,8 @@ DEFINE_EXPERIMENTAL_FEATURE(turboshaft,
                             "enable TurboFan's Turboshaft phases for JS")
 DEFINE_BOOL(turboshaft_trace_reduction, false,
             "trace individual Turboshaft reduction steps")
+DEFINE_BOOL(turboshaft_load_elimination, false,
+            "eliminate redundant loads within basic blocks in Turboshaft")
 DEFINE_EXPERIMENTAL_FEATURE(turboshaft_wasm,
                             "enable TurboFan's Turboshaft phases for wasm")
 #ifdef DEBUG
@@ -1113,6 +1142,9 @@ DEFINE_DEBUG_BOOL(trace_wasm_stack_switching, false,
                   "trace wasm stack switching")
 DEFINE_INT(wasm_stack_switching_stack_size, V8_DEFAULT_STACK_SIZE_KB,
            "default size of stacks for wasm stack-switching (in kB)")
+DEFINE_INT(wasm_stack_switching_pool_size, 16,
+           "maximum number of unused stacks that wasm stack-switching keeps "
+           "for reuse")
 DEFINE_BOOL(liftoff, true,
             "enable Liftoff, the baseline compiler for WebAssembly")
 DEFINE_BOOL(liftoff_only, false,
@@ -1121,6 +1153,9 @@ DEFINE_IMPLICATION(liftoff_only, liftoff)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_tier_up)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_dynamic_tiering)
 DEFINE_NEG_IMPLICATION(fuzzing, liftoff_only)
+DEFINE_BOOL(liftoff_keep_loop_invariant_locals, false,
+            "keep locals which are not assigned in a loop in their registers "
+            "when Liftoff enters the loop")
 DEFINE_DEBUG_BOOL(
     enable_testing_opcode_in_wasm, false,
     "enables a testing opcode in wasm that is only implemented in TurboFan")
@@ -1139,6 +1174,10 @@ DEFINE_INT(wasm_tier_mask_for_testing, 0,
 DEFINE_INT(wasm_debug_mask_for_testing, 0,
            "bitmask of functions to compile for debugging, only applies if the "
            "tier is Liftoff")
+DEFINE_BOOL(wasm_lazy_debug_tier_down, false,
+            "keep existing Wasm code when a debugger attaches; only functions "
+            "with breakpoints are recompiled for debugging until stepping into "
+            "a call requires all code to be debuggable")
 // TODO(clemensb): Introduce experimental_wasm_pgo to read from a custom section
 // instead of from a local file.
 DEFINE_BOOL(
@@ -1216,6 +1255,11 @@ DEFINE_SIZE_T(wasm_inlining_max_size, 500,
               "maximum function size (in wire bytes) that may be inlined")
 DEFINE_BOOL(wasm_speculative_inlining, false,
             "enable speculative inlining of call_ref targets (experimental)")
+DEFINE_BOOL(wasm_speculative_inlining_call_indirect, false,
+            "also collect feedback for and speculatively inline call_indirect "
+            "targets (experimental)")
+DEFINE_IMPLICATION(wasm_speculative_inlining_call_indirect,
+                   wasm_speculative_inlining)
 DEFINE_BOOL(trace_wasm_inlining, false, "trace wasm inlining")
 DEFINE_BOOL(trace_wasm_speculative_inlining, false,
             "trace wasm speculative inlining")
@@ -1242,6 +1286,9 @@ DEFINE_BOOL(asm_wasm_lazy_compilation, false,
 DEFINE_IMPLICATION(validate_asm, asm_wasm_lazy_compilation)
 DEFINE_BOOL(wasm_lazy_compilation, true,
             "enable lazy compilation for all wasm modules")
+DEFINE_INT(wasm_lazy_compilation_prefetch, 0,
+           "when compiling a wasm function lazily, compile up to this many of "
+           "its direct callees in the background")
 DEFINE_DEBUG_BOOL(trace_wasm_lazy_compilation, false,
                   "trace lazy compilation of wasm functions")
 DEFINE_BOOL(wasm_lazy_validation, false,
@@ -1303,6 +1350,16 @@ DEFINE_SIZE_T(max_semi_space_size, 0,
               "max size of a semi-space (in MBytes), the new space consists of "
               "two semi-spaces")
 DEFINE_INT(semi_space_growth_factor, 2, "factor by which to grow the new space")
+DEFINE_BOOL(survival_based_new_space_sizing, false,
+            "grow and shrink the new space based on the recent survival rate "
+            "of young generation GCs instead of the bytes survived since the "
+            "last expansion")
+DEFINE_UINT(new_space_grow_survival_percent, 15,
+            "survival rate (in percent) of the last young generation GC above "
+            "which the new space grows with --survival-based-new-space-sizing")
+DEFINE_UINT(new_space_shrink_survival_percent, 3,
+            "survival rate (in percent) below which the new space shrinks with "
+            "--survival-based-new-space-sizing")
 DEFINE_SIZE_T(max_old_space_size, 0, "max size of the old space (in Mbytes)")
 DEFINE_SIZE_T(
     max_heap_size, 0,
@@ -1382,6 +1439,9 @@ DEFINE_BOOL(incremental_marking, true, "use incremental marking")
 DEFINE_BOOL(incremental_marking_wrappers, true,
             "use incremental marking for marking wrappers")
 DEFINE_BOOL(incremental_marking_task, true, "use tasks for incremental marking")
+DEFINE_BOOL(incremental_marking_client_heaps, false,
+            "mark shared objects referenced from client heaps already when "
+            "incremental marking of the shared heap starts")
 DEFINE_INT(incremental_marking_soft_trigger, 0,
            "threshold for starting incremental marking via a task in percent "
            "of available space: limit - size")
@@ -1420,9 +1480,18 @@ DEFINE_INT(
     "max worker number of concurrent marking, 0 for NumberOfWorkerThreads")
 DEFINE_BOOL(concurrent_array_buffer_sweeping, true,
             "concurrently sweep array buffers")
+DEFINE_BOOL(concurrent_array_buffer_freeing, false,
+            "free backing stores of dead array buffers in batches on a "
+            "background thread instead of while sweeping")
 DEFINE_BOOL(stress_concurrent_allocation, false,
             "start background threads that allocate memory")
+DEFINE_BOOL(concurrent_allocator_adaptive_labs, false,
+            "grow the linear allocation buffers of background threads that "
+            "keep allocating between GCs")
 DEFINE_BOOL(parallel_marking, true, "use parallel marking in atomic pause")
+DEFINE_BOOL(parallel_large_array_marking, false,
+            "let several markers scan chunks of the same large array and "
+            "share the remaining range with idle markers")
 DEFINE_INT(ephemeron_fixpoint_iterations, 10,
            "number of fixpoint iterations it takes to switch to linear "
            "ephemeron algorithm")
@@ -1431,6 +1500,12 @@ DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
 DEFINE_NEG_NEG_IMPLICATION(concurrent_sweeping,
                            concurrent_array_buffer_sweeping)
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
+DEFINE_BOOL(numa_aware_evacuation, false,
+            "tag pages with their home NUMA node and let parallel evacuation "
+            "tasks prefer pages on their own node")
+DEFINE_BOOL(compact_old_to_new_remembered_set, false,
+            "keep sparse buckets of the old-to-new remembered set inline "
+            "instead of allocating a bitmap per bucket")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
 DEFINE_BOOL(detect_ineffective_gcs_near_heap_limit, true,
@@ -1491,8 +1566,21 @@ DEFINE_BOOL(move_object_start, true, "enable moving of object starts")
 DEFINE_BOOL(memory_reducer, true, "use memory reducer")
 DEFINE_BOOL(memory_reducer_for_small_heaps, true,
             "use memory reducer for small heaps")
+DEFINE_BOOL(memory_reducer_deep_idle, false,
+            "flush all bytecode and baseline code and compact the heap once "
+            "an isolate stays idle after the memory reducer is done")
+DEFINE_INT(memory_reducer_deep_idle_delay_ms, 5 * 60 * 1000,
+           "idle time after the memory reducer is done before a deep idle GC")
+DEFINE_INT(shared_page_pool_max_pages, 0,
+           "maximum number of uncommitted pages that isolates hand over to a "
+           "process-wide pool on tear down for reuse by other isolates in the "
+           "same pointer compression cage (0 disables the pool)")
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
+DEFINE_BOOL(unified_heap_growing, false,
+            "compute the global heap growing factor from the combined live "
+            "size, marking speed and allocation rate of the V8 and embedder "
+            "heaps")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
 DEFINE_BOOL(allocation_buffer_parking, true, "allocation buffer parking")
 DEFINE_BOOL(compact, true,
@@ -1580,6 +1668,10 @@ DEFINE_BOOL(cppheap_concurrent_marking, false,
 DEFINE_NEG_NEG_IMPLICATION(cppheap_incremental_marking,
                            cppheap_concurrent_marking)
 DEFINE_WEAK_IMPLICATION(concurrent_marking, cppheap_concurrent_marking)
+DEFINE_SIZE_T(cppheap_compaction_budget_kb, 0,
+              "bound the estimated live bytes moved by a single CppHeap "
+              "compaction; fragmented spaces that exceed the budget are "
+              "compacted in subsequent GCs (0 means no bound)")
 
 // assembler-ia32.cc / assembler-arm.cc / assembler-arm64.cc / assembler-x64.cc
 #ifdef V8_ENABLE_DEBUG_CODE
@@ -1738,6 +1830,9 @@ DEFINE_BOOL(trace_deopt, false, "trace deoptimization")
 DEFINE_BOOL(log_deopt, false, "log deoptimization")
 DEFINE_BOOL(trace_deopt_verbose, false, "extra verbose deoptimization tracing")
 DEFINE_IMPLICATION(trace_deopt_verbose, trace_deopt)
+DEFINE_UINT(metrics_jit_sampling_rate, 1,
+            "report about 1 in n deoptimization and optimized compilation "
+            "events to the embedder's metrics recorder (0 disables them)")
 DEFINE_BOOL(trace_file_names, false,
             "include file names in trace-opt/trace-deopt output")
 DEFINE_BOOL(always_turbofan, false, "always try to optimize functions")
@@ -1823,6 +1918,9 @@ DEFINE_INT(heap_snapshot_string_limit, 1024,
            "truncate strings to this length in the heap snapshot")
 DEFINE_BOOL(heap_profiler_show_hidden_objects, false,
             "use 'native' rather than 'hidden' node type in snapshot")
+DEFINE_BOOL(heap_snapshot_concurrent_string_serialization, true,
+            "escape the heap snapshot string table on a background thread "
+            "while nodes and edges are written out")
 #ifdef V8_ENABLE_HEAP_SNAPSHOT_VERIFY
 DEFINE_BOOL(heap_snapshot_verify, false,
             "verify that heap snapshot matches marking visitor behavior")
@@ -1847,6 +1945,9 @@ DEFINE_BOOL_READONLY(fast_map_update, false,
                      "enable fast map update by caching the migration target")
 DEFINE_INT(max_valid_polymorphic_map_count, 4,
            "maximum number of valid maps to track in POLYMORPHIC state")
+DEFINE_INT(max_valid_polymorphic_map_count_same_handler, 4,
+           "maximum number of valid maps to track in POLYMORPHIC state if "
+           "they all share the same handler, e.g. the same field location")
 
 DEFINE_BOOL(native_code_counters, DEBUG_BOOL,
             "generate extra code for manipulating stats counters")
@@ -1967,6 +2068,9 @@ DEFINE_BOOL(
 DEFINE_BOOL(abort_on_far_code_range, false,
             "Abort if code range is allocated further away than 4GB from the"
             ".text section")
+DEFINE_BOOL(code_range_huge_pages, false,
+            "align the code range to 2MB and advise the OS to back it with "
+            "transparent huge pages (Linux only)")
 
 // runtime.cc
 DEFINE_BOOL(runtime_call_stats, false, "report runtime call counts and times")
@@ -1992,6 +2096,7 @@ DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
+DEFINE_BOOL(regexp_simd, true, "use SIMD instructions in regexp jit code")
 DEFINE_BOOL(regexp_interpret_all, false, "interpret all regexp code")
 #ifdef V8_TARGET_BIG_ENDIAN
 #define REGEXP_PEEPHOLE_OPTIMIZATION_BOOL false
@@ -2009,6 +2114,9 @@ DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
             "trace regexp bytecode peephole optimization")
+DEFINE_SIZE_T(regexp_bytecode_cache_size, 0,
+              "memory budget in bytes for the process-wide cache of regexp "
+              "bytecode (0 disables it)")
 DEFINE_BOOL(trace_regexp_bytecodes, false, "trace regexp bytecode execution")
 DEFINE_BOOL(trace_regexp_assembler, false,
             "trace regexp macro assembler calls.")
@@ -2024,6 +2132,14 @@ DEFINE_IMPLICATION(default_to_experimental_regexp_engine,
                    enable_experimental_regexp_engine)
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
+DEFINE_SIZE_T(experimental_regexp_engine_dfa_cache_size, 64 * KB,
+              "memory budget in bytes for the lazy DFA the experimental "
+              "regexp engine uses to rule out matches (0 disables it)")
+DEFINE_BOOL(enable_experimental_regexp_engine_on_nested_quantifiers, false,
+            "run regexps with nested unbounded quantifiers with the "
+            "experimental engine where possible")
+DEFINE_IMPLICATION(enable_experimental_regexp_engine_on_nested_quantifiers,
+                   enable_experimental_regexp_engine)
 
 DEFINE_BOOL(enable_experimental_regexp_engine_on_excessive_backtracks, false,
             "fall back to a breadth-first regexp engine on excessive "
@@ -2114,6 +2230,10 @@ DEFINE_IMPLICATION(minor_mc, separate_gc_phases)
 DEFINE_EXPERIMENTAL_FEATURE(concurrent_minor_mc_marking,
                             "perform young generation marking concurrently")
 DEFINE_NEG_NEG_IMPLICATION(concurrent_marking, concurrent_minor_mc_marking)
+DEFINE_BOOL(concurrent_minor_mc_sweeping, false,
+            "sweep empty new space pages on background threads after a young "
+            "generation mark compact GC instead of in the atomic pause")
+DEFINE_NEG_NEG_IMPLICATION(concurrent_sweeping, concurrent_minor_mc_sweeping)
 
 //
 // Dev shell flags
@@ -2304,7 +2424,6 @@ DEFINE_PERF_PROF_BOOL(
 DEFINE_PERF_PROF_BOOL(
     perf_prof_delete_file,
     "Remove the perf file right after creating it (for testing only).")
-DEFINE_NEG_IMPLICATION(perf_prof, compact_code_space)
 // TODO(v8:8462) Remove implication once perf supports remapping.
 DEFINE_NEG_IMPLICATION(perf_prof, write_protect_code_memory)
 
@@ -2447,6 +2566,7 @@ DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_marking)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_pointer_update)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_scavenge)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_array_buffer_sweeping)
+DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_array_buffer_freeing)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, stress_concurrent_allocation)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, cppheap_concurrent_marking)
 
@@ -741,6 +741,11 @@ void GlobalHandles::ProcessWeakYoungObjects(
 }
 
 void GlobalHandles::InvokeSecondPassPhantomCallbacks() {
+  InvokeSecondPassPhantomCallbacksUntil(base::TimeTicks::Max());
+}
+
+void GlobalHandles::InvokeSecondPassPhantomCallbacksUntil(
+    base::TimeTicks deadline) {
   DCHECK(AllowJavascriptExecution::IsAllowed(isolate()));
   DCHECK(AllowGarbageCollection::IsAllowed());
 
@@ -759,7 +764,15 @@ void GlobalHandles::InvokeSecondPassPhantomCallbacks() {
     {
       TRACE_GC(isolate_->heap()->tracer(),
                GCTracer::Scope::HEAP_EXTERNAL_SECOND_PASS_CALLBACKS);
+      // Only check the clock every few callbacks, as most of them are cheap.
+      static constexpr size_t kCallbacksPerDeadlineCheck = 64;
+      const bool has_deadline = deadline != base::TimeTicks::Max();
+      size_t invoked = 0;
       while (!second_pass_callbacks_.empty()) {
+        if (has_deadline && ++invoked % kCallbacksPerDeadlineCheck == 0 &&
+            base::TimeTicks::Now() >= deadline) {
+          break;
+        }
         auto callback = second_pass_callbacks_.back();
         second_pass_callbacks_.pop_back();
         callback.Invoke(isolate(), PendingPhantomCallback::kSecondPass);
@@ -884,16 +897,27 @@ void GlobalHandles::PostGarbageCollectionProcessing(
     return;
   }
 
-  if (!second_pass_callbacks_task_posted_) {
-    second_pass_callbacks_task_posted_ = true;
-    V8::GetCurrentPlatform()
-        ->GetForegroundTaskRunner(reinterpret_cast<v8::Isolate*>(isolate()))
-        ->PostTask(MakeCancelableTask(isolate(), [this] {
-          DCHECK(second_pass_callbacks_task_posted_);
-          second_pass_callbacks_task_posted_ = false;
-          InvokeSecondPassPhantomCallbacks();
-        }));
-  }
+  PostSecondPassPhantomCallbacksTask();
+}
+
+void GlobalHandles::PostSecondPassPhantomCallbacksTask() {
+  if (second_pass_callbacks_task_posted_) return;
+  second_pass_callbacks_task_posted_ = true;
+  V8::GetCurrentPlatform()
+      ->GetForegroundTaskRunner(reinterpret_cast<v8::Isolate*>(isolate()))
+      ->PostTask(MakeCancelableTask(isolate(), [this] {
+        DCHECK(second_pass_callbacks_task_posted_);
+        second_pass_callbacks_task_posted_ = false;
+        // Run the callbacks in slices so that embedders with many weak
+        // wrappers do not block the main thread in a single task.
+        static constexpr base::TimeDelta kTimeSlice =
+            base::TimeDelta::FromMilliseconds(1);
+        InvokeSecondPassPhantomCallbacksUntil(base::TimeTicks::Now() +
+                                              kTimeSlice);
+        if (!second_pass_callbacks_.empty()) {
+          PostSecondPassPhantomCallbacksTask();
+        }
+      }));
 }
 
 void GlobalHandles::IterateStrongRoots(RootVisitor* v) {
@@ -151,6 +151,11 @@ class V8_EXPORT_PRIVATE GlobalHandles final {
   bool ResetWeakNodeIfDead(Node* node,
                            WeakSlotCallbackWithHeap should_reset_node);
 
+  // Invokes second pass callbacks until they are exhausted or `deadline` has
+  // passed, whichever comes first.
+  void InvokeSecondPassPhantomCallbacksUntil(base::TimeTicks deadline);
+  void PostSecondPassPhantomCallbacksTask();
+
   Isolate* const isolate_;
 
   std::unique_ptr<NodeSpace<Node>> regular_nodes_;
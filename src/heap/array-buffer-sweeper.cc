@@ -91,13 +91,19 @@ struct ArrayBufferSweeper::SweepingJob final {
   void SweepFull();
   ArrayBufferList SweepListFull(ArrayBufferList* list);
 
+  // Dead extensions are either deleted right away or collected in dead_ and
+  // deleted as a batch once the sweeping state has been published.
+  void ReleaseExtension(ArrayBufferExtension* extension);
+
  private:
   CancelableTaskManager::Id id_ = CancelableTaskManager::kInvalidTaskId;
   std::atomic<SweepingState> state_;
   ArrayBufferList young_;
   ArrayBufferList old_;
+  ArrayBufferList dead_;
   const SweepingType type_;
   size_t freed_bytes_{0};
+  const bool batch_release_ = v8_flags.concurrent_array_buffer_freeing;
   TreatAllYoungAsPromoted treat_all_young_as_promoted_;
 
   friend class ArrayBufferSweeper;
@@ -110,6 +116,10 @@ ArrayBufferSweeper::~ArrayBufferSweeper() {
   EnsureFinished();
   ReleaseAll(&old_);
   ReleaseAll(&young_);
+  // Background release tasks have been cancelled or have finished at this
+  // point. Free whatever they did not get to.
+  base::MutexGuard guard(&release_mutex_);
+  ReleaseAll(&release_list_);
 }
 
 void ArrayBufferSweeper::EnsureFinished() {
@@ -169,9 +179,18 @@ void ArrayBufferSweeper::RequestSweep(
               ? GCTracer::Scope::BACKGROUND_YOUNG_ARRAY_BUFFER_SWEEP
               : GCTracer::Scope::BACKGROUND_FULL_ARRAY_BUFFER_SWEEP;
       TRACE_GC_EPOCH(heap_->tracer(), scope_id, ThreadKind::kBackground);
-      base::MutexGuard guard(&sweeping_mutex_);
-      DoSweep();
-      job_finished_.NotifyAll();
+      ArrayBufferList dead;
+      {
+        base::MutexGuard guard(&sweeping_mutex_);
+        DoSweep();
+        // Take the dead extensions before notifying since the main thread may
+        // finalize and destroy the job right after.
+        dead.Append(&job_->dead_);
+        job_finished_.NotifyAll();
+      }
+      // Freeing backing stores may be slow and does not need to block the
+      // main thread waiting for sweeping.
+      ReleaseAll(&dead);
     });
     job_->id_ = task->id();
     V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
@@ -224,6 +243,16 @@ void ArrayBufferSweeper::Finalize() {
   old_.Append(&job_->old_);
   DecrementExternalMemoryCounters(job_->freed_bytes_);
 
+  // Dead extensions are only left in the job if it was swept on the main
+  // thread. Unless memory should be released right away, free their backing
+  // stores in the background.
+  if (v8_flags.concurrent_array_buffer_freeing && !heap_->IsTearingDown() &&
+      !heap_->ShouldReduceMemory()) {
+    ReleaseInBackground(&job_->dead_);
+  } else {
+    ReleaseAll(&job_->dead_);
+  }
+
   local_sweeper_.Finalize();
 
   job_.reset();
@@ -240,6 +269,34 @@ void ArrayBufferSweeper::ReleaseAll(ArrayBufferList* list) {
   *list = ArrayBufferList();
 }
 
+void ArrayBufferSweeper::ReleaseInBackground(ArrayBufferList* list) {
+  if (list->IsEmpty()) return;
+  {
+    base::MutexGuard guard(&release_mutex_);
+    release_list_.Append(list);
+    if (release_task_posted_) return;
+    release_task_posted_ = true;
+  }
+  auto task =
+      MakeCancelableTask(heap_->isolate(), [this] { ReleasePending(); });
+  V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
+}
+
+void ArrayBufferSweeper::ReleasePending() {
+  while (true) {
+    ArrayBufferList batch;
+    {
+      base::MutexGuard guard(&release_mutex_);
+      if (release_list_.IsEmpty()) {
+        release_task_posted_ = false;
+        return;
+      }
+      batch.Append(&release_list_);
+    }
+    ReleaseAll(&batch);
+  }
+}
+
 void ArrayBufferSweeper::Append(JSArrayBuffer object,
                                 ArrayBufferExtension* extension) {
   size_t bytes = extension->accounting_length();
@@ -312,6 +369,15 @@ void ArrayBufferSweeper::SweepingJob::Sweep() {
   state_ = SweepingState::kDone;
 }
 
+void ArrayBufferSweeper::SweepingJob::ReleaseExtension(
+    ArrayBufferExtension* extension) {
+  if (batch_release_) {
+    dead_.Append(extension);
+  } else {
+    delete extension;
+  }
+}
+
 void ArrayBufferSweeper::SweepingJob::SweepFull() {
   DCHECK_EQ(SweepingType::kFull, type_);
   ArrayBufferList promoted = SweepListFull(&young_);
@@ -331,7 +397,7 @@ ArrayBufferList ArrayBufferSweeper::SweepingJob::SweepListFull(
 
     if (!current->IsMarked()) {
       const size_t bytes = current->accounting_length();
-      delete current;
+      ReleaseExtension(current);
       if (bytes) freed_bytes_ += bytes;
     } else {
       current->Unmark();
@@ -357,7 +423,7 @@ void ArrayBufferSweeper::SweepingJob::SweepYoung() {
 
     if (!current->IsYoungMarked()) {
       size_t bytes = current->accounting_length();
-      delete current;
+      ReleaseExtension(current);
       if (bytes) freed_bytes_ += bytes;
     } else if ((treat_all_young_as_promoted_ ==
                 TreatAllYoungAsPromoted::kYes) ||
@@ -94,6 +94,11 @@ class ArrayBufferSweeper final {
 
   void ReleaseAll(ArrayBufferList* extension);
 
+  // Hands dead extensions to a background task that deletes them and thereby
+  // frees their backing stores.
+  void ReleaseInBackground(ArrayBufferList* list);
+  void ReleasePending();
+
   void DoSweep();
 
   Heap* const heap_;
@@ -103,6 +108,11 @@ class ArrayBufferSweeper final {
   ArrayBufferList young_;
   ArrayBufferList old_;
   Sweeper::LocalSweeper local_sweeper_;
+  // Dead extensions waiting to be deleted by a background task. Guarded by
+  // release_mutex_.
+  base::Mutex release_mutex_;
+  ArrayBufferList release_list_;
+  bool release_task_posted_ = false;
 };
 
 }  // namespace internal
@@ -22,6 +22,9 @@ enum SlotCallbackResult { KEEP_SLOT, REMOVE_SLOT };
 // The data structure assumes that the slots are pointer size aligned and
 // splits the valid slot offset range into buckets.
 // Each bucket is a bitmap with a bit corresponding to a single slot offset.
+// Buckets created through InsertCompact() start out inline instead: the bucket
+// pointer itself holds a few sorted slot indices and is only promoted to a
+// bitmap once those no longer fit.
 template <size_t SlotGranularity>
 class BasicSlotSet {
   static constexpr auto kSystemPointerSize = sizeof(void*);
@@ -111,37 +114,19 @@ class BasicSlotSet {
   // or not.
   template <AccessMode access_mode>
   void Insert(size_t slot_offset) {
-    size_t bucket_index;
-    int cell_index, bit_index;
-    SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
-    Bucket* bucket = LoadBucket<access_mode>(bucket_index);
-    if (bucket == nullptr) {
-      bucket = new Bucket;
-      if (!SwapInNewBucket<access_mode>(bucket_index, bucket)) {
-        delete bucket;
-        bucket = LoadBucket<access_mode>(bucket_index);
-      }
-    }
-    // Check that monotonicity is preserved, i.e., once a bucket is set we do
-    // not free it concurrently.
-    DCHECK(bucket != nullptr);
-    DCHECK_EQ(bucket->cells(), LoadBucket<access_mode>(bucket_index)->cells());
-    uint32_t mask = 1u << bit_index;
-    if ((bucket->template LoadCell<access_mode>(cell_index) & mask) == 0) {
-      bucket->template SetCellBits<access_mode>(cell_index, mask);
-    }
+    InsertImpl<access_mode>(slot_offset, false);
+  }
+
+  // Like Insert() but records the slot in an inline bucket if the bucket is
+  // still sparse.
+  template <AccessMode access_mode>
+  void InsertCompact(size_t slot_offset) {
+    InsertImpl<access_mode>(slot_offset, true);
   }
 
   // The slot offset specifies a slot at address page_start_ + slot_offset.
   // Returns true if the set contains the slot.
-  bool Contains(size_t slot_offset) {
-    size_t bucket_index;
-    int cell_index, bit_index;
-    SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
-    Bucket* bucket = LoadBucket(bucket_index);
-    if (bucket == nullptr) return false;
-    return (bucket->LoadCell(cell_index) & (1u << bit_index)) != 0;
-  }
+  bool Contains(size_t slot_offset) { return Lookup(slot_offset); }
 
   // The slot offset specifies a slot at address page_start_ + slot_offset.
   void Remove(size_t slot_offset) {
@@ -149,6 +134,11 @@ class BasicSlotSet {
     int cell_index, bit_index;
     SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
     Bucket* bucket = LoadBucket(bucket_index);
+    if (IsInlineBucket(bucket)) {
+      const int slot_index = SlotInBucket(cell_index, bit_index);
+      bucket = RemoveInlineSlotsIf(
+          bucket_index, [slot_index](int slot) { return slot == slot_index; });
+    }
     if (bucket != nullptr) {
       uint32_t cell = bucket->LoadCell(cell_index);
       uint32_t bit_mask = 1u << bit_index;
@@ -172,9 +162,22 @@ class BasicSlotSet {
     SlotToIndices(end_offset, &end_bucket, &end_cell, &end_bit);
     uint32_t start_mask = (1u << start_bit) - 1;
     uint32_t end_mask = ~((1u << end_bit) - 1);
+    // Remove the slots held by inline buckets first. Afterwards inline buckets
+    // only hold slots outside of the range and are skipped below.
+    const size_t start_slot = start_offset / SlotGranularity;
+    const size_t end_slot = end_offset / SlotGranularity;
+    for (size_t bucket_index = start_bucket;
+         bucket_index <= end_bucket && bucket_index < buckets; bucket_index++) {
+      if (!IsInlineBucket(LoadBucket(bucket_index))) continue;
+      const size_t bucket_start_slot = bucket_index << kBitsPerBucketLog2;
+      RemoveInlineSlotsIf(bucket_index, [=](int slot) {
+        const size_t page_slot = bucket_start_slot + slot;
+        return start_slot <= page_slot && page_slot < end_slot;
+      });
+    }
     Bucket* bucket;
     if (start_bucket == end_bucket && start_cell == end_cell) {
-      bucket = LoadBucket(start_bucket);
+      bucket = LoadRegularBucket(start_bucket);
       if (bucket != nullptr) {
         bucket->ClearCellBits(start_cell, ~(start_mask | end_mask));
       }
@@ -182,7 +185,7 @@ class BasicSlotSet {
     }
     size_t current_bucket = start_bucket;
     int current_cell = start_cell;
-    bucket = LoadBucket(current_bucket);
+    bucket = LoadRegularBucket(current_bucket);
     if (bucket != nullptr) {
       bucket->ClearCellBits(current_cell, ~start_mask);
     }
@@ -203,7 +206,7 @@ class BasicSlotSet {
         ReleaseBucket(current_bucket);
       } else {
         DCHECK(mode == KEEP_EMPTY_BUCKETS);
-        bucket = LoadBucket(current_bucket);
+        bucket = LoadRegularBucket(current_bucket);
         if (bucket != nullptr) {
           ClearBucket(bucket, 0, kCellsPerBucket);
         }
@@ -213,7 +216,7 @@ class BasicSlotSet {
     // All buckets between start_bucket and end_bucket are cleared.
     DCHECK(current_bucket == end_bucket);
     if (current_bucket == buckets) return;
-    bucket = LoadBucket(current_bucket);
+    bucket = LoadRegularBucket(current_bucket);
     DCHECK(current_cell <= end_cell);
     if (bucket == nullptr) return;
     while (current_cell < end_cell) {
@@ -232,6 +235,9 @@ class BasicSlotSet {
     SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
     Bucket* bucket = LoadBucket(bucket_index);
     if (bucket == nullptr) return false;
+    if (IsInlineBucket(bucket)) {
+      return InlineSlots(bucket).Contains(SlotInBucket(cell_index, bit_index));
+    }
     return (bucket->LoadCell(cell_index) & (1u << bit_index)) != 0;
   }
 
@@ -281,6 +287,17 @@ class BasicSlotSet {
   static const int kBitsPerBucket = kCellsPerBucket * kBitsPerCell;
   static const int kBitsPerBucketLog2 = kCellsPerBucketLog2 + kBitsPerCellLog2;
 
+  // Layout of an inline bucket pointer, from the least significant bit: the
+  // tag bit, the number of slots and the slot indices within the bucket.
+  static constexpr uintptr_t kInlineTag = 1;
+  static constexpr int kInlineCountShift = 1;
+  static constexpr int kInlineCountBits = 3;
+  static constexpr int kInlineSlotsShift = kInlineCountShift + kInlineCountBits;
+  static constexpr int kInlineSlotBits = kBitsPerBucketLog2;
+  static constexpr int kMaxInlineSlots =
+      (sizeof(uintptr_t) * 8 - kInlineSlotsShift) / kInlineSlotBits;
+  static_assert(kMaxInlineSlots < (1 << kInlineCountBits));
+
   class Bucket final {
     uint32_t cells_[kCellsPerBucket];
 
@@ -330,6 +347,90 @@ class BasicSlotSet {
     }
   };
 
+  // Decoded contents of an inline bucket. Slots are indices within the bucket
+  // and kept in ascending order.
+  class InlineSlots final {
+   public:
+    InlineSlots() = default;
+    explicit InlineSlots(Bucket* bucket) {
+      const uintptr_t value = reinterpret_cast<uintptr_t>(bucket);
+      if (value == 0) return;
+      DCHECK(IsInlineBucket(bucket));
+      size_ = static_cast<int>((value >> kInlineCountShift) &
+                               ((1 << kInlineCountBits) - 1));
+      DCHECK_LT(0, size_);
+      DCHECK_LE(size_, kMaxInlineSlots);
+      for (int i = 0; i < size_; i++) {
+        slots_[i] = static_cast<int>(
+            (value >> (kInlineSlotsShift + i * kInlineSlotBits)) &
+            ((1 << kInlineSlotBits) - 1));
+      }
+    }
+
+    int size() const { return size_; }
+    int operator[](int index) const {
+      DCHECK_LT(index, size_);
+      return slots_[index];
+    }
+
+    bool Contains(int slot) const {
+      for (int i = 0; i < size_ && slots_[i] <= slot; i++) {
+        if (slots_[i] == slot) return true;
+      }
+      return false;
+    }
+
+    // Returns false if there is no space left. The slot must not be contained
+    // yet.
+    bool Add(int slot) {
+      DCHECK(!Contains(slot));
+      if (size_ == kMaxInlineSlots) return false;
+      int i = size_++;
+      for (; i > 0 && slots_[i - 1] > slot; i--) slots_[i] = slots_[i - 1];
+      slots_[i] = slot;
+      return true;
+    }
+
+    template <typename Predicate>
+    void RemoveIf(Predicate predicate) {
+      int new_size = 0;
+      for (int i = 0; i < size_; i++) {
+        if (!predicate(slots_[i])) slots_[new_size++] = slots_[i];
+      }
+      size_ = new_size;
+    }
+
+    // Empty inline buckets are encoded as nullptr.
+    Bucket* Encode() const {
+      if (size_ == 0) return nullptr;
+      uintptr_t value = kInlineTag | (static_cast<uintptr_t>(size_)
+                                      << kInlineCountShift);
+      for (int i = 0; i < size_; i++) {
+        value |= static_cast<uintptr_t>(slots_[i])
+                 << (kInlineSlotsShift + i * kInlineSlotBits);
+      }
+      return reinterpret_cast<Bucket*>(value);
+    }
+
+    Bucket* ToBucket() const {
+      Bucket* bucket = new Bucket;
+      for (int i = 0; i < size_; i++) {
+        bucket->template SetCellBits<AccessMode::NON_ATOMIC>(
+            slots_[i] >> kBitsPerCellLog2,
+            1u << (slots_[i] & (kBitsPerCell - 1)));
+      }
+      return bucket;
+    }
+
+   private:
+    int size_ = 0;
+    int slots_[kMaxInlineSlots] = {};
+  };
+
+  static bool IsInlineBucket(Bucket* bucket) {
+    return (reinterpret_cast<uintptr_t>(bucket) & kInlineTag) != 0;
+  }
+
  protected:
   template <typename Callback, typename EmptyBucketCallback>
   size_t Iterate(Address chunk_start, size_t start_bucket, size_t end_bucket,
@@ -338,7 +439,14 @@ class BasicSlotSet {
     for (size_t bucket_index = start_bucket; bucket_index < end_bucket;
          bucket_index++) {
       Bucket* bucket = LoadBucket(bucket_index);
-      if (bucket != nullptr) {
+      if (IsInlineBucket(bucket)) {
+        size_t in_bucket_count =
+            IterateInlineBucket(chunk_start, bucket_index, bucket, callback);
+        if (in_bucket_count == 0) {
+          empty_bucket_callback(bucket_index);
+        }
+        new_count += in_bucket_count;
+      } else if (bucket != nullptr) {
         size_t in_bucket_count = 0;
         size_t cell_offset = bucket_index << kBitsPerBucketLog2;
         for (int i = 0; i < kCellsPerBucket; i++, cell_offset += kBitsPerCell) {
@@ -372,8 +480,117 @@ class BasicSlotSet {
     return new_count;
   }
 
+  template <typename Callback>
+  size_t IterateInlineBucket(Address chunk_start, size_t bucket_index,
+                             Bucket* bucket, Callback callback) {
+    InlineSlots slots(bucket);
+    InlineSlots removed;
+    size_t in_bucket_count = 0;
+    const size_t bucket_start_slot = bucket_index << kBitsPerBucketLog2;
+    for (int i = 0; i < slots.size(); i++) {
+      Address slot = (bucket_start_slot + slots[i]) * SlotGranularity;
+      if (callback(chunk_start + slot) == KEEP_SLOT) {
+        ++in_bucket_count;
+      } else {
+        removed.Add(slots[i]);
+      }
+    }
+    if (removed.size() > 0) {
+      Bucket* promoted =
+          RemoveInlineSlotsIf(bucket_index, [&removed](int slot) {
+            return removed.Contains(slot);
+          });
+      if (promoted != nullptr) {
+        // The bucket was promoted concurrently.
+        for (int i = 0; i < removed.size(); i++) {
+          promoted->ClearCellBits(removed[i] >> kBitsPerCellLog2,
+                                  1u << (removed[i] & (kBitsPerCell - 1)));
+        }
+      }
+    }
+    return in_bucket_count;
+  }
+
+  // Removes the slots matching {predicate} from the inline bucket at
+  // {bucket_index}. Returns the regular bucket if the bucket is or became one
+  // concurrently, in which case the caller is responsible for removing the
+  // slots from it, and nullptr otherwise.
+  template <typename Predicate>
+  Bucket* RemoveInlineSlotsIf(size_t bucket_index, Predicate predicate) {
+    Bucket** location = bucket(bucket_index);
+    Bucket* current = LoadBucket(location);
+    while (IsInlineBucket(current)) {
+      InlineSlots slots(current);
+      slots.RemoveIf(predicate);
+      Bucket* desired = slots.Encode();
+      if (desired == current ||
+          CompareAndSwapBucket(location, current, desired) == current) {
+        return nullptr;
+      }
+      current = LoadBucket(location);
+    }
+    return current;
+  }
+
+  template <AccessMode access_mode>
+  void InsertImpl(size_t slot_offset, bool compact) {
+    size_t bucket_index;
+    int cell_index, bit_index;
+    SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
+    Bucket** location = bucket(bucket_index);
+    Bucket* bucket = LoadBucket<access_mode>(location);
+    while (bucket == nullptr || IsInlineBucket(bucket)) {
+      InlineSlots slots(bucket);
+      const int slot_index = SlotInBucket(cell_index, bit_index);
+      if (slots.Contains(slot_index)) return;
+      Bucket* new_bucket = nullptr;
+      Bucket* desired;
+      if ((compact || bucket != nullptr) && slots.Add(slot_index)) {
+        desired = slots.Encode();
+      } else {
+        new_bucket = slots.ToBucket();
+        desired = new_bucket;
+      }
+      if (CompareAndSwapBucket<access_mode>(location, bucket, desired) ==
+          bucket) {
+        if (new_bucket == nullptr) return;
+        bucket = new_bucket;
+        break;
+      }
+      delete new_bucket;
+      bucket = LoadBucket<access_mode>(location);
+    }
+    // Check that monotonicity is preserved, i.e., once a bucket is set we do
+    // not free it concurrently.
+    DCHECK(bucket != nullptr);
+    DCHECK_EQ(bucket->cells(), LoadBucket<access_mode>(bucket_index)->cells());
+    uint32_t mask = 1u << bit_index;
+    if ((bucket->template LoadCell<access_mode>(cell_index) & mask) == 0) {
+      bucket->template SetCellBits<access_mode>(cell_index, mask);
+    }
+  }
+
+  // Turns the bucket at {bucket_index} into a regular one if it is inline or
+  // empty and returns it.
+  template <AccessMode access_mode = AccessMode::ATOMIC>
+  Bucket* EnsureRegularBucket(size_t bucket_index) {
+    Bucket** location = bucket(bucket_index);
+    Bucket* bucket = LoadBucket<access_mode>(location);
+    while (bucket == nullptr || IsInlineBucket(bucket)) {
+      Bucket* new_bucket = InlineSlots(bucket).ToBucket();
+      if (CompareAndSwapBucket<access_mode>(location, bucket, new_bucket) ==
+          bucket) {
+        return new_bucket;
+      }
+      delete new_bucket;
+      bucket = LoadBucket<access_mode>(location);
+    }
+    return bucket;
+  }
+
   bool FreeBucketIfEmpty(size_t bucket_index) {
     Bucket* bucket = LoadBucket<AccessMode::NON_ATOMIC>(bucket_index);
+    if (IsInlineBucket(bucket)) return false;
     if (bucket != nullptr) {
       if (bucket->IsEmpty()) {
         ReleaseBucket<AccessMode::NON_ATOMIC>(bucket_index);
@@ -399,7 +616,7 @@ class BasicSlotSet {
   void ReleaseBucket(size_t bucket_index) {
     Bucket* bucket = LoadBucket<access_mode>(bucket_index);
     StoreBucket<access_mode>(bucket_index, nullptr);
-    delete bucket;
+    if (!IsInlineBucket(bucket)) delete bucket;
   }
 
   template <AccessMode access_mode = AccessMode::ATOMIC>
@@ -414,6 +631,12 @@ class BasicSlotSet {
     return LoadBucket(bucket(bucket_index));
   }
 
+  // Returns nullptr for inline buckets.
+  Bucket* LoadRegularBucket(size_t bucket_index) {
+    Bucket* bucket = LoadBucket(bucket_index);
+    return IsInlineBucket(bucket) ? nullptr : bucket;
+  }
+
   template <AccessMode access_mode = AccessMode::ATOMIC>
   void StoreBucket(Bucket** bucket, Bucket* value) {
     if (access_mode == AccessMode::ATOMIC) {
@@ -428,17 +651,21 @@ class BasicSlotSet {
     StoreBucket(bucket(bucket_index), value);
   }
 
+  // Replaces {expected} with {value} and returns the previous bucket.
   template <AccessMode access_mode = AccessMode::ATOMIC>
-  bool SwapInNewBucket(size_t bucket_index, Bucket* value) {
-    Bucket** b = bucket(bucket_index);
+  Bucket* CompareAndSwapBucket(Bucket** location, Bucket* expected,
+                               Bucket* value) {
     if (access_mode == AccessMode::ATOMIC) {
-      return v8::base::AsAtomicPointer::Release_CompareAndSwap(
-                 b, nullptr, value) == nullptr;
-    } else {
-      DCHECK_NULL(*b);
-      *b = value;
-      return true;
+      return v8::base::AsAtomicPointer::AcquireRelease_CompareAndSwap(
+          location, expected, value);
     }
+    Bucket* previous = *location;
+    if (previous == expected) *location = value;
+    return previous;
+  }
+
+  static int SlotInBucket(int cell_index, int bit_index) {
+    return (cell_index << kBitsPerCellLog2) + bit_index;
   }
 
   // Converts the slot offset into bucket/cell/bit index.
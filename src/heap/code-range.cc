@@ -7,6 +7,7 @@
 #include "src/base/bits.h"
 #include "src/base/lazy-instance.h"
 #include "src/base/once.h"
+#include "src/base/platform/platform.h"
 #include "src/codegen/constants-arch.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
@@ -25,6 +26,9 @@ DEFINE_LAZY_LEAKY_OBJECT_GETTER(CodeRangeAddressHint, GetCodeRangeAddressHint)
 
 void FunctionInStaticBinaryForAddressHint() {}
 
+// Size of a transparent huge page on the architectures that support them.
+constexpr size_t kTransparentHugePageSize = size_t{2} * MB;
+
 }  // anonymous namespace
 
 Address CodeRangeAddressHint::GetAddressHint(size_t code_range_size,
@@ -109,13 +113,23 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
   const size_t kPageSize = MemoryChunk::kPageSize;
   CHECK(IsAligned(kPageSize, page_allocator->AllocatePageSize()));
 
+  // Huge pages can only back fully aligned 2MB granules, so align both the
+  // start and the size of the reservation.
+  const size_t min_base_alignment =
+      v8_flags.code_range_huge_pages
+          ? std::max(kPageSize, kTransparentHugePageSize)
+          : kPageSize;
+  if (v8_flags.code_range_huge_pages) {
+    requested = RoundUp(requested, min_base_alignment);
+  }
+
   // When V8_EXTERNAL_CODE_SPACE_BOOL is enabled the allocatable region must
   // not cross the 4Gb boundary and thus the default compression scheme of
   // truncating the InstructionStream pointers to 32-bits still works. It's
   // achieved by specifying base_alignment parameter.
   const size_t base_alignment = V8_EXTERNAL_CODE_SPACE_BOOL
                                     ? base::bits::RoundUpToPowerOfTwo(requested)
-                                    : kPageSize;
+                                    : min_base_alignment;
 
   DCHECK_IMPLIES(kPlatformRequiresCodeRange,
                  requested <= kMaximalCodeRangeSize);
@@ -151,7 +165,7 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
   if (kShouldTryHarder) {
     // Relax alignment requirement while trying to allocate code range inside
     // preferred region.
-    params.base_alignment = kPageSize;
+    params.base_alignment = min_base_alignment;
 
     // TODO(v8:11880): consider using base::OS::GetFreeMemoryRangesWithin()
     // to avoid attempts that's going to fail anyway.
@@ -162,9 +176,9 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
     // towards the start in steps.
     const int kAllocationTries = 16;
     params.requested_start_hint =
-        RoundDown(preferred_region.end() - requested, kPageSize);
-    Address step =
-        RoundDown(preferred_region.size() / kAllocationTries, kPageSize);
+        RoundDown(preferred_region.end() - requested, min_base_alignment);
+    Address step = RoundDown(preferred_region.size() / kAllocationTries,
+                             min_base_alignment);
     for (int i = 0; i < kAllocationTries; i++) {
       TRACE("=== Attempt #%d, hint=%p\n", i,
             reinterpret_cast<void*>(params.requested_start_hint));
@@ -202,6 +216,23 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
     FATAL("Failed to allocate code range close to the .text section");
   }
 
+#if V8_OS_LINUX
+  if (v8_flags.code_range_huge_pages) {
+    DCHECK(IsAligned(base(), kTransparentHugePageSize));
+    DCHECK(IsAligned(size(), kTransparentHugePageSize));
+    // The advice sticks to the reservation and applies to pages once they get
+    // committed. Freed pages are made inaccessible and discarded in place, see
+    // VirtualMemoryCage::InitReservation, which keeps the advice. Decommitting
+    // them, which maps fresh pages over them, would drop it. Failing to get
+    // huge pages is not fatal.
+    if (!base::OS::AdviseHugePages(reinterpret_cast<void*>(base()), size())) {
+      TRACE("=== Failed to advise huge pages for [%p, %p)\n",
+            reinterpret_cast<void*>(region().begin()),
+            reinterpret_cast<void*>(region().end()));
+    }
+  }
+#endif  // V8_OS_LINUX
+
   // On some platforms, specifically Win64, we need to reserve some pages at
   // the beginning of an executable space. See
   //   https://cs.chromium.org/chromium/src/components/crash/content/
@@ -400,7 +431,12 @@ uint8_t* CodeRange::RemapEmbeddedBuiltins(Isolate* isolate,
     // Builtins should start at a page boundary, see
     // platform-embedded-file-writer-mac.cc. If it's not the case (e.g. if the
     // embedded builtins are not coming from the binary), fall back to copying.
-    if (IsAligned(reinterpret_cast<uintptr_t>(embedded_blob_code),
+    //
+    // Remapping replaces the advised anonymous mapping with a file-backed one,
+    // which drops the huge page advice. Copy the builtins instead, so that
+    // they are backed by huge pages like the rest of the code range.
+    if (!v8_flags.code_range_huge_pages &&
+        IsAligned(reinterpret_cast<uintptr_t>(embedded_blob_code),
                   kCommitPageSize)) {
       bool ok = base::OS::RemapPages(embedded_blob_code, code_size,
                                      embedded_blob_code_copy,
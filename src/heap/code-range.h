@@ -97,9 +97,10 @@ class CodeRange final : public VirtualMemoryCage {
     return embedded_blob_code_copy_.load(std::memory_order_acquire);
   }
 
-  bool InitReservation(v8::PageAllocator* page_allocator, size_t requested);
+  V8_EXPORT_PRIVATE bool InitReservation(v8::PageAllocator* page_allocator,
+                                         size_t requested);
 
-  void Free();
+  V8_EXPORT_PRIVATE void Free();
 
   // Remap and copy the embedded builtins into this CodeRange. This method is
   // idempotent and only performs the copy once. This property is so that this
@@ -102,6 +102,7 @@ void ConcurrentAllocator::FreeLinearAllocationArea() {
 
   MakeLabIterable();
   ResetLab();
+  max_lab_size_ = kMaxLabSize;
 }
 
 void ConcurrentAllocator::MakeLinearAllocationAreaIterable() {
@@ -157,12 +158,19 @@ AllocationResult ConcurrentAllocator::AllocateInLabSlow(
 }
 
 bool ConcurrentAllocator::AllocateLab(AllocationOrigin origin) {
-  auto result = AllocateFromSpaceFreeList(kMinLabSize, kMaxLabSize, origin);
+  const size_t max_lab_size = max_lab_size_;
+  auto result = AllocateFromSpaceFreeList(kMinLabSize, max_lab_size, origin);
   if (!result) return false;
 
   owning_heap()->StartIncrementalMarkingIfAllocationLimitIsReachedBackground();
 
   FreeLinearAllocationArea();
+  if (v8_flags.concurrent_allocator_adaptive_labs) {
+    // Threads that keep refilling their LAB get larger LABs, which reduces
+    // the number of times they need to take the space mutex.
+    max_lab_size_ = std::min(2 * max_lab_size,
+                             static_cast<size_t>(kMaxAdaptiveLabSize));
+  }
 
   Address lab_start = result->first;
   Address lab_end = lab_start + result->second;
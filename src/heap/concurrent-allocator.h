@@ -42,6 +42,8 @@ class ConcurrentAllocator {
 
   static constexpr int kMinLabSize = 4 * KB;
   static constexpr int kMaxLabSize = 32 * KB;
+  // Upper bound for LABs with --concurrent-allocator-adaptive-labs.
+  static constexpr int kMaxAdaptiveLabSize = 128 * KB;
   static constexpr int kMaxLabObjectSize = 2 * KB;
 
   ConcurrentAllocator(LocalHeap* local_heap, PagedSpace* space,
@@ -56,6 +58,8 @@ class ConcurrentAllocator {
   void MarkLinearAllocationAreaBlack();
   void UnmarkLinearAllocationArea();
 
+  size_t max_lab_size_for_testing() const { return max_lab_size_; }
+
  private:
   static_assert(
       kMinLabSize > kMaxLabObjectSize,
@@ -102,6 +106,9 @@ class ConcurrentAllocator {
   PagedSpace* const space_;
   Heap* const owning_heap_;
   LinearAllocationArea lab_;
+  // Maximum size of the next LAB. Doubles with every LAB refill and is reset
+  // whenever the LAB is given up, e.g., for a GC.
+  size_t max_lab_size_ = kMaxLabSize;
   const Context context_;
 };
 
@@ -0,0 +1,129 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/context-memory-sampler.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "src/base/ieee754.h"
+#include "src/base/utils/random-number-generator.h"
+#include "src/execution/isolate-inl.h"
+#include "src/handles/global-handles-inl.h"
+#include "src/heap/heap-inl.h"
+
+namespace v8 {
+namespace internal {
+
+// Same sampling process as SamplingHeapProfiler: the distance between samples
+// is exponentially distributed with an average of |rate_| bytes.
+intptr_t ContextMemorySampler::Observer::GetNextStepSize() {
+  if (v8_flags.sampling_heap_profiler_suppress_randomness) {
+    return static_cast<intptr_t>(rate_);
+  }
+  double u = random_->NextDouble();
+  double next = (-base::ieee754::log(u)) * rate_;
+  return next < kTaggedSize
+             ? kTaggedSize
+             : (next > INT_MAX ? INT_MAX : static_cast<intptr_t>(next));
+}
+
+ContextMemorySampler::ContextMemorySampler(Heap* heap, uint64_t rate)
+    : isolate_(Isolate::FromHeap(heap)),
+      heap_(heap),
+      rate_(rate),
+      allocation_observer_(static_cast<intptr_t>(rate), rate, this,
+                           isolate_->random_number_generator()) {
+  CHECK_GT(rate_, 0u);
+  heap_->AddAllocationObserversToAllSpaces(&allocation_observer_,
+                                           &allocation_observer_);
+}
+
+ContextMemorySampler::~ContextMemorySampler() {
+  heap_->RemoveAllocationObserversFromAllSpaces(&allocation_observer_,
+                                                &allocation_observer_);
+  for (auto& pair : samples_) {
+    GlobalHandles::Destroy(pair.first->location);
+  }
+  for (auto& entry : entries_) {
+    if (entry->location) GlobalHandles::Destroy(entry->location);
+  }
+}
+
+size_t ContextMemorySampler::SampledBytes(NativeContext context) const {
+  for (const auto& entry : entries_) {
+    if (entry->location && Object(*entry->location) == context) {
+      return entry->bytes;
+    }
+  }
+  return 0;
+}
+
+void ContextMemorySampler::SampleObject(Address soon_object, size_t size) {
+  DisallowGarbageCollection no_gc;
+  DCHECK_EQ(heap_->gc_state(), Heap::NOT_IN_GC);
+
+  // Allocations outside of any context, e.g. during bootstrapping, are not
+  // attributed.
+  if (isolate_->context().is_null()) return;
+  ContextEntry* entry = FindOrAddEntry(isolate_->context().native_context());
+
+  // An allocation of size S is sampled with probability 1 - exp(-S/R), so
+  // scaling by the inverse keeps the estimate unbiased for any object size.
+  double scale = 1.0 / (1.0 - std::exp(-static_cast<double>(size) / rate_));
+  size_t bytes = static_cast<size_t>(size * scale + 0.5);
+
+  HeapObject heap_object = HeapObject::FromAddress(soon_object);
+  auto sample = std::make_unique<Sample>(Sample{
+      isolate_->global_handles()->Create(heap_object).location(), entry, bytes,
+      this});
+  GlobalHandles::MakeWeak(sample->location, sample.get(), OnWeakCallback,
+                          v8::WeakCallbackType::kParameter);
+  entry->bytes += bytes;
+  entry->samples++;
+  total_bytes_ += bytes;
+  samples_.emplace(sample.get(), std::move(sample));
+}
+
+ContextMemorySampler::ContextEntry* ContextMemorySampler::FindOrAddEntry(
+    NativeContext context) {
+  // Drop entries of dead contexts once their last sample is gone.
+  entries_.erase(
+      std::remove_if(entries_.begin(), entries_.end(),
+                     [](const std::unique_ptr<ContextEntry>& entry) {
+                       return !entry->location && entry->samples == 0;
+                     }),
+      entries_.end());
+  for (auto& entry : entries_) {
+    if (entry->location && Object(*entry->location) == context) {
+      return entry.get();
+    }
+  }
+  auto entry = std::make_unique<ContextEntry>();
+  entry->location = isolate_->global_handles()->Create(context).location();
+  GlobalHandles::MakeWeak(&entry->location);
+  entries_.push_back(std::move(entry));
+  return entries_.back().get();
+}
+
+void ContextMemorySampler::RemoveSample(Sample* sample) {
+  ContextEntry* entry = sample->entry;
+  DCHECK_GE(entry->bytes, sample->bytes);
+  DCHECK_GT(entry->samples, 0);
+  entry->bytes -= sample->bytes;
+  entry->samples--;
+  total_bytes_ -= sample->bytes;
+  GlobalHandles::Destroy(sample->location);
+  samples_.erase(sample);
+}
+
+// static
+void ContextMemorySampler::OnWeakCallback(const WeakCallbackInfo<void>& data) {
+  Sample* sample = reinterpret_cast<Sample*>(data.GetParameter());
+  sample->sampler->RemoveSample(sample);
+  // sample is deleted because its unique ptr was erased from samples_.
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,100 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_CONTEXT_MEMORY_SAMPLER_H_
+#define V8_HEAP_CONTEXT_MEMORY_SAMPLER_H_
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "include/v8-weak-callback-info.h"
+#include "src/common/globals.h"
+#include "src/heap/allocation-observer.h"
+#include "src/objects/contexts.h"
+
+namespace v8 {
+
+namespace base {
+class RandomNumberGenerator;
+}  // namespace base
+
+namespace internal {
+
+class Heap;
+
+// Attributes a Poisson sample of allocations to the native context that is
+// current at the time of allocation. Every sample holds a weak global handle
+// to the sampled object and is dropped when the GC reclaims that object, so
+// the per-context numbers estimate live memory without adding marking work
+// the way MemoryMeasurement does.
+class ContextMemorySampler final {
+ public:
+  ContextMemorySampler(Heap* heap, uint64_t rate);
+  ~ContextMemorySampler();
+  ContextMemorySampler(const ContextMemorySampler&) = delete;
+  ContextMemorySampler& operator=(const ContextMemorySampler&) = delete;
+
+  // Returns the estimated number of live bytes that were allocated while
+  // |context| was the current native context.
+  size_t SampledBytes(NativeContext context) const;
+
+  // Returns the estimated number of live bytes over all contexts.
+  size_t TotalSampledBytes() const { return total_bytes_; }
+
+ private:
+  struct ContextEntry {
+    // Weak global handle that is cleared when the context dies.
+    Address* location = nullptr;
+    size_t bytes = 0;
+    size_t samples = 0;
+  };
+
+  struct Sample {
+    Address* location;
+    ContextEntry* entry;
+    size_t bytes;
+    ContextMemorySampler* sampler;
+  };
+
+  class Observer final : public AllocationObserver {
+   public:
+    Observer(intptr_t step_size, uint64_t rate, ContextMemorySampler* sampler,
+             base::RandomNumberGenerator* random)
+        : AllocationObserver(step_size),
+          sampler_(sampler),
+          random_(random),
+          rate_(rate) {}
+
+   protected:
+    void Step(int bytes_allocated, Address soon_object, size_t size) override {
+      if (soon_object) sampler_->SampleObject(soon_object, size);
+    }
+
+    intptr_t GetNextStepSize() override;
+
+   private:
+    ContextMemorySampler* const sampler_;
+    base::RandomNumberGenerator* const random_;
+    uint64_t const rate_;
+  };
+
+  void SampleObject(Address soon_object, size_t size);
+  ContextEntry* FindOrAddEntry(NativeContext context);
+  void RemoveSample(Sample* sample);
+  static void OnWeakCallback(const WeakCallbackInfo<void>& data);
+
+  Isolate* const isolate_;
+  Heap* const heap_;
+  const uint64_t rate_;
+  Observer allocation_observer_;
+  std::vector<std::unique_ptr<ContextEntry>> entries_;
+  std::unordered_map<Sample*, std::unique_ptr<Sample>> samples_;
+  size_t total_bytes_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_CONTEXT_MEMORY_SAMPLER_H_
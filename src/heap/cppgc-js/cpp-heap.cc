@@ -628,6 +628,8 @@ void CppHeap::ReduceGCCapabilitiesFromFlags() {
   sweeping_support_ = v8_flags.single_threaded_gc
                           ? CppHeap::SweepingType::kIncremental
                           : CppHeap::SweepingType::kIncrementalAndConcurrent;
+
+  compactor_.set_compaction_budget(v8_flags.cppheap_compaction_budget_kb * KB);
 }
 
 void CppHeap::InitializeTracing(CollectionType collection_type,
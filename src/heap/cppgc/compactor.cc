@@ -4,6 +4,7 @@
 
 #include "src/heap/cppgc/compactor.h"
 
+#include <algorithm>
 #include <map>
 #include <numeric>
 #include <unordered_map>
@@ -39,7 +40,9 @@ class MovableReferences final {
   using MovableReference = CompactionWorklists::MovableReference;
 
  public:
-  explicit MovableReferences(HeapBase& heap) : heap_(heap) {}
+  MovableReferences(HeapBase& heap,
+                    const std::vector<NormalPageSpace*>& compacted_spaces)
+      : heap_(heap), compacted_spaces_(compacted_spaces) {}
 
   // Adds a slot for compaction. Filters slots in dead objects.
   void AddOrFilter(MovableReference*);
@@ -55,7 +58,15 @@ class MovableReferences final {
   void UpdateCallbacks();
 
  private:
+  bool IsCompacted(const BaseSpace& space) const {
+    return std::find(compacted_spaces_.begin(), compacted_spaces_.end(),
+                     &space) != compacted_spaces_.end();
+  }
+
   HeapBase& heap_;
+  // Spaces that are compacted in this cycle. Only objects in these spaces are
+  // moved.
+  const std::vector<NormalPageSpace*>& compacted_spaces_;
 
   // Map from movable reference (value) to its slot. Upon moving an object its
   // slot pointing to it requires updating. Movable reference should currently
@@ -103,7 +114,9 @@ void MovableReferences::AddOrFilter(MovableReference* slot) {
   // The following cases are not compacted and do not require recording:
   // - Compactable object on large pages.
   // - Compactable object on non-compactable spaces.
-  if (value_page->is_large() || !value_page->space().is_compactable()) return;
+  // - Compactable object on compactable spaces that are not compacted in this
+  //   cycle.
+  if (value_page->is_large() || !IsCompacted(value_page->space())) return;
 
   // Slots must reside in and values must point to live objects at this
   // point. |value| usually points to a separate object but can also point
@@ -124,7 +137,7 @@ void MovableReferences::AddOrFilter(MovableReference* slot) {
   movable_references_.emplace(value, slot);
 
   // Check whether the slot itself resides on a page that is compacted.
-  if (V8_LIKELY(!slot_page->space().is_compactable())) return;
+  if (V8_LIKELY(!IsCompacted(slot_page->space()))) return;
 
   CHECK_EQ(interior_movable_references_.end(),
            interior_movable_references_.find(slot));
@@ -442,6 +455,14 @@ size_t UpdateHeapResidency(const std::vector<NormalPageSpace*>& spaces) {
                          });
 }
 
+// Estimates the bytes that are moved when compacting |space|. The free list
+// still reflects the previous cycle which is good enough as estimate.
+size_t EstimateCompactionCost(const NormalPageSpace* space) {
+  const size_t capacity = space->size() * NormalPage::PayloadSize();
+  const size_t free_size = space->free_list().Size();
+  return capacity > free_size ? capacity - free_size : 0u;
+}
+
 }  // namespace
 
 Compactor::Compactor(RawHeap& heap) : heap_(heap) {
@@ -472,6 +493,33 @@ bool Compactor::ShouldCompact(GCConfig::MarkingType marking_type,
   return free_list_size > kFreeListSizeThreshold;
 }
 
+void Compactor::SelectSpacesToCompact() {
+  spaces_to_compact_.clear();
+  for (NormalPageSpace* space : compactable_spaces_) {
+    if (space->size()) spaces_to_compact_.push_back(space);
+  }
+  if (!compaction_budget_) return;
+
+  // Compact the most fragmented spaces first. Each space is compacted as a
+  // whole, so at least one space is always compacted to make progress.
+  std::stable_sort(spaces_to_compact_.begin(), spaces_to_compact_.end(),
+                   [](const NormalPageSpace* a, const NormalPageSpace* b) {
+                     return a->free_list().Size() > b->free_list().Size();
+                   });
+  size_t cost = 0;
+  auto it = spaces_to_compact_.begin();
+  for (; it != spaces_to_compact_.end(); ++it) {
+    cost += EstimateCompactionCost(*it);
+    if (cost > compaction_budget_ && it != spaces_to_compact_.begin()) break;
+  }
+  spaces_to_compact_.erase(it, spaces_to_compact_.end());
+}
+
+bool Compactor::WasCompacted(const NormalPageSpace& space) const {
+  return std::find(spaces_to_compact_.begin(), spaces_to_compact_.end(),
+                   &space) != spaces_to_compact_.end();
+}
+
 void Compactor::InitializeIfShouldCompact(GCConfig::MarkingType marking_type,
                                           StackState stack_state) {
   DCHECK(!is_enabled_);
@@ -479,6 +527,7 @@ void Compactor::InitializeIfShouldCompact(GCConfig::MarkingType marking_type,
   if (!ShouldCompact(marking_type, stack_state)) return;
 
   compaction_worklists_ = std::make_unique<CompactionWorklists>();
+  spaces_to_compact_.clear();
 
   is_enabled_ = true;
   is_cancelled_ = false;
@@ -502,7 +551,8 @@ Compactor::CompactableSpaceHandling Compactor::CompactSpacesIfEnabled() {
   StatsCollector::EnabledScope stats_scope(heap_.heap()->stats_collector(),
                                            StatsCollector::kAtomicCompact);
 
-  MovableReferences movable_references(*heap_.heap());
+  SelectSpacesToCompact();
+  MovableReferences movable_references(*heap_.heap(), spaces_to_compact_);
 
   CompactionWorklists::MovableReferencesWorklist::Local local(
       *compaction_worklists_->movable_slots_worklist());
@@ -514,7 +564,7 @@ Compactor::CompactableSpaceHandling Compactor::CompactSpacesIfEnabled() {
 
   const bool young_gen_enabled = heap_.heap()->generational_gc_supported();
 
-  for (NormalPageSpace* space : compactable_spaces_) {
+  for (NormalPageSpace* space : spaces_to_compact_) {
     CompactSpace(
         space, movable_references,
         young_gen_enabled ? StickyBits::kEnabled : StickyBits::kDisabled);
@@ -34,18 +34,33 @@ class V8_EXPORT_PRIVATE Compactor final {
     return compaction_worklists_.get();
   }
 
+  // Bounds the estimated amount of live bytes that are moved in a single
+  // atomic pause. Spaces are compacted in order of their fragmentation until
+  // the budget is exhausted; remaining spaces are swept and become candidates
+  // for the next compacting GC. A budget of 0 compacts all compactable spaces.
+  void set_compaction_budget(size_t bytes) { compaction_budget_ = bytes; }
+
+  // Returns whether |space| was compacted by the last call to
+  // CompactSpacesIfEnabled() and must thus be ignored by the Sweeper.
+  bool WasCompacted(const NormalPageSpace& space) const;
+
   void EnableForNextGCForTesting();
   bool IsEnabledForTesting() const { return is_enabled_; }
 
  private:
   bool ShouldCompact(GCConfig::MarkingType, StackState) const;
+  void SelectSpacesToCompact();
 
   RawHeap& heap_;
   // Compactor does not own the compactable spaces. The heap owns all spaces.
   std::vector<NormalPageSpace*> compactable_spaces_;
+  // Subset of |compactable_spaces_| that is compacted in the current cycle.
+  std::vector<NormalPageSpace*> spaces_to_compact_;
 
   std::unique_ptr<CompactionWorklists> compaction_worklists_;
 
+  size_t compaction_budget_ = 0;
+
   bool is_enabled_ = false;
   bool is_cancelled_ = false;
   bool enable_for_next_gc_for_testing_ = false;
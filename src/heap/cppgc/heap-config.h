@@ -33,6 +33,7 @@ struct MarkingConfig {
 
 struct SweepingConfig {
   using SweepingType = cppgc::Heap::SweepingType;
+  // kIgnore skips spaces that have been compacted in the current cycle.
   enum class CompactableSpaceHandling { kSweep, kIgnore };
   enum class FreeMemoryHandling { kDoNotDiscard, kDiscardWherePossible };
 
@@ -757,7 +757,8 @@ class PrepareForSweepVisitor final
  protected:
   bool VisitNormalPageSpace(NormalPageSpace& space) {
     if ((compactable_space_handling_ == CompactableSpaceHandling::kIgnore) &&
-        space.is_compactable())
+        space.is_compactable() &&
+        space.raw_heap()->heap()->compactor().WasCompacted(space))
       return true;
     DCHECK(!space.linear_allocation_buffer().size());
     space.free_list().Clear();
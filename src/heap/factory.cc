@@ -501,7 +501,7 @@ Handle<FeedbackVector> Factory::NewFeedbackVector(
   vector.set_length(length);
   vector.set_invocation_count(0);
   vector.set_profiler_ticks(0);
-  vector.set_placeholder0(0);
+  vector.set_deopt_count(0);
   vector.reset_osr_state();
   vector.reset_flags();
   vector.set_log_next_execution(v8_flags.log_function_events);
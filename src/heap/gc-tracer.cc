@@ -1408,6 +1408,14 @@ void GCTracer::RecordGCPhasesHistograms(RecordGCPhasesInfo::Mode mode) {
         static_cast<int>(current_.scopes[Scope::SCAVENGER_SCAVENGE_PARALLEL]));
     counters->gc_scavenger_scavenge_roots()->AddSample(
         static_cast<int>(current_.scopes[Scope::SCAVENGER_SCAVENGE_ROOTS]));
+    counters->gc_scavenger_scavenge_update_refs()->AddSample(static_cast<int>(
+        current_.scopes[Scope::SCAVENGER_SCAVENGE_UPDATE_REFS]));
+    counters->gc_scavenger_scavenge_weak()->AddSample(
+        static_cast<int>(current_.scopes[Scope::SCAVENGER_SCAVENGE_WEAK]));
+    counters->gc_scavenger_scavenge_finalize()->AddSample(
+        static_cast<int>(current_.scopes[Scope::SCAVENGER_SCAVENGE_FINALIZE]));
+    counters->gc_scavenger_free_remembered_set()->AddSample(static_cast<int>(
+        current_.scopes[Scope::SCAVENGER_FREE_REMEMBERED_SET]));
   }
 }
 
@@ -0,0 +1,100 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/heap-budget.h"
+
+#include <memory>
+
+#include "src/base/logging.h"
+
+namespace v8 {
+
+// static
+std::shared_ptr<HeapBudget> HeapBudget::New(size_t budget_in_bytes) {
+  return std::make_shared<internal::SharedHeapBudget>(budget_in_bytes);
+}
+
+void HeapBudget::SetBudgetInBytes(size_t budget_in_bytes) {
+  internal::SharedHeapBudget::From(this)->SetBudgetInBytes(budget_in_bytes);
+}
+
+size_t HeapBudget::GetBudgetInBytes() const {
+  return internal::SharedHeapBudget::From(this)->GetBudgetInBytes();
+}
+
+size_t HeapBudget::GetUsedBytes() const {
+  return internal::SharedHeapBudget::From(this)->GetUsedBytes();
+}
+
+namespace internal {
+
+void SharedHeapBudget::SetBudgetInBytes(size_t budget_in_bytes) {
+  base::MutexGuard guard(&mutex_);
+  budget_in_bytes_ = budget_in_bytes;
+}
+
+size_t SharedHeapBudget::GetBudgetInBytes() const {
+  base::MutexGuard guard(&mutex_);
+  return budget_in_bytes_;
+}
+
+size_t SharedHeapBudget::GetUsedBytes() const {
+  base::MutexGuard guard(&mutex_);
+  return UsedBytesLocked();
+}
+
+size_t SharedHeapBudget::UsedBytesLocked() const {
+  size_t used = 0;
+  for (const auto& entry : demands_) {
+    used += entry.second.old_generation_size;
+  }
+  return used;
+}
+
+void SharedHeapBudget::AddHeap(Heap* heap) {
+  base::MutexGuard guard(&mutex_);
+  bool inserted = demands_.emplace(heap, Demand{}).second;
+  USE(inserted);
+  DCHECK(inserted);
+}
+
+void SharedHeapBudget::RemoveHeap(Heap* heap) {
+  base::MutexGuard guard(&mutex_);
+  size_t removed = demands_.erase(heap);
+  USE(removed);
+  DCHECK_EQ(1u, removed);
+}
+
+size_t SharedHeapBudget::UpdateAndComputeLimit(Heap* heap,
+                                               size_t old_generation_size,
+                                               double allocation_rate) {
+  base::MutexGuard guard(&mutex_);
+  auto it = demands_.find(heap);
+  DCHECK(it != demands_.end());
+  Demand& demand = it->second;
+  demand.old_generation_size = old_generation_size;
+  demand.allocation_rate =
+      demand.allocation_rate == 0.0
+          ? allocation_rate
+          : kAllocationRateSmoothingFactor * allocation_rate +
+                (1 - kAllocationRateSmoothingFactor) * demand.allocation_rate;
+
+  const size_t used = UsedBytesLocked();
+  if (used >= budget_in_bytes_) return old_generation_size;
+  const size_t headroom = budget_in_bytes_ - used;
+
+  double total_rate = 0.0;
+  for (const auto& entry : demands_) {
+    total_rate += entry.second.allocation_rate;
+  }
+  // Without allocation rate information all heaps get an equal share.
+  const double share = total_rate > 0.0
+                           ? demand.allocation_rate / total_rate
+                           : 1.0 / static_cast<double>(demands_.size());
+  return old_generation_size +
+         static_cast<size_t>(static_cast<double>(headroom) * share);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,68 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_HEAP_BUDGET_H_
+#define V8_HEAP_HEAP_BUDGET_H_
+
+#include <unordered_map>
+
+#include "include/v8-isolate.h"
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+
+// Process-wide memory budget shared by several heaps. Heaps report their old
+// generation size and allocation rate after every full GC, and the budget
+// hands out the remaining headroom in proportion to the smoothed allocation
+// rates. All methods are thread-safe.
+class V8_EXPORT_PRIVATE SharedHeapBudget final : public v8::HeapBudget {
+ public:
+  // Weight of the latest allocation rate sample in the exponential moving
+  // average that is used as a forecast of the future allocation rate.
+  static constexpr double kAllocationRateSmoothingFactor = 0.5;
+
+  static SharedHeapBudget* From(v8::HeapBudget* budget) {
+    return static_cast<SharedHeapBudget*>(budget);
+  }
+  static const SharedHeapBudget* From(const v8::HeapBudget* budget) {
+    return static_cast<const SharedHeapBudget*>(budget);
+  }
+
+  explicit SharedHeapBudget(size_t budget_in_bytes)
+      : budget_in_bytes_(budget_in_bytes) {}
+
+  void SetBudgetInBytes(size_t budget_in_bytes);
+  size_t GetBudgetInBytes() const;
+  size_t GetUsedBytes() const;
+
+  void AddHeap(Heap* heap);
+  void RemoveHeap(Heap* heap);
+
+  // Records the current old generation size and allocation rate (in
+  // bytes/ms) of |heap| and returns the old generation allocation limit that
+  // corresponds to the heap's share of the budget.
+  size_t UpdateAndComputeLimit(Heap* heap, size_t old_generation_size,
+                               double allocation_rate);
+
+ private:
+  struct Demand {
+    size_t old_generation_size = 0;
+    double allocation_rate = 0.0;
+  };
+
+  size_t UsedBytesLocked() const;
+
+  mutable base::Mutex mutex_;
+  size_t budget_in_bytes_;
+  std::unordered_map<Heap*, Demand> demands_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_HEAP_BUDGET_H_
@@ -27,6 +27,22 @@ double MemoryController<Trait>::GrowingFactor(Heap* heap, size_t max_heap_size,
   return factor;
 }
 
+template <typename Trait>
+double MemoryController<Trait>::CombinedGcSpeed(size_t v8_size,
+                                                double v8_gc_speed,
+                                                size_t embedder_size,
+                                                double embedder_gc_speed) {
+  DCHECK_LT(0, v8_gc_speed);
+  DCHECK_LT(0, embedder_gc_speed);
+  // Both heaps are marked within the same unified GC cycle, so the time to
+  // mark the global heap is the sum of the time needed for either heap.
+  const double marking_time = static_cast<double>(v8_size) / v8_gc_speed +
+                              static_cast<double>(embedder_size) /
+                                  embedder_gc_speed;
+  if (marking_time == 0) return 0;
+  return static_cast<double>(v8_size + embedder_size) / marking_time;
+}
+
 template <typename Trait>
 double MemoryController<Trait>::MaxGrowingFactor(size_t max_heap_size) {
   constexpr double kMinSmallFactor = 1.3;
@@ -41,6 +41,12 @@ class V8_EXPORT_PRIVATE MemoryController : public AllStatic {
   static double GrowingFactor(Heap* heap, size_t max_heap_size, double gc_speed,
                               double mutator_speed);
 
+  // Computes the speed of marking two heaps in the same cycle from their live
+  // sizes and individual marking speeds. Returns 0 if there is nothing to
+  // mark.
+  static double CombinedGcSpeed(size_t v8_size, double v8_gc_speed,
+                                size_t embedder_size, double embedder_gc_speed);
+
   static size_t CalculateAllocationLimit(Heap* heap, size_t current_size,
                                          size_t min_size, size_t max_size,
                                          size_t new_space_capacity,
@@ -95,6 +95,12 @@ base::EnumSet<CodeFlushMode> Heap::GetCodeFlushMode(Isolate* isolate) {
     code_flush_mode.Add(CodeFlushMode::kStressFlushCode);
   }
 
+  if (isolate->heap()->IsDeepIdleGC() && !code_flush_mode.empty()) {
+    // Code that survived a long idle period is not worth keeping, whatever
+    // its age.
+    code_flush_mode.Add(CodeFlushMode::kStressFlushCode);
+  }
+
   return code_flush_mode;
 }
 
@@ -49,6 +49,7 @@
 #include "src/heap/combined-heap.h"
 #include "src/heap/concurrent-allocator.h"
 #include "src/heap/concurrent-marking.h"
+#include "src/heap/context-memory-sampler.h"
 #include "src/heap/cppgc-js/cpp-heap.h"
 #include "src/heap/evacuation-verifier-inl.h"
 #include "src/heap/finalization-registry-cleanup-task.h"
@@ -56,6 +57,7 @@
 #include "src/heap/gc-tracer-inl.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-allocator.h"
+#include "src/heap/heap-budget.h"
 #include "src/heap/heap-controller.h"
 #include "src/heap/heap-layout-tracer.h"
 #include "src/heap/heap-write-barrier-inl.h"
@@ -2476,17 +2478,55 @@ void Heap::RecomputeLimits(GarbageCollector collector) {
   global_growing_factor = std::max(v8_growing_factor, embedder_growing_factor);
 
   size_t old_gen_size = OldGenerationSizeOfObjects();
+  if (v8_flags.unified_heap_growing && v8_gc_speed > 0 &&
+      embedder_growing_factor > 0) {
+    // Growing the global limit based on the combined numbers avoids scheduling
+    // GCs for one heap while ignoring how much the other heap allocates.
+    const double combined_gc_speed =
+        MemoryController<GlobalMemoryTrait>::CombinedGcSpeed(
+            old_gen_size, v8_gc_speed, EmbedderSizeOfObjects(),
+            embedder_gc_speed);
+    if (combined_gc_speed > 0) {
+      const double combined_mutator_speed = v8_mutator_speed + embedder_speed;
+      global_growing_factor =
+          MemoryController<GlobalMemoryTrait>::GrowingFactor(
+              this, max_global_memory_size_, combined_gc_speed,
+              combined_mutator_speed);
+    }
+  }
+
   size_t new_space_capacity = NewSpaceCapacity();
   HeapGrowingMode mode = CurrentHeapGrowingMode();
 
   if (collector == GarbageCollector::MARK_COMPACTOR) {
     external_memory_.ResetAfterGC();
 
-    set_old_generation_allocation_limit(
+    size_t new_old_generation_limit =
         MemoryController<V8HeapTrait>::CalculateAllocationLimit(
             this, old_gen_size, min_old_generation_size_,
             max_old_generation_size(), new_space_capacity, v8_growing_factor,
-            mode));
+            mode);
+    if (heap_budget_) {
+      // Cap the limit at this heap's share of the process-wide budget, but
+      // always leave room for a minimal growing step to avoid GC storms.
+      size_t budget_limit = heap_budget_->UpdateAndComputeLimit(
+          this, old_gen_size,
+          tracer()->OldGenerationAllocationThroughputInBytesPerMillisecond());
+      size_t min_limit =
+          old_gen_size +
+          MemoryController<V8HeapTrait>::MinimumAllocationLimitGrowingStep(
+              mode);
+      new_old_generation_limit = std::min(
+          new_old_generation_limit, std::max(budget_limit, min_limit));
+      if (v8_flags.trace_gc_verbose) {
+        isolate()->PrintWithTimestamp(
+            "Heap budget: limit %zu KB, shared budget %zu KB, used %zu KB\n",
+            new_old_generation_limit / KB,
+            heap_budget_->GetBudgetInBytes() / KB,
+            heap_budget_->GetUsedBytes() / KB);
+      }
+    }
+    set_old_generation_allocation_limit(new_old_generation_limit);
     DCHECK_GT(global_growing_factor, 0);
     global_allocation_limit_ =
         MemoryController<GlobalMemoryTrait>::CalculateAllocationLimit(
@@ -3772,6 +3812,10 @@ Heap::ResizeNewSpaceMode Heap::ShouldResizeNewSpace() {
                                   : ResizeNewSpaceMode::kShrink;
   }
 
+  if (v8_flags.survival_based_new_space_sizing) {
+    return ShouldResizeNewSpaceBasedOnSurvival();
+  }
+
   static const size_t kLowAllocationThroughput = 1000;
   const double allocation_throughput =
       tracer_->CurrentAllocationThroughputInBytesPerMillisecond();
@@ -3789,6 +3833,42 @@ Heap::ResizeNewSpaceMode Heap::ShouldResizeNewSpace() {
   return should_grow ? ResizeNewSpaceMode::kGrow : ResizeNewSpaceMode::kShrink;
 }
 
+Heap::ResizeNewSpaceMode Heap::ShouldResizeNewSpaceBasedOnSurvival() {
+  if (v8_flags.predictable || !tracer_->SurvivalEventsRecorded()) {
+    return ResizeNewSpaceMode::kNone;
+  }
+  // Survival of the last young generation GC and the average over the recent
+  // ones, both in percent of the young generation size at the start of GC.
+  const double last_survival = promotion_ratio_ + new_space_surviving_rate_;
+  const double average_survival = tracer_->AverageSurvivalRatio();
+
+  // Allocation sites that were just switched to old space allocation stop
+  // contributing to young generation survival, so a high survival rate in the
+  // GC that made these decisions does not predict the next one.
+  const bool should_grow =
+      new_space_->TotalCapacity() < new_space_->MaximumCapacity() &&
+      last_survival >= v8_flags.new_space_grow_survival_percent &&
+      !pretenuring_handler_.MadeTenureDecisionsInLastGC();
+
+  // Shrink only once survival has been low for a while so that short quiet
+  // periods within a burst do not cause oscillation, but then shrink down to
+  // the live young generation right away.
+  static const size_t kLowAllocationThroughput = 1000;
+  const double allocation_throughput =
+      tracer_->CurrentAllocationThroughputInBytesPerMillisecond();
+  const bool is_idle = allocation_throughput != 0 &&
+                       allocation_throughput < kLowAllocationThroughput;
+  const double shrink_threshold = v8_flags.new_space_shrink_survival_percent;
+  const bool should_shrink =
+      is_idle || (last_survival < shrink_threshold &&
+                  average_survival < shrink_threshold);
+
+  if (should_grow) survived_since_last_expansion_ = 0;
+
+  if (should_grow == should_shrink) return ResizeNewSpaceMode::kNone;
+  return should_grow ? ResizeNewSpaceMode::kGrow : ResizeNewSpaceMode::kShrink;
+}
+
 void Heap::ExpandNewSpaceSize() {
   // Grow the size of new space if there is room to grow, and enough data
   // has survived scavenge since the last expansion.
@@ -4122,6 +4202,20 @@ void Heap::CollectGarbageOnMemoryPressure() {
   }
 }
 
+void Heap::CollectGarbageForDeepIdle() {
+  DCHECK(!is_deep_idle_gc_);
+  is_deep_idle_gc_ = true;
+  CollectAllGarbage(kReduceMemoryFootprintMask,
+                    GarbageCollectionReason::kMemoryReducer,
+                    kGCCallbackFlagCollectAllAvailableGarbage);
+  is_deep_idle_gc_ = false;
+  // Feedback vectors of the functions flushed above only became unreachable
+  // during the first GC and are reclaimed by a second one.
+  CollectAllGarbage(kReduceMemoryFootprintMask,
+                    GarbageCollectionReason::kMemoryReducer,
+                    kGCCallbackFlagCollectAllAvailableGarbage);
+}
+
 void Heap::MemoryPressureNotification(MemoryPressureLevel level,
                                       bool is_isolate_locked) {
   TRACE_EVENT1("devtools.timeline,v8", "V8.MemoryPressureNotification", "level",
@@ -4232,6 +4326,13 @@ std::unique_ptr<v8::MeasureMemoryDelegate> Heap::MeasureMemoryDelegate(
                                                mode);
 }
 
+void Heap::StartContextMemorySampling(uint64_t sample_interval) {
+  context_memory_sampler_ =
+      std::make_unique<ContextMemorySampler>(this, sample_interval);
+}
+
+void Heap::StopContextMemorySampling() { context_memory_sampler_.reset(); }
+
 void Heap::CollectCodeStatistics() {
   TRACE_EVENT0("v8", "Heap::CollectCodeStatistics");
   IgnoreLocalGCRequests ignore_gc_requests(this);
@@ -5082,6 +5183,13 @@ void Heap::ConfigureHeapDefault() {
   ConfigureHeap(constraints);
 }
 
+void Heap::SetHeapBudget(std::shared_ptr<v8::HeapBudget> budget) {
+  DCHECK_NULL(heap_budget_);
+  DCHECK_NOT_NULL(budget);
+  heap_budget_ = std::static_pointer_cast<SharedHeapBudget>(std::move(budget));
+  heap_budget_->AddHeap(this);
+}
+
 void Heap::RecordStats(HeapStats* stats, bool take_snapshot) {
   *stats->start_marker = HeapStats::kStartMarker;
   *stats->end_marker = HeapStats::kEndMarker;
@@ -5884,6 +5992,12 @@ void Heap::TearDown() {
 
   minor_gc_task_observer_.reset();
   scavenge_job_.reset();
+  context_memory_sampler_.reset();
+
+  if (heap_budget_) {
+    heap_budget_->RemoveHeap(this);
+    heap_budget_.reset();
+  }
 
   if (need_to_remove_stress_concurrent_allocation_observer_) {
     RemoveAllocationObserversFromAllSpaces(
@@ -96,6 +96,7 @@ class CodeRange;
 class CollectionBarrier;
 class ConcurrentAllocator;
 class ConcurrentMarking;
+class ContextMemorySampler;
 class CppHeap;
 class GCIdleTimeHandler;
 class GCIdleTimeHeapState;
@@ -126,6 +127,7 @@ class SafepointScope;
 class ScavengeJob;
 class Scavenger;
 class ScavengerCollector;
+class SharedHeapBudget;
 class SharedLargeObjectSpace;
 class SharedReadOnlySpace;
 class SharedSpace;
@@ -717,6 +719,14 @@ class Heap {
       Handle<NativeContext> context, Handle<JSPromise> promise,
       v8::MeasureMemoryMode mode);
 
+  // Starts or stops attributing sampled allocations to native contexts. See
+  // ContextMemorySampler.
+  void StartContextMemorySampling(uint64_t sample_interval);
+  void StopContextMemorySampling();
+  ContextMemorySampler* context_memory_sampler() {
+    return context_memory_sampler_.get();
+  }
+
   void VisitExternalResources(v8::ExternalResourceVisitor* visitor);
 
   void IncrementDeferredCount(v8::Isolate::UseCounterFeature feature);
@@ -797,6 +807,10 @@ class Heap {
   void ConfigureHeap(const v8::ResourceConstraints& constraints);
   void ConfigureHeapDefault();
 
+  // Makes the heap take part in a memory budget shared with other isolates.
+  // Must be called before the first GC.
+  void SetHeapBudget(std::shared_ptr<v8::HeapBudget> budget);
+
   // Prepares the heap, setting up for deserialization.
   void SetUp(LocalHeap* main_thread_local_heap);
 
@@ -1002,6 +1016,14 @@ class Heap {
   V8_EXPORT_PRIVATE void CollectAllAvailableGarbage(
       GarbageCollectionReason gc_reason);
 
+  // GC for isolates that have been idle for a long time. Flushes all
+  // flushable bytecode and baseline code regardless of its age, which also
+  // drops the feedback of the flushed functions, and compacts the heap
+  // including code space.
+  V8_EXPORT_PRIVATE void CollectGarbageForDeepIdle();
+
+  bool IsDeepIdleGC() const { return is_deep_idle_gc_; }
+
   // Precise garbage collection that potentially finalizes already running
   // incremental marking before performing an atomic garbage collection.
   // Only use if absolutely necessary or in tests to avoid floating garbage!
@@ -1825,6 +1847,10 @@ class Heap {
 
   enum class ResizeNewSpaceMode { kShrink, kGrow, kNone };
   ResizeNewSpaceMode ShouldResizeNewSpace();
+  // Used with --survival-based-new-space-sizing. Decides from the survival
+  // rate of the last young GC and GCTracer's average over its recent survival
+  // events. No survival histogram is kept.
+  ResizeNewSpaceMode ShouldResizeNewSpaceBasedOnSurvival();
   void ExpandNewSpaceSize();
   void ReduceNewSpaceSize();
 
@@ -2251,6 +2277,7 @@ class Heap {
   double last_gc_time_ = 0.0;
 
   std::unique_ptr<GCTracer> tracer_;
+  std::shared_ptr<SharedHeapBudget> heap_budget_;
   std::unique_ptr<Sweeper> sweeper_;
   std::unique_ptr<MarkCompactCollector> mark_compact_collector_;
   std::unique_ptr<MinorMarkCompactCollector> minor_mark_compact_collector_;
@@ -2262,6 +2289,7 @@ class Heap {
   std::unique_ptr<ConcurrentMarking> concurrent_marking_;
   std::unique_ptr<GCIdleTimeHandler> gc_idle_time_handler_;
   std::unique_ptr<MemoryMeasurement> memory_measurement_;
+  std::unique_ptr<ContextMemorySampler> context_memory_sampler_;
   std::unique_ptr<MemoryReducer> memory_reducer_;
   std::unique_ptr<ObjectStats> live_object_stats_;
   std::unique_ptr<ObjectStats> dead_object_stats_;
@@ -2335,6 +2363,8 @@ class Heap {
 
   bool is_current_gc_forced_ = false;
   bool is_current_gc_for_heap_profiler_ = false;
+  // Set while CollectGarbageForDeepIdle() runs its GCs.
+  bool is_deep_idle_gc_ = false;
   GarbageCollector current_or_last_garbage_collector_ =
       GarbageCollector::SCAVENGER;
 
@@ -16,6 +16,7 @@
 #include "src/heap/heap.h"
 #include "src/heap/incremental-marking-inl.h"
 #include "src/heap/incremental-marking-job.h"
+#include "src/heap/invalidated-slots-inl.h"
 #include "src/heap/mark-compact-inl.h"
 #include "src/heap/mark-compact.h"
 #include "src/heap/marking-barrier.h"
@@ -25,6 +26,8 @@
 #include "src/heap/object-stats.h"
 #include "src/heap/objects-visiting-inl.h"
 #include "src/heap/objects-visiting.h"
+#include "src/heap/paged-spaces.h"
+#include "src/heap/remembered-set.h"
 #include "src/heap/safepoint.h"
 #include "src/init/v8.h"
 #include "src/logging/runtime-call-stats-scope.h"
@@ -266,6 +269,43 @@ void IncrementalMarking::MarkRoots() {
 
 void IncrementalMarking::MarkRootsForTesting() { MarkRoots(); }
 
+void IncrementalMarking::MarkSharedHeapObjectsFromClients() {
+  DCHECK(IsMajorMarking());
+  DCHECK(isolate()->is_shared_space_isolate());
+  // Incremental marking is started within a global safepoint, so client
+  // mutators cannot modify their remembered sets here. Shared objects found
+  // this way are traced incrementally and concurrently instead of in the
+  // atomic pause. MarkCompactCollector::MarkObjectsFromClientHeaps() still
+  // revisits all client heaps in the atomic pause, which also takes care of
+  // the young generation, typed slots and slots recorded in the meantime.
+  // Marking here is thus only an optimization and may at most retain
+  // floating garbage until the next GC.
+  isolate()->global_safepoint()->IterateClientIsolates([this](Isolate* client) {
+    PtrComprCageBase cage_base(client);
+    OldGenerationMemoryChunkIterator chunk_iterator(client->heap());
+    for (MemoryChunk* chunk = chunk_iterator.next(); chunk;
+         chunk = chunk_iterator.next()) {
+      // Pages still being swept may concurrently drop slots.
+      if (!chunk->SweepingDone()) continue;
+      InvalidatedSlotsFilter filter = InvalidatedSlotsFilter::OldToShared(
+          chunk, InvalidatedSlotsFilter::LivenessCheck::kNo);
+      RememberedSet<OLD_TO_SHARED>::Iterate(
+          chunk,
+          [this, cage_base, &filter](MaybeObjectSlot slot) {
+            if (!filter.IsValid(slot.address())) return KEEP_SLOT;
+            MaybeObject obj = slot.Relaxed_Load(cage_base);
+            HeapObject heap_object;
+            if (obj.GetHeapObject(&heap_object) &&
+                heap_object.InWritableSharedSpace()) {
+              WhiteToGreyAndPush(heap_object);
+            }
+            return KEEP_SLOT;
+          },
+          SlotSet::KEEP_EMPTY_BUCKETS);
+    }
+  });
+}
+
 void IncrementalMarking::StartMarkingMajor() {
   if (isolate()->serializer_enabled()) {
     // Black allocation currently starts when we start incremental marking,
@@ -316,6 +356,10 @@ void IncrementalMarking::StartMarkingMajor() {
   {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_MARK_ROOTS);
     MarkRoots();
+    if (v8_flags.incremental_marking_client_heaps &&
+        isolate()->is_shared_space_isolate()) {
+      MarkSharedHeapObjectsFromClients();
+    }
   }
 
   if (v8_flags.concurrent_marking && !heap_->IsTearingDown()) {
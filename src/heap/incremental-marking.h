@@ -212,6 +212,10 @@ class V8_EXPORT_PRIVATE IncrementalMarking final {
   bool TryInitializeTaskTimeout();
 
   void MarkRoots();
+  // Marks shared objects that are reachable through the OLD_TO_SHARED
+  // remembered sets of client isolates. Only invoked on the shared space
+  // isolate while all clients are stopped in a global safepoint.
+  void MarkSharedHeapObjectsFromClients();
 
   // Performs incremental marking steps and returns before the deadline_in_ms is
   // reached. It may return earlier if the marker is already ahead of the
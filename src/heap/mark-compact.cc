@@ -4287,6 +4287,9 @@ class PageEvacuationJob : public v8::JobTask {
   }
 
   void ProcessItems(JobDelegate* delegate, Evacuator* evacuator) {
+    if (v8_flags.numa_aware_evacuation && !ProcessNodeLocalItems(evacuator)) {
+      return;
+    }
     while (remaining_evacuation_items_.load(std::memory_order_relaxed) > 0) {
       base::Optional<size_t> index = generator_.GetNext();
       if (!index) return;
@@ -4302,6 +4305,26 @@ class PageEvacuationJob : public v8::JobTask {
     }
   }
 
+  // Evacuates the pages that live on the NUMA node of the current thread
+  // before falling back to the generic work distribution. Objects are copied
+  // into LABs the worker touches on its own node, so this keeps both the
+  // source and the target of the copy node-local. Returns false if there are
+  // no items left.
+  bool ProcessNodeLocalItems(Evacuator* evacuator) {
+    const int node = base::OS::GetCurrentNumaNode();
+    if (node == MemoryChunk::kNoNumaNode) return true;
+    for (auto& work_item : evacuation_items_) {
+      if (work_item.second->numa_node() != node) continue;
+      if (!work_item.first.TryAcquire()) continue;
+      evacuator->EvacuatePage(work_item.second);
+      if (remaining_evacuation_items_.fetch_sub(
+              1, std::memory_order_relaxed) <= 1) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   size_t GetMaxConcurrency(size_t worker_count) const override {
     const size_t kItemsPerWorker = std::max(1, MB / Page::kPageSize);
     // Ceiling division to ensure enough workers for all
@@ -6189,6 +6212,11 @@ bool MinorMarkCompactCollector::StartSweepNewSpace() {
       if ((resize_new_space_ == ResizeNewSpaceMode::kShrink) &&
           paged_space->ShouldReleaseEmptyPage()) {
         paged_space->ReleasePage(p);
+      } else if (v8_flags.concurrent_minor_mc_sweeping) {
+        // Leave the page to the concurrent sweepers, which turn it into a
+        // single free list entry off the main thread.
+        sweeper()->AddNewSpacePage(p);
+        will_be_swept++;
       } else {
         sweeper()->SweepEmptyNewSpacePage(p);
       }
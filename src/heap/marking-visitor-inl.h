@@ -249,12 +249,41 @@ int MarkingVisitorBase<ConcreteVisitor, MarkingState>::
   concrete_visitor()->marking_state()->GreyToBlack(object);
   int size = FixedArray::BodyDescriptor::SizeOf(map, object);
   size_t current_progress_bar = progress_bar.Value();
-  int start = static_cast<int>(current_progress_bar);
+  int start;
+  int end;
+  if (v8_flags.parallel_large_array_marking) {
+    // Several markers may hold the same array at once. Each of them claims the
+    // next chunk by advancing the progress bar and pushes the array back
+    // before scanning, so that the remaining range can be stolen by idle
+    // markers while this one is busy with its chunk.
+    while (true) {
+      start = static_cast<int>(current_progress_bar);
+      if (start >= size) return 0;
+      end = std::min(
+          size, std::max(start, FixedArray::BodyDescriptor::kStartOffset) +
+                    kProgressBarScanningChunk);
+      if (progress_bar.TrySetNewValue(current_progress_bar, end)) break;
+      current_progress_bar = progress_bar.Value();
+    }
+    large_array_chunks_claimed_++;
+    if (end < size) {
+      DCHECK(ShouldMarkObject(object));
+      local_marking_worklists_->Push(object);
+      local_marking_worklists_->ShareWork();
+    }
+    if (start == 0) {
+      this->VisitMapPointer(object);
+      start = FixedArray::BodyDescriptor::kStartOffset;
+    }
+    VisitPointers(object, object.RawField(start), object.RawField(end));
+    return end - start;
+  }
+  start = static_cast<int>(current_progress_bar);
   if (start == 0) {
     this->VisitMapPointer(object);
     start = FixedArray::BodyDescriptor::kStartOffset;
   }
-  int end = std::min(size, start + kProgressBarScanningChunk);
+  end = std::min(size, start + kProgressBarScanningChunk);
   if (start < end) {
     VisitPointers(object, object.RawField(start), object.RawField(end));
     bool success = progress_bar.TrySetNewValue(current_progress_bar, end);
@@ -5,8 +5,11 @@
 #include "src/heap/memory-allocator.h"
 
 #include <cinttypes>
+#include <unordered_map>
 
 #include "src/base/address-region.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
@@ -23,6 +26,54 @@
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// Process-wide pool of uncommitted regular pages that outlive the isolate that
+// allocated them. Pages can only be reused by isolates allocating from the same
+// page allocator, i.e., isolates living in the same pointer compression cage.
+class SharedPagePool final {
+ public:
+  bool Add(v8::PageAllocator* page_allocator, Address page) {
+    base::MutexGuard guard(&mutex_);
+    if (size_ >= static_cast<size_t>(v8_flags.shared_page_pool_max_pages)) {
+      return false;
+    }
+    pages_[page_allocator].push_back(page);
+    size_++;
+    return true;
+  }
+
+  Address TryGet(v8::PageAllocator* page_allocator) {
+    base::MutexGuard guard(&mutex_);
+    auto it = pages_.find(page_allocator);
+    if (it == pages_.end() || it->second.empty()) return kNullAddress;
+    Address page = it->second.back();
+    it->second.pop_back();
+    size_--;
+    return page;
+  }
+
+  size_t size() {
+    base::MutexGuard guard(&mutex_);
+    return size_;
+  }
+
+ private:
+  base::Mutex mutex_;
+  std::unordered_map<v8::PageAllocator*, std::vector<Address>> pages_;
+  size_t size_ = 0;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(SharedPagePool, GetSharedPagePool)
+
+bool UseSharedPagePool() {
+  // Pages of a per-isolate cage cannot outlive their isolate.
+  return !COMPRESS_POINTERS_IN_ISOLATE_CAGE_BOOL &&
+         v8_flags.shared_page_pool_max_pages > 0;
+}
+
+}  // namespace
+
 // -----------------------------------------------------------------------------
 // MemoryAllocator
 //
@@ -167,12 +218,17 @@ void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks(
     if (pooled) AddMemoryChunkSafe(ChunkQueueType::kPooled, chunk);
     if (delegate && delegate->ShouldYield()) return;
   }
-  if (mode == MemoryAllocator::Unmapper::FreeMode::kFreePooled) {
+  if (mode == MemoryAllocator::Unmapper::FreeMode::kFreePooled ||
+      mode == MemoryAllocator::Unmapper::FreeMode::kReleasePooled) {
     // The previous loop uncommitted any pages marked as pooled and added them
     // to the pooled list. In case of kFreePooled we need to free them though as
     // well.
     while ((chunk = GetMemoryChunkSafe(ChunkQueueType::kPooled)) != nullptr) {
-      allocator_->FreePooledChunk(chunk);
+      if (mode == MemoryAllocator::Unmapper::FreeMode::kReleasePooled) {
+        allocator_->ReleasePooledChunk(chunk);
+      } else {
+        allocator_->FreePooledChunk(chunk);
+      }
       if (delegate && delegate->ShouldYield()) return;
     }
   }
@@ -181,7 +237,7 @@ void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks(
 
 void MemoryAllocator::Unmapper::TearDown() {
   CHECK(!job_handle_ || !job_handle_->IsValid());
-  PerformFreeMemoryOnQueuedChunks(FreeMode::kFreePooled);
+  PerformFreeMemoryOnQueuedChunks(FreeMode::kReleasePooled);
   for (int i = 0; i < ChunkQueueType::kNumberOfChunkQueues; i++) {
     DCHECK(chunks_[i].empty());
   }
@@ -562,6 +618,19 @@ void MemoryAllocator::FreePooledChunk(MemoryChunk* chunk) {
                    static_cast<size_t>(MemoryChunk::kPageSize));
 }
 
+void MemoryAllocator::ReleasePooledChunk(MemoryChunk* chunk) {
+  if (UseSharedPagePool() &&
+      GetSharedPagePool()->Add(data_page_allocator(), chunk->address())) {
+    return;
+  }
+  FreePooledChunk(chunk);
+}
+
+// static
+size_t MemoryAllocator::GetSharedPagePoolSizeForTesting() {
+  return GetSharedPagePool()->size();
+}
+
 Page* MemoryAllocator::AllocatePage(MemoryAllocator::AllocationMode alloc_mode,
                                     Space* space, Executability executable) {
   size_t size =
@@ -638,6 +707,10 @@ LargePage* MemoryAllocator::AllocateLargePage(LargeObjectSpace* space,
 base::Optional<MemoryAllocator::MemoryChunkAllocationResult>
 MemoryAllocator::AllocateUninitializedPageFromPool(Space* space) {
   void* chunk = unmapper()->TryGetPooledMemoryChunkSafe();
+  if (chunk == nullptr && UseSharedPagePool()) {
+    chunk = reinterpret_cast<void*>(
+        GetSharedPagePool()->TryGet(data_page_allocator()));
+  }
   if (chunk == nullptr) return {};
   const int size = MemoryChunk::kPageSize;
   const Address start = reinterpret_cast<Address>(chunk);
@@ -112,6 +112,10 @@ class MemoryAllocator {
 
       // Free pooled pages. Only used on tear down and last-resort GCs.
       kFreePooled,
+
+      // Hand pooled pages over to the process-wide pool if possible and free
+      // them otherwise. Only used on tear down.
+      kReleasePooled,
     };
 
     void AddMemoryChunkSafe(ChunkQueueType type, MemoryChunk* chunk) {
@@ -184,6 +188,10 @@ class MemoryAllocator {
   V8_EXPORT_PRIVATE static base::AddressRegion ComputeDiscardMemoryArea(
       Address addr, size_t size);
 
+  // Returns the number of uncommitted pages in the process-wide pool that
+  // isolates hand over on tear down (see --shared-page-pool-max-pages).
+  V8_EXPORT_PRIVATE static size_t GetSharedPagePoolSizeForTesting();
+
   V8_EXPORT_PRIVATE MemoryAllocator(Isolate* isolate,
                                     v8::PageAllocator* code_page_allocator,
                                     size_t max_capacity);
@@ -369,6 +377,11 @@ class MemoryAllocator {
   // Frees a pooled page. Only used on tear-down and last-resort GCs.
   void FreePooledChunk(MemoryChunk* chunk);
 
+  // Adds a pooled page to the process-wide pool so that other isolates using
+  // the same page allocator can reuse it. Frees the page if the process-wide
+  // pool is disabled or full.
+  void ReleasePooledChunk(MemoryChunk* chunk);
+
   // Initializes pages in a chunk. Returns the first page address.
   // This function and GetChunkId() are provided for the mark-compact
   // collector to rebuild page headers in the from space, which is
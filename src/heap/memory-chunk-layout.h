@@ -69,6 +69,7 @@ class V8_EXPORT_PRIVATE MemoryChunkLayout {
     FIELD(PossiblyEmptyBuckets, PossiblyEmptyBuckets),
     FIELD(ActiveSystemPages*, ActiveSystemPages),
     FIELD(size_t, WasUsedForAllocation),
+    FIELD(int, NumaNode),
     kMarkingBitmapOffset,
     kMemoryChunkHeaderSize =
         kMarkingBitmapOffset +
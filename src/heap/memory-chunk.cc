@@ -178,6 +178,10 @@ MemoryChunk::MemoryChunk(Heap* heap, BaseSpace* space, size_t chunk_size,
 
   possibly_empty_buckets_.Initialize();
 
+  if (v8_flags.numa_aware_evacuation) {
+    numa_node_ = base::OS::GetCurrentNumaNode();
+  }
+
   if (page_size == PageSize::kRegular) {
     active_system_pages_ = new ActiveSystemPages;
     active_system_pages_->Init(MemoryChunkLayout::kMemoryChunkHeaderSize,
@@ -529,6 +533,8 @@ void MemoryChunk::ValidateOffsets(MemoryChunk* chunk) {
   DCHECK_EQ(reinterpret_cast<Address>(&chunk->was_used_for_allocation_) -
                 chunk->address(),
             MemoryChunkLayout::kWasUsedForAllocationOffset);
+  DCHECK_EQ(reinterpret_cast<Address>(&chunk->numa_node_) - chunk->address(),
+            MemoryChunkLayout::kNumaNodeOffset);
 }
 #endif
 
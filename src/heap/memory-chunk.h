@@ -220,6 +220,11 @@ class MemoryChunk : public BasicMemoryChunk {
   void ClearWasUsedForAllocation() { was_used_for_allocation_ = false; }
   bool WasUsedForAllocation() const { return was_used_for_allocation_; }
 
+  // The NUMA node the chunk was committed on, or kNoNumaNode if unknown or
+  // --numa-aware-evacuation is disabled.
+  static constexpr int kNoNumaNode = -1;
+  int numa_node() const { return numa_node_; }
+
  protected:
   // Release all memory allocated by the chunk. Should be called when memory
   // chunk is about to be freed.
@@ -297,6 +302,10 @@ class MemoryChunk : public BasicMemoryChunk {
   // only for new space pages.
   size_t was_used_for_allocation_ = false;
 
+  // Home NUMA node of the chunk. Memory is placed on first touch, so this is
+  // the node of the thread that set up the chunk header.
+  int numa_node_ = kNoNumaNode;
+
  private:
   friend class ConcurrentMarkingState;
   friend class MarkingState;
@@ -64,6 +64,14 @@ void MemoryReducer::TimerTask::RunInternal() {
 }
 
 
+MemoryReducer::DeepIdleTask::DeepIdleTask(MemoryReducer* memory_reducer)
+    : CancelableTask(memory_reducer->heap()->isolate()),
+      memory_reducer_(memory_reducer) {}
+
+void MemoryReducer::DeepIdleTask::RunInternal() {
+  memory_reducer_->NotifyDeepIdleTimer();
+}
+
 void MemoryReducer::NotifyTimer(const Event& event) {
   DCHECK_EQ(kTimer, event.type);
   DCHECK_EQ(kWait, state_.id());
@@ -122,7 +130,38 @@ void MemoryReducer::NotifyMarkCompact(size_t committed_memory_before) {
           "Memory reducer: finished GC #%d (%s)\n", state_.started_gcs(),
           state_.id() == kWait ? "will do more" : "done");
     }
+    if (state_.id() == kDone) ScheduleDeepIdleTimer();
+  }
+}
+
+void MemoryReducer::ScheduleDeepIdleTimer() {
+  if (!v8_flags.memory_reducer_deep_idle) return;
+  if (heap()->IsTearingDown()) return;
+  ms_count_at_deep_idle_schedule_ = heap()->ms_count();
+  taskrunner_->PostDelayedTask(
+      std::make_unique<MemoryReducer::DeepIdleTask>(this),
+      v8_flags.memory_reducer_deep_idle_delay_ms / 1000.0);
+}
+
+void MemoryReducer::NotifyDeepIdleTimer() {
+  // Only act if nothing happened since the memory reducer finished: the state
+  // machine went back to work or a full GC ran in between.
+  if (state_.id() != kDone ||
+      heap()->ms_count() != ms_count_at_deep_idle_schedule_ ||
+      !heap()->incremental_marking()->IsStopped()) {
+    return;
+  }
+  const double time_ms = heap()->MonotonicallyIncreasingTimeInMs();
+  heap()->tracer()->SampleAllocation(time_ms,
+                                     heap()->NewSpaceAllocationCounter(),
+                                     heap()->OldGenerationAllocationCounter(),
+                                     heap()->EmbedderAllocationCounter());
+  if (!heap()->HasLowAllocationRate()) return;
+  if (v8_flags.trace_gc_verbose) {
+    heap()->isolate()->PrintWithTimestamp(
+        "Memory reducer: isolate is deeply idle, flushing code\n");
   }
+  heap()->CollectGarbageForDeepIdle();
 }
 
 void MemoryReducer::NotifyPossibleGarbage() {
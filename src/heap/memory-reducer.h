@@ -184,6 +184,20 @@ class V8_EXPORT_PRIVATE MemoryReducer {
   }
 
  private:
+  // Scheduled when the memory reducer finishes its GCs. If the isolate has
+  // stayed idle until the task runs, a deep idle GC is performed.
+  class DeepIdleTask : public v8::internal::CancelableTask {
+   public:
+    explicit DeepIdleTask(MemoryReducer* memory_reducer);
+    DeepIdleTask(const DeepIdleTask&) = delete;
+    DeepIdleTask& operator=(const DeepIdleTask&) = delete;
+
+   private:
+    // v8::internal::CancelableTask overrides.
+    void RunInternal() override;
+    MemoryReducer* memory_reducer_;
+  };
+
   class TimerTask : public v8::internal::CancelableTask {
    public:
     explicit TimerTask(MemoryReducer* memory_reducer);
@@ -197,6 +211,8 @@ class V8_EXPORT_PRIVATE MemoryReducer {
   };
 
   void NotifyTimer(const Event& event);
+  void NotifyDeepIdleTimer();
+  void ScheduleDeepIdleTimer();
 
   static bool WatchdogGC(const State& state, const Event& event);
 
@@ -206,6 +222,9 @@ class V8_EXPORT_PRIVATE MemoryReducer {
   unsigned int js_calls_counter_;
   double js_calls_sample_time_ms_;
   int start_delay_ms_ = false;
+  // Number of full GCs when the deep idle timer was scheduled. Any full GC in
+  // between means the isolate was not idle after all.
+  int ms_count_at_deep_idle_schedule_ = -1;
 
   // Used in cctest.
   friend class heap::HeapTester;
@@ -4,12 +4,18 @@
 
 #include "src/heap/pretenuring-handler.h"
 
+#include <algorithm>
+
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
 #include "src/handles/global-handles-inl.h"
+#include "src/heap/heap.h"
 #include "src/heap/new-spaces.h"
 #include "src/objects/allocation-site-inl.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -154,6 +160,7 @@ void PretenuringHandler::RemoveAllocationSitePretenuringFeedback(
 
 void PretenuringHandler::ProcessPretenuringFeedback() {
   bool trigger_deoptimization = false;
+  made_tenure_decisions_in_last_gc_ = false;
   if (v8_flags.allocation_site_pretenuring) {
     int tenure_decisions = 0;
     int dont_tenure_decisions = 0;
@@ -180,7 +187,9 @@ void PretenuringHandler::ProcessPretenuringFeedback() {
         allocation_mementos_found += found_count;
         if (DigestPretenuringFeedback(heap_->isolate(), site,
                                       maximum_size_scavenge)) {
+          // Deoptimization is only required for transitions to tenure.
           trigger_deoptimization = true;
+          made_tenure_decisions_in_last_gc_ = true;
         }
         if (site.GetAllocationType() == AllocationType::kOld) {
           tenure_decisions++;
@@ -196,6 +205,7 @@ void PretenuringHandler::ProcessPretenuringFeedback() {
         auto pretenure_site = allocation_sites_to_pretenure_->Pop();
         if (PretenureAllocationSiteManually(heap_->isolate(), pretenure_site)) {
           trigger_deoptimization = true;
+          made_tenure_decisions_in_last_gc_ = true;
         }
       }
       allocation_sites_to_pretenure_.reset();
@@ -248,5 +258,139 @@ void PretenuringHandler::PretenureAllocationSiteOnNextCollection(
 
 void PretenuringHandler::reset() { allocation_sites_to_pretenure_.reset(); }
 
+namespace {
+
+// Blob layout: magic, version, entry count, followed by five 32-bit words per
+// entry. All words are little endian.
+constexpr uint32_t kTenureDecisionsMagic = 0x54503856;  // "V8PT"
+constexpr uint32_t kTenureDecisionsVersion = 1;
+constexpr size_t kTenureDecisionsHeaderWords = 3;
+constexpr size_t kTenureDecisionsEntryWords = 5;
+
+void AppendWord(std::vector<uint8_t>* out, uint32_t word) {
+  for (int i = 0; i < 4; i++) {
+    out->push_back(static_cast<uint8_t>(word >> (8 * i)));
+  }
+}
+
+uint32_t ReadWord(const uint8_t* data, size_t index) {
+  const uint8_t* bytes = data + index * 4;
+  return static_cast<uint32_t>(bytes[0]) |
+         (static_cast<uint32_t>(bytes[1]) << 8) |
+         (static_cast<uint32_t>(bytes[2]) << 16) |
+         (static_cast<uint32_t>(bytes[3]) << 24);
+}
+
+}  // namespace
+
+// static
+bool PretenuringHandler::ComputeLiteralSiteKey(FeedbackVector vector,
+                                               FeedbackSlot slot,
+                                               LiteralSiteKey* key) {
+  SharedFunctionInfo shared = vector.shared_function_info();
+  if (!shared.script().IsScript()) return false;
+  Object source = Script::cast(shared.script()).source();
+  if (!source.IsString()) return false;
+  String source_string = String::cast(source);
+  // Long strings only hash their length, so the script name helps telling
+  // sources apart.
+  Object name = Script::cast(shared.script()).name();
+  uint32_t name_hash = name.IsString() ? String::cast(name).EnsureHash() : 0;
+  *key = LiteralSiteKey(name_hash, source_string.EnsureHash(),
+                        source_string.length(), shared.StartPosition(),
+                        slot.ToInt());
+  return true;
+}
+
+std::vector<uint8_t> PretenuringHandler::SerializeTenureDecisions() {
+  std::vector<LiteralSiteKey> keys;
+  {
+    HeapObjectIterator iterator(heap_);
+    for (HeapObject obj = iterator.Next(); !obj.is_null();
+         obj = iterator.Next()) {
+      if (!obj.IsFeedbackVector()) continue;
+      FeedbackVector vector = FeedbackVector::cast(obj);
+      FeedbackMetadataIterator it(vector.metadata());
+      while (it.HasNext()) {
+        FeedbackSlot slot = it.Next();
+        if (it.kind() != FeedbackSlotKind::kLiteral) continue;
+        HeapObject feedback;
+        if (!vector.Get(slot).GetHeapObjectIfStrong(&feedback) ||
+            !feedback.IsAllocationSite()) {
+          continue;
+        }
+        AllocationSite site = AllocationSite::cast(feedback);
+        if (site.IsZombie() || site.GetAllocationType() != AllocationType::kOld)
+          continue;
+        LiteralSiteKey key;
+        if (ComputeLiteralSiteKey(vector, slot, &key)) keys.push_back(key);
+      }
+    }
+  }
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+  std::vector<uint8_t> result;
+  result.reserve(
+      (kTenureDecisionsHeaderWords + keys.size() * kTenureDecisionsEntryWords) *
+      4);
+  AppendWord(&result, kTenureDecisionsMagic);
+  AppendWord(&result, kTenureDecisionsVersion);
+  AppendWord(&result, static_cast<uint32_t>(keys.size()));
+  for (const LiteralSiteKey& key : keys) {
+    AppendWord(&result, std::get<0>(key));
+    AppendWord(&result, std::get<1>(key));
+    AppendWord(&result, static_cast<uint32_t>(std::get<2>(key)));
+    AppendWord(&result, static_cast<uint32_t>(std::get<3>(key)));
+    AppendWord(&result, static_cast<uint32_t>(std::get<4>(key)));
+  }
+  return result;
+}
+
+bool PretenuringHandler::DeserializeTenureDecisions(const uint8_t* data,
+                                                    size_t length) {
+  if (length % 4 != 0) return false;
+  const size_t words = length / 4;
+  if (words < kTenureDecisionsHeaderWords) return false;
+  if (ReadWord(data, 0) != kTenureDecisionsMagic ||
+      ReadWord(data, 1) != kTenureDecisionsVersion) {
+    return false;
+  }
+  const size_t count = ReadWord(data, 2);
+  if ((words - kTenureDecisionsHeaderWords) / kTenureDecisionsEntryWords !=
+          count ||
+      (words - kTenureDecisionsHeaderWords) % kTenureDecisionsEntryWords != 0) {
+    return false;
+  }
+  for (size_t i = 0; i < count; i++) {
+    const size_t entry =
+        kTenureDecisionsHeaderWords + i * kTenureDecisionsEntryWords;
+    seeded_tenure_decisions_.emplace(
+        ReadWord(data, entry), ReadWord(data, entry + 1),
+        static_cast<int>(ReadWord(data, entry + 2)),
+        static_cast<int>(ReadWord(data, entry + 3)),
+        static_cast<int>(ReadWord(data, entry + 4)));
+  }
+  if (v8_flags.trace_pretenuring) {
+    PrintIsolate(heap_->isolate(),
+                 "pretenuring: seeded %zu persisted tenure decisions\n",
+                 count);
+  }
+  return true;
+}
+
+void PretenuringHandler::ApplySeededTenureDecision(FeedbackVector vector,
+                                                   FeedbackSlot slot,
+                                                   AllocationSite site) {
+  if (seeded_tenure_decisions_.empty()) return;
+  if (!v8_flags.allocation_site_pretenuring) return;
+  LiteralSiteKey key;
+  if (!ComputeLiteralSiteKey(vector, slot, &key)) return;
+  if (seeded_tenure_decisions_.count(key) == 0) return;
+  DCHECK_EQ(AllocationSite::kUndecided, site.pretenure_decision());
+  // The site is brand new, so no code depends on it yet.
+  site.set_pretenure_decision(AllocationSite::kTenure);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -6,6 +6,9 @@
 #define V8_HEAP_PRETENURING_HANDLER_H_
 
 #include <memory>
+#include <set>
+#include <tuple>
+#include <vector>
 
 #include "src/objects/allocation-site.h"
 #include "src/objects/heap-object.h"
@@ -14,6 +17,7 @@
 namespace v8 {
 namespace internal {
 
+class FeedbackVector;
 template <typename T>
 class GlobalHandleVector;
 class Heap;
@@ -72,7 +76,41 @@ class PretenuringHandler final {
     return !global_pretenuring_feedback_.empty();
   }
 
+  // Returns whether the last call to ProcessPretenuringFeedback() switched
+  // any allocation site to old space allocation.
+  bool MadeTenureDecisionsInLastGC() const {
+    return made_tenure_decisions_in_last_gc_;
+  }
+
+  // ===========================================================================
+  // Persisted decisions. ======================================================
+  // ===========================================================================
+
+  // Literal allocation sites are identified across processes by their script
+  // name and source, the start position of the enclosing function and the
+  // literal's feedback slot.
+
+  // Returns a blob describing all literal allocation sites that are currently
+  // pretenured.
+  V8_EXPORT_PRIVATE std::vector<uint8_t> SerializeTenureDecisions();
+
+  // Seeds the decisions from a blob created by SerializeTenureDecisions(),
+  // possibly in another process. Returns false and leaves the seeded
+  // decisions untouched if the blob is malformed.
+  V8_EXPORT_PRIVATE bool DeserializeTenureDecisions(const uint8_t* data,
+                                                    size_t length);
+
+  // Pretenures a freshly created literal {site} stored in {slot} of {vector}
+  // if it was seeded as pretenured.
+  void ApplySeededTenureDecision(FeedbackVector vector, FeedbackSlot slot,
+                                 AllocationSite site);
+
  private:
+  using LiteralSiteKey = std::tuple<uint32_t, uint32_t, int, int, int>;
+
+  static bool ComputeLiteralSiteKey(FeedbackVector vector, FeedbackSlot slot,
+                                    LiteralSiteKey* key);
+
   bool DeoptMaybeTenuredAllocationSites() const;
 
   Heap* const heap_;
@@ -86,6 +124,10 @@ class PretenuringHandler final {
 
   std::unique_ptr<GlobalHandleVector<AllocationSite>>
       allocation_sites_to_pretenure_;
+
+  bool made_tenure_decisions_in_last_gc_ = false;
+
+  std::set<LiteralSiteKey> seeded_tenure_decisions_;
 };
 
 }  // namespace internal
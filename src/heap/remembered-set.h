@@ -27,14 +27,21 @@ class RememberedSetOperations {
  public:
   // Given a page and a slot in that page, this function adds the slot to the
   // remembered set.
+  // With {compact} sparse buckets are kept inline, see BasicSlotSet.
   template <AccessMode access_mode>
-  static void Insert(SlotSet* slot_set, MemoryChunk* chunk, Address slot_addr) {
+  static void Insert(SlotSet* slot_set, MemoryChunk* chunk, Address slot_addr,
+                     bool compact = false) {
     DCHECK(chunk->Contains(slot_addr));
     uintptr_t offset = slot_addr - chunk->address();
-    slot_set->Insert<access_mode == v8::internal::AccessMode::ATOMIC
-                         ? v8::internal::SlotSet::AccessMode::ATOMIC
-                         : v8::internal::SlotSet::AccessMode::NON_ATOMIC>(
-        offset);
+    constexpr SlotSet::AccessMode slot_set_access_mode =
+        access_mode == v8::internal::AccessMode::ATOMIC
+            ? v8::internal::SlotSet::AccessMode::ATOMIC
+            : v8::internal::SlotSet::AccessMode::NON_ATOMIC;
+    if (compact) {
+      slot_set->InsertCompact<slot_set_access_mode>(offset);
+    } else {
+      slot_set->Insert<slot_set_access_mode>(offset);
+    }
   }
 
   template <typename Callback>
@@ -99,7 +106,9 @@ class RememberedSet : public AllStatic {
     if (slot_set == nullptr) {
       slot_set = chunk->AllocateSlotSet<type>();
     }
-    RememberedSetOperations::Insert<access_mode>(slot_set, chunk, slot_addr);
+    RememberedSetOperations::Insert<access_mode>(
+        slot_set, chunk, slot_addr,
+        type == OLD_TO_NEW && v8_flags.compact_old_to_new_remembered_set);
   }
 
   // Given a page and a slot set, this function merges the slot set to the set
@@ -216,6 +216,7 @@ void IsolateSafepoint::Barrier::Arm() {
   DCHECK(!IsArmed());
   armed_ = true;
   stopped_ = 0;
+  running_ = 0;
 }
 
 void IsolateSafepoint::Barrier::Disarm() {
@@ -223,6 +224,7 @@ void IsolateSafepoint::Barrier::Disarm() {
   DCHECK(IsArmed());
   armed_ = false;
   stopped_ = 0;
+  running_ = 0;
   cv_resume_.NotifyAll();
 }
 
@@ -230,24 +232,31 @@ void IsolateSafepoint::Barrier::WaitUntilRunningThreadsInSafepoint(
     size_t running) {
   base::MutexGuard guard(&mutex_);
   DCHECK(IsArmed());
+  DCHECK_EQ(running_, 0);
+  running_ = running;
   while (stopped_ < running) {
     cv_stopped_.Wait(&mutex_);
   }
   DCHECK_EQ(stopped_, running);
 }
 
+void IsolateSafepoint::Barrier::NotifyStopped() {
+  stopped_++;
+  // Waking up the initiator for every stopped thread only makes it re-check
+  // and sleep again, which delays the threads still trying to stop.
+  if (stopped_ == running_) cv_stopped_.NotifyOne();
+}
+
 void IsolateSafepoint::Barrier::NotifyPark() {
   base::MutexGuard guard(&mutex_);
   CHECK(IsArmed());
-  stopped_++;
-  cv_stopped_.NotifyOne();
+  NotifyStopped();
 }
 
 void IsolateSafepoint::Barrier::WaitInSafepoint() {
   base::MutexGuard guard(&mutex_);
   CHECK(IsArmed());
-  stopped_++;
-  cv_stopped_.NotifyOne();
+  NotifyStopped();
 
   while (IsArmed()) {
     cv_resume_.Wait(&mutex_);
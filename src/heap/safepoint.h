@@ -51,9 +51,15 @@ class IsolateSafepoint final {
     bool armed_;
 
     size_t stopped_ = 0;
+    // Number of running threads the initiator waits for, or 0 while the
+    // initiator has not started waiting yet. Lets stopping threads only wake
+    // up the initiator once the last of them arrived.
+    size_t running_ = 0;
 
     bool IsArmed() { return armed_; }
 
+    void NotifyStopped();
+
    public:
     Barrier() : armed_(false), stopped_(0) {}
 
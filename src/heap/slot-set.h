@@ -176,7 +176,10 @@ class SlotSet final : public ::heap::base::BasicSlotSet<kTaggedSize> {
     bool empty = true;
     for (size_t bucket_index = 0; bucket_index < buckets; bucket_index++) {
       Bucket* bucket = LoadBucket<AccessMode::NON_ATOMIC>(bucket_index);
-      if (bucket) {
+      if (IsInlineBucket(bucket)) {
+        // Inline buckets are never empty.
+        empty = false;
+      } else if (bucket) {
         if (possibly_empty_buckets->Contains(bucket_index)) {
           if (bucket->IsEmpty()) {
             ReleaseBucket<AccessMode::NON_ATOMIC>(bucket_index);
@@ -203,11 +206,16 @@ class SlotSet final : public ::heap::base::BasicSlotSet<kTaggedSize> {
       Bucket* other_bucket =
           other->LoadBucket<AccessMode::NON_ATOMIC>(bucket_index);
       if (!other_bucket) continue;
-      Bucket* bucket = LoadBucket<AccessMode::NON_ATOMIC>(bucket_index);
-      if (bucket == nullptr) {
-        bucket = new Bucket;
-        CHECK(SwapInNewBucket<AccessMode::NON_ATOMIC>(bucket_index, bucket));
+      if (IsInlineBucket(other_bucket)) {
+        InlineSlots slots(other_bucket);
+        for (int i = 0; i < slots.size(); i++) {
+          InsertCompact<AccessMode::NON_ATOMIC>(
+              OffsetForBucket(bucket_index) + slots[i] * kTaggedSize);
+        }
+        continue;
       }
+      Bucket* bucket =
+          EnsureRegularBucket<AccessMode::NON_ATOMIC>(bucket_index);
       for (int cell_index = 0; cell_index < kCellsPerBucket; cell_index++) {
         bucket->SetCellBits(cell_index, *other_bucket->cell(cell_index));
       }
@@ -879,7 +879,8 @@ class PromotedPageRecordMigratedSlotVisitor
           host_chunk, SlotSet::Allocate(host_chunk->buckets()));
     }
     RememberedSetOperations::Insert<AccessMode::NON_ATOMIC>(
-        (*snapshot_old_to_new_remembered_sets_)[host_chunk], host_chunk, slot);
+        (*snapshot_old_to_new_remembered_sets_)[host_chunk], host_chunk, slot,
+        v8_flags.compact_old_to_new_remembered_set);
   }
 
   inline void RecordOldToSharedMigratedSlot(HeapObject host, MaybeObject value,
@@ -1516,6 +1516,34 @@ void AccessorAssembler::UpdateMayHaveInterestingSymbol(
   BIND(&done);
 }
 
+void AccessorAssembler::AddDictionaryProperty(
+    TNode<JSReceiver> receiver, TNode<PropertyDictionary> properties,
+    TNode<Name> name, TNode<Object> value, Label* slow) {
+  Comment("AddDictionaryProperty");
+  Label grow(this, Label::kDeferred), done(this);
+  // The flags are copied over when the dictionary grows.
+  UpdateMayHaveInterestingSymbol(properties, name);
+  Add<PropertyDictionary>(properties, name, value, &grow);
+  Goto(&done);
+
+  BIND(&grow);
+  if constexpr (V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) {
+    Goto(slow);
+  } else {
+    // The empty dictionary may stand in for a hash stored in the properties
+    // field, leave it to the runtime to keep that.
+    GotoIf(TaggedEqual(properties, EmptyPropertyDictionaryConstant()), slow);
+    TNode<NameDictionary> new_properties =
+        GrowNameDictionary(CAST(properties), slow);
+    Add<NameDictionary>(new_properties, name, value, slow);
+    StoreObjectField(receiver, JSReceiver::kPropertiesOrHashOffset,
+                     new_properties);
+    Goto(&done);
+  }
+
+  BIND(&done);
+}
+
 void AccessorAssembler::CheckFieldType(TNode<DescriptorArray> descriptors,
                                        TNode<IntPtrT> name_index,
                                        TNode<Word32T> representation,
@@ -1923,11 +1951,11 @@ void AccessorAssembler::HandleStoreICProtoHandler(
       TNode<Map> receiver_map = LoadMap(CAST(p->receiver()));
       InvalidateValidityCellIfPrototype(receiver_map);
 
+      TNode<JSReceiver> receiver = CAST(p->receiver());
       TNode<PropertyDictionary> properties =
-          CAST(LoadSlowProperties(CAST(p->receiver())));
-      TNode<Name> name = CAST(p->name());
-      Add<PropertyDictionary>(properties, name, p->value(), &slow);
-      UpdateMayHaveInterestingSymbol(properties, name);
+          CAST(LoadSlowProperties(receiver));
+      AddDictionaryProperty(receiver, properties, CAST(p->name()), p->value(),
+                            &slow);
       Return(p->value());
 
       BIND(&slow);
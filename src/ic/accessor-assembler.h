@@ -279,6 +279,14 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
   void UpdateMayHaveInterestingSymbol(TNode<PropertyDictionary> dict,
                                       TNode<Name> name);
 
+  // Adds a data property {name} to the dictionary {properties} of {receiver},
+  // growing the dictionary if it is full. Jumps to {slow} if the property
+  // can't be added here.
+  void AddDictionaryProperty(TNode<JSReceiver> receiver,
+                             TNode<PropertyDictionary> properties,
+                             TNode<Name> name, TNode<Object> value,
+                             Label* slow);
+
   void JumpIfDataProperty(TNode<Uint32T> details, Label* writable,
                           Label* readonly);
 
@@ -664,6 +664,10 @@ bool IC::UpdatePolymorphicIC(Handle<Name> name,
   maps_and_handlers.reserve(v8_flags.max_valid_polymorphic_map_count);
   int deprecated_maps = 0;
   int handler_to_overwrite = -1;
+  // Accesses that hit the same handler for every map (e.g. fields at the same
+  // location) can stay polymorphic for longer, since optimized code merges
+  // them into a single access behind one map check.
+  bool all_handlers_identical = true;
 
   {
     DisallowGarbageCollection no_gc;
@@ -675,6 +679,9 @@ bool IC::UpdatePolymorphicIC(Handle<Name> name,
 
       maps_and_handlers.push_back(
           MapAndHandler(existing_map, existing_handler));
+      if (!existing_map->is_deprecated() && *existing_handler != *handler) {
+        all_handlers_identical = false;
+      }
 
       if (existing_map->is_deprecated()) {
         // Filter out deprecated maps to ensure their instances get migrated.
@@ -708,8 +715,12 @@ bool IC::UpdatePolymorphicIC(Handle<Name> name,
   int number_of_valid_maps =
       number_of_maps - deprecated_maps - (handler_to_overwrite != -1);
 
-  if (number_of_valid_maps >= v8_flags.max_valid_polymorphic_map_count)
-    return false;
+  int max_valid_maps = v8_flags.max_valid_polymorphic_map_count;
+  if (all_handlers_identical) {
+    max_valid_maps = std::max(
+        max_valid_maps, v8_flags.max_valid_polymorphic_map_count_same_handler);
+  }
+  if (number_of_valid_maps >= max_valid_maps) return false;
   if (number_of_maps == 0 && state() != MONOMORPHIC && state() != POLYMORPHIC) {
     return false;
   }
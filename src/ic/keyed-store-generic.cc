@@ -1017,9 +1017,8 @@ void KeyedStoreGenericAssembler::EmitGenericPropertyStore(
       }
       Label add_dictionary_property_slow(this);
       InvalidateValidityCellIfPrototype(receiver_map, bitfield3);
-      UpdateMayHaveInterestingSymbol(properties, name);
-      Add<PropertyDictionary>(properties, name, p->value(),
-                              &add_dictionary_property_slow);
+      AddDictionaryProperty(receiver, properties, name, p->value(),
+                            &add_dictionary_property_slow);
       exit_point->Return(p->value());
 
       BIND(&add_dictionary_property_slow);
@@ -85,10 +85,25 @@ class V8_EXPORT_PRIVATE StubCache {
   // the static_assert below, in {entry(...)}).
   static const int kCacheIndexShift = Name::HashBits::kShift;
 
+  // The table sizes are baked into the builtins that probe the cache, so they
+  // are configured at build time (see v8_stub_cache_*_table_bits in BUILD.gn).
+#ifdef V8_STUB_CACHE_PRIMARY_TABLE_BITS
+  static const int kPrimaryTableBits = V8_STUB_CACHE_PRIMARY_TABLE_BITS;
+#else
   static const int kPrimaryTableBits = 11;
+#endif
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
+#ifdef V8_STUB_CACHE_SECONDARY_TABLE_BITS
+  static const int kSecondaryTableBits = V8_STUB_CACHE_SECONDARY_TABLE_BITS;
+#else
   static const int kSecondaryTableBits = 9;
+#endif
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
+  // The scaled offsets are computed with 32-bit arithmetic.
+  static_assert(kPrimaryTableBits > 0 &&
+                kPrimaryTableBits + kCacheIndexShift < 31);
+  static_assert(kSecondaryTableBits > 0 &&
+                kSecondaryTableBits + kCacheIndexShift < 31);
 
   static int PrimaryOffsetForTesting(Name name, Map map);
   static int SecondaryOffsetForTesting(Name name, Map map);
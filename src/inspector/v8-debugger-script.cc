@@ -19,16 +19,19 @@ namespace {
 const char kGlobalDebuggerScriptHandleLabel[] = "DevTools debugger";
 
 String16 calculateHash(v8::Isolate* isolate, v8::Local<v8::String> source) {
-  std::unique_ptr<UChar[]> buffer(new UChar[source->Length()]);
-  int written = source->Write(
-      isolate, reinterpret_cast<uint16_t*>(buffer.get()), 0, source->Length());
-
-  const uint8_t* data = nullptr;
-  size_t sizeInBytes = sizeof(UChar) * written;
-  data = reinterpret_cast<const uint8_t*>(buffer.get());
-
-  uint8_t hash[kSizeOfSha256Digest];
-  v8::internal::SHA256_hash(data, sizeInBytes, hash);
+  // Hash the UTF-16 representation in fixed-size chunks instead of copying
+  // the whole source, which for large scripts would double their footprint.
+  static constexpr int kChunkLength = 4096;
+  uint16_t buffer[kChunkLength];
+  v8::internal::LITE_SHA256_CTX ctx;
+  v8::internal::SHA256_init(&ctx);
+  const int length = source->Length();
+  for (int start = 0; start < length; start += kChunkLength) {
+    int written = source->Write(isolate, buffer, start, kChunkLength,
+                                v8::String::NO_NULL_TERMINATION);
+    v8::internal::SHA256_update(&ctx, buffer, sizeof(uint16_t) * written);
+  }
+  const uint8_t* hash = v8::internal::SHA256_final(&ctx);
 
   String16Builder formatted_hash;
   for (size_t i = 0; i < kSizeOfSha256Digest; i++)
@@ -219,6 +222,15 @@ class ActualScript : public V8DebuggerScript {
   const String16& hash() const override {
     if (!m_hash.isEmpty()) return m_hash;
     v8::HandleScope scope(m_isolate);
+    // The hash is cached on the script itself, so that sessions attaching
+    // later and other agents do not hash the source again.
+    v8::Local<v8::String> cachedHash;
+    if (!m_script.IsEmpty() &&
+        script()->GetSha256Hash().ToLocal(&cachedHash) &&
+        cachedHash->Length() > 0) {
+      m_hash = toProtocolString(m_isolate, cachedHash);
+      return m_hash;
+    }
     v8::Local<v8::String> v8Source;
     if (!m_scriptSource.Get(m_isolate)->JavaScriptCode().ToLocal(&v8Source)) {
       v8Source = v8::String::Empty(m_isolate);
@@ -276,11 +288,6 @@ class ActualScript : public V8DebuggerScript {
 
     m_isModule = script->IsModule();
 
-    bool hasHash = script->GetSha256Hash().ToLocal(&tmp) && tmp->Length() > 0;
-    if (hasHash) {
-      m_hash = toProtocolString(m_isolate, tmp);
-    }
-
     m_script.Reset(m_isolate, script);
     m_script.AnnotateStrongRetainer(kGlobalDebuggerScriptHandleLabel);
     m_scriptSource.Reset(m_isolate, script->Source());
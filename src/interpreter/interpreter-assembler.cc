@@ -1243,11 +1243,58 @@ void InterpreterAssembler::InlineShortStar(TNode<WordT> target_bytecode) {
   implicit_register_use_ = previous_acc_use;
 }
 
+void InterpreterAssembler::JumpIfBooleanDispatchLookahead(
+    TNode<WordT> target_bytecode) {
+  Label is_jump_if_true(this), is_jump_if_false(this), done(this);
+
+  // Comparisons are almost always followed by a conditional jump, so handle
+  // the jump here rather than paying for another dispatch. The DebugBreak
+  // bytecodes that replace a jump when a break point is set don't match, so
+  // they are still dispatched to as usual.
+  TNode<Word32T> next_bytecode = TruncateWordToInt32(target_bytecode);
+  GotoIf(Word32Equal(next_bytecode,
+                     Int32Constant(static_cast<int>(Bytecode::kJumpIfTrue))),
+         &is_jump_if_true);
+  Branch(Word32Equal(next_bytecode,
+                     Int32Constant(static_cast<int>(Bytecode::kJumpIfFalse))),
+         &is_jump_if_false, &done);
+
+  Bytecode previous_bytecode = bytecode_;
+  ImplicitRegisterUse previous_acc_use = implicit_register_use_;
+
+  BIND(&is_jump_if_true);
+  {
+    bytecode_ = Bytecode::kJumpIfTrue;
+    implicit_register_use_ = ImplicitRegisterUse::kNone;
+#ifdef V8_TRACE_UNOPTIMIZED
+    TraceBytecode(Runtime::kTraceUnoptimizedBytecodeEntry);
+#endif
+    JumpIfTaggedEqual(GetAccumulator(), TrueConstant(), 0);
+  }
+
+  BIND(&is_jump_if_false);
+  {
+    bytecode_ = Bytecode::kJumpIfFalse;
+    implicit_register_use_ = ImplicitRegisterUse::kNone;
+#ifdef V8_TRACE_UNOPTIMIZED
+    TraceBytecode(Runtime::kTraceUnoptimizedBytecodeEntry);
+#endif
+    JumpIfTaggedEqual(GetAccumulator(), FalseConstant(), 0);
+  }
+
+  bytecode_ = previous_bytecode;
+  implicit_register_use_ = previous_acc_use;
+  BIND(&done);
+}
+
 void InterpreterAssembler::Dispatch() {
   Comment("========= Dispatch");
   DCHECK_IMPLIES(Bytecodes::MakesCallAlongCriticalPath(bytecode_), made_call_);
   TNode<IntPtrT> target_offset = Advance();
   TNode<WordT> target_bytecode = LoadBytecode(target_offset);
+  if (Bytecodes::IsJumpIfBooleanLookahead(bytecode_, operand_scale_)) {
+    JumpIfBooleanDispatchLookahead(target_bytecode);
+  }
   DispatchToBytecodeWithOptionalStarLookahead(target_bytecode);
 }
 
@@ -435,6 +435,12 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // the next dispatch offset.
   void InlineShortStar(TNode<WordT> target_bytecode);
 
+  // Look ahead for a single-width JumpIfTrue or JumpIfFalse and inline it in a
+  // branch, including the subsequent dispatch on either side of the jump.
+  // Anything after this point can assume that the following instruction was
+  // not one of them.
+  void JumpIfBooleanDispatchLookahead(TNode<WordT> target_bytecode);
+
   // Dispatch to the bytecode handler with code entry point |handler_entry|.
   void DispatchToBytecodeHandlerEntry(TNode<RawPtrT> handler_entry,
                                       TNode<IntPtrT> bytecode_offset);
@@ -21,6 +21,7 @@
 #include "src/roots/roots.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
+#include "src/strings/string-simd.h"
 
 namespace v8 {
 namespace internal {
@@ -122,6 +123,30 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+// The map of the last object built as an array element is cached weakly per
+// native context, so that the cache doesn't keep the map, and through it its
+// prototype and constructor, alive. Returns Smi zero if there is no map.
+Object CachedJsonParseElementMap(NativeContext native_context) {
+  HeapObject cache = native_context.json_parse_element_map();
+  HeapObject map;
+  if (cache.IsWeakFixedArray() &&
+      WeakFixedArray::cast(cache).Get(0).GetHeapObjectIfWeak(&map)) {
+    return map;
+  }
+  return Smi::zero();
+}
+
+void CacheJsonParseElementMap(Isolate* isolate, Handle<Map> map) {
+  Handle<NativeContext> native_context = isolate->native_context();
+  if (!native_context->json_parse_element_map().IsWeakFixedArray()) {
+    Handle<WeakFixedArray> cache =
+        isolate->factory()->NewWeakFixedArray(1, AllocationType::kOld);
+    native_context->set_json_parse_element_map(*cache);
+  }
+  WeakFixedArray::cast(native_context->json_parse_element_map())
+      .Set(0, HeapObjectReference::Weak(*map));
+}
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(
@@ -1178,21 +1203,36 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue(Handle<Object> reviver) {
           }
 
           Handle<Map> feedback;
-          if (cont_stack.size() > 0 &&
-              cont_stack.back().type() == JsonContinuation::kArrayElement &&
-              cont_stack.back().index < element_stack.size() &&
-              element_stack.back()->IsJSObject()) {
-            Map maybe_feedback = JSObject::cast(*element_stack.back()).map();
+          const bool is_array_element =
+              cont_stack.size() > 0 &&
+              cont_stack.back().type() == JsonContinuation::kArrayElement;
+          if (is_array_element) {
+            // Objects in an array likely have the same shape as their previous
+            // sibling. The first one gets the map of the last object built as
+            // an array element in this native context, possibly by an earlier
+            // JSON.parse call.
+            Object maybe_feedback =
+                cont_stack.back().index < element_stack.size()
+                    ? *element_stack.back()
+                    : CachedJsonParseElementMap(*isolate_->native_context());
+            if (maybe_feedback.IsJSObject()) {
+              maybe_feedback = JSObject::cast(maybe_feedback).map();
+            }
             // Don't consume feedback from objects with a map that's detached
             // from the transition tree.
-            if (!maybe_feedback.IsDetached(isolate_)) {
-              feedback = handle(maybe_feedback, isolate_);
-              if (maybe_feedback.is_deprecated()) {
+            if (maybe_feedback.IsMap() &&
+                !Map::cast(maybe_feedback).IsDetached(isolate_)) {
+              feedback = handle(Map::cast(maybe_feedback), isolate_);
+              if (feedback->is_deprecated()) {
                 feedback = Map::Update(isolate_, feedback);
               }
             }
           }
           value = BuildJsonObject(cont, property_stack, feedback);
+          if (is_array_element) {
+            CacheJsonParseElementMap(
+                isolate_, handle(JSObject::cast(*value).map(), isolate_));
+          }
           Expect(JsonToken::RBRACE,
                  MessageTemplate::kJsonParseExpectedCommaOrRBrace);
           // Return the object.
@@ -1457,11 +1497,10 @@ void JsonParser<Char>::DecodeString(SinkChar* sink, int start, int length) {
   const Char* cursor = chars_ + start;
   while (true) {
     const Char* end = cursor + length - (sink - sink_start);
-    cursor = std::find_if(cursor, end, [&sink](Char c) {
-      if (c == '\\') return true;
-      *sink++ = c;
-      return false;
-    });
+    const Char* escape = std::find(cursor, end, '\\');
+    CopyChars(sink, cursor, escape - cursor);
+    sink += escape - cursor;
+    cursor = escape;
 
     if (cursor == end) return;
 
@@ -1523,13 +1562,17 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
-    cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
-      if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
-        bits |= c;
-        return false;
-      }
-      return MayTerminateJsonString(character_json_scan_flags[c]);
-    });
+    if constexpr (sizeof(Char) == 1) {
+      cursor_ = FindJsonSpecialChar(cursor_, end_);
+    } else {
+      cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
+        if (V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
+          bits |= c;
+          return false;
+        }
+        return MayTerminateJsonString(character_json_scan_flags[c]);
+      });
+    }
 
     if (V8_UNLIKELY(is_at_end())) {
       AllowGarbageCollection allow_before_exception;
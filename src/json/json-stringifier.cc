@@ -4,6 +4,7 @@
 
 #include "src/json/json-stringifier.h"
 
+#include "src/base/bits.h"
 #include "src/base/strings.h"
 #include "src/common/message-template.h"
 #include "src/numbers/conversions.h"
@@ -16,6 +17,18 @@
 #include "src/objects/ordered-hash-table.h"
 #include "src/objects/smi.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/string-simd.h"
+
+#ifdef V8_HOST_ARCH_X64
+// SSE2 is part of the x64 baseline.
+#include <emmintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+// ARM64 is guaranteed to have Neon.
+#define NEON64
+#include <arm_neon.h>
+#endif
 
 namespace v8 {
 namespace internal {
@@ -98,6 +111,12 @@ class JsonStringifier {
   template <typename SrcChar, typename DestChar>
   V8_INLINE void SerializeString_(Handle<String> string);
 
+  template <typename SrcChar, typename DestChar>
+  V8_INLINE void SerializeStringContents_(Handle<String> string);
+
+  template <typename DestChar>
+  void SerializeOneByteConsString_(Handle<ConsString> cons);
+
   template <typename Char>
   V8_INLINE static bool DoNotEscape(Char c);
 
@@ -943,6 +962,68 @@ JsonStringifier::Result JsonStringifier::SerializeJSProxy(
   return SUCCESS;
 }
 
+namespace {
+
+// Characters that JSON.stringify emits unchanged. DoNotEscape is stricter,
+// some of these go through JsonEscapeTable, which maps them to themselves.
+// One-byte characters are the ones FindJsonSpecialChar skips over.
+V8_INLINE bool IsVerbatimJsonChar(base::uc16 c) {
+  return c >= 0x20 && c != '"' && c != '\\' && (c & 0xF800) != 0xD800;
+}
+
+// Returns the index of the first character in chars[index, length) that
+// isn't serialized verbatim, or length. Checks 16 bytes at a time where SIMD
+// is available, using the scanner the JSON parser uses for one-byte strings.
+int FindNonVerbatimJsonChar(const uint8_t* chars, int index, int length) {
+  return static_cast<int>(
+      FindJsonSpecialChar(chars + index, chars + length) - chars);
+}
+
+int FindNonVerbatimJsonChar(const base::uc16* chars, int index, int length) {
+  int i = index;
+#if defined(V8_HOST_ARCH_X64)
+  const __m128i quote = _mm_set1_epi16('"');
+  const __m128i backslash = _mm_set1_epi16('\\');
+  const __m128i control_bits = _mm_set1_epi16(static_cast<int16_t>(0xFFE0));
+  const __m128i surrogate_bits = _mm_set1_epi16(static_cast<int16_t>(0xF800));
+  const __m128i surrogate = _mm_set1_epi16(static_cast<int16_t>(0xD800));
+  for (; length - i >= 8; i += 8) {
+    const __m128i c =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
+    const __m128i escape = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi16(c, quote), _mm_cmpeq_epi16(c, backslash)),
+        _mm_or_si128(
+            _mm_cmpeq_epi16(_mm_and_si128(c, control_bits),
+                            _mm_setzero_si128()),
+            _mm_cmpeq_epi16(_mm_and_si128(c, surrogate_bits), surrogate)));
+    // Two bits per character.
+    const uint32_t mask = _mm_movemask_epi8(escape);
+    if (mask != 0) return i + base::bits::CountTrailingZeros(mask) / 2;
+  }
+#elif defined(NEON64)
+  const uint16x8_t quote = vdupq_n_u16('"');
+  const uint16x8_t backslash = vdupq_n_u16('\\');
+  const uint16x8_t min_verbatim = vdupq_n_u16(0x20);
+  const uint16x8_t surrogate_bits = vdupq_n_u16(0xF800);
+  const uint16x8_t surrogate = vdupq_n_u16(0xD800);
+  for (; length - i >= 8; i += 8) {
+    const uint16x8_t c = vld1q_u16(chars + i);
+    const uint16x8_t escape = vorrq_u16(
+        vorrq_u16(vceqq_u16(c, quote), vceqq_u16(c, backslash)),
+        vorrq_u16(vcltq_u16(c, min_verbatim),
+                  vceqq_u16(vandq_u16(c, surrogate_bits), surrogate)));
+    // One byte per character.
+    const uint64_t mask =
+        vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(escape)), 0);
+    if (mask != 0) return i + base::bits::CountTrailingZeros(mask) / 8;
+  }
+#endif
+  while (i < length && IsVerbatimJsonChar(chars[i])) i++;
+  return i;
+}
+
+}  // namespace
+
 template <typename SrcChar, typename DestChar>
 void JsonStringifier::SerializeStringUnchecked_(
     base::Vector<const SrcChar> src,
@@ -953,7 +1034,10 @@ void JsonStringifier::SerializeStringUnchecked_(
   for (int i = 0; i < src.length(); i++) {
     SrcChar c = src[i];
     if (DoNotEscape(c)) {
-      dest->Append(c);
+      // Copy the whole run of characters that don't need escaping.
+      int end = FindNonVerbatimJsonChar(src.begin(), i + 1, src.length());
+      dest->AppendChars(src.begin() + i, end - i);
+      i = end - 1;
     } else if (sizeof(SrcChar) != 1 &&
                base::IsInRange(c, static_cast<SrcChar>(0xD800),
                                static_cast<SrcChar>(0xDFFF))) {
@@ -1004,8 +1088,14 @@ void JsonStringifier::SerializeStringUnchecked_(
 
 template <typename SrcChar, typename DestChar>
 void JsonStringifier::SerializeString_(Handle<String> string) {
-  int length = string->length();
   builder_.Append<uint8_t, DestChar>('"');
+  SerializeStringContents_<SrcChar, DestChar>(string);
+  builder_.Append<uint8_t, DestChar>('"');
+}
+
+template <typename SrcChar, typename DestChar>
+void JsonStringifier::SerializeStringContents_(Handle<String> string) {
+  int length = string->length();
   // We might be able to fit the whole escaped string in the current string
   // part, or we might need to allocate.
   if (int worst_case_length = builder_.EscapedLengthIfCurrentPartFits(length)) {
@@ -1067,6 +1157,25 @@ void JsonStringifier::SerializeString_(Handle<String> string) {
       }
     }
   }
+}
+
+template <typename DestChar>
+void JsonStringifier::SerializeOneByteConsString_(Handle<ConsString> cons) {
+  HandleScope handle_scope(isolate_);
+  std::vector<Handle<String>> leaves;
+  {
+    DisallowGarbageCollection no_gc;
+    ConsStringIterator iter(*cons);
+    int offset;
+    for (String leaf = iter.Next(&offset); !leaf.is_null();
+         leaf = iter.Next(&offset)) {
+      leaves.push_back(handle(leaf, isolate_));
+    }
+  }
+  builder_.Append<uint8_t, DestChar>('"');
+  for (Handle<String> leaf : leaves) {
+    SerializeStringContents_<uint8_t, DestChar>(leaf);
+  }
   builder_.Append<uint8_t, DestChar>('"');
 }
 
@@ -1108,6 +1217,19 @@ void JsonStringifier::SerializeDeferredKey(bool deferred_comma,
 }
 
 void JsonStringifier::SerializeString(Handle<String> object) {
+  // Serialize one-byte ropes leaf by leaf instead of copying them into a flat
+  // string first. Two-byte ones are flattened, since a surrogate pair may
+  // straddle two leaves.
+  if (object->IsConsString() && !object->IsFlat() &&
+      object->IsOneByteRepresentation()) {
+    if (builder_.CurrentEncoding() == String::ONE_BYTE_ENCODING) {
+      SerializeOneByteConsString_<uint8_t>(Handle<ConsString>::cast(object));
+    } else {
+      SerializeOneByteConsString_<base::uc16>(
+          Handle<ConsString>::cast(object));
+    }
+    return;
+  }
   object = String::Flatten(isolate_, object);
   if (builder_.CurrentEncoding() == String::ONE_BYTE_ENCODING) {
     if (String::IsOneByteRepresentationUnderneath(*object)) {
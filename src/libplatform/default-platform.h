@@ -29,7 +29,8 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
   explicit DefaultPlatform(
       int thread_pool_size = 0,
       IdleTaskSupport idle_task_support = IdleTaskSupport::kDisabled,
-      std::unique_ptr<v8::TracingController> tracing_controller = {});
+      std::unique_ptr<v8::TracingController> tracing_controller = {},
+      PriorityMode priority_mode = PriorityMode::kDontApply);
 
   ~DefaultPlatform() override;
 
@@ -56,6 +57,8 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
   std::shared_ptr<TaskRunner> GetForegroundTaskRunner(
       v8::Isolate* isolate) override;
   void CallOnWorkerThread(std::unique_ptr<Task> task) override;
+  void CallBlockingTaskOnWorkerThread(std::unique_ptr<Task> task) override;
+  void CallLowPriorityTaskOnWorkerThread(std::unique_ptr<Task> task) override;
   void CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
                                  double delay_in_seconds) override;
   bool IdleTasksEnabled(Isolate* isolate) override;
@@ -72,10 +75,25 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
   void NotifyIsolateShutdown(Isolate* isolate);
 
  private:
+  static constexpr int kNumTaskPriorities =
+      static_cast<int>(TaskPriority::kUserBlocking) + 1;
+
+  DefaultWorkerThreadsTaskRunner* worker_threads_task_runner(
+      TaskPriority priority) const {
+    return worker_threads_task_runners_[priority_mode_ == PriorityMode::kApply
+                                            ? static_cast<int>(priority)
+                                            : 0]
+        .get();
+  }
+
   base::Mutex lock_;
   const int thread_pool_size_;
   IdleTaskSupport idle_task_support_;
-  std::shared_ptr<DefaultWorkerThreadsTaskRunner> worker_threads_task_runner_;
+  const PriorityMode priority_mode_;
+  // Indexed by TaskPriority with PriorityMode::kApply. Otherwise only the
+  // first entry is used, for tasks of all priorities.
+  std::shared_ptr<DefaultWorkerThreadsTaskRunner>
+      worker_threads_task_runners_[kNumTaskPriorities];
   std::map<v8::Isolate*, std::shared_ptr<DefaultForegroundTaskRunner>>
       foreground_task_runner_map_;
 
@@ -25,9 +25,13 @@ double DelayedTaskQueue::MonotonicallyIncreasingTime() {
 }
 
 void DelayedTaskQueue::Append(std::unique_ptr<Task> task) {
-  base::MutexGuard guard(&lock_);
-  DCHECK(!terminated_);
-  task_queue_.push(std::move(task));
+  {
+    base::MutexGuard guard(&lock_);
+    DCHECK(!terminated_);
+    task_queue_.push(std::move(task));
+  }
+  // Notify outside of the lock, so that the woken up worker does not
+  // immediately block on |lock_| again.
   queues_condition_var_.NotifyOne();
 }
 
@@ -39,19 +43,24 @@ void DelayedTaskQueue::AppendDelayed(std::unique_ptr<Task> task,
     base::MutexGuard guard(&lock_);
     DCHECK(!terminated_);
     delayed_task_queue_.emplace(deadline, std::move(task));
-    queues_condition_var_.NotifyOne();
   }
+  queues_condition_var_.NotifyOne();
 }
 
 std::unique_ptr<Task> DelayedTaskQueue::GetNext() {
   base::MutexGuard guard(&lock_);
   for (;;) {
-    // Move delayed tasks that have hit their deadline to the main queue.
-    double now = MonotonicallyIncreasingTime();
-    std::unique_ptr<Task> task = PopTaskFromDelayedQueue(now);
-    while (task) {
-      task_queue_.push(std::move(task));
-      task = PopTaskFromDelayedQueue(now);
+    // Move delayed tasks that have hit their deadline to the main queue. The
+    // clock is only read if there are delayed tasks at all, which keeps the
+    // critical section short for the common case of immediate tasks.
+    double now = 0.0;
+    if (!delayed_task_queue_.empty()) {
+      now = MonotonicallyIncreasingTime();
+      std::unique_ptr<Task> task = PopTaskFromDelayedQueue(now);
+      while (task) {
+        task_queue_.push(std::move(task));
+        task = PopTaskFromDelayedQueue(now);
+      }
     }
     if (!task_queue_.empty()) {
       std::unique_ptr<Task> result = std::move(task_queue_.front());
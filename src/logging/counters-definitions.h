@@ -31,6 +31,13 @@ namespace internal {
   HR(gc_finalize_sweep, V8.GCFinalizeMC.Sweep, 0, 10000, 101)                  \
   HR(gc_scavenger_scavenge_main, V8.GCScavenger.ScavengeMain, 0, 10000, 101)   \
   HR(gc_scavenger_scavenge_roots, V8.GCScavenger.ScavengeRoots, 0, 10000, 101) \
+  HR(gc_scavenger_scavenge_update_refs, V8.GCScavenger.ScavengeUpdateRefs, 0,  \
+     10000, 101)                                                               \
+  HR(gc_scavenger_scavenge_weak, V8.GCScavenger.ScavengeWeak, 0, 10000, 101)   \
+  HR(gc_scavenger_scavenge_finalize, V8.GCScavenger.ScavengeFinalize, 0,       \
+     10000, 101)                                                               \
+  HR(gc_scavenger_free_remembered_set, V8.GCScavenger.FreeRememberedSet, 0,    \
+     10000, 101)                                                               \
   HR(gc_marking_sum, V8.GCMarkingSum, 0, 10000, 101)                           \
   /* Asm/Wasm. */                                                              \
   HR(wasm_functions_per_asm_module, V8.WasmFunctionsPerModule.asm, 1, 1000000, \
@@ -42,6 +49,7 @@ namespace internal {
   HR(array_buffer_new_size_failures, V8.ArrayBufferNewSizeFailures, 0, 4096,   \
      13)                                                                       \
   HR(shared_array_allocations, V8.SharedArrayAllocationSizes, 0, 4096, 13)     \
+  HR(turbofan_queue_length, V8.TurboFanConcurrentQueueLength, 0, 256, 33)      \
   HR(wasm_asm_huge_function_size_bytes, V8.WasmHugeFunctionSizeBytes.asm,      \
      100 * KB, GB, 51)                                                         \
   HR(wasm_wasm_huge_function_size_bytes, V8.WasmHugeFunctionSizeBytes.wasm,    \
@@ -344,7 +352,8 @@ namespace internal {
   SC(wasm_generated_code_size, V8.WasmGeneratedCodeBytes)                      \
   SC(wasm_reloc_size, V8.WasmRelocBytes)                                       \
   SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions)           \
-  SC(wasm_compiled_export_wrapper, V8.WasmCompiledExportWrappers)
+  SC(wasm_compiled_export_wrapper, V8.WasmCompiledExportWrappers)              \
+  SC(turbofan_queue_evictions, V8.TurboFanConcurrentQueueEvictions)
 
 // List of counters that can be incremented from generated code. We need them in
 // a separate list to be able to relocate them.
@@ -5,6 +5,7 @@
 #include "src/logging/metrics.h"
 
 #include "include/v8-platform.h"
+#include "src/flags/flags.h"
 
 namespace v8 {
 namespace internal {
@@ -42,6 +43,13 @@ void Recorder::SetEmbedderRecorder(
 
 bool Recorder::HasEmbedderRecorder() const { return embedder_recorder_.get(); }
 
+bool Recorder::ShouldSampleJitEvent(base::RandomNumberGenerator* rng) const {
+  if (!embedder_recorder_) return false;
+  const unsigned int rate = v8_flags.metrics_jit_sampling_rate;
+  if (rate <= 1) return rate == 1;
+  return rng->NextInt(static_cast<int>(rate)) == 0;
+}
+
 void Recorder::NotifyIsolateDisposal() {
   if (embedder_recorder_) {
     embedder_recorder_->NotifyIsolateDisposal();
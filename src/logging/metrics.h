@@ -11,6 +11,7 @@
 #include "include/v8-metrics.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/time.h"
+#include "src/base/utils/random-number-generator.h"
 #include "src/init/v8.h"
 
 namespace v8 {
@@ -30,6 +31,11 @@ class Recorder : public std::enable_shared_from_this<Recorder> {
 
   V8_EXPORT_PRIVATE void NotifyIsolateDisposal();
 
+  // Returns whether a deoptimization or optimized compilation event should be
+  // reported, sampling them according to --metrics-jit-sampling-rate.
+  V8_EXPORT_PRIVATE bool ShouldSampleJitEvent(
+      base::RandomNumberGenerator* rng) const;
+
   template <class T>
   void AddMainThreadEvent(const T& event,
                           v8::metrics::Recorder::ContextId id) {
@@ -38,6 +38,7 @@
 #include "src/maglev/maglev-interpreter-frame-state.h"
 #include "src/maglev/maglev-ir-inl.h"
 #include "src/maglev/maglev-ir.h"
+#include "src/maglev/maglev-loop-invariant-code-motion.h"
 #include "src/maglev/maglev-phi-representation-selector.h"
 #include "src/maglev/maglev-regalloc-data.h"
 #include "src/maglev/maglev-regalloc.h"
@@ -355,6 +356,18 @@ bool MaglevCompiler::Compile(LocalIsolate* local_isolate,
       std::cout << "\nAfter Phi untagging" << std::endl;
       PrintGraph(std::cout, compilation_info, graph);
     }
+
+    if (v8_flags.maglev_licm) {
+      GraphProcessor<MaglevLoopInvariantCodeMotion,
+                     /*visit_identity_nodes*/ true>
+          licm(compilation_info);
+      licm.ProcessGraph(graph);
+
+      if (v8_flags.print_maglev_graph) {
+        std::cout << "\nAfter loop invariant code motion" << std::endl;
+        PrintGraph(std::cout, compilation_info, graph);
+      }
+    }
   }
 
 #ifdef DEBUG
@@ -4,12 +4,14 @@
 
 #include "src/maglev/maglev-concurrent-dispatcher.h"
 
+#include "src/base/platform/time.h"
 #include "src/codegen/compiler.h"
 #include "src/compiler/compilation-dependencies.h"
 #include "src/compiler/js-heap-broker.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
 #include "src/handles/persistent-handles.h"
+#include "src/heap/heap-inl.h"
 #include "src/maglev/maglev-compilation-info.h"
 #include "src/maglev/maglev-compiler.h"
 #include "src/maglev/maglev-graph-labeller.h"
@@ -215,9 +217,28 @@ void MaglevConcurrentDispatcher::EnqueueJob(
   job_handle_->NotifyConcurrencyIncrease();
 }
 
-void MaglevConcurrentDispatcher::FinalizeFinishedJobs() {
+void MaglevConcurrentDispatcher::FinalizeFinishedJobs(bool use_time_budget) {
   HandleScope handle_scope(isolate_);
+  // Jobs tend to finish in bursts, e.g. after startup. Finalize them as one
+  // batch, so that the permissions of the code pages are only switched back
+  // once at the end.
+  CodePageCollectionMemoryModificationScope batch_allocation(isolate_->heap());
+  base::Optional<base::TimeDelta> budget = finalization_budget_for_testing_;
+  if (!budget.has_value() && v8_flags.maglev_finalization_budget_ms > 0) {
+    budget = base::TimeDelta::FromMilliseconds(
+        v8_flags.maglev_finalization_budget_ms);
+  }
+  const bool has_deadline = use_time_budget && budget.has_value();
+  const base::TimeTicks deadline =
+      has_deadline ? base::TimeTicks::Now() + budget.value()
+                   : base::TimeTicks();
   while (!outgoing_queue_.IsEmpty()) {
+    if (has_deadline && base::TimeTicks::Now() >= deadline) {
+      // Leave the remaining jobs to the next interrupt, so that a large batch
+      // doesn't block the main thread for too long.
+      isolate_->stack_guard()->RequestInstallMaglevCode();
+      return;
+    }
     std::unique_ptr<MaglevCompilationJob> job;
     outgoing_queue_.Dequeue(&job);
     TRACE_EVENT_WITH_FLOW0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
@@ -227,6 +248,10 @@ void MaglevConcurrentDispatcher::FinalizeFinishedJobs() {
   }
 }
 
+size_t MaglevConcurrentDispatcher::finished_jobs_for_testing() const {
+  return outgoing_queue_.size();
+}
+
 void MaglevConcurrentDispatcher::AwaitCompileJobs() {
   // Use Join to wait until there are no more queued or running jobs.
   job_handle_->Join();
@@ -9,6 +9,8 @@
 
 #include <memory>
 
+#include "src/base/optional.h"
+#include "src/base/platform/time.h"
 #include "src/codegen/compiler.h"  // For OptimizedCompilationJob.
 #include "src/utils/locked-queue.h"
 
@@ -88,18 +90,28 @@ class MaglevConcurrentDispatcher final {
   // Called from the main thread.
   void EnqueueJob(std::unique_ptr<MaglevCompilationJob>&& job);
 
-  // Called from the main thread.
-  void FinalizeFinishedJobs();
+  // Called from the main thread. With {use_time_budget}, finalization stops
+  // after --maglev-finalization-budget-ms and the remaining jobs are finalized
+  // on the next interrupt.
+  void FinalizeFinishedJobs(bool use_time_budget = false);
 
   void AwaitCompileJobs();
 
   bool is_enabled() const { return static_cast<bool>(job_handle_); }
 
+  // Used instead of --maglev-finalization-budget-ms. A zero budget is used up
+  // before the first job is finalized.
+  void set_finalization_budget_for_testing(base::TimeDelta budget) {
+    finalization_budget_for_testing_ = budget;
+  }
+  size_t finished_jobs_for_testing() const;
+
  private:
   Isolate* const isolate_;
   std::unique_ptr<JobHandle> job_handle_;
   QueueT incoming_queue_;
   QueueT outgoing_queue_;
+  base::Optional<base::TimeDelta> finalization_budget_for_testing_;
 };
 
 }  // namespace maglev
@@ -1982,6 +1982,16 @@ bool MaglevGraphBuilder::CanElideWriteBarrier(ValueNode* object,
     return true;
   }
 
+  // Nor if the object is part of the current young allocation: nothing that
+  // could trigger a GC has happened since it was allocated, so it is still in
+  // the young generation and unreachable from the heap. This matches
+  // TurboFan's and Turboshaft's memory optimizers, which skip barriers for
+  // stores into the last young allocation group.
+  if (allocation != nullptr && allocation == current_raw_allocation_ &&
+      allocation->allocation_type() == AllocationType::kYoung) {
+    return true;
+  }
+
   return false;
 }
 
@@ -2370,8 +2380,16 @@ ReduceResult MaglevGraphBuilder::TryBuildNamedAccess(
   ZoneVector<compiler::PropertyAccessInfo> access_infos(zone());
   {
     ZoneVector<compiler::PropertyAccessInfo> access_infos_for_feedback(zone());
+    // TODO(v8:12547): Support writing to objects in shared space, which need
+    // a write barrier that calls Object::Share to ensure the RHS is shared.
+    auto is_shared_store = [access_mode](compiler::MapRef map) {
+      return access_mode == compiler::AccessMode::kStore &&
+             InstanceTypeChecker::IsAlwaysSharedSpaceJSObject(
+                 map.instance_type());
+    };
     if (Constant* n = lookup_start_object->TryCast<Constant>()) {
       compiler::MapRef constant_map = n->object().map(broker());
+      if (is_shared_store(constant_map)) return ReduceResult::Fail();
       compiler::PropertyAccessInfo access_info =
           broker()->GetPropertyAccessInfo(constant_map, feedback.name(),
                                           access_mode);
@@ -2379,6 +2397,7 @@ ReduceResult MaglevGraphBuilder::TryBuildNamedAccess(
     } else {
       for (const compiler::MapRef& map : feedback.maps()) {
         if (map.is_deprecated()) continue;
+        if (is_shared_store(map)) return ReduceResult::Fail();
         compiler::PropertyAccessInfo access_info =
             broker()->GetPropertyAccessInfo(map, feedback.name(), access_mode);
         access_infos_for_feedback.push_back(access_info);
@@ -3570,7 +3589,15 @@ bool MaglevGraphBuilder::ShouldInlineCall(compiler::JSFunctionRef function,
         break;
     }
   }
-  if (call_frequency < v8_flags.min_inlining_frequency) {
+  // Recursive calls are not unrolled; every level would only grow the graph.
+  for (const MaglevCompilationUnit* unit = compilation_unit_; unit != nullptr;
+       unit = unit->caller()) {
+    if (unit->shared_function_info().equals(shared)) {
+      TRACE_CANNOT_INLINE("it is recursive");
+      return false;
+    }
+  }
+  if (call_frequency < v8_flags.min_maglev_inlining_frequency) {
     TRACE_CANNOT_INLINE("call frequency ("
                         << call_frequency << ") < minimum thredshold ("
                         << v8_flags.min_maglev_inlining_frequency << ")");
@@ -3578,6 +3605,9 @@ bool MaglevGraphBuilder::ShouldInlineCall(compiler::JSFunctionRef function,
   }
   if (bytecode.length() < v8_flags.max_maglev_inlined_bytecode_size_small) {
     TRACE_INLINING("  inlining " << shared << ": small function");
+    // Small functions are always inlined, but still count towards the
+    // cumulative budget so that chains of them are bounded.
+    graph()->add_inlined_bytecode_size(bytecode.length());
     return true;
   }
   if (bytecode.length() > v8_flags.max_maglev_inlined_bytecode_size) {
@@ -5225,6 +5255,13 @@ MaglevGraphBuilder::TryReadBoilerplateForFastLiteral(
 
 ValueNode* MaglevGraphBuilder::ExtendOrReallocateCurrentRawAllocation(
     int size, AllocationType allocation_type) {
+  // For non-generational heap, all young allocations are redirected to old
+  // space. Normalize the type here so that CanElideWriteBarrier never treats
+  // such an allocation as young.
+  if (v8_flags.single_generation &&
+      allocation_type == AllocationType::kYoung) {
+    allocation_type = AllocationType::kOld;
+  }
   if (!current_raw_allocation_ ||
       current_raw_allocation_->allocation_type() != allocation_type) {
     current_raw_allocation_ =
@@ -5327,7 +5364,6 @@ ValueNode* MaglevGraphBuilder::BuildAllocateFastLiteral(
           {allocation, GetSmiConstant(value.length)},
           FixedArray::kLengthOffset);
       for (int i = 0; i < value.length; ++i) {
-        // TODO(leszeks): Elide the write barrier where possible.
         BuildStoreTaggedField(allocation, elements[i],
                               FixedArray::OffsetOfElementAt(i));
       }
@@ -0,0 +1,114 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/maglev/maglev-loop-invariant-code-motion.h"
+
+#include "src/maglev/maglev-graph-printer.h"
+#include "src/maglev/maglev-graph.h"
+
+namespace v8 {
+namespace internal {
+namespace maglev {
+
+void MaglevLoopInvariantCodeMotion::PreProcessBasicBlock(BasicBlock* block) {
+  if (!block->is_loop()) return;
+  MergePointInterpreterFrameState* state = block->state();
+  BasicBlock* preheader = nullptr;
+  // Blocks are in bytecode order, so the body of a loop is exactly the blocks
+  // between its header and its JumpLoop. Hoisting requires a single forward
+  // edge, which has to be an unconditional jump so that the hoisted nodes
+  // only execute when the loop is entered.
+  if (!state->is_resumable_loop() && state->predecessor_count() == 2) {
+    BasicBlock* predecessor = state->predecessor_at(0);
+    if (predecessor->control_node()->Is<Jump>() &&
+        !predecessor->is_exception_handler_block()) {
+      preheader = predecessor;
+    }
+  }
+  current_loop_ = zone_->New<LoopInfo>(LoopInfo{block, preheader,
+                                                current_loop_});
+}
+
+MaglevLoopInvariantCodeMotion::LoopInfo* MaglevLoopInvariantCodeMotion::LoopOf(
+    ValueNode* node) const {
+  auto it = node_loops_.find(node);
+  if (it == node_loops_.end()) return nullptr;
+  return it->second;
+}
+
+bool MaglevLoopInvariantCodeMotion::IsInvariantIn(ValueNode* node,
+                                                  const LoopInfo* loop) const {
+  for (Input& input : *node) {
+    for (const LoopInfo* input_loop = LoopOf(input.node());
+         input_loop != nullptr; input_loop = input_loop->parent) {
+      if (input_loop == loop) return false;
+    }
+  }
+  return true;
+}
+
+MaglevLoopInvariantCodeMotion::LoopInfo*
+MaglevLoopInvariantCodeMotion::FindTargetLoop(
+    const Candidate& candidate) const {
+  LoopInfo* loop = LoopOf(candidate.node);
+  if (candidate.reads_memory) {
+    // Loads are only hoisted out of the loop whose header they are in, and
+    // only if the loop can't change the value they read.
+    DCHECK_EQ(loop->header, candidate.block);
+    if (loop->preheader == nullptr || loop->has_side_effects ||
+        !IsInvariantIn(candidate.node, loop)) {
+      return nullptr;
+    }
+    return loop;
+  }
+  // Pure nodes are moved out of as many loops as possible.
+  LoopInfo* target = nullptr;
+  for (; loop != nullptr && IsInvariantIn(candidate.node, loop);
+       loop = loop->parent) {
+    if (loop->preheader != nullptr) target = loop;
+  }
+  return target;
+}
+
+void MaglevLoopInvariantCodeMotion::PostProcessGraph(Graph* graph) {
+  DCHECK_NULL(current_loop_);
+  // Candidates are in graph order, so the inputs of a candidate have already
+  // been moved if they could be, and their new loop is taken into account.
+  ZoneVector<std::pair<BasicBlock*, Node*>> moves(zone_);
+  ZoneUnorderedSet<Node*> moved_nodes(zone_);
+  ZoneUnorderedSet<BasicBlock*> changed_blocks(zone_);
+  for (const Candidate& candidate : candidates_) {
+    LoopInfo* target = FindTargetLoop(candidate);
+    if (target == nullptr) continue;
+    if (v8_flags.trace_maglev_licm && compilation_info_->has_graph_labeller()) {
+      std::cout << "Hoisting "
+                << PrintNodeLabel(compilation_info_->graph_labeller(),
+                                  candidate.node)
+                << " into the loop preheader" << std::endl;
+    }
+    moves.emplace_back(target->preheader, candidate.node);
+    moved_nodes.insert(candidate.node);
+    changed_blocks.insert(candidate.block);
+    node_loops_[candidate.node] = target->parent;
+  }
+
+  for (BasicBlock* block : changed_blocks) {
+    Node::List& nodes = block->nodes();
+    for (auto it = nodes.begin(); it != nodes.end();) {
+      if (moved_nodes.count(*it)) {
+        it = nodes.RemoveAt(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+  // Appending in graph order keeps every hoisted node after its inputs.
+  for (auto& [preheader, node] : moves) {
+    preheader->nodes().Add(node);
+  }
+}
+
+}  // namespace maglev
+}  // namespace internal
+}  // namespace v8
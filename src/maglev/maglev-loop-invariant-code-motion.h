@@ -0,0 +1,136 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_MAGLEV_MAGLEV_LOOP_INVARIANT_CODE_MOTION_H_
+#define V8_MAGLEV_MAGLEV_LOOP_INVARIANT_CODE_MOTION_H_
+
+#include <type_traits>
+
+#include "src/maglev/maglev-basic-block.h"
+#include "src/maglev/maglev-compilation-info.h"
+#include "src/maglev/maglev-graph-processor.h"
+#include "src/maglev/maglev-ir.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace maglev {
+
+class Graph;
+
+// Moves loop invariant nodes into the block that jumps into their loop (the
+// preheader), so that they are computed once instead of on every iteration.
+//
+// Two kinds of nodes are hoisted:
+//
+//   - Pure nodes which can neither deopt nor call, from anywhere in the loop.
+//     Executing them when the loop body wouldn't have is harmless.
+//
+//   - Loads (and other reading nodes which can neither deopt nor call) from
+//     the loop header, if they are not preceded by any node in the header that
+//     could deopt or have side effects, and if the whole loop has no side
+//     effects. Such a load would have been executed right at loop entry
+//     anyway, and nothing in the loop can change the value it reads.
+//
+// Checks (or any node which can deopt) are not hoisted, since their deopt
+// frames refer to the interpreter state inside of the loop. In practice, the
+// checks of values which don't change in the loop are mostly elided already by
+// the graph builder, since KnownNodeAspects keeps node types and stable maps
+// across loop headers.
+//
+// The pass only records nodes while the graph is walked, and moves them in
+// PostProcessGraph, once the side effects of every loop are known.
+class MaglevLoopInvariantCodeMotion {
+ public:
+  explicit MaglevLoopInvariantCodeMotion(
+      MaglevCompilationInfo* compilation_info)
+      : compilation_info_(compilation_info),
+        zone_(compilation_info->zone()),
+        node_loops_(zone_),
+        candidates_(zone_) {}
+
+  void PreProcessGraph(Graph* graph) {}
+  void PostProcessGraph(Graph* graph);
+  void PreProcessBasicBlock(BasicBlock* block);
+
+  void Process(Phi* node, const ProcessingState& state) { Record(node); }
+
+  void Process(JumpLoop* node, const ProcessingState& state) {
+    if (current_loop_ != nullptr &&
+        current_loop_->header == node->target()) {
+      current_loop_ = current_loop_->parent;
+    }
+  }
+
+  template <class NodeT>
+  void Process(NodeT* node, const ProcessingState& state) {
+    if (current_loop_ == nullptr) return;
+    const OpProperties properties = node->properties();
+    bool is_barrier = properties.can_deopt() || properties.is_any_call() ||
+                      properties.has_any_side_effects();
+    if (properties.has_any_side_effects() || properties.is_call()) {
+      for (LoopInfo* loop = current_loop_; loop != nullptr;
+           loop = loop->parent) {
+        loop->has_side_effects = true;
+      }
+    }
+    if constexpr (std::is_base_of_v<ValueNode, NodeT>) {
+      Record(node);
+      if constexpr (!std::is_same_v<NodeT, Identity> &&
+                    !std::is_same_v<NodeT, FoldedAllocation> &&
+                    !std::is_same_v<NodeT, GeneratorRestoreRegister>) {
+        if (!is_barrier && node->input_count() > 0 &&
+            (properties.is_pure() || IsInHeaderPrefix(state.block()))) {
+          candidates_.push_back({node, state.block(), current_loop_,
+                                 !properties.is_pure()});
+        }
+      }
+    }
+    if (is_barrier && state.block() == current_loop_->header) {
+      current_loop_->header_prefix_ended = true;
+    }
+  }
+
+ private:
+  struct LoopInfo {
+    BasicBlock* header;
+    // The only forward predecessor of the header, or nullptr if nodes can't
+    // be hoisted out of this loop.
+    BasicBlock* preheader;
+    LoopInfo* parent;
+    bool has_side_effects = false;
+    bool header_prefix_ended = false;
+  };
+
+  struct Candidate {
+    ValueNode* node;
+    BasicBlock* block;
+    LoopInfo* loop;
+    bool reads_memory;
+  };
+
+  void Record(ValueNode* node) { node_loops_[node] = current_loop_; }
+
+  bool IsInHeaderPrefix(BasicBlock* block) const {
+    return block == current_loop_->header &&
+           !current_loop_->header_prefix_ended;
+  }
+
+  LoopInfo* LoopOf(ValueNode* node) const;
+  bool IsInvariantIn(ValueNode* node, const LoopInfo* loop) const;
+  LoopInfo* FindTargetLoop(const Candidate& candidate) const;
+
+  MaglevCompilationInfo* const compilation_info_;
+  Zone* const zone_;
+  LoopInfo* current_loop_ = nullptr;
+  // The innermost loop of every node visited inside of a loop.
+  ZoneUnorderedMap<ValueNode*, LoopInfo*> node_loops_;
+  ZoneVector<Candidate> candidates_;
+};
+
+}  // namespace maglev
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_MAGLEV_MAGLEV_LOOP_INVARIANT_CODE_MOTION_H_
@@ -220,6 +220,8 @@ enum ContextLookupFlags {
   V(JS_TEMPORAL_ZONED_DATE_TIME_FUNCTION_INDEX, JSFunction,                    \
     temporal_zoned_date_time_function)                                         \
   V(JSON_OBJECT, JSObject, json_object)                                        \
+  /* Undefined or a WeakFixedArray holding a weak reference to a Map. */       \
+  V(JSON_PARSE_ELEMENT_MAP_INDEX, HeapObject, json_parse_element_map)          \
   V(TEMPORAL_INSTANT_FIXED_ARRAY_FROM_ITERABLE_FUNCTION_INDEX, JSFunction,     \
     temporal_instant_fixed_array_from_iterable)                                \
   V(STRING_FIXED_ARRAY_FROM_ITERABLE_FUNCTION_INDEX, JSFunction,               \
@@ -255,6 +255,26 @@ void CopyDictionaryToObjectElements(Isolate* isolate, FixedArrayBase from_base,
     copy_size = to_length - to_start;
   }
   WriteBarrierMode write_barrier_mode = GetWriteBarrierMode(to, to_kind, no_gc);
+  if (from.Capacity() < copy_size) {
+    // Sparse dictionaries are cheaper to walk than to look up every index of
+    // the copied range in.
+    MemsetTagged(to.RawFieldOfElementAt(to_start),
+                 ReadOnlyRoots(isolate).the_hole_value(), copy_size);
+    ReadOnlyRoots roots(isolate);
+    for (InternalIndex entry : from.IterateEntries()) {
+      Object key = from.KeyAt(isolate, entry);
+      if (!from.IsKey(roots, key)) continue;
+      uint32_t index = static_cast<uint32_t>(key.Number());
+      if (index < from_start ||
+          index - from_start >= static_cast<uint32_t>(copy_size)) {
+        continue;
+      }
+      Object value = from.ValueAt(entry);
+      DCHECK(!value.IsTheHole(isolate));
+      to.set(index - from_start + to_start, value, write_barrier_mode);
+    }
+    return;
+  }
   for (int i = 0; i < copy_size; i++) {
     InternalIndex entry = from.FindEntry(isolate, i + from_start);
     if (entry.is_found()) {
@@ -301,15 +321,25 @@ void CopyDoubleToObjectElements(Isolate* isolate, FixedArrayBase from_base,
 
   // Use an outer loop to not waste too much time on creating HandleScopes.
   // On the other hand we might overflow a single handle scope depending on
-  // the copy_size.
+  // the copy_size. Holes and Smi values are stored directly, only HeapNumbers
+  // need allocating.
   int offset = 0;
   while (offset < copy_size) {
     HandleScope scope(isolate);
     offset += 100;
     for (int i = offset - 100; i < offset && i < copy_size; ++i) {
-      Handle<Object> value =
-          FixedDoubleArray::get(*from, i + from_start, isolate);
-      to->set(i + to_start, *value, UPDATE_WRITE_BARRIER);
+      if (from->is_the_hole(i + from_start)) {
+        to->set_the_hole(isolate, i + to_start);
+        continue;
+      }
+      double value = from->get_scalar(i + from_start);
+      int smi_value;
+      if (DoubleToSmiInteger(value, &smi_value)) {
+        to->set(i + to_start, Smi::FromInt(smi_value));
+        continue;
+      }
+      Handle<HeapNumber> number = isolate->factory()->NewHeapNumber(value);
+      to->set(i + to_start, *number, UPDATE_WRITE_BARRIER);
     }
   }
 }
@@ -459,6 +489,23 @@ void CopyDictionaryToDoubleElements(Isolate* isolate, FixedArrayBase from_base,
   if (to_start + copy_size > to_length) {
     copy_size = to_length - to_start;
   }
+  if (from.Capacity() < copy_size) {
+    // Sparse dictionaries are cheaper to walk than to look up every index of
+    // the copied range in.
+    for (int i = 0; i < copy_size; i++) to.set_the_hole(i + to_start);
+    ReadOnlyRoots roots(isolate);
+    for (InternalIndex entry : from.IterateEntries()) {
+      Object key = from.KeyAt(isolate, entry);
+      if (!from.IsKey(roots, key)) continue;
+      uint32_t index = static_cast<uint32_t>(key.Number());
+      if (index < from_start ||
+          index - from_start >= static_cast<uint32_t>(copy_size)) {
+        continue;
+      }
+      to.set(index - from_start + to_start, from.ValueAt(entry).Number());
+    }
+    return;
+  }
   for (int i = 0; i < copy_size; i++) {
     InternalIndex entry = from.FindEntry(isolate, i + from_start);
     if (entry.is_found()) {
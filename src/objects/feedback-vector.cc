@@ -352,6 +352,11 @@ void FeedbackVector::SaturatingIncrementProfilerTicks() {
   if (ticks < Smi::kMaxValue) set_profiler_ticks(ticks + 1);
 }
 
+void FeedbackVector::SaturatingIncrementDeoptCount() {
+  int count = deopt_count();
+  if (count < kMaxUInt8) set_deopt_count(count + 1);
+}
+
 void FeedbackVector::SetOptimizedCode(Code code) {
   DCHECK(CodeKindIsOptimizedJSFunction(code.kind()));
   // We should set optimized code only when there is no valid optimized code.
@@ -227,6 +227,9 @@ class FeedbackVector
   // Increment profiler ticks, saturating at the maximal value.
   void SaturatingIncrementProfilerTicks();
 
+  // Increment the deopt count, saturating at the maximal value.
+  void SaturatingIncrementDeoptCount();
+
   // Forward declare the non-atomic accessors.
   using TorqueGeneratedFeedbackVector::invocation_count;
   using TorqueGeneratedFeedbackVector::set_invocation_count;
@@ -332,7 +332,13 @@ void JSAtomicsMutex::LockSlowPath(Isolate* requester,
     int backoff = 1;
     StateT current_state = state->load(std::memory_order_relaxed);
     do {
-      if (TryLockExplicit(state, current_state)) return;
+      // Only attempt the CAS when the mutex was seen unlocked. Failing CASes
+      // still take the state's cache line exclusively, which slows down the
+      // owner and every other spinning thread.
+      if (!(current_state & kIsLockedBit) &&
+          TryLockExplicit(state, current_state)) {
+        return;
+      }
 
       for (int yields = 0; yields < backoff; yields++) {
         YIELD_PROCESSOR;
@@ -340,6 +346,7 @@ void JSAtomicsMutex::LockSlowPath(Isolate* requester,
       }
 
       backoff = std::min(kMaxBackoff, backoff << 1);
+      current_state = state->load(std::memory_order_relaxed);
     } while (tries < kSpinCount);
 
     // At this point the lock is considered contended, so try to go to sleep and
@@ -5,6 +5,7 @@
 #include "src/objects/map.h"
 
 #include "src/common/assert-scope.h"
+#include "src/deoptimizer/deoptimizer.h"
 #include "src/execution/frames.h"
 #include "src/execution/isolate.h"
 #include "src/handles/handles-inl.h"
@@ -565,11 +566,22 @@ Map::FieldCounts Map::GetFieldCounts() const {
 }
 
 void Map::DeprecateTransitionTree(Isolate* isolate) {
-  if (is_deprecated()) return;
+  // Mark the dependent code of the whole tree first and deoptimize it in one
+  // go, instead of walking all stacks once for every map in the tree.
+  if (MarkTransitionTreeDeprecated(isolate)) {
+    DCHECK(AllowCodeDependencyChange::IsAllowed());
+    Deoptimizer::DeoptimizeMarkedCode(isolate);
+  }
+}
+
+bool Map::MarkTransitionTreeDeprecated(Isolate* isolate) {
+  if (is_deprecated()) return false;
+  bool marked_something = false;
   TransitionsAccessor transitions(isolate, *this);
   int num_transitions = transitions.NumberOfTransitions();
   for (int i = 0; i < num_transitions; ++i) {
-    transitions.GetTarget(i).DeprecateTransitionTree(isolate);
+    marked_something |=
+        transitions.GetTarget(i).MarkTransitionTreeDeprecated(isolate);
   }
   DCHECK(!constructor_or_back_pointer().IsFunctionTemplateInfo());
   DCHECK(CanBeDeprecated());
@@ -577,9 +589,15 @@ void Map::DeprecateTransitionTree(Isolate* isolate) {
   if (v8_flags.log_maps) {
     LOG(isolate, MapEvent("Deprecate", handle(*this, isolate), Handle<Map>()));
   }
-  DependentCode::DeoptimizeDependencyGroups(isolate, *this,
-                                            DependentCode::kTransitionGroup);
-  NotifyLeafMapLayoutChange(isolate);
+  marked_something |= DependentCode::MarkCodeForDeoptimization(
+      *this, DependentCode::kTransitionGroup);
+  // Same as NotifyLeafMapLayoutChange, with the deoptimization deferred.
+  if (is_stable()) {
+    mark_unstable();
+    marked_something |= DependentCode::MarkCodeForDeoptimization(
+        *this, DependentCode::kPrototypeCheckGroup);
+  }
+  return marked_something;
 }
 
 // Installs |new_descriptors| over the current instance_descriptors to ensure
@@ -958,6 +958,10 @@ class Map : public TorqueGeneratedMap<Map, HeapObject> {
                                     PropertyNormalizationMode mode);
 
   void DeprecateTransitionTree(Isolate* isolate);
+  // Deprecates the transition tree rooted at this map and marks the code that
+  // depends on it, without deoptimizing it yet. Returns whether any code was
+  // marked.
+  bool MarkTransitionTreeDeprecated(Isolate* isolate);
 
   void ReplaceDescriptors(Isolate* isolate, DescriptorArray new_descriptors);
 
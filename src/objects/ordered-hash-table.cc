@@ -276,30 +276,36 @@ MaybeHandle<Derived> OrderedHashTable<Derived, entrysize>::Rehash(
   int removed_holes_index = 0;
 
   DisallowGarbageCollection no_gc;
+  Derived raw_table = *table;
+  Derived raw_new_table = *new_table;
+  // The new table was just allocated, so copying the entries over usually
+  // needs no write barrier.
+  WriteBarrierMode mode = raw_new_table.GetWriteBarrierMode(no_gc);
 
-  for (InternalIndex old_entry : table->IterateEntries()) {
+  for (InternalIndex old_entry : raw_table.IterateEntries()) {
     int old_entry_raw = old_entry.as_int();
-    Object key = table->KeyAt(old_entry);
+    Object key = raw_table.KeyAt(old_entry);
     if (key.IsTheHole(isolate)) {
-      table->SetRemovedIndexAt(removed_holes_index++, old_entry_raw);
+      raw_table.SetRemovedIndexAt(removed_holes_index++, old_entry_raw);
       continue;
     }
 
     Object hash = key.GetHash();
     int bucket = Smi::ToInt(hash) & (new_buckets - 1);
-    Object chain_entry = new_table->get(HashTableStartIndex() + bucket);
-    new_table->set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
-    int new_index = new_table->EntryToIndexRaw(new_entry);
-    int old_index = table->EntryToIndexRaw(old_entry_raw);
+    Smi chain_entry =
+        Smi::cast(raw_new_table.get(HashTableStartIndex() + bucket));
+    raw_new_table.set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
+    int new_index = raw_new_table.EntryToIndexRaw(new_entry);
+    int old_index = raw_table.EntryToIndexRaw(old_entry_raw);
     for (int i = 0; i < entrysize; ++i) {
-      Object value = table->get(old_index + i);
-      new_table->set(new_index + i, value);
+      Object value = raw_table.get(old_index + i);
+      raw_new_table.set(new_index + i, value, mode);
     }
-    new_table->set(new_index + kChainOffset, chain_entry);
+    raw_new_table.set(new_index + kChainOffset, chain_entry);
     ++new_entry;
   }
 
-  DCHECK_EQ(table->NumberOfDeletedElements(), removed_holes_index);
+  DCHECK_EQ(raw_table.NumberOfDeletedElements(), removed_holes_index);
 
   new_table->SetNumberOfElements(table->NumberOfElements());
   if (table->NumberOfBuckets() > 0) {
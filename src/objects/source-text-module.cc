@@ -272,6 +272,7 @@ MaybeHandle<Cell> SourceTextModule::ResolveExportUsingStarExports(
     Handle<Cell> unique_cell;
     Handle<FixedArray> special_exports(module->info().special_exports(),
                                        isolate);
+    Handle<Script> script(module->GetScript(), isolate);
     for (int i = 0, n = special_exports->length(); i < n; ++i) {
       i::Handle<i::SourceTextModuleInfoEntry> entry(
           i::SourceTextModuleInfoEntry::cast(special_exports->get(i)), isolate);
@@ -279,7 +280,6 @@ MaybeHandle<Cell> SourceTextModule::ResolveExportUsingStarExports(
         continue;  // Indirect export.
       }
 
-      Handle<Script> script(module->GetScript(), isolate);
       MessageLocation new_loc(script, entry->beg_pos(), entry->end_pos());
 
       Handle<Cell> cell;
@@ -106,25 +106,54 @@ class StringTable::Data {
     slot(index).Release_Store(entry);
   }
 
+  // Stores {entry} if the entry still holds {expected}, and returns whether it
+  // did.
+  bool CompareAndSet(InternalIndex index, Object expected, String entry) {
+#ifdef V8_COMPRESS_POINTERS
+    Tagged_t expected_value =
+        V8HeapCompressionScheme::CompressObject(expected.ptr());
+    Tagged_t entry_value = V8HeapCompressionScheme::CompressObject(entry.ptr());
+#else
+    Tagged_t expected_value = expected.ptr();
+    Tagged_t entry_value = entry.ptr();
+#endif
+    return AsAtomicTagged::Release_CompareAndSwap(
+               &elements_[index.as_uint32()], expected_value, entry_value) ==
+           expected_value;
+  }
+
   void ElementAdded() {
-    DCHECK_LT(number_of_elements_ + 1, capacity());
+    DCHECK_LT(number_of_elements() + 1, capacity());
     DCHECK(StringTableHasSufficientCapacityToAdd(
         capacity(), number_of_elements(), number_of_deleted_elements(), 1));
 
-    number_of_elements_++;
+    number_of_elements_.fetch_add(1, std::memory_order_relaxed);
   }
   void DeletedElementOverwritten() {
-    DCHECK_LT(number_of_elements_ + 1, capacity());
+    DCHECK_LT(number_of_elements() + 1, capacity());
     DCHECK(StringTableHasSufficientCapacityToAdd(
         capacity(), number_of_elements(), number_of_deleted_elements() - 1, 1));
 
-    number_of_elements_++;
-    number_of_deleted_elements_--;
+    number_of_elements_.fetch_add(1, std::memory_order_relaxed);
+    number_of_deleted_elements_.fetch_sub(1, std::memory_order_relaxed);
   }
   void ElementsRemoved(int count) {
-    DCHECK_LE(count, number_of_elements_);
-    number_of_elements_ -= count;
-    number_of_deleted_elements_ += count;
+    DCHECK_LE(count, number_of_elements());
+    number_of_elements_.fetch_sub(count, std::memory_order_relaxed);
+    number_of_deleted_elements_.fetch_add(count, std::memory_order_relaxed);
+  }
+
+  // Counts one more element ahead of a concurrent insertion, unless the table
+  // would have to be resized first. The reservation is either released, or
+  // the element is added with ReservedElementAdded().
+  bool TryReserveElement();
+  void ReleaseReservedElement() {
+    number_of_elements_.fetch_sub(1, std::memory_order_relaxed);
+  }
+  void ReservedElementAdded(bool overwrote_deleted_element) {
+    if (overwrote_deleted_element) {
+      number_of_deleted_elements_.fetch_sub(1, std::memory_order_relaxed);
+    }
   }
 
   void* operator new(size_t size, int capacity);
@@ -132,8 +161,12 @@ class StringTable::Data {
   void operator delete(void* description);
 
   int capacity() const { return capacity_; }
-  int number_of_elements() const { return number_of_elements_; }
-  int number_of_deleted_elements() const { return number_of_deleted_elements_; }
+  int number_of_elements() const {
+    return number_of_elements_.load(std::memory_order_relaxed);
+  }
+  int number_of_deleted_elements() const {
+    return number_of_deleted_elements_.load(std::memory_order_relaxed);
+  }
 
   template <typename IsolateT, typename StringTableKey>
   InternalIndex FindEntry(IsolateT* isolate, StringTableKey* key,
@@ -176,8 +209,8 @@ class StringTable::Data {
 
  private:
   std::unique_ptr<Data> previous_data_;
-  int number_of_elements_;
-  int number_of_deleted_elements_;
+  std::atomic<int> number_of_elements_;
+  std::atomic<int> number_of_deleted_elements_;
   const int capacity_;
   Tagged_t elements_[1];
 };
@@ -243,12 +276,29 @@ std::unique_ptr<StringTable::Data> StringTable::Data::Resize(
         new_data->FindInsertionEntry(cage_base, hash);
     new_data->Set(insertion_index, string);
   }
-  new_data->number_of_elements_ = data->number_of_elements();
+  new_data->number_of_elements_.store(data->number_of_elements(),
+                                      std::memory_order_relaxed);
 
   new_data->previous_data_ = std::move(data);
   return new_data;
 }
 
+bool StringTable::Data::TryReserveElement() {
+  int nof = number_of_elements();
+  do {
+    // Leave shrinking and growing the table to EnsureCapacity. Deleted
+    // elements are only ever overwritten concurrently, so their count can only
+    // be overestimated here.
+    if (ComputeStringTableCapacityWithShrink(capacity_, nof + 1) < capacity_ ||
+        !StringTableHasSufficientCapacityToAdd(
+            capacity_, nof, number_of_deleted_elements(), 1)) {
+      return false;
+    }
+  } while (!number_of_elements_.compare_exchange_weak(
+      nof, nof + 1, std::memory_order_relaxed));
+  return true;
+}
+
 template <typename IsolateT, typename StringTableKey>
 InternalIndex StringTable::Data::FindEntry(IsolateT* isolate,
                                            StringTableKey* key,
@@ -336,7 +386,7 @@ int StringTable::Capacity() const {
 }
 int StringTable::NumberOfElements() const {
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
+    base::SharedMutexGuard<base::kShared> table_write_guard(&write_mutex_);
     return data_.load(std::memory_order_relaxed)->number_of_elements();
   }
 }
@@ -370,6 +420,7 @@ class InternalizedStringKey final : public StringTableKey {
       case StringTransitionStrategy::kInPlace:
         // In-place transition will be done in GetHandleForInsertion, when we
         // are sure that we are going to insert the string into the table.
+        set_can_insert_concurrently(false);
         return;
       case StringTransitionStrategy::kAlreadyTransitioned:
         // We can see already internalized strings here only when sharing the
@@ -585,6 +636,12 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   // (without copying values) outside the lock, and potentially discard the
   // allocation if another write also did an allocation. This assumes that
   // writes are rarer than reads.
+  //
+  // Writes that only fill an empty or deleted entry don't need to exclude each
+  // other either: they hold the lock shared, which only excludes resizes, and
+  // claim the entry with a compare-and-swap. Entries only ever go from empty or
+  // deleted to a string outside of GCs, so a thread that loses the race for an
+  // entry probes again and finds the winning string if it has the same key.
 
   // Load the current string table data, in case another thread updates the
   // data while we're reading.
@@ -605,8 +662,34 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
 
   // No entry found, so adding new string.
   key->PrepareForInsertion(isolate);
+  if (v8_flags.concurrent_string_table_insertion &&
+      key->can_insert_concurrently()) {
+    base::SharedMutexGuard<base::kShared> table_write_guard(&write_mutex_);
+
+    // This load can be relaxed as the table pointer can only be modified while
+    // the lock is held exclusively.
+    Data* data = data_.load(std::memory_order_relaxed);
+    if (data->TryReserveElement()) {
+      Handle<String> new_string = key->GetHandleForInsertion();
+      DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
+      while (true) {
+        entry = data->FindEntryOrInsertionEntry(isolate, key, key->hash());
+        Object element = data->Get(isolate, entry);
+        if (element != empty_element() && element != deleted_element()) {
+          // Another thread added the key in the meantime.
+          data->ReleaseReservedElement();
+          return handle(String::cast(element), isolate);
+        }
+        if (data->CompareAndSet(entry, element, *new_string)) {
+          data->ReservedElementAdded(element == deleted_element());
+          return new_string;
+        }
+        // Another thread claimed the entry first, possibly for the same key.
+      }
+    }
+  }
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
+    base::SharedMutexGuard<base::kExclusive> table_write_guard(&write_mutex_);
 
     Data* data = EnsureCapacity(isolate, 1);
 
@@ -659,8 +742,7 @@ template Handle<String> StringTable::LookupKey(LocalIsolate* isolate,
 
 StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
                                                int additional_elements) {
-  // This call is only allowed while the write mutex is held.
-  write_mutex_.AssertHeld();
+  // This call is only allowed while the write mutex is held exclusively.
 
   // This load can be relaxed as the table pointer can only be modified while
   // the lock is held.
@@ -30,12 +30,21 @@ class StringTableKey {
   inline uint32_t hash() const;
   int length() const { return length_; }
 
+  // Whether the string returned by GetHandleForInsertion() may be dropped
+  // again, if another thread inserts the same key first. This is not the case
+  // for keys that transition their string to internalized in place.
+  bool can_insert_concurrently() const { return can_insert_concurrently_; }
+
  protected:
   inline void set_raw_hash_field(uint32_t raw_hash_field);
+  void set_can_insert_concurrently(bool value) {
+    can_insert_concurrently_ = value;
+  }
 
  private:
   uint32_t raw_hash_field_ = 0;
   int length_;
+  bool can_insert_concurrently_ = true;
 };
 
 class SeqOneByteString;
@@ -89,9 +98,12 @@ class V8_EXPORT_PRIVATE StringTable {
   Data* EnsureCapacity(PtrComprCageBase cage_base, int additional_elements);
 
   std::atomic<Data*> data_;
-  // Write mutex is mutable so that readers of concurrently mutated values (e.g.
-  // NumberOfElements) are allowed to lock it while staying const.
-  mutable base::Mutex write_mutex_;
+  // Insertions that only fill an empty or deleted entry hold the write mutex
+  // shared and claim the entry with a compare-and-swap; resizing the table and
+  // in-place internalization hold it exclusively. The mutex is mutable so
+  // that readers of concurrently mutated values (e.g. NumberOfElements) are
+  // allowed to lock it while staying const.
+  mutable base::SharedMutex write_mutex_;
   Isolate* isolate_;
 };
 
@@ -1206,6 +1206,15 @@ bool String::SlowEquals(Isolate* isolate, Handle<String> one,
   // before we try to flatten the strings.
   if (one->Get(0) != two->Get(0)) return false;
 
+  // Compare ropes leaf by leaf instead of copying them into flat strings.
+  if ((one->IsConsString() && !one->IsFlat()) ||
+      (two->IsConsString() && !two->IsFlat())) {
+    DisallowGarbageCollection no_gc;
+    StringComparator comparator;
+    return comparator.Equals(*one, *two,
+                             SharedStringAccessGuardIfNeeded::NotNeeded());
+  }
+
   one = String::Flatten(isolate, one);
   two = String::Flatten(isolate, two);
 
@@ -377,8 +377,13 @@ Maybe<uint8_t*> ValueSerializer::ReserveRawBytes(size_t bytes) {
 
 Maybe<bool> ValueSerializer::ExpandBuffer(size_t required_capacity) {
   DCHECK_GT(required_capacity, buffer_capacity_);
+  // Leave some room after large writes, such as the contents of a big
+  // ArrayBuffer, so the few bytes that usually follow them don't double (and
+  // copy) the whole buffer once more.
   size_t requested_capacity =
-      std::max(required_capacity, buffer_capacity_ * 2) + 64;
+      std::max(required_capacity + required_capacity / 8,
+               buffer_capacity_ * 2) +
+      64;
   size_t provided_capacity = 0;
   void* new_buffer = nullptr;
   if (delegate_) {
@@ -1226,6 +1231,8 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate,
       position_(data.begin()),
       end_(data.end()),
       id_map_(isolate->global_handles()->Create(
+          ReadOnlyRoots(isolate_).empty_fixed_array())),
+      object_map_hints_(isolate->global_handles()->Create(
           ReadOnlyRoots(isolate_).empty_fixed_array())) {}
 
 ValueDeserializer::ValueDeserializer(Isolate* isolate, const uint8_t* data,
@@ -1235,11 +1242,14 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate, const uint8_t* data,
       position_(data),
       end_(data + size),
       id_map_(isolate->global_handles()->Create(
+          ReadOnlyRoots(isolate_).empty_fixed_array())),
+      object_map_hints_(isolate->global_handles()->Create(
           ReadOnlyRoots(isolate_).empty_fixed_array())) {}
 
 ValueDeserializer::~ValueDeserializer() {
   DCHECK_LE(position_, end_);
   GlobalHandles::Destroy(id_map_.location());
+  GlobalHandles::Destroy(object_map_hints_.location());
 
   Handle<Object> transfer_map_handle;
   if (array_buffer_transfer_map_.ToHandle(&transfer_map_handle)) {
@@ -1750,8 +1760,11 @@ MaybeHandle<JSObject> ValueDeserializer::ReadJSObject() {
 
   uint32_t num_properties;
   uint32_t expected_num_properties;
-  if (!ReadJSObjectProperties(object, SerializationTag::kEndJSObject, true)
-           .To(&num_properties) ||
+  object_depth_++;
+  Maybe<uint32_t> maybe_num_properties =
+      ReadJSObjectProperties(object, SerializationTag::kEndJSObject, true);
+  object_depth_--;
+  if (!maybe_num_properties.To(&num_properties) ||
       !ReadVarint<uint32_t>().To(&expected_num_properties) ||
       num_properties != expected_num_properties) {
     return MaybeHandle<JSObject>();
@@ -2431,6 +2444,7 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
         ConsumeTag(end_tag);
         CommitProperties(object, map, properties);
         CHECK_LT(properties.size(), std::numeric_limits<uint32_t>::max());
+        if (!properties.empty()) SetObjectMapHint(map);
         return Just(static_cast<uint32_t>(properties.size()));
       }
 
@@ -2447,8 +2461,29 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
           target = transitions.ExpectedTransitionTarget();
         }
       }
+      // If the map has several transitions, guess the key from the map of the
+      // previous object read through this path at the same nesting depth.
+      // Arrays of records mostly hold objects of the same shape, and matching
+      // the raw string is much cheaper than reading and internalizing it.
+      Handle<String> hinted_key;
+      Handle<Map> hint;
+      if (expected_key.is_null() && GetObjectMapHint().ToHandle(&hint)) {
+        InternalIndex descriptor(properties.size());
+        if (descriptor.as_int() < hint->NumberOfOwnDescriptors()) {
+          Name hint_key =
+              hint->instance_descriptors(isolate_).GetKey(descriptor);
+          if (hint_key.IsString()) {
+            hinted_key = handle(String::cast(hint_key), isolate_);
+          }
+        }
+      }
       if (!expected_key.is_null() && ReadExpectedString(expected_key)) {
         key = expected_key;
+      } else if (!hinted_key.is_null() && ReadExpectedString(hinted_key)) {
+        key = hinted_key;
+        transitioning = TransitionsAccessor(isolate_, *map)
+                            .FindTransitionToField(hinted_key)
+                            .ToHandle(&target);
       } else {
         if (!ReadObject().ToHandle(&key) || !IsValidObjectKey(*key, isolate_)) {
           return Nothing<uint32_t>();
@@ -2584,6 +2619,31 @@ void ValueDeserializer::AddObjectWithID(uint32_t id,
   }
 }
 
+MaybeHandle<Map> ValueDeserializer::GetObjectMapHint() {
+  DCHECK_LT(0u, object_depth_);
+  int index = static_cast<int>(object_depth_) - 1;
+  if (index >= object_map_hints_->length()) return MaybeHandle<Map>();
+  Object hint = object_map_hints_->get(index);
+  if (!hint.IsMap()) return MaybeHandle<Map>();
+  return handle(Map::cast(hint), isolate_);
+}
+
+void ValueDeserializer::SetObjectMapHint(Handle<Map> map) {
+  // Deeply nested objects are rare, so only the outer levels are tracked.
+  static constexpr int kMaxObjectMapHintDepth = 8;
+  DCHECK_LT(0u, object_depth_);
+  int index = static_cast<int>(object_depth_) - 1;
+  if (index >= kMaxObjectMapHintDepth) return;
+  Handle<FixedArray> new_array =
+      FixedArray::SetAndGrow(isolate_, object_map_hints_, index, map);
+
+  // If the array was reallocated, update the global handle.
+  if (!new_array.is_identical_to(object_map_hints_)) {
+    GlobalHandles::Destroy(object_map_hints_.location());
+    object_map_hints_ = isolate_->global_handles()->Create(*new_array);
+  }
+}
+
 static Maybe<bool> SetPropertiesFromKeyValuePairs(Isolate* isolate,
                                                   Handle<JSObject> object,
                                                   Handle<Object>* data,
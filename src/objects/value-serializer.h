@@ -323,18 +323,26 @@ class ValueDeserializer {
   MaybeHandle<JSReceiver> GetObjectWithID(uint32_t id);
   void AddObjectWithID(uint32_t id, Handle<JSReceiver> object);
 
+  // The final map of the last object read with map transitions at the
+  // current object nesting depth.
+  MaybeHandle<Map> GetObjectMapHint();
+  void SetObjectMapHint(Handle<Map> map);
+
   Isolate* const isolate_;
   v8::ValueDeserializer::Delegate* const delegate_;
   const uint8_t* position_;
   const uint8_t* const end_;
   uint32_t version_ = 0;
   uint32_t next_id_ = 0;
+  uint32_t object_depth_ = 0;
   bool version_13_broken_data_mode_ = false;
   bool suppress_deserialization_errors_ = false;
 
   // Always global handles.
   Handle<FixedArray> id_map_;
   MaybeHandle<SimpleNumberDictionary> array_buffer_transfer_map_;
+  // Object map hints indexed by object nesting depth, or undefined.
+  Handle<FixedArray> object_map_hints_;
 
   // The conveyor used to keep shared objects alive.
   const SharedObjectConveyorHandles* shared_object_conveyor_ = nullptr;
@@ -16,6 +16,7 @@
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/objects-inl.h"
 #include "src/parsing/scanner.h"
+#include "src/strings/string-simd.h"
 #include "src/strings/unicode-inl.h"
 
 namespace v8 {
@@ -711,8 +712,7 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
     size_t max_buffer = max_buffer_end - output_cursor;
     int max_length = static_cast<int>(std::min(remaining, max_buffer));
     DCHECK_EQ(state, unibrow::Utf8::State::kAccept);
-    int ascii_length = NonAsciiStart(cursor, max_length);
-    CopyChars(output_cursor, cursor, ascii_length);
+    int ascii_length = CopyAsciiPrefix(output_cursor, cursor, max_length);
     cursor += ascii_length;
     output_cursor += ascii_length;
   }
@@ -0,0 +1,97 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/parsing/scanner-simd.h"
+
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
+#include "src/base/logging.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SCANNER_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+// As in simd.cc, Neon is only used on 64-bit ARM, where it is guaranteed to be
+// available.
+#define SCANNER_NEON64
+#include <arm_neon.h>
+#endif
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+constexpr uint16_t kMaxAscii = 127;
+
+inline bool IsAsciiDelimiter(uint16_t value, uint16_t a, uint16_t b,
+                             uint16_t c) {
+  return value > kMaxAscii || value == a || value == b || value == c;
+}
+
+}  // namespace
+
+const uint16_t* FindAsciiDelimiter(const uint16_t* start, const uint16_t* end,
+                                   uint16_t a, uint16_t b, uint16_t c) {
+  DCHECK_LE(a, kMaxAscii);
+  DCHECK_LE(b, kMaxAscii);
+  DCHECK_LE(c, kMaxAscii);
+  const uint16_t* cursor = start;
+
+#if defined(SCANNER_SSE2)
+  constexpr int kStride = sizeof(__m128i) / sizeof(uint16_t);
+  const __m128i va = _mm_set1_epi16(a);
+  const __m128i vb = _mm_set1_epi16(b);
+  const __m128i vc = _mm_set1_epi16(c);
+  const __m128i max_ascii = _mm_set1_epi16(kMaxAscii);
+  const __m128i zero = _mm_setzero_si128();
+  for (; end - cursor >= kStride; cursor += kStride) {
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    __m128i matches = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi16(chars, va), _mm_cmpeq_epi16(chars, vb)),
+        _mm_cmpeq_epi16(chars, vc));
+    // Saturating subtraction leaves exactly the non-ASCII code units non-zero.
+    __m128i non_ascii = _mm_subs_epu16(chars, max_ascii);
+    __m128i ascii = _mm_cmpeq_epi16(non_ascii, zero);
+    // Every code unit contributes two bits to the mask.
+    int mask =
+        _mm_movemask_epi8(matches) | (~_mm_movemask_epi8(ascii) & 0xFFFF);
+    if (mask != 0) {
+      return cursor + base::bits::CountTrailingZeros32(mask) / 2;
+    }
+  }
+#elif defined(SCANNER_NEON64)
+  constexpr int kStride = sizeof(uint16x8_t) / sizeof(uint16_t);
+  const uint16x8_t va = vdupq_n_u16(a);
+  const uint16x8_t vb = vdupq_n_u16(b);
+  const uint16x8_t vc = vdupq_n_u16(c);
+  const uint16x8_t max_ascii = vdupq_n_u16(kMaxAscii);
+  for (; end - cursor >= kStride; cursor += kStride) {
+    uint16x8_t chars = vld1q_u16(cursor);
+    uint16x8_t matches =
+        vorrq_u16(vorrq_u16(vceqq_u16(chars, va), vceqq_u16(chars, vb)),
+                  vorrq_u16(vceqq_u16(chars, vc), vcgtq_u16(chars, max_ascii)));
+    // Narrowing turns every matching lane into one 0xFF byte of the mask.
+    uint64_t mask =
+        vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(matches, 4)), 0);
+    if (mask != 0) {
+      return cursor + base::bits::CountTrailingZeros64(mask) / 8;
+    }
+  }
+#endif
+
+  for (; cursor < end; cursor++) {
+    if (IsAsciiDelimiter(*cursor, a, b, c)) return cursor;
+  }
+  return end;
+}
+
+#undef SCANNER_SSE2
+#undef SCANNER_NEON64
+
+}  // namespace internal
+}  // namespace v8
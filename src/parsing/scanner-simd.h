@@ -0,0 +1,25 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_SCANNER_SIMD_H_
+#define V8_PARSING_SCANNER_SIMD_H_
+
+#include <cstdint>
+
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace internal {
+
+// Returns the first position in [start, end) which holds |a|, |b|, |c| or a
+// non-ASCII code unit, or |end| if there is none. |a|, |b| and |c| have to be
+// ASCII. Uses SSE2 or Neon to look at several code units at a time when they
+// are available.
+const uint16_t* FindAsciiDelimiter(const uint16_t* start, const uint16_t* end,
+                                   uint16_t a, uint16_t b, uint16_t c);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_SCANNER_SIMD_H_
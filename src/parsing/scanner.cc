@@ -210,7 +210,9 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](base::uc32 c0) { return unibrow::IsLineTerminator(c0); });
+  AdvanceUntilAsciiDelimiter(
+      [](base::uc32 c0) { return unibrow::IsLineTerminator(c0); }, '\n', '\r',
+      '\r');
 
   return Token::WHITESPACE;
 }
@@ -277,13 +279,16 @@ Token::Value Scanner::SkipMultiLineComment() {
   // Until we see the first newline, check for * and newline characters.
   if (!next().after_line_terminator) {
     do {
-      AdvanceUntil([](base::uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          return unibrow::IsLineTerminator(c0);
-        }
-        uint8_t char_flags = character_scan_flags[c0];
-        return MultilineCommentCharacterNeedsSlowPath(char_flags);
-      });
+      // These are exactly the characters with
+      // kMultilineCommentCharacterNeedsSlowPath.
+      AdvanceUntilAsciiDelimiter(
+          [](base::uc32 c0) {
+            if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+              return unibrow::IsLineTerminator(c0);
+            }
+            return true;
+          },
+          '\n', '\r', '*');
 
       while (c0_ == '*') {
         Advance();
@@ -302,7 +307,8 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
-    AdvanceUntil([](base::uc32 c0) { return c0 == '*'; });
+    AdvanceUntilAsciiDelimiter([](base::uc32 c0) { return c0 == '*'; }, '*',
+                               '*', '*');
 
     while (c0_ == '*') {
       Advance();
@@ -16,6 +16,7 @@
 #include "src/common/message-template.h"
 #include "src/parsing/literal-buffer.h"
 #include "src/parsing/parse-info.h"
+#include "src/parsing/scanner-simd.h"
 #include "src/parsing/token.h"
 #include "src/regexp/regexp-flags.h"
 #include "src/strings/char-predicates.h"
@@ -95,6 +96,38 @@ class Utf16CharacterStream {
     }
   }
 
+  // Like AdvanceUntil, for checks which are false for every ASCII code unit
+  // other than |a|, |b| and |c|. Runs of such code units are skipped with
+  // FindAsciiDelimiter, several at a time.
+  template <typename FunctionType>
+  V8_INLINE base::uc32 AdvanceUntilAsciiDelimiter(FunctionType check,
+                                                  uint16_t a, uint16_t b,
+                                                  uint16_t c) {
+    while (true) {
+      const uint16_t* next_cursor_pos = buffer_cursor_;
+      while (true) {
+        next_cursor_pos =
+            FindAsciiDelimiter(next_cursor_pos, buffer_end_, a, b, c);
+        if (next_cursor_pos == buffer_end_ ||
+            check(static_cast<base::uc32>(*next_cursor_pos))) {
+          break;
+        }
+        next_cursor_pos++;
+      }
+
+      if (next_cursor_pos == buffer_end_) {
+        buffer_cursor_ = buffer_end_;
+        if (!ReadBlockChecked(pos())) {
+          buffer_cursor_++;
+          return kEndOfInput;
+        }
+      } else {
+        buffer_cursor_ = next_cursor_pos + 1;
+        return static_cast<base::uc32>(*next_cursor_pos);
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -541,6 +574,12 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <typename FunctionType>
+  V8_INLINE void AdvanceUntilAsciiDelimiter(FunctionType check, uint16_t a,
+                                            uint16_t b, uint16_t c) {
+    c0_ = source_->AdvanceUntilAsciiDelimiter(check, a, b, c);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
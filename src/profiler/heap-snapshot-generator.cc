@@ -8,6 +8,7 @@
 
 #include "src/api/api-inl.h"
 #include "src/base/optional.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/vector.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/common/globals.h"
@@ -16,6 +17,7 @@
 #include "src/heap/combined-heap.h"
 #include "src/heap/heap.h"
 #include "src/heap/safepoint.h"
+#include "src/init/v8.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/api-callbacks.h"
@@ -2825,6 +2827,10 @@ bool HeapSnapshotGenerator::FillReferences() {
 // type, name, id, self_size, edge_count, trace_node_id, detachedness.
 const int HeapSnapshotJSONSerializer::kNodeFieldsCount = 7;
 
+HeapSnapshotJSONSerializer::~HeapSnapshotJSONSerializer() {
+  if (strings_job_ && strings_job_->IsValid()) strings_job_->Cancel();
+}
+
 void HeapSnapshotJSONSerializer::Serialize(v8::OutputStream* stream) {
   if (AllocationTracker* allocation_tracker =
       snapshot_->profiler()->allocation_tracker()) {
@@ -2832,7 +2838,16 @@ void HeapSnapshotJSONSerializer::Serialize(v8::OutputStream* stream) {
   }
   DCHECK_NULL(writer_);
   writer_ = new OutputStreamWriter(stream);
+  if (v8_flags.heap_snapshot_concurrent_string_serialization) {
+    AssignStringIds();
+    StartConcurrentStringSerialization();
+  }
   SerializeImpl();
+  if (strings_job_ && strings_job_->IsValid()) {
+    // Only reached if the stream was aborted before the strings section.
+    strings_job_->Cancel();
+  }
+  strings_job_.reset();
   delete writer_;
   writer_ = nullptr;
 }
@@ -2874,7 +2889,14 @@ void HeapSnapshotJSONSerializer::SerializeImpl() {
   writer_->AddString("],\n");
 
   writer_->AddString("\"strings\":[");
-  SerializeStrings();
+  if (strings_job_) {
+    strings_job_->Join();
+    writer_->AddString("\"<dummy>\"");
+    writer_->AddSubstring(serialized_strings_.data(),
+                          static_cast<int>(serialized_strings_.size()));
+  } else {
+    SerializeStrings();
+  }
   if (writer_->aborted()) return;
   writer_->AddCharacter(']');
   writer_->AddCharacter('}');
@@ -2886,6 +2908,8 @@ int HeapSnapshotJSONSerializer::GetStringId(const char* s) {
   base::HashMap::Entry* cache_entry =
       strings_.LookupOrInsert(const_cast<char*>(s), StringHash(s));
   if (cache_entry->value == nullptr) {
+    // The string table must not grow once it is being serialized.
+    DCHECK_NULL(strings_job_);
     cache_entry->value = reinterpret_cast<void*>(next_string_id_++);
   }
   return static_cast<int>(reinterpret_cast<intptr_t>(cache_entry->value));
@@ -3009,16 +3033,15 @@ void HeapSnapshotJSONSerializer::SerializeNodes() {
   }
 }
 
-void HeapSnapshotJSONSerializer::SerializeSnapshot() {
-  writer_->AddString("\"meta\":");
-  // The object describing node serialization layout.
-  // We use a set of macros to improve readability.
+namespace {
 
+// The object describing node serialization layout, shared by the JSON and the
+// binary serializer. We use a set of macros to improve readability.
 // clang-format off
 #define JSON_A(s) "[" s "]"
 #define JSON_O(s) "{" s "}"
 #define JSON_S(s) "\"" s "\""
-  writer_->AddString(JSON_O(
+const char kHeapSnapshotMeta[] = JSON_O(
     JSON_S("node_fields") ":" JSON_A(
         JSON_S("type") ","
         JSON_S("name") ","
@@ -3086,11 +3109,17 @@ void HeapSnapshotJSONSerializer::SerializeSnapshot() {
         JSON_S("object_index") ","
         JSON_S("script_id") ","
         JSON_S("line") ","
-        JSON_S("column"))));
+        JSON_S("column")));
 // clang-format on
 #undef JSON_S
 #undef JSON_O
 #undef JSON_A
+
+}  // namespace
+
+void HeapSnapshotJSONSerializer::SerializeSnapshot() {
+  writer_->AddString("\"meta\":");
+  writer_->AddString(kHeapSnapshotMeta);
   writer_->AddString(",\"node_count\":");
   writer_->AddNumber(static_cast<unsigned>(snapshot_->entries().size()));
   writer_->AddString(",\"edge_count\":");
@@ -3105,7 +3134,8 @@ void HeapSnapshotJSONSerializer::SerializeSnapshot() {
 }
 
 
-static void WriteUChar(OutputStreamWriter* w, unibrow::uchar u) {
+template <typename Writer>
+static void WriteUChar(Writer* w, unibrow::uchar u) {
   static const char hex_chars[] = "0123456789ABCDEF";
   w->AddString("\\u");
   w->AddCharacter(hex_chars[(u >> 12) & 0xF]);
@@ -3225,55 +3255,144 @@ void HeapSnapshotJSONSerializer::SerializeSamples() {
 }
 
 
-void HeapSnapshotJSONSerializer::SerializeString(const unsigned char* s) {
-  writer_->AddCharacter('\n');
-  writer_->AddCharacter('\"');
+namespace {
+
+// Writes |s| as a quoted JSON string literal preceded by a newline.
+template <typename Writer>
+void SerializeJSONString(Writer* writer, const unsigned char* s) {
+  writer->AddCharacter('\n');
+  writer->AddCharacter('\"');
   for ( ; *s != '\0'; ++s) {
     switch (*s) {
       case '\b':
-        writer_->AddString("\\b");
+        writer->AddString("\\b");
         continue;
       case '\f':
-        writer_->AddString("\\f");
+        writer->AddString("\\f");
         continue;
       case '\n':
-        writer_->AddString("\\n");
+        writer->AddString("\\n");
         continue;
       case '\r':
-        writer_->AddString("\\r");
+        writer->AddString("\\r");
         continue;
       case '\t':
-        writer_->AddString("\\t");
+        writer->AddString("\\t");
         continue;
       case '\"':
       case '\\':
-        writer_->AddCharacter('\\');
-        writer_->AddCharacter(*s);
+        writer->AddCharacter('\\');
+        writer->AddCharacter(*s);
         continue;
       default:
         if (*s > 31 && *s < 128) {
-          writer_->AddCharacter(*s);
+          writer->AddCharacter(*s);
         } else if (*s <= 31) {
           // Special character with no dedicated literal.
-          WriteUChar(writer_, *s);
+          WriteUChar(writer, *s);
         } else {
           // Convert UTF-8 into \u UTF-16 literal.
           size_t length = 1, cursor = 0;
           for ( ; length <= 4 && *(s + length) != '\0'; ++length) { }
           unibrow::uchar c = unibrow::Utf8::CalculateValue(s, length, &cursor);
           if (c != unibrow::Utf8::kBadChar) {
-            WriteUChar(writer_, c);
+            WriteUChar(writer, c);
             DCHECK_NE(cursor, 0);
             s += cursor - 1;
           } else {
-            writer_->AddCharacter('?');
+            writer->AddCharacter('?');
           }
         }
     }
   }
-  writer_->AddCharacter('\"');
+  writer->AddCharacter('\"');
+}
+
+// Minimal in-memory counterpart of OutputStreamWriter used to escape the
+// string table off the main thread.
+class StringBufferWriter {
+ public:
+  explicit StringBufferWriter(std::string* buffer) : buffer_(buffer) {}
+  void AddCharacter(char c) { buffer_->push_back(c); }
+  void AddString(const char* s) { buffer_->append(s); }
+
+ private:
+  std::string* buffer_;
+};
+
+class StringSerializationJob final : public v8::JobTask {
+ public:
+  StringSerializationJob(std::vector<const unsigned char*> strings,
+                         std::string* output)
+      : strings_(std::move(strings)), output_(output) {}
+
+  void Run(JobDelegate* delegate) override {
+    // The output is sequential, so at most one worker makes progress at a
+    // time. Yielding keeps |next_| so that a later worker (or the joining
+    // main thread) can resume where this one stopped.
+    base::MutexGuard guard(&mutex_);
+    StringBufferWriter writer(output_);
+    size_t next = next_.load(std::memory_order_relaxed);
+    for (; next < strings_.size(); ++next) {
+      if (delegate->ShouldYield()) break;
+      writer.AddCharacter(',');
+      SerializeJSONString(&writer, strings_[next]);
+    }
+    next_.store(next, std::memory_order_relaxed);
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    return next_.load(std::memory_order_relaxed) < strings_.size() ? 1 : 0;
+  }
+
+ private:
+  const std::vector<const unsigned char*> strings_;
+  std::string* const output_;
+  base::Mutex mutex_;
+  std::atomic<size_t> next_{0};
+};
+
+}  // namespace
+
+void HeapSnapshotJSONSerializer::SerializeString(const unsigned char* s) {
+  SerializeJSONString(writer_, s);
+}
+
+void HeapSnapshotJSONSerializer::AssignStringIds() {
+  for (const HeapEntry& entry : snapshot_->entries()) {
+    GetStringId(entry.name());
+  }
+  for (HeapGraphEdge* edge : snapshot_->children()) {
+    if (edge->type() != HeapGraphEdge::kElement &&
+        edge->type() != HeapGraphEdge::kHidden) {
+      GetStringId(edge->name());
+    }
+  }
+  if (AllocationTracker* tracker =
+          snapshot_->profiler()->allocation_tracker()) {
+    for (AllocationTracker::FunctionInfo* info :
+         tracker->function_info_list()) {
+      GetStringId(info->name);
+      GetStringId(info->script_name);
+    }
+  }
 }
 
+void HeapSnapshotJSONSerializer::StartConcurrentStringSerialization() {
+  DCHECK_NULL(strings_job_);
+  // Index 0 is reserved for the "<dummy>" entry written by SerializeImpl.
+  std::vector<const unsigned char*> sorted_strings(strings_.occupancy());
+  for (base::HashMap::Entry* entry = strings_.Start(); entry != nullptr;
+       entry = strings_.Next(entry)) {
+    int index = static_cast<int>(reinterpret_cast<uintptr_t>(entry->value));
+    sorted_strings[index - 1] =
+        reinterpret_cast<const unsigned char*>(entry->key);
+  }
+  strings_job_ = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserVisible,
+      std::make_unique<StringSerializationJob>(std::move(sorted_strings),
+                                               &serialized_strings_));
+}
 
 void HeapSnapshotJSONSerializer::SerializeStrings() {
   base::ScopedVector<const unsigned char*> sorted_strings(strings_.occupancy() +
@@ -3319,5 +3438,183 @@ void HeapSnapshotJSONSerializer::SerializeLocations() {
   }
 }
 
+void HeapSnapshotBinarySerializer::Serialize(v8::OutputStream* stream) {
+  if (AllocationTracker* allocation_tracker =
+          snapshot_->profiler()->allocation_tracker()) {
+    allocation_tracker->PrepareForSerialization();
+  }
+  DCHECK_NULL(writer_);
+  writer_ = new OutputStreamWriter(stream);
+  SerializeImpl();
+  delete writer_;
+  writer_ = nullptr;
+}
+
+void HeapSnapshotBinarySerializer::SerializeImpl() {
+  DCHECK_EQ(0, snapshot_->root()->index());
+  writer_->AddBytes(reinterpret_cast<const uint8_t*>(kMagic), sizeof(kMagic));
+  WriteVarint(kFormatVersion);
+  WriteString(kHeapSnapshotMeta);
+  SerializeNodes();
+  if (writer_->aborted()) return;
+  SerializeEdges();
+  if (writer_->aborted()) return;
+  SerializeTraceNodeInfos();
+  if (writer_->aborted()) return;
+  AllocationTracker* tracker = snapshot_->profiler()->allocation_tracker();
+  if (tracker) {
+    WriteVarint(1);
+    SerializeTraceNode(tracker->trace_tree()->root());
+  } else {
+    WriteVarint(0);
+  }
+  if (writer_->aborted()) return;
+  SerializeSamples();
+  if (writer_->aborted()) return;
+  SerializeLocations();
+  if (writer_->aborted()) return;
+  SerializeStrings();
+  if (writer_->aborted()) return;
+  writer_->Finalize();
+}
+
+int HeapSnapshotBinarySerializer::GetStringId(const char* s) {
+  uint32_t hash = StringHasher::HashSequentialString(
+      s, static_cast<int>(strlen(s)), kZeroHashSeed);
+  base::HashMap::Entry* cache_entry =
+      strings_.LookupOrInsert(const_cast<char*>(s), hash);
+  if (cache_entry->value == nullptr) {
+    cache_entry->value = reinterpret_cast<void*>(next_string_id_++);
+  }
+  return static_cast<int>(reinterpret_cast<intptr_t>(cache_entry->value));
+}
+
+void HeapSnapshotBinarySerializer::WriteVarint(uint64_t value) {
+  // Seven payload bits per byte; the high bit marks that more bytes follow.
+  static constexpr int kMaxVarintLength = (64 + 6) / 7;
+  uint8_t buffer[kMaxVarintLength];
+  int length = 0;
+  do {
+    uint8_t byte = value & 0x7F;
+    value >>= 7;
+    if (value != 0) byte |= 0x80;
+    buffer[length++] = byte;
+  } while (value != 0);
+  writer_->AddBytes(buffer, length);
+}
+
+void HeapSnapshotBinarySerializer::WriteString(const char* s) {
+  size_t length = strlen(s);
+  DCHECK_GE(kMaxInt, length);
+  WriteVarint(length);
+  writer_->AddBytes(reinterpret_cast<const uint8_t*>(s),
+                    static_cast<int>(length));
+}
+
+void HeapSnapshotBinarySerializer::SerializeNodes() {
+  const std::deque<HeapEntry>& entries = snapshot_->entries();
+  WriteVarint(entries.size());
+  for (const HeapEntry& entry : entries) {
+    WriteVarint(entry.type());
+    WriteVarint(static_cast<unsigned>(GetStringId(entry.name())));
+    WriteVarint(entry.id());
+    WriteVarint(entry.self_size());
+    WriteVarint(static_cast<unsigned>(entry.children_count()));
+    WriteVarint(entry.trace_node_id());
+    WriteVarint(entry.detachedness());
+    if (writer_->aborted()) return;
+  }
+}
+
+void HeapSnapshotBinarySerializer::SerializeEdges() {
+  std::vector<HeapGraphEdge*>& edges = snapshot_->children();
+  WriteVarint(edges.size());
+  for (HeapGraphEdge* edge : edges) {
+    int edge_name_or_index = edge->type() == HeapGraphEdge::kElement ||
+                                     edge->type() == HeapGraphEdge::kHidden
+                                 ? edge->index()
+                                 : GetStringId(edge->name());
+    WriteVarint(edge->type());
+    WriteVarint(static_cast<unsigned>(edge_name_or_index));
+    WriteVarint(static_cast<unsigned>(edge->to()->index()));
+    if (writer_->aborted()) return;
+  }
+}
+
+void HeapSnapshotBinarySerializer::SerializeTraceNodeInfos() {
+  AllocationTracker* tracker = snapshot_->profiler()->allocation_tracker();
+  if (!tracker) {
+    WriteVarint(0);
+    return;
+  }
+  // Positions are 1-based with 0 meaning "unknown", as in the JSON format.
+  auto position = [](int value) -> uint64_t {
+    DCHECK_GE(value, -1);
+    return static_cast<uint64_t>(value + 1);
+  };
+  WriteVarint(tracker->function_info_list().size());
+  for (AllocationTracker::FunctionInfo* info : tracker->function_info_list()) {
+    WriteVarint(info->function_id);
+    WriteVarint(static_cast<unsigned>(GetStringId(info->name)));
+    WriteVarint(static_cast<unsigned>(GetStringId(info->script_name)));
+    // The cast is safe because script id is a non-negative Smi.
+    WriteVarint(static_cast<unsigned>(info->script_id));
+    WriteVarint(position(info->line));
+    WriteVarint(position(info->column));
+  }
+}
+
+void HeapSnapshotBinarySerializer::SerializeTraceNode(
+    AllocationTraceNode* node) {
+  WriteVarint(node->id());
+  WriteVarint(node->function_info_index());
+  WriteVarint(node->allocation_count());
+  WriteVarint(node->allocation_size());
+  WriteVarint(node->children().size());
+  for (AllocationTraceNode* child : node->children()) {
+    SerializeTraceNode(child);
+  }
+}
+
+void HeapSnapshotBinarySerializer::SerializeSamples() {
+  const std::vector<HeapObjectsMap::TimeInterval>& samples =
+      snapshot_->profiler()->heap_object_map()->samples();
+  WriteVarint(samples.size());
+  if (samples.empty()) return;
+  base::TimeTicks start_time = samples[0].timestamp;
+  for (const HeapObjectsMap::TimeInterval& sample : samples) {
+    base::TimeDelta time_delta = sample.timestamp - start_time;
+    WriteVarint(time_delta.InMicroseconds());
+    WriteVarint(sample.last_assigned_id());
+  }
+}
+
+void HeapSnapshotBinarySerializer::SerializeLocations() {
+  const std::vector<SourceLocation>& locations = snapshot_->locations();
+  WriteVarint(locations.size());
+  for (const SourceLocation& location : locations) {
+    WriteVarint(static_cast<unsigned>(location.entry_index));
+    WriteVarint(static_cast<unsigned>(location.scriptId));
+    WriteVarint(static_cast<unsigned>(location.line));
+    WriteVarint(static_cast<unsigned>(location.col));
+    if (writer_->aborted()) return;
+  }
+}
+
+void HeapSnapshotBinarySerializer::SerializeStrings() {
+  std::vector<const char*> sorted_strings(strings_.occupancy() + 1);
+  sorted_strings[0] = "<dummy>";
+  for (base::HashMap::Entry* entry = strings_.Start(); entry != nullptr;
+       entry = strings_.Next(entry)) {
+    int index = static_cast<int>(reinterpret_cast<uintptr_t>(entry->value));
+    sorted_strings[index] = reinterpret_cast<const char*>(entry->key);
+  }
+  WriteVarint(sorted_strings.size());
+  for (const char* s : sorted_strings) {
+    WriteString(s);
+    if (writer_->aborted()) return;
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
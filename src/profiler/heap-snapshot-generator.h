@@ -7,10 +7,12 @@
 
 #include <deque>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "include/v8-platform.h"
 #include "include/v8-profiler.h"
 #include "src/base/platform/time.h"
 #include "src/execution/isolate.h"
@@ -673,6 +675,7 @@ class HeapSnapshotJSONSerializer {
         next_node_id_(1),
         next_string_id_(1),
         writer_(nullptr) {}
+  ~HeapSnapshotJSONSerializer();
   HeapSnapshotJSONSerializer(const HeapSnapshotJSONSerializer&) = delete;
   HeapSnapshotJSONSerializer& operator=(const HeapSnapshotJSONSerializer&) =
       delete;
@@ -687,6 +690,11 @@ class HeapSnapshotJSONSerializer {
   V8_INLINE static uint32_t StringHash(const void* string);
 
   int GetStringId(const char* s);
+  // Assigns string ids in the same order as the serialization of nodes, edges
+  // and trace function infos would, so that the string table is complete
+  // before any of those sections is written.
+  void AssignStringIds();
+  void StartConcurrentStringSerialization();
   V8_INLINE int to_node_index(const HeapEntry* e);
   V8_INLINE int to_node_index(int entry_index);
   void SerializeEdge(HeapGraphEdge* edge, bool first_edge);
@@ -712,11 +720,73 @@ class HeapSnapshotJSONSerializer {
   int next_node_id_;
   int next_string_id_;
   OutputStreamWriter* writer_;
+  // Escaped contents of the "strings" section when it is produced on a
+  // background thread. Only valid after |strings_job_| has been joined.
+  std::string serialized_strings_;
+  std::unique_ptr<JobHandle> strings_job_;
 
   friend class HeapSnapshotJSONSerializerEnumerator;
   friend class HeapSnapshotJSONSerializerIterator;
 };
 
+// Serializes a snapshot into a compact binary encoding of the same data the
+// JSON serializer produces. All integers are unsigned LEB128 varints and all
+// strings are a varint byte length followed by UTF-8 bytes. Sections, in order:
+//
+//   header:     the 8 byte kMagic, varint kFormatVersion
+//   meta:       the JSON "meta" object describing field layouts, as a string
+//   nodes:      node count, then kNodeFieldsCount varints per node
+//   edges:      edge count, then kEdgeFieldsCount varints per edge; to_node is
+//               a node ordinal rather than an offset into the nodes array
+//   trace_function_infos: count, then 6 varints per function info
+//   trace_tree: pre-order; id, function_info_index, count, size, number of
+//               children, followed by the children
+//   samples:    count, then timestamp_us and last_assigned_id per sample
+//   locations:  count, then 4 varints per location; object_index is a node
+//               ordinal
+//   strings:    count, then that many strings; entry 0 is "<dummy>"
+//
+// tools/heap-snapshot-binary-to-json.py converts the output into the JSON
+// format understood by DevTools.
+class HeapSnapshotBinarySerializer {
+ public:
+  static constexpr char kMagic[] = "V8HSNAP";
+  static constexpr uint32_t kFormatVersion = 1;
+
+  explicit HeapSnapshotBinarySerializer(HeapSnapshot* snapshot)
+      : snapshot_(snapshot),
+        strings_(StringsMatch),
+        next_string_id_(1),
+        writer_(nullptr) {}
+  HeapSnapshotBinarySerializer(const HeapSnapshotBinarySerializer&) = delete;
+  HeapSnapshotBinarySerializer& operator=(const HeapSnapshotBinarySerializer&) =
+      delete;
+  void Serialize(v8::OutputStream* stream);
+
+ private:
+  V8_INLINE static bool StringsMatch(void* key1, void* key2) {
+    return strcmp(reinterpret_cast<char*>(key1),
+                  reinterpret_cast<char*>(key2)) == 0;
+  }
+
+  int GetStringId(const char* s);
+  void WriteVarint(uint64_t value);
+  void WriteString(const char* s);
+  void SerializeImpl();
+  void SerializeNodes();
+  void SerializeEdges();
+  void SerializeTraceNodeInfos();
+  void SerializeTraceNode(AllocationTraceNode* node);
+  void SerializeSamples();
+  void SerializeLocations();
+  void SerializeStrings();
+
+  HeapSnapshot* snapshot_;
+  base::CustomMatcherHashMap strings_;
+  int next_string_id_;
+  OutputStreamWriter* writer_;
+};
+
 
 }  // namespace internal
 }  // namespace v8
@@ -61,14 +61,20 @@ class OutputStreamWriter {
   void AddSubstring(const char* s, int n) {
     if (n <= 0) return;
     DCHECK_LE(n, strlen(s));
-    const char* s_end = s + n;
-    while (s < s_end) {
-      int s_chunk_size =
-          std::min(chunk_size_ - chunk_pos_, static_cast<int>(s_end - s));
-      DCHECK_GT(s_chunk_size, 0);
-      MemCopy(chunk_.begin() + chunk_pos_, s, s_chunk_size);
-      s += s_chunk_size;
-      chunk_pos_ += s_chunk_size;
+    AddBytes(reinterpret_cast<const uint8_t*>(s), n);
+  }
+  // Adds |n| raw bytes which, unlike strings, may contain '\0'. Used by binary
+  // output formats.
+  void AddBytes(const uint8_t* bytes, int n) {
+    if (n <= 0) return;
+    const uint8_t* bytes_end = bytes + n;
+    while (bytes < bytes_end) {
+      int chunk_size = std::min(chunk_size_ - chunk_pos_,
+                                static_cast<int>(bytes_end - bytes));
+      DCHECK_GT(chunk_size, 0);
+      MemCopy(chunk_.begin() + chunk_pos_, bytes, chunk_size);
+      bytes += chunk_size;
+      chunk_pos_ += chunk_size;
       MaybeWriteChunk();
     }
   }
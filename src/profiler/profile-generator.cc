@@ -687,6 +687,16 @@ void BuildNodeValue(const ProfileNode* node, TracedValue* value) {
 void CpuProfile::StreamPendingTraceEvents() {
   std::vector<const ProfileNode*> pending_nodes = top_down_.TakePendingNodes();
   if (pending_nodes.empty() && samples_.empty()) return;
+
+  // Building the chunk is costly and happens every few samples. Skip it if
+  // nobody is tracing, the nodes and samples are still in the profile itself.
+  bool tracing_enabled = false;
+  TRACE_EVENT_CATEGORY_GROUP_ENABLED(
+      TRACE_DISABLED_BY_DEFAULT("v8.cpu_profiler"), &tracing_enabled);
+  if (!tracing_enabled) {
+    streaming_next_sample_ = samples_.size();
+    return;
+  }
   auto value = TracedValue::Create();
 
   if (!pending_nodes.empty() || streaming_next_sample_ != samples_.size()) {
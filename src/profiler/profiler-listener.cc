@@ -5,6 +5,7 @@
 #include "src/profiler/profiler-listener.h"
 
 #include <algorithm>
+#include <map>
 
 #include "src/base/vector.h"
 #include "src/codegen/reloc-info.h"
@@ -118,6 +119,10 @@ void ProfilerListener::CodeCreateEvent(CodeTag tag,
   std::unordered_map<int, std::vector<CodeEntryAndLineNumber>> inline_stacks;
   std::unordered_set<CodeEntry*, CodeEntry::Hasher, CodeEntry::Equals>
       cached_inline_entries;
+  // Inlined functions usually show up at many source positions. Look them up
+  // by script id and start position, which is what CodeEntry::Equals compares,
+  // so that their names and start line and column are only computed once.
+  std::map<std::pair<int, int>, CodeEntry*> inline_entries_by_function;
   bool is_shared_cross_origin = false;
   if (shared->script(cage_base).IsScript(cage_base)) {
     Handle<Script> script =
@@ -181,31 +186,36 @@ void ProfilerListener::CodeCreateEvent(CodeTag tag,
               pos_info.script->GetLineNumber(pos_info.position.ScriptOffset()) +
               1;
 
-          const char* resource_name =
-              (pos_info.script->name().IsName())
-                  ? GetName(Name::cast(pos_info.script->name()))
-                  : CodeEntry::kEmptyResourceName;
-
-          bool inline_is_shared_cross_origin =
-              pos_info.script->origin_options().IsSharedCrossOrigin();
-
-          // We need the start line number and column number of the function for
-          // kLeafNodeLineNumbers mode. Creating a SourcePositionInfo is a handy
-          // way of getting both easily.
-          SourcePositionInfo start_pos_info(
-              SourcePosition(pos_info.shared->StartPosition()),
-              pos_info.shared);
-
-          CodeEntry* inline_entry = code_entries_.Create(
-              tag, GetFunctionName(*pos_info.shared), resource_name,
-              start_pos_info.line + 1, start_pos_info.column + 1, nullptr,
-              inline_is_shared_cross_origin);
-          inline_entry->FillFunctionInfo(*pos_info.shared);
-
-          // Create a canonical CodeEntry for each inlined frame and then re-use
-          // them for subsequent inline stacks to avoid a lot of duplication.
-          CodeEntry* cached_entry = GetOrInsertCachedEntry(
-              &cached_inline_entries, inline_entry, code_entries_);
+          CodeEntry*& cached_entry = inline_entries_by_function[{
+              pos_info.script->id(), pos_info.shared->StartPosition()}];
+          if (cached_entry == nullptr) {
+            const char* resource_name =
+                (pos_info.script->name().IsName())
+                    ? GetName(Name::cast(pos_info.script->name()))
+                    : CodeEntry::kEmptyResourceName;
+
+            bool inline_is_shared_cross_origin =
+                pos_info.script->origin_options().IsSharedCrossOrigin();
+
+            // We need the start line number and column number of the function
+            // for kLeafNodeLineNumbers mode. Creating a SourcePositionInfo is
+            // a handy way of getting both easily.
+            SourcePositionInfo start_pos_info(
+                SourcePosition(pos_info.shared->StartPosition()),
+                pos_info.shared);
+
+            CodeEntry* inline_entry = code_entries_.Create(
+                tag, GetFunctionName(*pos_info.shared), resource_name,
+                start_pos_info.line + 1, start_pos_info.column + 1, nullptr,
+                inline_is_shared_cross_origin);
+            inline_entry->FillFunctionInfo(*pos_info.shared);
+
+            // Create a canonical CodeEntry for each inlined frame and then
+            // re-use them for subsequent inline stacks to avoid a lot of
+            // duplication.
+            cached_entry = GetOrInsertCachedEntry(
+                &cached_inline_entries, inline_entry, code_entries_);
+          }
 
           inline_stack.push_back({cached_entry, line_number});
         }
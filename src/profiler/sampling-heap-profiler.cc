@@ -208,12 +208,21 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
   // the first element in the list.
   for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
     SharedFunctionInfo shared = *it;
-    const char* name = this->names()->GetCopy(shared.DebugNameCStr().get());
     int script_id = v8::UnboundScript::kNoScriptId;
     if (shared.script().IsScript()) {
       Script script = Script::cast(shared.script());
       script_id = script.id();
+      // Functions with a script are identified by their position alone. Most
+      // samples hit an existing node, so avoid copying and interning the
+      // function name in that case.
+      AllocationNode* child = node->FindChildNode(AllocationNode::function_id(
+          script_id, shared.StartPosition(), nullptr));
+      if (child) {
+        node = child;
+        continue;
+      }
     }
+    const char* name = this->names()->GetCopy(shared.DebugNameCStr().get());
     node = FindOrAddChildNode(node, name, script_id, shared.StartPosition());
   }
 
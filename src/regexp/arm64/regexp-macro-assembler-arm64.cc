@@ -640,6 +640,74 @@ void RegExpMacroAssemblerARM64::CheckBitInTable(
   CompareAndBranchOrBacktrack(w11, 0, ne, on_bit_set);
 }
 
+void RegExpMacroAssemblerARM64::SkipUntilBitInTable(
+    int cp_offset, Handle<ByteArray> table, Handle<ByteArray> nibble_table,
+    int advance_by) {
+  Label cont, scalar_repeat;
+
+  if (SkipUntilBitInTableUseSimd(advance_by)) {
+    DCHECK(!nibble_table.is_null());
+    // Only the low halves of v8-v15 are callee-saved, so use other registers.
+    const VRegister chars = v0.V16B();
+    const VRegister high_nibbles = v1.V16B();
+    const VRegister table_bits = v2.V16B();
+    const VRegister nibble_mask = v3.V16B();
+    const VRegister nibble_table_reg = v4.V16B();
+    const VRegister bit_mask = v5.V16B();
+    static constexpr int kCharsPerVector = 16;
+    Label simd_repeat, found;
+
+    __ Mov(x11, Operand(nibble_table));
+    __ Ldr(nibble_table_reg.Q(), FieldMemOperand(x11, ByteArray::kHeaderSize));
+    // Byte i of {bit_mask} is {1 << (i & 7)}, so the high nibbles of
+    // characters >= 0x80 alias the ones below, as in CheckBitInTable.
+    __ Movi(bit_mask, 0x8040201008040201, 0x8040201008040201);
+    __ Movi(nibble_mask, 0x0F);
+
+    __ Bind(&simd_repeat);
+    // Fall back to the scalar loop if fewer than 16 characters are left.
+    __ Add(w10, current_input_offset(), cp_offset + kCharsPerVector);
+    __ Cmp(w10, 0);
+    __ B(gt, &scalar_repeat);
+    __ Add(w10, current_input_offset(), cp_offset);
+    __ Ldr(chars.Q(), MemOperand(input_end(), w10, SXTW));
+    __ Ushr(high_nibbles, chars, 4);
+    __ And(chars, chars, nibble_mask);
+    __ Tbl(table_bits, nibble_table_reg, chars);
+    __ Tbl(chars, bit_mask, high_nibbles);
+    // A character is in the table iff the bit for its high nibble is set in
+    // the table byte for its low nibble.
+    __ Cmtst(table_bits, table_bits, chars);
+    // Narrow every byte of the comparison result to 4 bits of a 64-bit mask.
+    __ Shrn(table_bits.V8B(), table_bits.V8H(), 4);
+    __ Fmov(x11, table_bits.D());
+    __ Cbnz(x11, &found);
+    __ Add(current_input_offset(), current_input_offset(), kCharsPerVector);
+    __ B(&simd_repeat);
+
+    __ Bind(&found);
+    __ Rbit(x11, x11);
+    __ Clz(x11, x11);
+    __ Add(current_input_offset(), current_input_offset(),
+           Operand(w11, LSR, 2));
+    __ B(&cont);
+  }
+
+  Bind(&scalar_repeat);
+  LoadCurrentCharacter(cp_offset, &cont, true);
+  CheckBitInTable(table, &cont);
+  AdvanceCurrentPosition(advance_by);
+  GoTo(&scalar_repeat);
+  Bind(&cont);
+}
+
+bool RegExpMacroAssemblerARM64::SkipUntilBitInTableUseSimd(int advance_by) {
+  // The SIMD loop checks consecutive characters, and only supports one-byte
+  // strings.
+  return v8_flags.regexp_simd && advance_by * char_size() == 1 &&
+         CanReadUnaligned();
+}
+
 bool RegExpMacroAssemblerARM64::CheckSpecialClassRanges(
     StandardCharacterSet type, Label* on_no_match) {
   // Range checks (c in min..max) are generally implemented by an unsigned
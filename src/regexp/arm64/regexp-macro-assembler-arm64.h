@@ -57,6 +57,10 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerARM64
   bool CheckCharacterNotInRangeArray(const ZoneList<CharacterRange>* ranges,
                                      Label* on_not_in_range) override;
   void CheckBitInTable(Handle<ByteArray> table, Label* on_bit_set) override;
+  void SkipUntilBitInTable(int cp_offset, Handle<ByteArray> table,
+                           Handle<ByteArray> nibble_table,
+                           int advance_by) override;
+  bool SkipUntilBitInTableUseSimd(int advance_by) override;
 
   // Checks whether the given offset from the current position is before
   // the end of the string.
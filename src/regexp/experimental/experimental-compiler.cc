@@ -35,10 +35,11 @@ class CanBeHandledVisitor final : private RegExpVisitor {
 
   static bool AreSuitableFlags(RegExpFlags flags) {
     // TODO(mbid, v8:10765): We should be able to support all flags in the
-    // future.
+    // future.  Case-insensitive matching is only supported in non-unicode
+    // mode, since /ui and /vi match by simple case folding instead.
     static constexpr RegExpFlags kAllowedFlags =
         RegExpFlag::kGlobal | RegExpFlag::kSticky | RegExpFlag::kMultiline |
-        RegExpFlag::kDotAll | RegExpFlag::kLinear;
+        RegExpFlag::kDotAll | RegExpFlag::kLinear | RegExpFlag::kIgnoreCase;
     // We support Unicode iff kUnicode is among the supported flags.
     static_assert(ExperimentalRegExp::kSupportsUnicode ==
                   IsUnicode(kAllowedFlags));
@@ -306,9 +307,10 @@ class BytecodeAssembler {
 
 class CompileVisitor : private RegExpVisitor {
  public:
-  static ZoneList<RegExpInstruction> Compile(RegExpTree* tree,
+  static ZoneList<RegExpInstruction> Compile(Isolate* isolate,
+                                             RegExpTree* tree,
                                              RegExpFlags flags, Zone* zone) {
-    CompileVisitor compiler(zone);
+    CompileVisitor compiler(isolate, zone, IsIgnoreCase(flags));
 
     if (!IsSticky(flags) && !tree->IsAnchoredAtStart()) {
       // The match is not anchored, i.e. may start at any input position, so we
@@ -327,7 +329,11 @@ class CompileVisitor : private RegExpVisitor {
   }
 
  private:
-  explicit CompileVisitor(Zone* zone) : zone_(zone), assembler_(zone) {}
+  CompileVisitor(Isolate* isolate, Zone* zone, bool ignore_case)
+      : isolate_(isolate),
+        zone_(zone),
+        ignore_case_(ignore_case),
+        assembler_(zone) {}
 
   // Generate a disjunction of code fragments compiled by a function `alt_gen`.
   // `alt_gen` is called repeatedly with argument `int i = 0, 1, ..., alt_num -
@@ -429,7 +435,13 @@ class CompileVisitor : private RegExpVisitor {
   }
 
   void* VisitClassRanges(RegExpClassRanges* node, void*) override {
-    CompileCharacterRanges(node->ranges(zone_), node->is_negated());
+    ZoneList<CharacterRange>* ranges = node->ranges(zone_);
+    // Standard character sets other than \w are closed under case
+    // equivalence, and \w only gains characters in unicode mode.
+    if (ignore_case_ && !node->is_standard(zone_)) {
+      CharacterRange::AddCaseEquivalents(isolate_, zone_, ranges, false);
+    }
+    CompileCharacterRanges(ranges, node->is_negated());
     return nullptr;
   }
 
@@ -448,7 +460,16 @@ class CompileVisitor : private RegExpVisitor {
 
   void* VisitAtom(RegExpAtom* node, void*) override {
     for (base::uc16 c : node->data()) {
-      assembler_.ConsumeRange(c, c);
+      if (ignore_case_) {
+        // Match each character as the class of its case equivalents.
+        ZoneList<CharacterRange>* ranges =
+            zone_->New<ZoneList<CharacterRange>>(2, zone_);
+        ranges->Add(CharacterRange::Singleton(c), zone_);
+        CharacterRange::AddCaseEquivalents(isolate_, zone_, ranges, false);
+        CompileCharacterRanges(ranges, false);
+      } else {
+        assembler_.ConsumeRange(c, c);
+      }
     }
     return nullptr;
   }
@@ -648,15 +669,17 @@ class CompileVisitor : private RegExpVisitor {
   }
 
  private:
+  Isolate* const isolate_;
   Zone* zone_;
+  const bool ignore_case_;
   BytecodeAssembler assembler_;
 };
 
 }  // namespace
 
 ZoneList<RegExpInstruction> ExperimentalRegExpCompiler::Compile(
-    RegExpTree* tree, RegExpFlags flags, Zone* zone) {
-  return CompileVisitor::Compile(tree, flags, zone);
+    Isolate* isolate, RegExpTree* tree, RegExpFlags flags, Zone* zone) {
+  return CompileVisitor::Compile(isolate, tree, flags, zone);
 }
 
 }  // namespace internal
@@ -19,13 +19,14 @@ class ExperimentalRegExpCompiler final : public AllStatic {
   // bytecode program.  This mostly amounts to the absence of back references,
   // but see the definition.
   // TODO(mbid,v8:10765): Currently more things are not handled, e.g. some
-  // quantifiers and unicode.
+  // quantifiers, lookarounds, unicode and case-insensitive unicode matching.
   static bool CanBeHandled(RegExpTree* tree, RegExpFlags flags,
                            int capture_count);
   // Compile regexp into a bytecode program.  The regexp must be handlable by
   // the experimental engine; see`CanBeHandled`.  The program is returned as a
   // ZoneList backed by the same Zone that is used in the RegExpTree argument.
-  static ZoneList<RegExpInstruction> Compile(RegExpTree* tree,
+  static ZoneList<RegExpInstruction> Compile(Isolate* isolate,
+                                             RegExpTree* tree,
                                              RegExpFlags flags, Zone* zone);
 };
 
@@ -4,9 +4,16 @@
 
 #include "src/regexp/experimental/experimental-interpreter.h"
 
+#include <algorithm>
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+#include "src/base/functional.h"
 #include "src/base/optional.h"
 #include "src/base/strings.h"
 #include "src/common/assert-scope.h"
+#include "src/flags/flags.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/string-inl.h"
 #include "src/regexp/experimental/experimental.h"
@@ -86,6 +93,247 @@ base::Vector<const base::uc16> ToCharacterVector<base::uc16>(
   return content.ToUC16Vector();
 }
 
+class LazyDfa {
+  // A DFA over the bytecode of a regexp that is built lazily while it runs,
+  // similar to the DFA of RE2.  A state is the set of CONSUME_RANGE
+  // instructions that some thread is blocked at after a given input prefix,
+  // and it is accepting if some thread has executed ACCEPT.  Registers and
+  // thread priorities are ignored, and assertions are assumed to hold.  The
+  // DFA thus reaches an accepting state whenever the NfaInterpreter would
+  // find a match, but not only then, so it can only be used to rule out
+  // matches.  Doing so takes a single table lookup per input character for
+  // transitions that have been computed before.
+  //
+  // Input characters are grouped into classes that no CONSUME_RANGE
+  // distinguishes, and states and their transitions are cached up to a memory
+  // budget.  When the budget is exhausted the cache is flushed.  If that
+  // happens again before the DFA has consumed `kMinCharsPerState` characters
+  // per cached state, the cache is thrashing, and the DFA gives up for good.
+ public:
+  static constexpr int kFailed = -1;
+
+  LazyDfa(base::Vector<const RegExpInstruction> bytecode, size_t budget)
+      : budget_(budget), visited_(bytecode.length(), 0) {
+    for (const RegExpInstruction& inst : bytecode) {
+      if (inst.opcode != RegExpInstruction::CONSUME_RANGE) continue;
+      boundaries_.push_back(inst.payload.consume_range.min);
+      boundaries_.push_back(inst.payload.consume_range.max + 1);
+    }
+    std::sort(boundaries_.begin(), boundaries_.end());
+    boundaries_.erase(std::unique(boundaries_.begin(), boundaries_.end()),
+                      boundaries_.end());
+    // Character class k consists of the characters in
+    // [boundaries_[k - 1], boundaries_[k]), where the first and last class
+    // are bounded by 0 and 0xFFFF.  Boundaries outside of that range would
+    // only produce empty classes.
+    if (!boundaries_.empty() && boundaries_.front() == 0) {
+      boundaries_.erase(boundaries_.begin());
+    }
+    if (!boundaries_.empty() && boundaries_.back() > 0xFFFF) {
+      boundaries_.pop_back();
+    }
+    class_count_ = static_cast<int>(boundaries_.size()) + 1;
+    for (size_t c = 0; c < latin1_classes_.size(); ++c) {
+      latin1_classes_[c] = static_cast<int>(
+          std::upper_bound(boundaries_.begin(), boundaries_.end(), c) -
+          boundaries_.begin());
+    }
+  }
+
+  bool failed() const { return failed_; }
+
+  // Returns the state before any input has been consumed, or kFailed.
+  int StartState(base::Vector<const RegExpInstruction> bytecode) {
+    if (start_state_ == kUnknown) {
+      BeginClosure();
+      AddClosure(bytecode, 0);
+      start_state_ = FindOrAddState();
+    }
+    return start_state_;
+  }
+
+  // Returns the state reached from `state` by consuming `c`, or kFailed.
+  int Next(base::Vector<const RegExpInstruction> bytecode, int state,
+           base::uc16 c) {
+    DCHECK(!failed_);
+    ++chars_since_flush_;
+    const int char_class = CharClass(c);
+    const size_t transition = static_cast<size_t>(state) * class_count_ +
+                              static_cast<size_t>(char_class);
+    if (transitions_[transition] != kUnknown) return transitions_[transition];
+
+    // All characters of a class are consumed by the same instructions, so it
+    // suffices to look at the first one.
+    const base::uc16 representative =
+        char_class == 0 ? 0
+                        : static_cast<base::uc16>(boundaries_[char_class - 1]);
+    BeginClosure();
+    const State& s = states_[state];
+    for (int i = s.pcs_begin; i != s.pcs_end; ++i) {
+      const int pc = pcs_[i];
+      DCHECK_EQ(bytecode[pc].opcode, RegExpInstruction::CONSUME_RANGE);
+      RegExpInstruction::Uc16Range range = bytecode[pc].payload.consume_range;
+      if (representative >= range.min && representative <= range.max) {
+        AddClosure(bytecode, pc + 1);
+      }
+    }
+
+    const int flush_count = flush_count_;
+    const int next = FindOrAddState();
+    // A flush discards `state` along with its transitions.
+    if (next != kFailed && flush_count == flush_count_) {
+      transitions_[transition] = next;
+    }
+    return next;
+  }
+
+  bool IsAccepting(int state) const { return states_[state].accepting; }
+
+  // No match can be found from a dead state on.
+  bool IsDead(int state) const {
+    const State& s = states_[state];
+    return !s.accepting && s.pcs_begin == s.pcs_end;
+  }
+
+ private:
+  static constexpr int kUnknown = -2;
+  static constexpr int kMinCharsPerState = 10;
+
+  struct State {
+    // The sorted pcs of the state are pcs_[pcs_begin, pcs_end).
+    int pcs_begin;
+    int pcs_end;
+    bool accepting;
+  };
+
+  struct KeyHash {
+    size_t operator()(const std::vector<int>& key) const {
+      return base::hash_range(key.begin(), key.end());
+    }
+  };
+
+  int CharClass(base::uc16 c) const {
+    if (c < latin1_classes_.size()) return latin1_classes_[c];
+    return static_cast<int>(
+        std::upper_bound(boundaries_.begin(), boundaries_.end(), c) -
+        boundaries_.begin());
+  }
+
+  void BeginClosure() {
+    closure_pcs_.clear();
+    closure_accepting_ = false;
+    ++generation_;
+  }
+
+  // Adds the pcs of the CONSUME_RANGE instructions that are reachable from
+  // `pc` without consuming input to `closure_pcs_`.
+  void AddClosure(base::Vector<const RegExpInstruction> bytecode, int pc) {
+    DCHECK(worklist_.empty());
+    worklist_.push_back(pc);
+    while (!worklist_.empty()) {
+      pc = worklist_.back();
+      worklist_.pop_back();
+      if (visited_[pc] == generation_) continue;
+      visited_[pc] = generation_;
+
+      RegExpInstruction inst = bytecode[pc];
+      switch (inst.opcode) {
+        case RegExpInstruction::CONSUME_RANGE:
+          closure_pcs_.push_back(pc);
+          break;
+        case RegExpInstruction::FORK:
+          worklist_.push_back(inst.payload.pc);
+          worklist_.push_back(pc + 1);
+          break;
+        case RegExpInstruction::JMP:
+          worklist_.push_back(inst.payload.pc);
+          break;
+        case RegExpInstruction::ACCEPT:
+          closure_accepting_ = true;
+          break;
+        case RegExpInstruction::ASSERTION:
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+        case RegExpInstruction::CLEAR_REGISTER:
+          worklist_.push_back(pc + 1);
+          break;
+      }
+    }
+  }
+
+  // Returns the state for the current closure, adding it to the cache if
+  // necessary, or kFailed.
+  int FindOrAddState() {
+    std::sort(closure_pcs_.begin(), closure_pcs_.end());
+    // The key is the sorted set of pcs, followed by the accepting bit.
+    closure_pcs_.push_back(closure_accepting_ ? 1 : 0);
+    auto it = state_ids_.find(closure_pcs_);
+    if (it != state_ids_.end()) return it->second;
+    closure_pcs_.pop_back();
+
+    // The pcs are stored twice, once as map key.
+    const size_t state_size =
+        sizeof(State) + sizeof(std::vector<int>) + 4 * sizeof(void*) +
+        (2 * closure_pcs_.size() + 1 + class_count_) * sizeof(int);
+    if (bytes_used_ + state_size > budget_) {
+      if (chars_since_flush_ < kMinCharsPerState * states_.size() ||
+          state_size > budget_) {
+        failed_ = true;
+        return kFailed;
+      }
+      Flush();
+    }
+    bytes_used_ += state_size;
+
+    const int id = static_cast<int>(states_.size());
+    const int pcs_begin = static_cast<int>(pcs_.size());
+    pcs_.insert(pcs_.end(), closure_pcs_.begin(), closure_pcs_.end());
+    states_.push_back(State{pcs_begin, static_cast<int>(pcs_.size()),
+                            closure_accepting_});
+    transitions_.resize(transitions_.size() + class_count_, kUnknown);
+    closure_pcs_.push_back(closure_accepting_ ? 1 : 0);
+    state_ids_.emplace(closure_pcs_, id);
+    return id;
+  }
+
+  void Flush() {
+    states_.clear();
+    pcs_.clear();
+    transitions_.clear();
+    state_ids_.clear();
+    start_state_ = kUnknown;
+    bytes_used_ = 0;
+    chars_since_flush_ = 0;
+    ++flush_count_;
+  }
+
+  const size_t budget_;
+  size_t bytes_used_ = 0;
+  size_t chars_since_flush_ = 0;
+  int flush_count_ = 0;
+  bool failed_ = false;
+
+  // The sorted start points of the character classes other than the first.
+  std::vector<base::uc32> boundaries_;
+  int class_count_;
+  std::array<int, 256> latin1_classes_;
+
+  std::vector<State> states_;
+  std::vector<int> pcs_;
+  // transitions_[state * class_count_ + k] is the state reached from `state`
+  // by a character of class k, or kUnknown if it hasn't been computed yet.
+  std::vector<int> transitions_;
+  std::unordered_map<std::vector<int>, int, KeyHash> state_ids_;
+  int start_state_ = kUnknown;
+
+  // Scratch space for computing closures.  visited_[pc] == generation_ iff
+  // pc has been visited by the current closure.
+  std::vector<int> closure_pcs_;
+  bool closure_accepting_ = false;
+  std::vector<int> worklist_;
+  std::vector<int> visited_;
+  int generation_ = 0;
+};
+
 template <class Character>
 class NfaInterpreter {
   // Executes a bytecode program in breadth-first mode, without backtracking.
@@ -159,6 +407,11 @@ class NfaInterpreter {
     DCHECK_LE(input_index_, input_.length());
 
     std::fill(pc_last_input_index_.begin(), pc_last_input_index_.end(), -1);
+
+    if (v8_flags.experimental_regexp_engine_dfa_cache_size > 0) {
+      dfa_.emplace(bytecode_,
+                   v8_flags.experimental_regexp_engine_dfa_cache_size);
+    }
   }
 
   // Finds matches and writes their concatenated capture registers to
@@ -328,6 +581,16 @@ class NfaInterpreter {
       best_match_registers_ = base::nullopt;
     }
 
+    if (dfa_.has_value()) {
+      bool may_match;
+      int err_code = RunDfa(&may_match);
+      if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      if (!may_match) {
+        SetInputIndex(input_.length());
+        return RegExp::kInternalRegExpSuccess;
+      }
+    }
+
     // All threads start at bytecode 0.
     active_threads_.Add(
         InterpreterThread{0, NewRegisterArray(kUndefinedRegisterValue)}, zone_);
@@ -348,7 +611,6 @@ class NfaInterpreter {
       base::uc16 input_char = input_[input_index_];
       ++input_index_;
 
-      static constexpr int kTicksBetweenInterruptHandling = 64;
       if (input_index_ % kTicksBetweenInterruptHandling == 0) {
         int err_code = HandleInterrupts();
         if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
@@ -364,6 +626,34 @@ class NfaInterpreter {
     return RegExp::kInternalRegExpSuccess;
   }
 
+  // Run the lazy DFA on the input from `input_index_` on.  Sets `*may_match`
+  // to false if there is no match to be found, and to true if there might be
+  // or the DFA gave up.  Returns RegExp::kInternalRegExpSuccess unless
+  // execution was interrupted.
+  int RunDfa(bool* may_match) {
+    *may_match = true;
+    int state = dfa_->StartState(bytecode_);
+    int index = input_index_;
+    while (state != LazyDfa::kFailed && !dfa_->IsAccepting(state)) {
+      if (dfa_->IsDead(state) || index == input_.length()) {
+        *may_match = false;
+        return RegExp::kInternalRegExpSuccess;
+      }
+      base::uc16 input_char = input_[index];
+      ++index;
+
+      if (index % kTicksBetweenInterruptHandling == 0) {
+        int err_code = HandleInterrupts();
+        if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      }
+
+      state = dfa_->Next(bytecode_, state, input_char);
+    }
+    // Don't bother with the DFA again if its cache thrashed.
+    if (dfa_->failed()) dfa_.reset();
+    return RegExp::kInternalRegExpSuccess;
+  }
+
   // Run an active thread `t` until it executes a CONSUME_RANGE or ACCEPT
   // instruction, or its PC value was already processed.
   // - If processing of `t` can't continue because of CONSUME_RANGE, it is
@@ -510,6 +800,8 @@ class NfaInterpreter {
     pc_last_input_index_[pc] = input_index_;
   }
 
+  static constexpr int kTicksBetweenInterruptHandling = 64;
+
   Isolate* const isolate_;
 
   const RegExp::CallOrigin call_origin_;
@@ -551,6 +843,10 @@ class NfaInterpreter {
   // `register_array_allocator_`.
   base::Optional<base::Vector<int>> best_match_registers_;
 
+  // Rules out inputs without a match before they are simulated thread by
+  // thread.  Empty if disabled or if it gave up.
+  base::Optional<LazyDfa> dfa_;
+
   Zone* zone_;
 };
 
@@ -0,0 +1,142 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-bytecode-cache.h"
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/heap/factory.h"
+#include "src/objects/fixed-array-inl.h"
+#include "src/objects/string-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+struct Key {
+  std::vector<base::uc16> source;
+  int flags;
+  bool is_one_byte;
+  uint32_t backtrack_limit;
+
+  bool operator<(const Key& other) const {
+    return std::tie(source, flags, is_one_byte, backtrack_limit) <
+           std::tie(other.source, other.flags, other.is_one_byte,
+                    other.backtrack_limit);
+  }
+};
+
+struct Entry {
+  std::vector<uint8_t> bytecode;
+  int register_count = 0;
+  uint32_t compiled_backtrack_limit = 0;
+};
+
+class Cache {
+ public:
+  base::Mutex* mutex() { return &mutex_; }
+
+  const Entry* Find(const Key& key) const {
+    auto it = entries_.find(key);
+    return it == entries_.end() ? nullptr : &it->second;
+  }
+
+  void Insert(Key key, Entry entry) {
+    const size_t size = EntrySize(key, entry);
+    if (size > v8_flags.regexp_bytecode_cache_size) return;
+    // Start over rather than tracking recency of use: the cache is meant for
+    // the regexps that all isolates of a process compile during startup.
+    if (bytes_used_ + size > v8_flags.regexp_bytecode_cache_size) Clear();
+    if (entries_.emplace(std::move(key), std::move(entry)).second) {
+      bytes_used_ += size;
+    }
+  }
+
+  void Clear() {
+    entries_.clear();
+    bytes_used_ = 0;
+  }
+
+ private:
+  static size_t EntrySize(const Key& key, const Entry& entry) {
+    static constexpr size_t kEntryOverhead = 64;
+    return kEntryOverhead + key.source.size() * sizeof(base::uc16) +
+           entry.bytecode.size();
+  }
+
+  base::Mutex mutex_;
+  std::map<Key, Entry> entries_;
+  size_t bytes_used_ = 0;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(Cache, GetCache)
+
+Key MakeKey(String source, RegExpFlags flags, bool is_one_byte,
+            uint32_t backtrack_limit) {
+  DisallowGarbageCollection no_gc;
+  DCHECK(source.IsFlat());
+  Key key{{}, static_cast<int>(flags), is_one_byte, backtrack_limit};
+  String::FlatContent content = source.GetFlatContent(no_gc);
+  if (content.IsOneByte()) {
+    base::Vector<const uint8_t> chars = content.ToOneByteVector();
+    key.source.assign(chars.begin(), chars.end());
+  } else {
+    base::Vector<const base::uc16> chars = content.ToUC16Vector();
+    key.source.assign(chars.begin(), chars.end());
+  }
+  return key;
+}
+
+}  // namespace
+
+// static
+MaybeHandle<ByteArray> RegExpBytecodeCache::Lookup(
+    Isolate* isolate, String source, RegExpFlags flags, bool is_one_byte,
+    uint32_t backtrack_limit, int* register_count,
+    uint32_t* compiled_backtrack_limit) {
+  Key key = MakeKey(source, flags, is_one_byte, backtrack_limit);
+  Entry entry;
+  {
+    // Copy the entry out rather than allocating under the lock: allocation
+    // may GC or wait for a shared heap safepoint while other isolates are
+    // blocked on the mutex.
+    Cache* cache = GetCache();
+    base::MutexGuard guard(cache->mutex());
+    const Entry* cached = cache->Find(key);
+    if (cached == nullptr) return {};
+    entry = *cached;
+  }
+
+  Handle<ByteArray> bytecode = isolate->factory()->NewByteArray(
+      static_cast<int>(entry.bytecode.size()));
+  bytecode->copy_in(0, entry.bytecode.data(),
+                    static_cast<int>(entry.bytecode.size()));
+  *register_count = entry.register_count;
+  *compiled_backtrack_limit = entry.compiled_backtrack_limit;
+  return bytecode;
+}
+
+// static
+void RegExpBytecodeCache::Insert(String source, RegExpFlags flags,
+                                 bool is_one_byte, uint32_t backtrack_limit,
+                                 ByteArray bytecode, int register_count,
+                                 uint32_t compiled_backtrack_limit) {
+  Key key = MakeKey(source, flags, is_one_byte, backtrack_limit);
+  Entry entry{std::vector<uint8_t>(bytecode.GetDataStartAddress(),
+                                   bytecode.GetDataEndAddress()),
+              register_count, compiled_backtrack_limit};
+  Cache* cache = GetCache();
+  base::MutexGuard guard(cache->mutex());
+  cache->Insert(std::move(key), std::move(entry));
+}
+
+}  // namespace internal
+}  // namespace v8
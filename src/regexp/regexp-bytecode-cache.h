@@ -0,0 +1,46 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+#define V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+
+#include "src/common/globals.h"
+#include "src/handles/maybe-handles.h"
+#include "src/regexp/regexp-flags.h"
+
+namespace v8 {
+namespace internal {
+
+class ByteArray;
+class String;
+
+// Process-wide cache of irregexp bytecode, keyed by pattern source, flags,
+// subject representation and backtrack limit. Bytecode does not refer to
+// any heap object, so an isolate that compiles a regexp somebody else in the
+// process has compiled before can copy the bytecode instead of parsing and
+// compiling the pattern again.
+class RegExpBytecodeCache final : public AllStatic {
+ public:
+  // Returns a copy of the cached bytecode on the heap of `isolate`, or an
+  // empty handle if there is none. On a hit, `*register_count` and
+  // `*compiled_backtrack_limit` are set to the values that the compiler
+  // produced along with the bytecode.
+  static MaybeHandle<ByteArray> Lookup(Isolate* isolate, String source,
+                                       RegExpFlags flags, bool is_one_byte,
+                                       uint32_t backtrack_limit,
+                                       int* register_count,
+                                       uint32_t* compiled_backtrack_limit);
+
+  // Records the bytecode compiled for the given key. Must not be used for
+  // patterns with named captures, whose capture name map is recreated from
+  // the parse tree.
+  static void Insert(String source, RegExpFlags flags, bool is_one_byte,
+                     uint32_t backtrack_limit, ByteArray bytecode,
+                     int register_count, uint32_t compiled_backtrack_limit);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
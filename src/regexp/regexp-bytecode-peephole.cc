@@ -614,6 +614,35 @@ void RegExpBytecodePeephole::DefineStandardSequences() {
       .IgnoreArgument(2, 4, 4)   // indirect loop jump
       .IgnoreArgument(3, 4, 4)   // jump out of loop
       .IgnoreArgument(4, 4, 4);  // loop jump
+
+  // Character class checks outside of skip loops. These are a prefix of the
+  // SKIP_UNTIL_BIT_IN_TABLE sequence above, which is preferred as the longer
+  // match.
+  CreateSequence(BC_LOAD_CURRENT_CHAR)
+      .FollowedBy(BC_CHECK_BIT_IN_TABLE)
+      .ReplaceWith(BC_LOAD_CURRENT_CHAR_AND_CHECK_BIT_IN_TABLE)
+      .MapArgument(0, 1, 3)    // load offset
+      .MapArgument(0, 4, 4)    // goto when out of bounds
+      .MapArgument(1, 4, 4)    // goto when match
+      .MapArgument(1, 8, 16);  // bit table
+
+  CreateSequence(BC_LOAD_CURRENT_CHAR)
+      .FollowedBy(BC_CHECK_CHAR_IN_RANGE)
+      .ReplaceWith(BC_LOAD_CURRENT_CHAR_AND_CHECK_CHAR_IN_RANGE)
+      .MapArgument(0, 1, 3)   // load offset
+      .MapArgument(0, 4, 4)   // goto when out of bounds
+      .MapArgument(1, 4, 2)   // from
+      .MapArgument(1, 6, 2)   // to
+      .MapArgument(1, 8, 4);  // goto when in range
+
+  CreateSequence(BC_LOAD_CURRENT_CHAR)
+      .FollowedBy(BC_CHECK_CHAR_NOT_IN_RANGE)
+      .ReplaceWith(BC_LOAD_CURRENT_CHAR_AND_CHECK_CHAR_NOT_IN_RANGE)
+      .MapArgument(0, 1, 3)   // load offset
+      .MapArgument(0, 4, 4)   // goto when out of bounds
+      .MapArgument(1, 4, 2)   // from
+      .MapArgument(1, 6, 2)   // to
+      .MapArgument(1, 8, 4);  // goto when not in range
 }
 
 bool RegExpBytecodePeephole::OptimizeBytecode(const byte* bytecode,
@@ -211,7 +211,39 @@ static_assert(1 << BYTECODE_SHIFT > BYTECODE_MASK);
   /* 0x40 - 0xBF    Bit Table                                               */ \
   /* 0xC0 - 0xDF    Address of bytecode when character is matched           */ \
   /* 0xE0 - 0xFF    Address of bytecode when no match                       */ \
-  V(SKIP_UNTIL_GT_OR_NOT_BIT_IN_TABLE, 58, 32)
+  V(SKIP_UNTIL_GT_OR_NOT_BIT_IN_TABLE, 58, 32)                                 \
+  /* Combination of:                                                        */ \
+  /* LOAD_CURRENT_CHAR and CHECK_BIT_IN_TABLE                               */ \
+  /* Emitted by RegExpBytecodePeepholeOptimization.                         */ \
+  /* Bit Layout:                                                            */ \
+  /* 0x00 - 0x07    0x3B (fixed) Bytecode                                   */ \
+  /* 0x08 - 0x1F    Load character offset from current position             */ \
+  /* 0x20 - 0x3F    Address of bytecode when load is out of bounds          */ \
+  /* 0x40 - 0x5F    Address of bytecode when bit is set                     */ \
+  /* 0x60 - 0xDF    Bit Table                                               */ \
+  V(LOAD_CURRENT_CHAR_AND_CHECK_BIT_IN_TABLE, 59, 28)                          \
+  /* Combination of:                                                        */ \
+  /* LOAD_CURRENT_CHAR and CHECK_CHAR_IN_RANGE                              */ \
+  /* Emitted by RegExpBytecodePeepholeOptimization.                         */ \
+  /* Bit Layout:                                                            */ \
+  /* 0x00 - 0x07    0x3C (fixed) Bytecode                                   */ \
+  /* 0x08 - 0x1F    Load character offset from current position             */ \
+  /* 0x20 - 0x3F    Address of bytecode when load is out of bounds          */ \
+  /* 0x40 - 0x4F    Lower bound of range (inclusive)                        */ \
+  /* 0x50 - 0x5F    Upper bound of range (inclusive)                        */ \
+  /* 0x60 - 0x7F    Address of bytecode when character is in range          */ \
+  V(LOAD_CURRENT_CHAR_AND_CHECK_CHAR_IN_RANGE, 60, 16)                         \
+  /* Combination of:                                                        */ \
+  /* LOAD_CURRENT_CHAR and CHECK_CHAR_NOT_IN_RANGE                          */ \
+  /* Emitted by RegExpBytecodePeepholeOptimization.                         */ \
+  /* Bit Layout:                                                            */ \
+  /* 0x00 - 0x07    0x3D (fixed) Bytecode                                   */ \
+  /* 0x08 - 0x1F    Load character offset from current position             */ \
+  /* 0x20 - 0x3F    Address of bytecode when load is out of bounds          */ \
+  /* 0x40 - 0x4F    Lower bound of range (inclusive)                        */ \
+  /* 0x50 - 0x5F    Upper bound of range (inclusive)                        */ \
+  /* 0x60 - 0x7F    Address of bytecode when character is not in range      */ \
+  V(LOAD_CURRENT_CHAR_AND_CHECK_CHAR_NOT_IN_RANGE, 61, 16)
 
 #define COUNT(...) +1
 static constexpr int kRegExpBytecodeCount = BYTECODE_ITERATOR(COUNT);
@@ -221,7 +253,7 @@ static constexpr int kRegExpBytecodeCount = BYTECODE_ITERATOR(COUNT);
 // contiguous, strictly increasing, and start at 0.
 // TODO(jgruber): Do not explicitly assign values, instead generate them
 // implicitly from the list order.
-static_assert(kRegExpBytecodeCount == 59);
+static_assert(kRegExpBytecodeCount == 62);
 
 #define DECLARE_BYTECODES(name, code, length) \
   static constexpr int BC_##name = code;
@@ -2891,6 +2891,24 @@ int BoyerMooreLookahead::GetSkipTable(int min_lookahead, int max_lookahead,
   return skip;
 }
 
+// Condenses the skip table into one byte per low nibble of the character, with
+// one bit per high nibble. SIMD implementations look up both nibbles of up to
+// 16 characters at once with a byte shuffle.
+void BoyerMooreLookahead::GetNibbleTable(Handle<ByteArray> boolean_skip_table,
+                                         Handle<ByteArray> nibble_table) {
+  static_assert(RegExpMacroAssembler::kTableSize ==
+                RegExpMacroAssembler::kNibbleTableSize * kBitsPerByte);
+  std::memset(nibble_table->GetDataStartAddress(), 0, nibble_table->length());
+  for (int i = 0; i < RegExpMacroAssembler::kTableSize; i++) {
+    if (boolean_skip_table->get(i) == 0) continue;
+    int low_nibble = i & (RegExpMacroAssembler::kNibbleTableSize - 1);
+    int high_nibble = i / RegExpMacroAssembler::kNibbleTableSize;
+    nibble_table->set(low_nibble, static_cast<uint8_t>(
+                                      nibble_table->get(low_nibble) |
+                                      (1 << high_nibble)));
+  }
+}
+
 // See comment above on the implementation of GetSkipTable.
 void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
   const int kSize = RegExpMacroAssembler::kTableSize;
@@ -2952,13 +2970,14 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
       GetSkipTable(min_lookahead, max_lookahead, boolean_skip_table);
   DCHECK_NE(0, skip_distance);
 
-  Label cont, again;
-  masm->Bind(&again);
-  masm->LoadCurrentCharacter(max_lookahead, &cont, true);
-  masm->CheckBitInTable(boolean_skip_table, &cont);
-  masm->AdvanceCurrentPosition(skip_distance);
-  masm->GoTo(&again);
-  masm->Bind(&cont);
+  Handle<ByteArray> nibble_table;
+  if (masm->SkipUntilBitInTableUseSimd(skip_distance)) {
+    nibble_table = factory->NewByteArray(
+        RegExpMacroAssembler::kNibbleTableSize, AllocationType::kOld);
+    GetNibbleTable(boolean_skip_table, nibble_table);
+  }
+  masm->SkipUntilBitInTable(max_lookahead, boolean_skip_table, nibble_table,
+                            skip_distance);
 }
 
 /* Code generation for choice nodes.
@@ -405,13 +405,10 @@ IrregexpInterpreter::Result RawMatch(
 // Fill dispatch table from last defined bytecode up to the next power of two
 // with BREAK (invalid operation).
 // TODO(pthier): Find a way to fill up automatically (at compile time)
-// 59 real bytecodes -> 5 fillers
+// 62 real bytecodes -> 2 fillers
 #define BYTECODE_FILLER_ITERATOR(V) \
   V(BREAK) /* 1 */                  \
-  V(BREAK) /* 2 */                  \
-  V(BREAK) /* 3 */                  \
-  V(BREAK) /* 4 */                  \
-  V(BREAK) /* 5 */
+  V(BREAK) /* 2 */
 
 #define COUNT(...) +1
   static constexpr int kRegExpBytecodeFillerCount =
@@ -746,6 +743,52 @@ IrregexpInterpreter::Result RawMatch(
       }
       DISPATCH();
     }
+    BYTECODE(LOAD_CURRENT_CHAR_AND_CHECK_BIT_IN_TABLE) {
+      int pos = current + LoadPacked24Signed(insn);
+      if (pos >= subject.length() || pos < 0) {
+        SET_PC_FROM_OFFSET(Load32Aligned(pc + 4));
+        DISPATCH();
+      }
+      current_char = subject[pos];
+      if (CheckBitInTable(current_char, pc + 12)) {
+        SET_PC_FROM_OFFSET(Load32Aligned(pc + 8));
+      } else {
+        ADVANCE(LOAD_CURRENT_CHAR_AND_CHECK_BIT_IN_TABLE);
+      }
+      DISPATCH();
+    }
+    BYTECODE(LOAD_CURRENT_CHAR_AND_CHECK_CHAR_IN_RANGE) {
+      int pos = current + LoadPacked24Signed(insn);
+      if (pos >= subject.length() || pos < 0) {
+        SET_PC_FROM_OFFSET(Load32Aligned(pc + 4));
+        DISPATCH();
+      }
+      current_char = subject[pos];
+      uint32_t from = Load16Aligned(pc + 8);
+      uint32_t to = Load16Aligned(pc + 10);
+      if (from <= current_char && current_char <= to) {
+        SET_PC_FROM_OFFSET(Load32Aligned(pc + 12));
+      } else {
+        ADVANCE(LOAD_CURRENT_CHAR_AND_CHECK_CHAR_IN_RANGE);
+      }
+      DISPATCH();
+    }
+    BYTECODE(LOAD_CURRENT_CHAR_AND_CHECK_CHAR_NOT_IN_RANGE) {
+      int pos = current + LoadPacked24Signed(insn);
+      if (pos >= subject.length() || pos < 0) {
+        SET_PC_FROM_OFFSET(Load32Aligned(pc + 4));
+        DISPATCH();
+      }
+      current_char = subject[pos];
+      uint32_t from = Load16Aligned(pc + 8);
+      uint32_t to = Load16Aligned(pc + 10);
+      if (from > current_char || current_char > to) {
+        SET_PC_FROM_OFFSET(Load32Aligned(pc + 12));
+      } else {
+        ADVANCE(LOAD_CURRENT_CHAR_AND_CHECK_CHAR_NOT_IN_RANGE);
+      }
+      DISPATCH();
+    }
     BYTECODE(CHECK_LT) {
       uint32_t limit = LoadPacked24Unsigned(insn);
       if (current_char < limit) {
@@ -367,6 +367,19 @@ void RegExpMacroAssemblerTracer::CheckBitInTable(
   assembler_->CheckBitInTable(table, on_bit_set);
 }
 
+void RegExpMacroAssemblerTracer::SkipUntilBitInTable(
+    int cp_offset, Handle<ByteArray> table, Handle<ByteArray> nibble_table,
+    int advance_by) {
+  PrintF(" SkipUntilBitInTable(cp_offset=%d, advance_by=%d%s\n  ", cp_offset,
+         advance_by, nibble_table.is_null() ? "" : ", simd");
+  for (int i = 0; i < kTableSize; i++) {
+    PrintF("%c", table->get(i) != 0 ? 'X' : '.');
+    if (i % 32 == 31 && i != kTableMask) PrintF("\n  ");
+  }
+  PrintF(");\n");
+  assembler_->SkipUntilBitInTable(cp_offset, table, nibble_table, advance_by);
+}
+
 
 void RegExpMacroAssemblerTracer::CheckNotBackReference(int start_reg,
                                                        bool read_backward,
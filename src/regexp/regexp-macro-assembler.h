@@ -107,6 +107,21 @@ class RegExpMacroAssembler {
   // The current character (modulus the kTableSize) is looked up in the byte
   // array, and if the found byte is non-zero, we jump to the on_bit_set label.
   virtual void CheckBitInTable(Handle<ByteArray> table, Label* on_bit_set) = 0;
+  // Advances the current position by {advance_by} characters until the
+  // character at {cp_offset} from the current position has its bit set in
+  // {table} (as in CheckBitInTable), or this character is past the end of the
+  // input. {nibble_table} is only used (and required) if
+  // SkipUntilBitInTableUseSimd returns true. It holds a bit for every table
+  // entry: bit (i >> 4) of byte (i & 0xF) is set if entry i of {table} is.
+  // May clobber the current loaded character.
+  virtual void SkipUntilBitInTable(int cp_offset, Handle<ByteArray> table,
+                                   Handle<ByteArray> nibble_table,
+                                   int advance_by);
+  // Returns whether SkipUntilBitInTable is implemented with SIMD instructions
+  // for the given {advance_by}. Those check multiple positions at once and
+  // may therefore stop at a position the scalar loop would have skipped.
+  virtual bool SkipUntilBitInTableUseSimd(int advance_by) { return false; }
+  static constexpr int kNibbleTableSize = 16;
 
   // Checks whether the given offset from the current position is before
   // the end of the string.  May overwrite the current character.
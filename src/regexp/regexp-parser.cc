@@ -318,6 +318,11 @@ class RegExpBuilder {
   void FlushText();
   RegExpTree* ToRegExp();
   RegExpFlags flags() const { return flags_; }
+  // Whether an unbounded quantifier was applied to an atom that can itself
+  // match unboundedly many characters, e.g. /(a+)*/.
+  bool has_nested_unbounded_quantifier() const {
+    return has_nested_unbounded_quantifier_;
+  }
 
   bool ignore_case() const { return IsIgnoreCase(flags_); }
   bool multiline() const { return IsMultiline(flags_); }
@@ -336,6 +341,7 @@ class RegExpBuilder {
 
   Zone* const zone_;
   bool pending_empty_ = false;
+  bool has_nested_unbounded_quantifier_ = false;
   const RegExpFlags flags_;
 
   using SmallRegExpTreeVector =
@@ -624,6 +630,7 @@ class RegExpParserImpl final {
   bool has_more_;
   bool simple_;
   bool contains_anchor_;
+  bool has_nested_unbounded_quantifier_;
   bool is_scanned_for_captures_;
   bool has_named_captures_;  // Only valid after we have scanned for captures.
   bool failed_;
@@ -651,6 +658,7 @@ RegExpParserImpl<CharT>::RegExpParserImpl(
       has_more_(true),
       simple_(false),
       contains_anchor_(false),
+      has_nested_unbounded_quantifier_(false),
       is_scanned_for_captures_(false),
       has_named_captures_(false),
       failed_(false),
@@ -1255,6 +1263,9 @@ RegExpTree* RegExpParserImpl<CharT>::ParseDisjunction() {
     if (!builder->AddQuantifierToAtom(min, max, quantifier_type)) {
       return ReportError(RegExpError::kInvalidQuantifier);
     }
+    if (builder->has_nested_unbounded_quantifier()) {
+      has_nested_unbounded_quantifier_ = true;
+    }
   }
 }
 
@@ -2974,6 +2985,7 @@ bool RegExpParserImpl<CharT>::Parse(RegExpCompileData* result) {
   const int capture_count = captures_started();
   result->simple = tree->IsAtom() && simple() && capture_count == 0;
   result->contains_anchor = contains_anchor();
+  result->has_nested_unbounded_quantifier = has_nested_unbounded_quantifier_;
   result->capture_count = capture_count;
   result->named_captures = GetNamedCaptures();
   return true;
@@ -3097,6 +3109,10 @@ bool RegExpBuilder::AddQuantifierToAtom(
     // Only call immediately after adding an atom or character!
     UNREACHABLE();
   }
+  if (max == RegExpTree::kInfinity &&
+      atom->max_match() == RegExpTree::kInfinity) {
+    has_nested_unbounded_quantifier_ = true;
+  }
   terms_.emplace_back(
       zone()->New<RegExpQuantifier>(min, max, quantifier_type, atom));
   return true;
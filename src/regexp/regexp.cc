@@ -11,6 +11,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/regexp/experimental/experimental.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
@@ -83,6 +84,12 @@ class RegExpImpl final : public AllStatic {
 
   static bool CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
                               Handle<String> sample_subject, bool is_one_byte);
+  // Installs bytecode taken from the RegExpBytecodeCache.
+  static void InstallIrregexpBytecode(Isolate* isolate, Handle<JSRegExp> re,
+                                      bool is_one_byte,
+                                      Handle<ByteArray> bytecode,
+                                      int register_count,
+                                      uint32_t backtrack_limit);
   static inline bool EnsureCompiledIrregexp(Isolate* isolate,
                                             Handle<JSRegExp> re,
                                             Handle<String> sample_subject,
@@ -228,7 +235,11 @@ MaybeHandle<Object> RegExp::Compile(Isolate* isolate, Handle<JSRegExp> re,
 
   bool has_been_compiled = false;
 
-  if (v8_flags.default_to_experimental_regexp_engine &&
+  const bool prefer_experimental_engine =
+      v8_flags.default_to_experimental_regexp_engine ||
+      (v8_flags.enable_experimental_regexp_engine_on_nested_quantifiers &&
+       parse_result.has_nested_unbounded_quantifier);
+  if (prefer_experimental_engine &&
       ExperimentalRegExp::CanBeHandled(parse_result.tree, flags,
                                        parse_result.capture_count)) {
     DCHECK(v8_flags.enable_experimental_regexp_engine);
@@ -549,6 +560,26 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
 
   Handle<String> pattern(re->source(), isolate);
   pattern = String::Flatten(isolate, pattern);
+  const uint32_t requested_backtrack_limit = re->backtrack_limit();
+
+  // Bytecode compiled for the same pattern by any isolate in the process can
+  // be reused as is.
+  const bool use_bytecode_cache =
+      v8_flags.regexp_bytecode_cache_size > 0 && re->ShouldProduceBytecode();
+  if (use_bytecode_cache) {
+    Handle<ByteArray> bytecode;
+    int register_count;
+    uint32_t backtrack_limit;
+    if (RegExpBytecodeCache::Lookup(isolate, *pattern, flags, is_one_byte,
+                                    requested_backtrack_limit, &register_count,
+                                    &backtrack_limit)
+            .ToHandle(&bytecode)) {
+      InstallIrregexpBytecode(isolate, re, is_one_byte, bytecode,
+                              register_count, backtrack_limit);
+      return true;
+    }
+  }
+
   RegExpCompileData compile_data;
   if (!RegExpParser::ParseRegExpFromHeapString(isolate, &zone, pattern, flags,
                                                &compile_data)) {
@@ -566,7 +597,7 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
   compile_data.compilation_target = re->ShouldProduceBytecode()
                                         ? RegExpCompilationTarget::kBytecode
                                         : RegExpCompilationTarget::kNative;
-  uint32_t backtrack_limit = re->backtrack_limit();
+  uint32_t backtrack_limit = requested_backtrack_limit;
   const bool compilation_succeeded =
       Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
               is_one_byte, backtrack_limit);
@@ -595,6 +626,12 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
     Handle<Code> trampoline =
         BUILTIN_CODE(isolate, RegExpInterpreterTrampoline);
     data->set(JSRegExp::code_index(is_one_byte), *trampoline);
+    if (use_bytecode_cache && compile_data.named_captures == nullptr) {
+      RegExpBytecodeCache::Insert(
+          *pattern, flags, is_one_byte, requested_backtrack_limit,
+          ByteArray::cast(*compile_data.code), compile_data.register_count,
+          backtrack_limit);
+    }
   }
   Handle<FixedArray> capture_name_map =
       RegExp::CreateCaptureNameMap(isolate, compile_data.named_captures);
@@ -617,6 +654,25 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
   return true;
 }
 
+void RegExpImpl::InstallIrregexpBytecode(Isolate* isolate,
+                                         Handle<JSRegExp> re, bool is_one_byte,
+                                         Handle<ByteArray> bytecode,
+                                         int register_count,
+                                         uint32_t backtrack_limit) {
+  Handle<FixedArray> data =
+      Handle<FixedArray>(FixedArray::cast(re->data()), isolate);
+  data->set(JSRegExp::bytecode_index(is_one_byte), *bytecode);
+  Handle<Code> trampoline = BUILTIN_CODE(isolate, RegExpInterpreterTrampoline);
+  data->set(JSRegExp::code_index(is_one_byte), *trampoline);
+  // Patterns with named captures are never cached.
+  re->set_capture_name_map(Handle<FixedArray>());
+  int register_max = IrregexpMaxRegisterCount(*data);
+  if (register_count > register_max) {
+    SetIrregexpMaxRegisterCount(*data, register_count);
+  }
+  data->set(JSRegExp::kIrregexpBacktrackLimit, Smi::FromInt(backtrack_limit));
+}
+
 int RegExpImpl::IrregexpMaxRegisterCount(FixedArray re) {
   return Smi::ToInt(re.get(JSRegExp::kIrregexpMaxRegisterCountIndex));
 }
@@ -43,6 +43,11 @@ struct RegExpCompileData {
   // True, iff the pattern is anchored at the start of the string with '^'.
   bool contains_anchor = false;
 
+  // True, iff an unbounded quantifier is applied to a subpattern that can
+  // itself match an unbounded number of characters, as in /(a+)*/. Such
+  // patterns are prone to exponential backtracking.
+  bool has_nested_unbounded_quantifier = false;
+
   // Only set if the pattern contains named captures.
   // Note: the lifetime equals that of the parse/compile zone.
   ZoneVector<RegExpCapture*>* named_captures = nullptr;
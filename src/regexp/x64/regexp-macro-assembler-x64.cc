@@ -596,6 +596,80 @@ void RegExpMacroAssemblerX64::CheckBitInTable(
   BranchOrBacktrack(not_equal, on_bit_set);
 }
 
+void RegExpMacroAssemblerX64::SkipUntilBitInTable(
+    int cp_offset, Handle<ByteArray> table, Handle<ByteArray> nibble_table,
+    int advance_by) {
+  Label cont, scalar_repeat;
+
+  if (SkipUntilBitInTableUseSimd(advance_by)) {
+    DCHECK(!nibble_table.is_null());
+    CpuFeatureScope ssse3_scope(&masm_, SSSE3);
+    // Only xmm0-xmm5 are caller-saved in all calling conventions.
+    const XMMRegister chars = xmm0;
+    const XMMRegister high_nibbles = xmm1;
+    const XMMRegister table_bits = xmm2;
+    const XMMRegister nibble_mask = xmm3;
+    const XMMRegister nibble_table_reg = xmm4;
+    const XMMRegister bit_mask = xmm5;
+    static constexpr int kCharsPerVector = 16;
+    Label simd_repeat, found;
+
+    __ Move(rax, nibble_table);
+    __ movdqu(nibble_table_reg, FieldOperand(rax, ByteArray::kHeaderSize));
+    // Byte i of {bit_mask} is {1 << (i & 7)}, so the high nibbles of
+    // characters >= 0x80 alias the ones below, as in CheckBitInTable.
+    __ movq(rax, uint64_t{0x8040201008040201});
+    __ movq(bit_mask, rax);
+    __ punpcklqdq(bit_mask, bit_mask);
+    __ movl(rax, Immediate(0x0F0F0F0F));
+    __ movd(nibble_mask, rax);
+    __ pshufd(nibble_mask, nibble_mask, 0);
+
+    __ bind(&simd_repeat);
+    // Fall back to the scalar loop if fewer than 16 characters are left.
+    __ leaq(rax, Operand(rdi, cp_offset + kCharsPerVector));
+    __ cmpq(rax, Immediate(0));
+    __ j(greater, &scalar_repeat);
+    __ movdqu(chars, Operand(rsi, rdi, times_1, cp_offset));
+    __ movdqa(high_nibbles, chars);
+    __ psrlw(high_nibbles, 4);
+    __ pand(high_nibbles, nibble_mask);
+    __ pand(chars, nibble_mask);
+    __ movdqa(table_bits, nibble_table_reg);
+    __ pshufb(table_bits, chars);
+    __ movdqa(chars, bit_mask);
+    __ pshufb(chars, high_nibbles);
+    // A character is in the table iff the bit for its high nibble is set in
+    // the table byte for its low nibble.
+    __ pand(table_bits, chars);
+    __ pcmpeqb(table_bits, chars);
+    __ pmovmskb(rax, table_bits);
+    __ testl(rax, rax);
+    __ j(not_zero, &found);
+    __ addq(rdi, Immediate(kCharsPerVector));
+    __ jmp(&simd_repeat);
+
+    __ bind(&found);
+    __ bsfl(rax, rax);
+    __ addq(rdi, rax);
+    __ jmp(&cont);
+  }
+
+  Bind(&scalar_repeat);
+  LoadCurrentCharacter(cp_offset, &cont, true);
+  CheckBitInTable(table, &cont);
+  AdvanceCurrentPosition(advance_by);
+  GoTo(&scalar_repeat);
+  Bind(&cont);
+}
+
+bool RegExpMacroAssemblerX64::SkipUntilBitInTableUseSimd(int advance_by) {
+  // The SIMD loop checks consecutive characters, and only supports one-byte
+  // strings.
+  return v8_flags.regexp_simd && advance_by * char_size() == 1 &&
+         CpuFeatures::IsSupported(SSSE3);
+}
+
 bool RegExpMacroAssemblerX64::CheckSpecialClassRanges(StandardCharacterSet type,
                                                       Label* on_no_match) {
   // Range checks (c in min..max) are generally implemented by an unsigned
@@ -2,11 +2,14 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/codegen/compiler.h"
+#include "src/debug/debug.h"
 #include "src/execution/arguments-inl.h"
 #include "src/execution/isolate-inl.h"
 #include "src/execution/protectors-inl.h"
 #include "src/heap/factory.h"
 #include "src/heap/heap-inl.h"  // For ToBoolean. TODO(jkummerow): Drop.
+#include "src/interpreter/bytecode-array-iterator.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/elements.h"
 #include "src/objects/js-array-inl.h"
@@ -323,6 +326,78 @@ RUNTIME_FUNCTION(Runtime_ArrayIncludes_Slow) {
   return ReadOnlyRoots(isolate).false_value();
 }
 
+namespace {
+
+// Keep in sync with the kSortComparator* constants in array-sort.tq.
+enum class SortComparatorKind {
+  kGeneric = 0,
+  kNumbersAscending = 1,
+  kNumbersDescending = 2,
+};
+
+// Recognizes the comparators (a, b) => a - b and (a, b) => b - a, whose
+// bytecode is "Ldar <rhs>; Sub <lhs>; Return". For Number arguments they
+// only compute the sign of a comparison, which the sort can do without
+// calling them. Calls are observable through the debugger and code coverage,
+// so neither may be active.
+SortComparatorKind GetSortComparatorKind(Isolate* isolate,
+                                         Handle<Object> comparefn) {
+  if (!comparefn->IsJSFunction()) return SortComparatorKind::kGeneric;
+  if (isolate->debug()->is_active() ||
+      !isolate->is_best_effort_code_coverage()) {
+    return SortComparatorKind::kGeneric;
+  }
+  Handle<SharedFunctionInfo> shared(
+      Handle<JSFunction>::cast(comparefn)->shared(), isolate);
+  if (!shared->IsUserJavaScript()) return SortComparatorKind::kGeneric;
+  IsCompiledScope is_compiled_scope(shared->is_compiled_scope(isolate));
+  if (!is_compiled_scope.is_compiled() &&
+      !Compiler::Compile(isolate, shared, Compiler::CLEAR_EXCEPTION,
+                         &is_compiled_scope)) {
+    return SortComparatorKind::kGeneric;
+  }
+  if (!shared->HasBytecodeArray()) return SortComparatorKind::kGeneric;
+
+  Handle<BytecodeArray> bytecode(shared->GetBytecodeArray(isolate), isolate);
+  interpreter::BytecodeArrayIterator iterator(bytecode);
+  if (iterator.done() ||
+      iterator.current_bytecode() != interpreter::Bytecode::kLdar) {
+    return SortComparatorKind::kGeneric;
+  }
+  interpreter::Register rhs = iterator.GetRegisterOperand(0);
+  iterator.Advance();
+  if (iterator.done() ||
+      iterator.current_bytecode() != interpreter::Bytecode::kSub) {
+    return SortComparatorKind::kGeneric;
+  }
+  interpreter::Register lhs = iterator.GetRegisterOperand(0);
+  iterator.Advance();
+  if (iterator.done() ||
+      iterator.current_bytecode() != interpreter::Bytecode::kReturn) {
+    return SortComparatorKind::kGeneric;
+  }
+
+  interpreter::Register first = iterator.GetParameter(0);
+  interpreter::Register second = iterator.GetParameter(1);
+  if (lhs == first && rhs == second) {
+    return SortComparatorKind::kNumbersAscending;
+  }
+  if (lhs == second && rhs == first) {
+    return SortComparatorKind::kNumbersDescending;
+  }
+  return SortComparatorKind::kGeneric;
+}
+
+}  // namespace
+
+RUNTIME_FUNCTION(Runtime_ArraySortComparatorKind) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  Handle<Object> comparefn = args.at(0);
+  return Smi::FromInt(
+      static_cast<int>(GetSortComparatorKind(isolate, comparefn)));
+}
+
 RUNTIME_FUNCTION(Runtime_ArrayIndexOf) {
   HandleScope hs(isolate);
   DCHECK_EQ(3, args.length());
@@ -12,6 +12,7 @@
 #include "src/execution/arguments-inl.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate-inl.h"
+#include "src/logging/metrics.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/shared-function-info.h"
@@ -354,6 +355,32 @@ void DeoptAllOsrLoopsContainingDeoptExit(Isolate* isolate, JSFunction function,
   }
 }
 
+void RecordDeoptimizationMetrics(Isolate* isolate, Handle<JSFunction> function,
+                                 InstructionStream optimized_code,
+                                 DeoptimizeKind deopt_kind,
+                                 DeoptimizeReason deopt_reason,
+                                 BytecodeOffset deopt_exit_offset) {
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      isolate->metrics_recorder();
+  if (V8_LIKELY(!recorder->ShouldSampleJitEvent(
+          isolate->random_number_generator()))) {
+    return;
+  }
+  v8::metrics::Deoptimization event;
+  event.reason = DeoptimizeReasonToString(deopt_reason);
+  event.lazy = deopt_kind == DeoptimizeKind::kLazy;
+  event.osr = !optimized_code.osr_offset().IsNone();
+  SharedFunctionInfo shared = function->shared();
+  if (shared.script().IsScript()) {
+    event.script_id = Script::cast(shared.script()).id();
+  }
+  event.function_start_position = shared.StartPosition();
+  event.bytecode_offset = deopt_exit_offset.ToInt();
+  Handle<NativeContext> native_context(function->native_context(), isolate);
+  recorder->DelayMainThreadEvent(
+      event, isolate->GetOrRegisterRecorderContextId(native_context));
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
@@ -389,6 +416,9 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   JavaScriptFrame* top_frame = top_it.frame();
   isolate->set_context(Context::cast(top_frame->context()));
 
+  RecordDeoptimizationMetrics(isolate, function, *optimized_code, deopt_kind,
+                              deopt_reason, deopt_exit_offset);
+
   // Lazy deopts don't invalidate the underlying optimized code since the code
   // object itself is still valid (as far as we know); the called function
   // caused the deopt, not the function we're currently looking at.
@@ -417,9 +447,11 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   if (osr_offset.IsNone()) {
     Deoptimizer::DeoptimizeFunction(*function, ToCode(*optimized_code));
     DeoptAllOsrLoopsContainingDeoptExit(isolate, *function, deopt_exit_offset);
+    function->feedback_vector().SaturatingIncrementDeoptCount();
   } else if (DeoptExitIsInsideOsrLoop(isolate, *function, deopt_exit_offset,
                                       osr_offset)) {
     Deoptimizer::DeoptimizeFunction(*function, ToCode(*optimized_code));
+    function->feedback_vector().SaturatingIncrementDeoptCount();
   }
 
   return ReadOnlyRoots(isolate).undefined_value();
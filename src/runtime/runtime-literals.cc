@@ -561,6 +561,8 @@ MaybeHandle<JSObject> CreateLiteral(Isolate* isolate,
     RETURN_ON_EXCEPTION(isolate, DeepWalk(boilerplate, &creation_context),
                         JSObject);
     creation_context.ExitScope(site, boilerplate);
+    isolate->heap()->pretenuring_handler()->ApplySeededTenureDecision(
+        *vector, literals_slot, *site);
 
     vector->SynchronizedSet(literals_slot, *site);
   }
@@ -2,6 +2,12 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
 #include "src/base/atomicops.h"
 #include "src/common/message-template.h"
 #include "src/execution/arguments-inl.h"
@@ -76,23 +82,74 @@ RUNTIME_FUNCTION(Runtime_GrowableSharedArrayBufferByteLength) {
 
 namespace {
 
+// Sorts 8- and 16-bit integers by counting the occurrences of each value,
+// which takes linear time and no copy of the elements.
 template <typename T>
-bool CompareNum(T x, T y) {
-  if (x < y) {
-    return true;
-  } else if (x > y) {
-    return false;
-  } else if (!std::is_integral<T>::value) {
-    double _x = x, _y = y;
-    if (x == 0 && x == y) {
-      /* -0.0 is less than +0.0 */
-      return std::signbit(_x) && !std::signbit(_y);
-    } else if (!std::isnan(_x) && std::isnan(_y)) {
-      /* number is less than NaN */
-      return true;
+void CountingSort(T* data, size_t length) {
+  static_assert(std::is_integral<T>::value && sizeof(T) <= 2);
+  using UnsignedT = typename std::make_unsigned<T>::type;
+  std::vector<size_t> counts(size_t{1} << (sizeof(T) * kBitsPerByte));
+  for (size_t i = 0; i < length; i++) {
+    counts[static_cast<UnsignedT>(data[i])]++;
+  }
+  size_t index = 0;
+  for (int value = std::numeric_limits<T>::min();
+       value <= std::numeric_limits<T>::max(); value++) {
+    size_t count = counts[static_cast<UnsignedT>(value)];
+    std::fill_n(data + index, count, static_cast<T>(value));
+    index += count;
+  }
+  DCHECK_EQ(index, length);
+}
+
+// Sorts floating point values so that -0 comes before +0 and NaNs come last.
+// Moving the NaNs out of the way first allows sorting the rest with plain <,
+// which is much cheaper than a comparison that also orders NaNs and zeros.
+// That leaves the zeros in one run, where the negative ones are moved first.
+template <typename T, typename Iterator>
+void SortFloatingPoint(Iterator begin, Iterator end) {
+  auto less = [](T x, T y) { return x < y; };
+  Iterator numbers_end =
+      std::partition(begin, end, [](T x) { return !std::isnan(x); });
+  std::sort(begin, numbers_end, less);
+  Iterator zeros = std::lower_bound(begin, numbers_end, T{0}, less);
+  Iterator zeros_end = std::upper_bound(zeros, numbers_end, T{0}, less);
+  Iterator positive_zeros = zeros;
+  for (Iterator it = zeros; it != zeros_end; ++it) {
+    if (std::signbit(static_cast<T>(*it))) *(positive_zeros++) = T{-0.0};
+  }
+  for (Iterator it = positive_zeros; it != zeros_end; ++it) *it = T{0};
+}
+
+// Counting sort pays for clearing and scanning its table of counts once there
+// are more elements than this fraction of possible values.
+constexpr size_t kCountingSortMinLengthDivisor = 16;
+
+template <typename T>
+void SortTypedArrayElements(T* data, size_t length) {
+  if constexpr (std::is_floating_point<T>::value) {
+    if (COMPRESS_POINTERS_BOOL && alignof(T) > kTaggedSize) {
+      // TODO(ishell, v8:8875): See UnalignedSlot<T> for details.
+      SortFloatingPoint<T>(UnalignedSlot<T>(data),
+                           UnalignedSlot<T>(data + length));
+    } else {
+      SortFloatingPoint<T>(data, data + length);
+    }
+  } else if constexpr (sizeof(T) <= 2) {
+    constexpr size_t kValues = size_t{1} << (sizeof(T) * kBitsPerByte);
+    if (length >= kValues / kCountingSortMinLengthDivisor) {
+      CountingSort(data, length);
+    } else {
+      std::sort(data, data + length);
+    }
+  } else {
+    if (COMPRESS_POINTERS_BOOL && alignof(T) > kTaggedSize) {
+      // TODO(ishell, v8:8875): See UnalignedSlot<T> for details.
+      std::sort(UnalignedSlot<T>(data), UnalignedSlot<T>(data + length));
+    } else {
+      std::sort(data, data + length);
     }
   }
-  return false;
 }
 
 }  // namespace
@@ -145,29 +202,12 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
   DisallowGarbageCollection no_gc;
 
   switch (array->type()) {
-#define TYPED_ARRAY_SORT(Type, type, TYPE, ctype)                          \
-  case kExternal##Type##Array: {                                           \
-    ctype* data = copy_data ? reinterpret_cast<ctype*>(data_copy_ptr)      \
-                            : static_cast<ctype*>(array->DataPtr());       \
-    if (kExternal##Type##Array == kExternalFloat64Array ||                 \
-        kExternal##Type##Array == kExternalFloat32Array) {                 \
-      if (COMPRESS_POINTERS_BOOL && alignof(ctype) > kTaggedSize) {        \
-        /* TODO(ishell, v8:8875): See UnalignedSlot<T> for details. */     \
-        std::sort(UnalignedSlot<ctype>(data),                              \
-                  UnalignedSlot<ctype>(data + length), CompareNum<ctype>); \
-      } else {                                                             \
-        std::sort(data, data + length, CompareNum<ctype>);                 \
-      }                                                                    \
-    } else {                                                               \
-      if (COMPRESS_POINTERS_BOOL && alignof(ctype) > kTaggedSize) {        \
-        /* TODO(ishell, v8:8875): See UnalignedSlot<T> for details. */     \
-        std::sort(UnalignedSlot<ctype>(data),                              \
-                  UnalignedSlot<ctype>(data + length));                    \
-      } else {                                                             \
-        std::sort(data, data + length);                                    \
-      }                                                                    \
-    }                                                                      \
-    break;                                                                 \
+#define TYPED_ARRAY_SORT(Type, type, TYPE, ctype)                     \
+  case kExternal##Type##Array: {                                      \
+    ctype* data = copy_data ? reinterpret_cast<ctype*>(data_copy_ptr) \
+                            : static_cast<ctype*>(array->DataPtr());  \
+    SortTypedArrayElements(data, length);                             \
+    break;                                                            \
   }
 
     TYPED_ARRAYS(TYPED_ARRAY_SORT)
@@ -41,6 +41,7 @@ namespace internal {
   F(ArrayIncludes_Slow, 3, 1)          \
   F(ArrayIndexOf, 3, 1)                \
   F(ArrayIsArray, 1, 1)                \
+  F(ArraySortComparatorKind, 1, 1)     \
   F(ArraySpeciesConstructor, 1, 1)     \
   F(GrowArrayElements, 2, 1)           \
   F(IsArray, 1, 1)                     \
@@ -244,6 +244,12 @@ class IncrementalStringBuilder {
 #endif
 
     V8_INLINE void Append(DestChar c) { *(cursor_++) = c; }
+    template <typename SrcChar>
+    V8_INLINE void AppendChars(const SrcChar* chars, int length) {
+      DCHECK_LE(sizeof(SrcChar), sizeof(DestChar));
+      CopyChars(cursor_, chars, length);
+      cursor_ += length;
+    }
     V8_INLINE void AppendCString(const char* s) {
       const uint8_t* u = reinterpret_cast<const uint8_t*>(s);
       while (*u != '\0') Append(*(u++));
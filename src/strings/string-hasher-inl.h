@@ -10,6 +10,7 @@
 // Comment inserted to prevent header reordering.
 #include <type_traits>
 
+#include "src/base/bits.h"
 #include "src/objects/name-inl.h"
 #include "src/objects/string-inl.h"
 #include "src/strings/char-predicates-inl.h"
@@ -46,6 +47,59 @@ uint32_t StringHasher::GetTrivialHash(int length) {
   return String::CreateHashFieldValue(hash, String::HashFieldType::kHash);
 }
 
+template <typename uchar>
+uint64_t StringHasher::ReadFourCharacters(const uchar* chars) {
+  // Assemble the word from the character values rather than the raw bytes,
+  // so that one-byte and two-byte strings with the same contents get the same
+  // hash, independently of the host's endianness.
+  return uint64_t{chars[0]} | (uint64_t{chars[1]} << 16) |
+         (uint64_t{chars[2]} << 32) | (uint64_t{chars[3]} << 48);
+}
+
+uint64_t StringHasher::BlockHashRound(uint64_t acc, uint64_t input) {
+  acc += input * kBlockHashPrime2;
+  acc = base::bits::RotateLeft64(acc, 31);
+  return acc * kBlockHashPrime1;
+}
+
+template <typename uchar>
+uint32_t StringHasher::HashLongString(const uchar* chars, int length,
+                                      uint64_t seed) {
+  DCHECK_GE(length, kMinBlockHashLength);
+  DCHECK_LE(length, String::kMaxHashCalcLength);
+  const uchar* end = chars + length;
+  uint64_t v1 = seed + kBlockHashPrime1 + kBlockHashPrime2;
+  uint64_t v2 = seed + kBlockHashPrime2;
+  uint64_t v3 = seed;
+  uint64_t v4 = seed - kBlockHashPrime1;
+  for (; end - chars >= 16; chars += 16) {
+    v1 = BlockHashRound(v1, ReadFourCharacters(chars));
+    v2 = BlockHashRound(v2, ReadFourCharacters(chars + 4));
+    v3 = BlockHashRound(v3, ReadFourCharacters(chars + 8));
+    v4 = BlockHashRound(v4, ReadFourCharacters(chars + 12));
+  }
+  uint64_t hash =
+      base::bits::RotateLeft64(v1, 1) + base::bits::RotateLeft64(v2, 7) +
+      base::bits::RotateLeft64(v3, 12) + base::bits::RotateLeft64(v4, 18);
+  hash += static_cast<uint64_t>(length);
+  for (; end - chars >= 4; chars += 4) {
+    hash ^= BlockHashRound(0, ReadFourCharacters(chars));
+    hash = base::bits::RotateLeft64(hash, 27) * kBlockHashPrime1 +
+           kBlockHashPrime3;
+  }
+  for (; chars != end; chars++) {
+    hash ^= *chars * kBlockHashPrime3;
+    hash = base::bits::RotateLeft64(hash, 11) * kBlockHashPrime1;
+  }
+  hash ^= hash >> 33;
+  hash *= kBlockHashPrime2;
+  hash ^= hash >> 29;
+  hash *= kBlockHashPrime3;
+  hash ^= hash >> 32;
+  return String::CreateHashFieldValue(
+      GetHashCore(static_cast<uint32_t>(hash)), String::HashFieldType::kHash);
+}
+
 template <typename char_t>
 uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
                                             uint64_t seed) {
@@ -112,6 +166,10 @@ uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
   }
 
   // Non-index hash.
+  static_assert(kMinBlockHashLength > String::kMaxIntegerIndexSize);
+  if (length >= kMinBlockHashLength) {
+    return HashLongString(chars, length, seed);
+  }
   uint32_t running_hash = static_cast<uint32_t>(seed);
   const uchar* end = &chars[length];
   while (chars != end) {
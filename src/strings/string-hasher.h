@@ -40,6 +40,23 @@ class V8_EXPORT_PRIVATE StringHasher final {
   V8_INLINE static uint32_t GetHashCore(uint32_t running_hash);
 
   static inline uint32_t GetTrivialHash(int length);
+
+  // Strings of at least this length are hashed four characters at a time,
+  // in four independent lanes (xxHash64-style rounds), rather than with the
+  // one-at-a-time loop. Shorter strings keep the array index detection.
+  static const int kMinBlockHashLength = 32;
+
+ private:
+  static constexpr uint64_t kBlockHashPrime1 = 0x9E3779B185EBCA87;
+  static constexpr uint64_t kBlockHashPrime2 = 0xC2B2AE3D27D4EB4F;
+  static constexpr uint64_t kBlockHashPrime3 = 0x165667B19E3779F9;
+
+  template <typename uchar>
+  static inline uint32_t HashLongString(const uchar* chars, int length,
+                                        uint64_t seed);
+  template <typename uchar>
+  V8_INLINE static uint64_t ReadFourCharacters(const uchar* chars);
+  V8_INLINE static uint64_t BlockHashRound(uint64_t acc, uint64_t input);
 };
 
 // Useful for std containers that require something ()'able.
@@ -0,0 +1,111 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/string-search.h"
+
+#include "src/base/bits.h"
+
+#ifdef V8_HOST_ARCH_X64
+// SSE2 is part of the x64 baseline.
+#include <emmintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+// ARM64 is guaranteed to have Neon.
+#define NEON64
+#include <arm_neon.h>
+#endif
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+template <typename Char>
+int FindFirstAndLastCharacterScalar(const Char* subject, int index, int limit,
+                                    Char first, Char last, int last_offset) {
+  for (int i = index; i < limit; i++) {
+    if (subject[i] == first && subject[i + last_offset] == last) return i;
+  }
+  return -1;
+}
+
+}  // namespace
+
+int FindFirstAndLastCharacter(const uint8_t* subject, int index, int limit,
+                              uint8_t first, uint8_t last, int last_offset) {
+  int i = index;
+#if defined(V8_HOST_ARCH_X64) || defined(NEON64)
+  constexpr int kStride = 16;
+#endif
+#if defined(V8_HOST_ARCH_X64)
+  const __m128i first_vec = _mm_set1_epi8(static_cast<char>(first));
+  const __m128i last_vec = _mm_set1_epi8(static_cast<char>(last));
+  for (; i + kStride <= limit; i += kStride) {
+    const __m128i firsts =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(subject + i));
+    const __m128i lasts = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(subject + i + last_offset));
+    const __m128i eq = _mm_and_si128(_mm_cmpeq_epi8(firsts, first_vec),
+                                     _mm_cmpeq_epi8(lasts, last_vec));
+    const uint32_t mask = _mm_movemask_epi8(eq);
+    if (mask != 0) return i + base::bits::CountTrailingZeros(mask);
+  }
+#elif defined(NEON64)
+  const uint8x16_t first_vec = vdupq_n_u8(first);
+  const uint8x16_t last_vec = vdupq_n_u8(last);
+  for (; i + kStride <= limit; i += kStride) {
+    const uint8x16_t eq =
+        vandq_u8(vceqq_u8(vld1q_u8(subject + i), first_vec),
+                 vceqq_u8(vld1q_u8(subject + i + last_offset), last_vec));
+    // Four bits per matching byte.
+    const uint64_t mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+    if (mask != 0) return i + base::bits::CountTrailingZeros(mask) / 4;
+  }
+#endif
+  return FindFirstAndLastCharacterScalar(subject, i, limit, first, last,
+                                         last_offset);
+}
+
+int FindFirstAndLastCharacter(const base::uc16* subject, int index, int limit,
+                              base::uc16 first, base::uc16 last,
+                              int last_offset) {
+  int i = index;
+#if defined(V8_HOST_ARCH_X64) || defined(NEON64)
+  constexpr int kStride = 8;
+#endif
+#if defined(V8_HOST_ARCH_X64)
+  const __m128i first_vec = _mm_set1_epi16(static_cast<int16_t>(first));
+  const __m128i last_vec = _mm_set1_epi16(static_cast<int16_t>(last));
+  for (; i + kStride <= limit; i += kStride) {
+    const __m128i firsts =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(subject + i));
+    const __m128i lasts = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(subject + i + last_offset));
+    const __m128i eq = _mm_and_si128(_mm_cmpeq_epi16(firsts, first_vec),
+                                     _mm_cmpeq_epi16(lasts, last_vec));
+    // Two bits per matching character.
+    const uint32_t mask = _mm_movemask_epi8(eq);
+    if (mask != 0) return i + base::bits::CountTrailingZeros(mask) / 2;
+  }
+#elif defined(NEON64)
+  const uint16x8_t first_vec = vdupq_n_u16(first);
+  const uint16x8_t last_vec = vdupq_n_u16(last);
+  for (; i + kStride <= limit; i += kStride) {
+    const uint16x8_t eq =
+        vandq_u16(vceqq_u16(vld1q_u16(subject + i), first_vec),
+                  vceqq_u16(vld1q_u16(subject + i + last_offset), last_vec));
+    // One byte per matching character.
+    const uint64_t mask =
+        vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(eq)), 0);
+    if (mask != 0) return i + base::bits::CountTrailingZeros(mask) / 8;
+  }
+#endif
+  return FindFirstAndLastCharacterScalar(subject, i, limit, first, last,
+                                         last_offset);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -41,6 +41,16 @@ class StringSearchBase {
   // to compensate for the algorithmic overhead compared to simple brute force.
   static const int kBMMinPatternLength = 7;
 
+  // Patterns up to this length are searched for by comparing their first and
+  // last character against many subject positions at once, if the host has
+  // SIMD support.
+  static const int kMaxVectorizedPatternLength = 16;
+#if V8_HOST_ARCH_X64 || V8_HOST_ARCH_ARM64
+  static constexpr bool kHasVectorizedSearch = true;
+#else
+  static constexpr bool kHasVectorizedSearch = false;
+#endif
+
   static inline bool IsOneByteString(base::Vector<const uint8_t> string) {
     return true;
   }
@@ -66,11 +76,16 @@ class StringSearch : private StringSearchBase {
       }
     }
     int pattern_length = pattern_.length();
+    if (pattern_length == 1) {
+      strategy_ = &SingleCharSearch;
+      return;
+    }
+    if (kHasVectorizedSearch &&
+        pattern_length <= kMaxVectorizedPatternLength) {
+      strategy_ = &VectorizedSearch;
+      return;
+    }
     if (pattern_length < kBMMinPatternLength) {
-      if (pattern_length == 1) {
-        strategy_ = &SingleCharSearch;
-        return;
-      }
       strategy_ = &LinearSearch;
       return;
     }
@@ -109,6 +124,10 @@ class StringSearch : private StringSearchBase {
                           base::Vector<const SubjectChar> subject,
                           int start_index);
 
+  static int VectorizedSearch(StringSearch<PatternChar, SubjectChar>* search,
+                              base::Vector<const SubjectChar> subject,
+                              int start_index);
+
   static int InitialSearch(StringSearch<PatternChar, SubjectChar>* search,
                            base::Vector<const SubjectChar> subject,
                            int start_index);
@@ -227,6 +246,20 @@ inline int FindFirstCharacter(base::Vector<const PatternChar> pattern,
   return -1;
 }
 
+// Returns the first index i in [index, limit) such that subject[i] == first
+// and subject[i + last_offset] == last, or -1. Compares 16 bytes at a time
+// where StringSearchBase::kHasVectorizedSearch, and one character at a time
+// everywhere else. Never reads beyond subject[limit - 1 + last_offset].
+V8_EXPORT_PRIVATE int FindFirstAndLastCharacter(const uint8_t* subject,
+                                                int index, int limit,
+                                                uint8_t first, uint8_t last,
+                                                int last_offset);
+V8_EXPORT_PRIVATE int FindFirstAndLastCharacter(const base::uc16* subject,
+                                                int index, int limit,
+                                                base::uc16 first,
+                                                base::uc16 last,
+                                                int last_offset);
+
 //---------------------------------------------------------------------
 // Single Character Pattern Search Strategy
 //---------------------------------------------------------------------
@@ -288,6 +321,43 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   return -1;
 }
 
+//---------------------------------------------------------------------
+// Vectorized search for short patterns
+//---------------------------------------------------------------------
+
+// Finds candidate positions where both the first and the last character of
+// the pattern match, and only compares the characters in between there.
+// Never bails out, since patterns are at most kMaxVectorizedPatternLength
+// long.
+template <typename PatternChar, typename SubjectChar>
+int StringSearch<PatternChar, SubjectChar>::VectorizedSearch(
+    StringSearch<PatternChar, SubjectChar>* search,
+    base::Vector<const SubjectChar> subject, int index) {
+  base::Vector<const PatternChar> pattern = search->pattern_;
+  const int pattern_length = pattern.length();
+  DCHECK_GT(pattern_length, 1);
+  DCHECK_LE(pattern_length, kMaxVectorizedPatternLength);
+  // A two-byte pattern can only be found in a one-byte subject if all its
+  // characters are one-byte, see the constructor.
+  const SubjectChar first = static_cast<SubjectChar>(pattern[0]);
+  const SubjectChar last =
+      static_cast<SubjectChar>(pattern[pattern_length - 1]);
+  const int limit = subject.length() - pattern_length + 1;
+  int i = index;
+  while (i < limit) {
+    i = FindFirstAndLastCharacter(subject.begin(), i, limit, first, last,
+                                  pattern_length - 1);
+    if (i == -1) return -1;
+    if (pattern_length == 2 ||
+        CharCompare(pattern.begin() + 1, subject.begin() + i + 1,
+                    pattern_length - 2)) {
+      return i;
+    }
+    i++;
+  }
+  return -1;
+}
+
 //---------------------------------------------------------------------
 // Boyer-Moore string search
 //---------------------------------------------------------------------
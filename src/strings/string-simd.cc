@@ -0,0 +1,173 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/string-simd.h"
+
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
+#include "src/base/logging.h"
+#include "src/strings/unicode-decoder.h"
+#include "src/utils/memcopy.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define STRING_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+// As in simd.cc, Neon is only used on 64-bit ARM, where it is guaranteed to be
+// available.
+#define STRING_NEON64
+#include <arm_neon.h>
+#endif
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+constexpr uint16_t kMaxAscii = 127;
+constexpr uint8_t kMaxJsonControl = 0x1F;
+
+inline bool IsJsonSpecialChar(uint8_t value) {
+  return value <= kMaxJsonControl || value == '"' || value == '\\';
+}
+
+#if defined(STRING_NEON64)
+// Neon has no movemask. Shifting every 16-bit lane right by four and narrowing
+// it to a byte keeps one nibble of each byte of |matches|, so the result has
+// four bits per byte.
+inline uint64_t NibbleMask(uint8x16_t matches) {
+  return vget_lane_u64(
+      vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+}
+#endif
+
+}  // namespace
+
+int AsciiPrefixLength(const uint8_t* chars, int length) {
+  int i = 0;
+
+#if defined(STRING_SSE2)
+  constexpr int kStride = sizeof(__m128i);
+  for (; length - i >= kStride; i += kStride) {
+    __m128i bytes =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
+    // The mask has the top bit of every byte, which is set for non-ASCII.
+    int mask = _mm_movemask_epi8(bytes);
+    if (mask != 0) {
+      return i + base::bits::CountTrailingZeros32(mask);
+    }
+  }
+#elif defined(STRING_NEON64)
+  constexpr int kStride = sizeof(uint8x16_t);
+  const uint8x16_t max_ascii = vdupq_n_u8(kMaxAscii);
+  for (; length - i >= kStride; i += kStride) {
+    uint64_t mask = NibbleMask(vcgtq_u8(vld1q_u8(chars + i), max_ascii));
+    if (mask != 0) {
+      return i + base::bits::CountTrailingZeros64(mask) / 4;
+    }
+  }
+#else
+  // NonAsciiStart checks a word at a time, but may stop at the start of the
+  // word holding the first non-ASCII byte.
+  i = NonAsciiStart(chars, length);
+#endif
+
+  while (i < length && chars[i] <= kMaxAscii) i++;
+  return i;
+}
+
+int AsciiPrefixLength(const uint16_t* chars, int length) {
+  int i = 0;
+
+#if defined(STRING_SSE2)
+  constexpr int kStride = sizeof(__m128i) / sizeof(uint16_t);
+  const __m128i max_ascii = _mm_set1_epi16(kMaxAscii);
+  const __m128i zero = _mm_setzero_si128();
+  for (; length - i >= kStride; i += kStride) {
+    __m128i units =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
+    // Saturating subtraction leaves exactly the non-ASCII code units non-zero.
+    __m128i ascii = _mm_cmpeq_epi16(_mm_subs_epu16(units, max_ascii), zero);
+    // Every code unit contributes two bits to the mask.
+    int mask = ~_mm_movemask_epi8(ascii) & 0xFFFF;
+    if (mask != 0) {
+      return i + base::bits::CountTrailingZeros32(mask) / 2;
+    }
+  }
+#elif defined(STRING_NEON64)
+  constexpr int kStride = sizeof(uint16x8_t) / sizeof(uint16_t);
+  const uint16x8_t max_ascii = vdupq_n_u16(kMaxAscii);
+  for (; length - i >= kStride; i += kStride) {
+    uint16x8_t non_ascii = vcgtq_u16(vld1q_u16(chars + i), max_ascii);
+    // Narrowing turns every non-ASCII lane into one 0xFF byte of the mask.
+    uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(non_ascii)), 0);
+    if (mask != 0) {
+      return i + base::bits::CountTrailingZeros64(mask) / 8;
+    }
+  }
+#endif
+
+  while (i < length && chars[i] <= kMaxAscii) i++;
+  return i;
+}
+
+int CopyAsciiPrefix(uint16_t* dst, const uint8_t* src, int length) {
+  int ascii_length = AsciiPrefixLength(src, length);
+  CopyChars(dst, src, ascii_length);
+  return ascii_length;
+}
+
+const uint8_t* FindJsonSpecialChar(const uint8_t* start, const uint8_t* end) {
+  const uint8_t* cursor = start;
+
+#if defined(STRING_SSE2)
+  constexpr int kStride = sizeof(__m128i);
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i max_control = _mm_set1_epi8(kMaxJsonControl);
+  for (; end - cursor >= kStride; cursor += kStride) {
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    // There is no unsigned byte comparison, but c <= 0x1F iff
+    // min(c, 0x1F) == c.
+    __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(chars, max_control), chars);
+    __m128i matches = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(chars, quote),
+                     _mm_cmpeq_epi8(chars, backslash)),
+        control);
+    int mask = _mm_movemask_epi8(matches);
+    if (mask != 0) {
+      return cursor + base::bits::CountTrailingZeros32(mask);
+    }
+  }
+#elif defined(STRING_NEON64)
+  constexpr int kStride = sizeof(uint8x16_t);
+  const uint8x16_t quote = vdupq_n_u8('"');
+  const uint8x16_t backslash = vdupq_n_u8('\\');
+  const uint8x16_t max_control = vdupq_n_u8(kMaxJsonControl);
+  for (; end - cursor >= kStride; cursor += kStride) {
+    uint8x16_t chars = vld1q_u8(cursor);
+    uint8x16_t matches =
+        vorrq_u8(vorrq_u8(vceqq_u8(chars, quote), vceqq_u8(chars, backslash)),
+                 vcleq_u8(chars, max_control));
+    uint64_t mask = NibbleMask(matches);
+    if (mask != 0) {
+      return cursor + base::bits::CountTrailingZeros64(mask) / 4;
+    }
+  }
+#endif
+
+  for (; cursor < end; cursor++) {
+    if (IsJsonSpecialChar(*cursor)) return cursor;
+  }
+  return end;
+}
+
+#undef STRING_SSE2
+#undef STRING_NEON64
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,38 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_STRINGS_STRING_SIMD_H_
+#define V8_STRINGS_STRING_SIMD_H_
+
+#include <cstdint>
+
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace internal {
+
+// Scanners over raw string contents. They use SSE2 or Neon to look at several
+// code units at a time when they are available.
+
+// Returns the number of leading ASCII code units of the |length| code units at
+// |chars|, i.e. the exact index of the first non-ASCII one, or |length| if
+// there is none. Unlike NonAsciiStart, this does not stop early at a word
+// boundary, so it can be used to skip over ASCII runs.
+V8_EXPORT_PRIVATE int AsciiPrefixLength(const uint8_t* chars, int length);
+V8_EXPORT_PRIVATE int AsciiPrefixLength(const uint16_t* chars, int length);
+
+// Widens the longest ASCII prefix of the |length| bytes at |src| into |dst|,
+// and returns its length.
+int CopyAsciiPrefix(uint16_t* dst, const uint8_t* src, int length);
+
+// Returns the first position in [start, end) which holds a quote, a backslash
+// or a control character, or |end| if there is none. These are the characters
+// that may end a plain run in a JSON string literal, and the ones
+// JSON.stringify escapes in one-byte strings.
+const uint8_t* FindJsonSpecialChar(const uint8_t* start, const uint8_t* end);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_STRINGS_STRING_SIMD_H_
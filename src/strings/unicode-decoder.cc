@@ -4,6 +4,7 @@
 
 #include "src/strings/unicode-decoder.h"
 
+#include "src/strings/string-simd.h"
 #include "src/strings/unicode-inl.h"
 #include "src/utils/memcopy.h"
 
@@ -77,9 +78,12 @@ Utf8DecoderBase<Decoder>::Utf8DecoderBase(
                   state == Traits::DfaDecoder::kAccept)) {
       DCHECK_EQ(0u, current);
       DCHECK(!Traits::IsInvalidSurrogatePair(previous, *cursor));
-      previous = *cursor;
-      utf16_length_++;
-      cursor++;
+      // Skip over the whole ASCII run at once.
+      int ascii_length =
+          AsciiPrefixLength(cursor, static_cast<int>(end - cursor));
+      cursor += ascii_length;
+      previous = cursor[-1];
+      utf16_length_ += ascii_length;
       continue;
     }
 
@@ -145,8 +149,11 @@ void Utf8DecoderBase<Decoder>::Decode(Char* out,
     if (V8_LIKELY(*cursor <= unibrow::Utf8::kMaxOneByteChar &&
                   state == Traits::DfaDecoder::kAccept)) {
       DCHECK_EQ(0u, current);
-      *(out++) = static_cast<Char>(*cursor);
-      cursor++;
+      int ascii_length =
+          AsciiPrefixLength(cursor, static_cast<int>(end - cursor));
+      CopyChars(out, cursor, ascii_length);
+      out += ascii_length;
+      cursor += ascii_length;
       continue;
     }
 
@@ -12,6 +12,7 @@
 #include "src/codegen/macro-assembler-inl.h"
 #include "src/compiler/linkage.h"
 #include "src/compiler/wasm-compiler.h"
+#include "src/utils/bit-vector.h"
 #include "src/utils/ostreams.h"
 #include "src/wasm/baseline/liftoff-register.h"
 #include "src/wasm/object-access.h"
@@ -983,6 +984,12 @@ void LiftoffAssembler::SpillLocals() {
   }
 }
 
+void LiftoffAssembler::SpillAssignedLocals(const BitVector* assigned) {
+  for (uint32_t i = 0; i < num_locals_; ++i) {
+    if (assigned->Contains(i)) Spill(&cache_state_.stack_state[i]);
+  }
+}
+
 void LiftoffAssembler::SpillAllRegisters() {
   for (uint32_t i = 0, e = cache_state_.stack_height(); i < e; ++i) {
     auto& slot = cache_state_.stack_state[i];
@@ -666,6 +666,8 @@ class LiftoffAssembler : public MacroAssembler {
 
   void Spill(VarState* slot);
   void SpillLocals();
+  // Spills the locals in {assigned}, and keeps the others where they are.
+  void SpillAssignedLocals(const BitVector* assigned);
   void SpillAllRegisters();
   inline void LoadSpillAddress(Register dst, int offset, ValueKind kind);
 
@@ -1256,9 +1256,20 @@ class LiftoffCompiler {
     // Before entering a loop, spill all locals to the stack, in order to free
     // the cache registers, and to avoid unnecessarily reloading stack values
     // into registers at branches.
-    // TODO(clemensb): Come up with a better strategy here, involving
-    // pre-analysis of the function.
-    __ SpillLocals();
+    // With --liftoff-keep-loop-invariant-locals, locals which the loop doesn't
+    // assign stay in their registers instead. Their value is the same on every
+    // back edge, so they are only reloaded if the loop body had to spill them.
+    BitVector* assigned = nullptr;
+    if (v8_flags.liftoff_keep_loop_invariant_locals &&
+        for_debugging_ == kNotForDebugging) {
+      assigned = FullDecoder::AnalyzeLoopAssignment(
+          decoder, decoder->pc(), __ num_locals(), zone_);
+    }
+    if (assigned != nullptr) {
+      __ SpillAssignedLocals(assigned);
+    } else {
+      __ SpillLocals();
+    }
 
     __ PrepareLoopArgs(loop->start_merge.arity);
 
@@ -7510,6 +7521,39 @@ class LiftoffCompiler {
       if (!CheckSupportedType(decoder, ret, "return")) return;
     }
 
+    if (v8_flags.wasm_speculative_inlining_call_indirect) {
+      // Record the called table entry before anything else, since the call
+      // clobbers all registers. The IC skips out-of-bounds indices, which
+      // trap below.
+      LiftoffRegister vector = __ GetUnusedRegister(kGpReg, {});
+      __ Fill(vector, liftoff::kFeedbackVectorOffset, kRef);
+      LiftoffAssembler::VarState vector_var{kRef, vector, 0};
+      LiftoffRegList pinned{vector};
+      LiftoffRegister vector_index =
+          pinned.set(__ GetUnusedRegister(kGpReg, pinned));
+      size_t vector_slot = encountered_call_instructions_.size() * 2;
+      encountered_call_instructions_.push_back(
+          FunctionTypeFeedback::kNonDirectCall);
+      __ LoadConstant(vector_index, WasmValue::ForUintPtr(vector_slot));
+      LiftoffAssembler::VarState vector_index_var(kIntPtrKind, vector_index,
+                                                  0);
+      LiftoffRegister table_index =
+          pinned.set(__ GetUnusedRegister(kGpReg, pinned));
+      __ LoadConstant(table_index,
+                      WasmValue::ForUintPtr(imm.table_imm.index));
+      LiftoffAssembler::VarState table_index_var(kIntPtrKind, table_index, 0);
+      LiftoffAssembler::VarState entry_index_var =
+          __ cache_state()->stack_state.back();
+
+      // CallIndirectIC(vector: FixedArray, index: intptr, tableIndex: intptr,
+      //                entryIndex: uint32)
+      CallRuntimeStub(WasmCode::kCallIndirectIC,
+                      MakeSig::Params(kRef, kIntPtrKind, kIntPtrKind, kI32),
+                      {vector_var, vector_index_var, table_index_var,
+                       entry_index_var},
+                      decoder->position());
+    }
+
     Register index = __ PeekToRegister(0, {}).gp();
 
     LiftoffRegList pinned{index};
@@ -7558,6 +7602,7 @@ class LiftoffCompiler {
         table_type.AsNonNull(), ValueType::Ref(imm.sig_imm.index),
         decoder->module_, decoder->module_);
     bool needs_null_check = table_type.is_nullable();
+    Label* null_entry_label = nullptr;
 
     if (needs_type_check) {
       CODE_COMMENT("Check indirect call signature");
@@ -7653,30 +7698,12 @@ class LiftoffCompiler {
                           formal_sig_id, trapping);
       }
     } else if (needs_null_check) {
-      CODE_COMMENT("Check indirect call element for nullity");
-      Register real_sig_id = tmp1;
-
-      // Load the signature from {instance->ift_sig_ids[key]}
-      if (imm.table_imm.index == 0) {
-        LOAD_INSTANCE_FIELD(real_sig_id, IndirectFunctionTableSigIds,
-                            kSystemPointerSize, pinned);
-      } else {
-        __ Load(LiftoffRegister(real_sig_id), indirect_function_table, no_reg,
-                wasm::ObjectAccess::ToTagged(
-                    WasmIndirectFunctionTable::kSigIdsOffset),
-                kPointerLoadType);
-      }
-      static_assert((1 << 2) == kInt32Size);
-      __ Load(LiftoffRegister(real_sig_id), real_sig_id, index, 0,
-              LoadType::kI32Load, nullptr, false, false, true);
-
-      Label* sig_mismatch_label =
+      // Null entries hold undefined instead of an instance. That is checked on
+      // the instance loaded for the call below, so the signature ids do not
+      // have to be loaded at all.
+      null_entry_label =
           AddOutOfLineTrap(decoder, WasmCode::kThrowWasmTrapFuncSigMismatch);
       __ DropValues(1);
-
-      FREEZE_STATE(frozen);
-      __ emit_i32_cond_jumpi(kEqual, sig_mismatch_label, real_sig_id, -1,
-                             frozen);
     } else {
       __ DropValues(1);
     }
@@ -7699,6 +7726,17 @@ class LiftoffCompiler {
                            ObjectAccess::ElementOffsetInTaggedFixedArray(0),
                            true);
 
+      if (null_entry_label) {
+        CODE_COMMENT("Check indirect call element for nullity");
+        Register undefined = tmp3;
+        __ LoadFullPointer(
+            undefined, kRootRegister,
+            IsolateData::root_slot_offset(RootIndex::kUndefinedValue));
+        FREEZE_STATE(trapping);
+        __ emit_cond_jump(kEqual, null_entry_label, kRefNull, function_instance,
+                          undefined, trapping);
+      }
+
       // Load the target from {instance->ift_targets[key]}
       if (imm.table_imm.index == 0) {
         LOAD_INSTANCE_FIELD(function_target, IndirectFunctionTableTargets,
@@ -8170,9 +8208,10 @@ class LiftoffCompiler {
   // Current number of exception refs on the stack.
   int num_exceptions_ = 0;
 
-  // Updated during compilation on every "call" or "call_ref" instruction.
+  // Updated during compilation on every "call" or "call_ref" instruction, and
+  // on every "call_indirect" with {wasm_speculative_inlining_call_indirect}.
   // Holds the call target, or {FunctionTypeFeedback::kNonDirectCall} for
-  // "call_ref".
+  // "call_ref" and "call_indirect".
   // After compilation, this is transferred into {WasmModule::type_feedback}.
   std::vector<uint32_t> encountered_call_instructions_;
 
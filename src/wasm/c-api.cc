@@ -1656,6 +1656,24 @@ i::Handle<i::JSReceiver> GetProperException(
       isolate->factory()->NewError(isolate->error_function(), string));
 }
 
+// Storage for the parameters or results of one host callback. Most host
+// functions have only a few of each, so keep those on the stack instead of
+// allocating on every call.
+class CallbackVals {
+ public:
+  explicit CallbackVals(int count)
+      : heap_vals_(count > kInlineCount ? new Val[count] : nullptr) {}
+
+  Val* get() { return heap_vals_ ? heap_vals_.get() : inline_vals_; }
+  Val& operator[](int index) { return get()[index]; }
+
+ private:
+  static constexpr int kInlineCount = 8;
+
+  Val inline_vals_[kInlineCount];
+  std::unique_ptr<Val[]> heap_vals_;
+};
+
 }  // namespace
 
 auto Func::call(const Val args[], Val results[]) const -> own<Trap> {
@@ -1742,8 +1760,8 @@ i::Address FuncData::v8_callback(i::Address host_data_foreign,
   int num_param_types = static_cast<int>(param_types.size());
   int num_result_types = static_cast<int>(result_types.size());
 
-  std::unique_ptr<Val[]> params(new Val[num_param_types]);
-  std::unique_ptr<Val[]> results(new Val[num_result_types]);
+  CallbackVals params(num_param_types);
+  CallbackVals results(num_result_types);
   i::Address p = argv;
   for (int i = 0; i < num_param_types; ++i) {
     switch (param_types[i]->kind()) {
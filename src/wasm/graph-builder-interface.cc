@@ -750,166 +750,55 @@ class WasmGraphBuildingInterface {
   void CallIndirect(FullDecoder* decoder, const Value& index,
                     const CallIndirectImmediate& imm, const Value args[],
                     Value returns[]) {
-    DoCall(
-        decoder,
-        CallInfo::CallIndirect(index, imm.table_imm.index, imm.sig_imm.index),
-        imm.sig, args, returns);
+    CallInfo call_info =
+        CallInfo::CallIndirect(index, imm.table_imm.index, imm.sig_imm.index);
+    if (v8_flags.wasm_speculative_inlining_call_indirect &&
+        type_feedback_.size() > 0) {
+      DoSpeculativeCall(decoder, next_call_feedback(), call_info, imm.sig,
+                        args, returns);
+      return;
+    }
+    DoCall(decoder, call_info, imm.sig, args, returns);
   }
 
   void ReturnCallIndirect(FullDecoder* decoder, const Value& index,
                           const CallIndirectImmediate& imm,
                           const Value args[]) {
-    DoReturnCall(
-        decoder,
-        CallInfo::CallIndirect(index, imm.table_imm.index, imm.sig_imm.index),
-        imm.sig, args);
+    CallInfo call_info =
+        CallInfo::CallIndirect(index, imm.table_imm.index, imm.sig_imm.index);
+    if (v8_flags.wasm_speculative_inlining_call_indirect &&
+        type_feedback_.size() > 0) {
+      DoSpeculativeReturnCall(decoder, next_call_feedback(), call_info,
+                              imm.sig, args);
+      return;
+    }
+    DoReturnCall(decoder, call_info, imm.sig, args);
   }
 
   void CallRef(FullDecoder* decoder, const Value& func_ref,
                const FunctionSig* sig, uint32_t sig_index, const Value args[],
                Value returns[]) {
-    const CallSiteFeedback* feedback = nullptr;
+    CallInfo call_info =
+        CallInfo::CallRef(func_ref, NullCheckFor(func_ref.type));
     if (v8_flags.wasm_speculative_inlining && type_feedback_.size() > 0) {
-      feedback = &next_call_feedback();
-    }
-    if (feedback == nullptr || feedback->num_cases() == 0) {
-      DoCall(decoder, CallInfo::CallRef(func_ref, NullCheckFor(func_ref.type)),
-             sig, args, returns);
+      DoSpeculativeCall(decoder, next_call_feedback(), call_info, sig, args,
+                        returns);
       return;
     }
-
-    // Check for equality against a function at a specific index, and if
-    // successful, just emit a direct call.
-    int num_cases = feedback->num_cases();
-    std::vector<TFNode*> control_args;
-    std::vector<TFNode*> effect_args;
-    std::vector<Value*> returns_values;
-    control_args.reserve(num_cases + 1);
-    effect_args.reserve(num_cases + 2);
-    returns_values.reserve(num_cases);
-    for (int i = 0; i < num_cases; i++) {
-      const uint32_t expected_function_index = feedback->function_index(i);
-
-      if (v8_flags.trace_wasm_speculative_inlining) {
-        PrintF("[Function #%d call #%d: graph support for inlining #%d]\n",
-               func_index_, feedback_instruction_index_ - 1,
-               expected_function_index);
-      }
-
-      TFNode* success_control;
-      TFNode* failure_control;
-      builder_->CompareToInternalFunctionAtIndex(
-          func_ref.node, expected_function_index, &success_control,
-          &failure_control, i == num_cases - 1);
-      TFNode* initial_effect = effect();
-
-      builder_->SetControl(success_control);
-      ssa_env_->control = success_control;
-      Value* returns_direct =
-          decoder->zone()->NewArray<Value>(sig->return_count());
-      for (size_t i = 0; i < sig->return_count(); i++) {
-        returns_direct[i].type = returns[i].type;
-      }
-      DoCall(decoder,
-             CallInfo::CallDirect(expected_function_index,
-                                  feedback->call_count(i)),
-             decoder->module_->signature(sig_index), args, returns_direct);
-      control_args.push_back(control());
-      effect_args.push_back(effect());
-      returns_values.push_back(returns_direct);
-
-      builder_->SetEffectControl(initial_effect, failure_control);
-      ssa_env_->effect = initial_effect;
-      ssa_env_->control = failure_control;
-    }
-    Value* returns_ref = decoder->zone()->NewArray<Value>(sig->return_count());
-    for (size_t i = 0; i < sig->return_count(); i++) {
-      returns_ref[i].type = returns[i].type;
-    }
-    DoCall(decoder, CallInfo::CallRef(func_ref, NullCheckFor(func_ref.type)),
-           sig, args, returns_ref);
-
-    control_args.push_back(control());
-    TFNode* control = builder_->Merge(num_cases + 1, control_args.data());
-
-    effect_args.push_back(effect());
-    effect_args.push_back(control);
-    TFNode* effect = builder_->EffectPhi(num_cases + 1, effect_args.data());
-
-    ssa_env_->control = control;
-    ssa_env_->effect = effect;
-    builder_->SetEffectControl(effect, control);
-
-    // Each of the {DoCall} helpers above has created a reload of the instance
-    // cache nodes. Rather than merging all of them into a Phi here, just
-    // let them get DCE'ed and perform a single reload after the merge.
-    if (decoder->module_->initial_pages != decoder->module_->maximum_pages) {
-      // The invoked function could have used grow_memory, so we need to
-      // reload mem_size and mem_start.
-      LoadContextIntoSsa(ssa_env_, decoder);
-    }
-
-    for (uint32_t i = 0; i < sig->return_count(); i++) {
-      std::vector<TFNode*> phi_args;
-      for (int j = 0; j < num_cases; j++) {
-        phi_args.push_back(returns_values[j][i].node);
-      }
-      phi_args.push_back(returns_ref[i].node);
-      phi_args.push_back(control);
-      SetAndTypeNode(
-          &returns[i],
-          builder_->Phi(sig->GetReturn(i), num_cases + 1, phi_args.data()));
-    }
+    DoCall(decoder, call_info, sig, args, returns);
   }
 
   void ReturnCallRef(FullDecoder* decoder, const Value& func_ref,
                      const FunctionSig* sig, uint32_t sig_index,
                      const Value args[]) {
-    const CallSiteFeedback* feedback = nullptr;
+    CallInfo call_info =
+        CallInfo::CallRef(func_ref, NullCheckFor(func_ref.type));
     if (v8_flags.wasm_speculative_inlining && type_feedback_.size() > 0) {
-      feedback = &next_call_feedback();
-    }
-    if (feedback == nullptr || feedback->num_cases() == 0) {
-      DoReturnCall(decoder,
-                   CallInfo::CallRef(func_ref, NullCheckFor(func_ref.type)),
-                   sig, args);
+      DoSpeculativeReturnCall(decoder, next_call_feedback(), call_info, sig,
+                              args);
       return;
     }
-
-    // Check for equality against a function at a specific index, and if
-    // successful, just emit a direct call.
-    int num_cases = feedback->num_cases();
-    for (int i = 0; i < num_cases; i++) {
-      const uint32_t expected_function_index = feedback->function_index(i);
-
-      if (v8_flags.trace_wasm_speculative_inlining) {
-        PrintF("[Function #%d call #%d: graph support for inlining #%d]\n",
-               func_index_, feedback_instruction_index_ - 1,
-               expected_function_index);
-      }
-
-      TFNode* success_control;
-      TFNode* failure_control;
-      builder_->CompareToInternalFunctionAtIndex(
-          func_ref.node, expected_function_index, &success_control,
-          &failure_control, i == num_cases - 1);
-      TFNode* initial_effect = effect();
-
-      builder_->SetControl(success_control);
-      ssa_env_->control = success_control;
-      DoReturnCall(decoder,
-                   CallInfo::CallDirect(expected_function_index,
-                                        feedback->call_count(i)),
-                   sig, args);
-
-      builder_->SetEffectControl(initial_effect, failure_control);
-      ssa_env_->effect = initial_effect;
-      ssa_env_->control = failure_control;
-    }
-
-    DoReturnCall(decoder,
-                 CallInfo::CallRef(func_ref, NullCheckFor(func_ref.type)), sig,
-                 args);
+    DoReturnCall(decoder, call_info, sig, args);
   }
 
   void BrOnNull(FullDecoder* decoder, const Value& ref_object, uint32_t depth,
@@ -1237,9 +1126,19 @@ class WasmGraphBuildingInterface {
   void ArrayCopy(FullDecoder* decoder, const Value& dst, const Value& dst_index,
                  const Value& src, const Value& src_index,
                  const Value& length) {
+    // The destination can be typed as a null reference, in which case the
+    // copy always traps and the builtin call is good enough.
+    const ArrayType* type =
+        dst.type.has_index() ? decoder->module_->array_type(dst.type.ref_index())
+                             : nullptr;
     builder_->ArrayCopy(dst.node, dst_index.node, NullCheckFor(dst.type),
                         src.node, src_index.node, NullCheckFor(src.type),
-                        length.node, decoder->position());
+                        length.node, type, decoder->position());
+    // Short copies are done with a loop. Therefore, we have to mark the
+    // immediately nesting loop (if any) as non-innermost.
+    if (type != nullptr && !loop_infos_.empty()) {
+      loop_infos_.back().can_be_innermost = false;
+    }
   }
 
   void ArrayFill(FullDecoder* decoder, ArrayIndexImmediate& imm,
@@ -2290,6 +2189,174 @@ class WasmGraphBuildingInterface {
     }
   }
 
+  // Returns the function indices and call counts of the {feedback} cases that
+  // {generic_call} can be specialized to.
+  std::vector<std::pair<uint32_t, int>> SpeculativeCallCases(
+      FullDecoder* decoder, const CallSiteFeedback& feedback,
+      CallInfo generic_call) {
+    std::vector<std::pair<uint32_t, int>> cases;
+    cases.reserve(feedback.num_cases());
+    for (int i = 0; i < feedback.num_cases(); i++) {
+      uint32_t function_index = feedback.function_index(i);
+      // call_indirect feedback is recorded before the signature check, so it
+      // may name functions that the call traps for. Leave those to the
+      // generic call.
+      if (generic_call.call_mode() == CallInfo::kCallIndirect &&
+          !IsSubtypeOf(
+              ValueType::Ref(
+                  decoder->module_->functions[function_index].sig_index),
+              ValueType::Ref(generic_call.sig_index()), decoder->module_)) {
+        continue;
+      }
+      cases.emplace_back(function_index, feedback.call_count(i));
+    }
+    return cases;
+  }
+
+  void CompareCalleeToFunctionAtIndex(FullDecoder* decoder,
+                                      CallInfo generic_call,
+                                      uint32_t function_index,
+                                      TFNode** success_control,
+                                      TFNode** failure_control,
+                                      bool is_last_case) {
+    if (v8_flags.trace_wasm_speculative_inlining) {
+      PrintF("[Function #%d call #%d: graph support for inlining #%d]\n",
+             func_index_, feedback_instruction_index_ - 1, function_index);
+    }
+    if (generic_call.call_mode() == CallInfo::kCallRef) {
+      builder_->CompareToInternalFunctionAtIndex(
+          generic_call.index_or_callee_value()->node, function_index,
+          success_control, failure_control, is_last_case);
+    } else {
+      DCHECK_EQ(generic_call.call_mode(), CallInfo::kCallIndirect);
+      builder_->CompareTableEntryToFunctionAtIndex(
+          generic_call.table_index(),
+          generic_call.index_or_callee_value()->node, function_index,
+          success_control, failure_control, is_last_case, decoder->position());
+    }
+  }
+
+  // Checks the callee of {generic_call} for equality against the functions in
+  // {feedback}, emits a direct call for each of them, and falls back to
+  // {generic_call} if none matches.
+  void DoSpeculativeCall(FullDecoder* decoder, const CallSiteFeedback& feedback,
+                         CallInfo generic_call, const FunctionSig* sig,
+                         const Value args[], Value returns[]) {
+    std::vector<std::pair<uint32_t, int>> cases =
+        SpeculativeCallCases(decoder, feedback, generic_call);
+    if (cases.empty()) {
+      DoCall(decoder, generic_call, sig, args, returns);
+      return;
+    }
+
+    int num_cases = static_cast<int>(cases.size());
+    std::vector<TFNode*> control_args;
+    std::vector<TFNode*> effect_args;
+    std::vector<Value*> returns_values;
+    control_args.reserve(num_cases + 1);
+    effect_args.reserve(num_cases + 2);
+    returns_values.reserve(num_cases);
+    for (int i = 0; i < num_cases; i++) {
+      const uint32_t expected_function_index = cases[i].first;
+
+      TFNode* success_control;
+      TFNode* failure_control;
+      CompareCalleeToFunctionAtIndex(decoder, generic_call,
+                                     expected_function_index, &success_control,
+                                     &failure_control, i == num_cases - 1);
+      TFNode* initial_effect = effect();
+
+      builder_->SetControl(success_control);
+      ssa_env_->control = success_control;
+      Value* returns_direct =
+          decoder->zone()->NewArray<Value>(sig->return_count());
+      for (size_t i = 0; i < sig->return_count(); i++) {
+        returns_direct[i].type = returns[i].type;
+      }
+      DoCall(decoder,
+             CallInfo::CallDirect(expected_function_index, cases[i].second),
+             sig, args, returns_direct);
+      control_args.push_back(control());
+      effect_args.push_back(effect());
+      returns_values.push_back(returns_direct);
+
+      builder_->SetEffectControl(initial_effect, failure_control);
+      ssa_env_->effect = initial_effect;
+      ssa_env_->control = failure_control;
+    }
+    Value* returns_generic =
+        decoder->zone()->NewArray<Value>(sig->return_count());
+    for (size_t i = 0; i < sig->return_count(); i++) {
+      returns_generic[i].type = returns[i].type;
+    }
+    DoCall(decoder, generic_call, sig, args, returns_generic);
+
+    control_args.push_back(control());
+    TFNode* control = builder_->Merge(num_cases + 1, control_args.data());
+
+    effect_args.push_back(effect());
+    effect_args.push_back(control);
+    TFNode* effect = builder_->EffectPhi(num_cases + 1, effect_args.data());
+
+    ssa_env_->control = control;
+    ssa_env_->effect = effect;
+    builder_->SetEffectControl(effect, control);
+
+    // Each of the {DoCall} helpers above has created a reload of the instance
+    // cache nodes. Rather than merging all of them into a Phi here, just
+    // let them get DCE'ed and perform a single reload after the merge.
+    if (decoder->module_->initial_pages != decoder->module_->maximum_pages) {
+      // The invoked function could have used grow_memory, so we need to
+      // reload mem_size and mem_start.
+      LoadContextIntoSsa(ssa_env_, decoder);
+    }
+
+    for (uint32_t i = 0; i < sig->return_count(); i++) {
+      std::vector<TFNode*> phi_args;
+      for (int j = 0; j < num_cases; j++) {
+        phi_args.push_back(returns_values[j][i].node);
+      }
+      phi_args.push_back(returns_generic[i].node);
+      phi_args.push_back(control);
+      SetAndTypeNode(
+          &returns[i],
+          builder_->Phi(sig->GetReturn(i), num_cases + 1, phi_args.data()));
+    }
+  }
+
+  // Like {DoSpeculativeCall}, for return calls.
+  void DoSpeculativeReturnCall(FullDecoder* decoder,
+                               const CallSiteFeedback& feedback,
+                               CallInfo generic_call, const FunctionSig* sig,
+                               const Value args[]) {
+    std::vector<std::pair<uint32_t, int>> cases =
+        SpeculativeCallCases(decoder, feedback, generic_call);
+    int num_cases = static_cast<int>(cases.size());
+    for (int i = 0; i < num_cases; i++) {
+      const uint32_t expected_function_index = cases[i].first;
+
+      TFNode* success_control;
+      TFNode* failure_control;
+      CompareCalleeToFunctionAtIndex(decoder, generic_call,
+                                     expected_function_index, &success_control,
+                                     &failure_control, i == num_cases - 1);
+      TFNode* initial_effect = effect();
+
+      builder_->SetControl(success_control);
+      ssa_env_->control = success_control;
+      DoReturnCall(decoder,
+                   CallInfo::CallDirect(expected_function_index,
+                                        cases[i].second),
+                   sig, args);
+
+      builder_->SetEffectControl(initial_effect, failure_control);
+      ssa_env_->effect = initial_effect;
+      ssa_env_->control = failure_control;
+    }
+
+    DoReturnCall(decoder, generic_call, sig, args);
+  }
+
   const CallSiteFeedback& next_call_feedback() {
     DCHECK_LT(feedback_instruction_index_, type_feedback_.size());
     return type_feedback_[feedback_instruction_index_++];
@@ -20,9 +20,11 @@
 #include "src/heap/heap-inl.h"  // For CodePageCollectionMemoryModificationScope.
 #include "src/logging/counters-scopes.h"
 #include "src/logging/metrics.h"
+#include "src/objects/struct-inl.h"
 #include "src/tracing/trace-event.h"
 #include "src/wasm/assembler-buffer-cache.h"
 #include "src/wasm/code-space-access.h"
+#include "src/wasm/function-body-decoder.h"
 #include "src/wasm/module-decoder.h"
 #include "src/wasm/pgo.h"
 #include "src/wasm/streaming-decoder.h"
@@ -614,6 +616,12 @@ class CompilationStateImpl {
   void CommitTopTierCompilationUnit(WasmCompilationUnit);
   void AddTopTierPriorityCompilationUnit(WasmCompilationUnit, size_t);
 
+  // Schedules background baseline compilation of up to
+  // {v8_flags.wasm_lazy_compilation_prefetch} direct callees of {func_index}
+  // that are still waiting for lazy compilation, so that calling them later
+  // doesn't block on compilation.
+  void PrefetchLazyCallees(int func_index);
+
   CompilationUnitQueues::Queue* GetQueueForCompileTask(int task_id);
 
   base::Optional<WasmCompilationUnit> GetNextCompilationUnit(
@@ -787,6 +795,8 @@ class CompilationStateImpl {
   using RequiredBaselineTierField = base::BitField8<ExecutionTier, 0, 2>;
   using RequiredTopTierField = base::BitField8<ExecutionTier, 2, 2>;
   using ReachedTierField = base::BitField8<ExecutionTier, 4, 2>;
+  // Set once {PrefetchLazyCallees} scheduled compilation of a lazy function.
+  using LazyPrefetchedField = ReachedTierField::Next<bool, 1>;
 };
 
 CompilationStateImpl* Impl(CompilationState* compilation_state) {
@@ -1198,6 +1208,10 @@ bool CompileLazy(Isolate* isolate, WasmInstanceObject instance,
                                      kNotForDebugging};
     compilation_state->CommitTopTierCompilationUnit(tiering_unit);
   }
+  if (v8_flags.wasm_lazy_compilation_prefetch > 0 &&
+      !v8_flags.wasm_lazy_validation && !is_in_debug_state) {
+    compilation_state->PrefetchLazyCallees(func_index);
+  }
   return true;
 }
 
@@ -1287,6 +1301,16 @@ class FeedbackMaker {
   }
 
   void AddCandidate(Object maybe_function, int count) {
+    if (maybe_function.IsTuple2()) {
+      // A call_indirect table entry that hasn't been exposed as a funcref yet,
+      // see {WasmTableObject::SetFunctionTablePlaceholder}.
+      Tuple2 placeholder = Tuple2::cast(maybe_function);
+      if (placeholder.value1() != instance_) return;
+      int function_index = Smi::cast(placeholder.value2()).value();
+      if (function_index < num_imported_functions_) return;
+      AddCall(function_index, count);
+      return;
+    }
     if (!maybe_function.IsWasmInternalFunction()) return;
     WasmInternalFunction function = WasmInternalFunction::cast(maybe_function);
     if (!WasmExportedFunction::IsWasmExportedFunction(function.external())) {
@@ -1300,6 +1324,20 @@ class FeedbackMaker {
   }
 
   void AddCall(int target, int count) {
+    // A call_indirect can reach the same function through several table
+    // entries, or through a placeholder and later the funcref that replaced it.
+    // Merge those into a single case.
+    for (int i = 0; i < cache_usage_; i++) {
+      if (targets_cache_[i] != target) continue;
+      count += counts_cache_[i];
+      for (int shifted_index = i + 1; shifted_index < cache_usage_;
+           shifted_index++) {
+        targets_cache_[shifted_index - 1] = targets_cache_[shifted_index];
+        counts_cache_[shifted_index - 1] = counts_cache_[shifted_index];
+      }
+      cache_usage_--;
+      break;
+    }
     // Keep the cache sorted (using insertion-sort), highest count first.
     int insertion_index = 0;
     while (insertion_index < cache_usage_ &&
@@ -3384,6 +3422,65 @@ void CompilationStateImpl::CommitTopTierCompilationUnit(
   CommitCompilationUnits({}, {&unit, 1}, {});
 }
 
+void CompilationStateImpl::PrefetchLazyCallees(int func_index) {
+  const WasmModule* module = native_module_->module();
+  base::Vector<const uint8_t> code =
+      GetWireBytesStorage()->GetCode(module->functions[func_index].code);
+  const size_t max_callees =
+      static_cast<size_t>(v8_flags.wasm_lazy_compilation_prefetch);
+
+  // Collect the direct callees in the order in which they are called. The
+  // function just compiled successfully, so its body is valid.
+  std::vector<int> callees;
+  {
+    Zone zone(GetWasmEngine()->allocator(), ZONE_NAME);
+    BodyLocalDecls locals;
+    BytecodeIterator iterator(code.begin(), code.end(), &locals, &zone);
+    for (; iterator.has_next() && callees.size() < max_callees;
+         iterator.next()) {
+      WasmOpcode opcode = iterator.current();
+      if (opcode != kExprCallFunction && opcode != kExprReturnCall) continue;
+      int callee = static_cast<int>(
+          iterator
+              .read_u32v<Decoder::NoValidationTag>(iterator.pc() + 1,
+                                                   "function index")
+              .first);
+      if (callee < static_cast<int>(module->num_imported_functions)) continue;
+      if (native_module_->HasCode(callee)) continue;
+      if (std::find(callees.begin(), callees.end(), callee) != callees.end()) {
+        continue;
+      }
+      callees.push_back(callee);
+    }
+  }
+  if (callees.empty()) return;
+
+  std::vector<WasmCompilationUnit> units;
+  {
+    base::MutexGuard guard(&callbacks_mutex_);
+    for (int callee : callees) {
+      uint8_t& progress =
+          compilation_progress_[declared_function_index(module, callee)];
+      // Functions that are not lazy get compiled anyway.
+      if (RequiredBaselineTierField::decode(progress) != ExecutionTier::kNone) {
+        continue;
+      }
+      if (LazyPrefetchedField::decode(progress)) continue;
+      progress = LazyPrefetchedField::update(progress, true);
+      units.emplace_back(
+          callee,
+          GetLazyCompilationTiers(native_module_, callee, kNotDebugging)
+              .baseline_tier,
+          kNotForDebugging);
+    }
+  }
+  if (units.empty()) return;
+
+  TRACE_LAZY("Prefetching %zu callees of wasm-function#%d.\n", units.size(),
+             func_index);
+  CommitCompilationUnits(base::VectorOf(units), {}, {});
+}
+
 void CompilationStateImpl::AddTopTierPriorityCompilationUnit(
     WasmCompilationUnit unit, size_t priority) {
   compilation_unit_queues_.AddTopTierPriorityUnit(unit, priority);
@@ -4,10 +4,41 @@
 
 #include "src/wasm/stacks.h"
 
+#include "src/base/lazy-instance.h"
 #include "src/base/platform/platform.h"
 
 namespace v8::internal::wasm {
 
+byte* StackPool::Get(size_t size) {
+  base::MutexGuard guard(&mutex_);
+  for (auto it = segments_.begin(); it != segments_.end(); ++it) {
+    if (it->second != size) continue;
+    byte* limit = it->first;
+    segments_.erase(it);
+    return limit;
+  }
+  return nullptr;
+}
+
+bool StackPool::Add(byte* limit, size_t size) {
+  base::MutexGuard guard(&mutex_);
+  if (segments_.size() >=
+      static_cast<size_t>(v8_flags.wasm_stack_switching_pool_size)) {
+    return false;
+  }
+  segments_.emplace_back(limit, size);
+  return true;
+}
+
+size_t StackPool::size() {
+  base::MutexGuard guard(&mutex_);
+  return segments_.size();
+}
+
+namespace {
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(StackPool, GetStackPool)
+}  // namespace
+
 // static
 StackMemory* StackMemory::GetCurrentStackView(Isolate* isolate) {
   uintptr_t limit = isolate->stack_guard()->real_jslimit();
@@ -21,8 +52,17 @@ StackMemory::~StackMemory() {
   if (v8_flags.trace_wasm_stack_switching) {
     PrintF("Delete stack #%d\n", id_);
   }
-  PageAllocator* allocator = GetPlatformPageAllocator();
-  if (owned_) allocator->DecommitPages(limit_, size_);
+  if (owned_) {
+    PageAllocator* allocator = GetPlatformPageAllocator();
+    if (allocator->DiscardSystemPages(limit_, size_) &&
+        GetStackPool()->Add(limit_, size_)) {
+      if (v8_flags.trace_wasm_stack_switching) {
+        PrintF("Return stack #%d to the pool\n", id_);
+      }
+    } else {
+      CHECK(allocator->FreePages(limit_, size_));
+    }
+  }
   // We don't need to handle removing the last stack from the list (next_ ==
   // this). This only happens on isolate tear down, otherwise there is always
   // at least one reachable stack (the active stack).
@@ -45,12 +85,16 @@ StackMemory::StackMemory(Isolate* isolate) : isolate_(isolate), owned_(true) {
   int kJsStackSizeKB = v8_flags.wasm_stack_switching_stack_size;
   size_ = (kJsStackSizeKB + kJSLimitOffsetKB) * KB;
   size_ = RoundUp(size_, allocator->AllocatePageSize());
-  limit_ = static_cast<byte*>(
-      allocator->AllocatePages(nullptr, size_, allocator->AllocatePageSize(),
-                               PageAllocator::kReadWrite));
+  limit_ = GetStackPool()->Get(size_);
+  bool reused = limit_ != nullptr;
+  if (!reused) {
+    limit_ = static_cast<byte*>(
+        allocator->AllocatePages(nullptr, size_, allocator->AllocatePageSize(),
+                                 PageAllocator::kReadWrite));
+  }
   if (v8_flags.trace_wasm_stack_switching) {
-    PrintF("Allocate stack #%d (limit: %p, base: %p)\n", id_, limit_,
-           limit_ + size_);
+    PrintF("%s stack #%d (limit: %p, base: %p)\n",
+           reused ? "Reuse" : "Allocate", id_, limit_, limit_ + size_);
   }
 }
 
@@ -9,6 +9,10 @@
 #error This header should only be included if WebAssembly is enabled.
 #endif  // !V8_ENABLE_WEBASSEMBLY
 
+#include <utility>
+#include <vector>
+
+#include "src/base/platform/mutex.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/utils/allocation.h"
@@ -30,6 +34,27 @@ constexpr int kJmpBufPcOffset = offsetof(JumpBuffer, pc);
 constexpr int kJmpBufStackLimitOffset = offsetof(JumpBuffer, stack_limit);
 constexpr int kJmpBufStateOffset = offsetof(JumpBuffer, state);
 
+// Stack segments of finished continuations, kept for reuse so that every new
+// suspender doesn't have to map a fresh segment. The pages of pooled segments
+// are discarded, so the pool only holds on to address space. Segments can be
+// reused by any isolate. At most --wasm-stack-switching-pool-size segments are
+// kept.
+class V8_EXPORT_PRIVATE StackPool {
+ public:
+  // Takes a pooled segment of |size| bytes out of the pool, or returns nullptr
+  // if there is none.
+  byte* Get(size_t size);
+  // Returns false if the pool is full, in which case the caller keeps owning
+  // the segment.
+  bool Add(byte* limit, size_t size);
+  // The number of pooled segments.
+  size_t size();
+
+ private:
+  base::Mutex mutex_;
+  std::vector<std::pair<byte*, size_t>> segments_;
+};
+
 class StackMemory {
  public:
   static StackMemory* New(Isolate* isolate) { return new StackMemory(isolate); }
@@ -87,6 +87,7 @@ struct WasmModule;
   V(WasmTraceMemory)                     \
   V(BigIntToI32Pair)                     \
   V(BigIntToI64)                         \
+  V(CallIndirectIC)                      \
   V(CallRefIC)                           \
   V(DoubleToI)                           \
   V(I32PairToBigInt)                     \
@@ -392,6 +392,10 @@ struct WasmEngine::IsolateInfo {
   // Keep new modules in debug state.
   bool keep_in_debug_state = false;
 
+  // With --wasm-lazy-debug-tier-down, non-debug code of modules in debug state
+  // is kept until the first step-in (see {TierDownForStepping}).
+  bool keep_non_debug_code = false;
+
   // Keep track whether we already added a sample for PKU support (we only want
   // one sample per Isolate).
   bool pku_support_sampled = false;
@@ -736,12 +740,40 @@ void WasmEngine::EnterDebuggingForIsolate(Isolate* isolate) {
     base::MutexGuard lock(&mutex_);
     if (isolates_[isolate]->keep_in_debug_state) return;
     isolates_[isolate]->keep_in_debug_state = true;
+    isolates_[isolate]->keep_non_debug_code =
+        v8_flags.wasm_lazy_debug_tier_down;
     for (auto* native_module : isolates_[isolate]->native_modules) {
+      DCHECK_EQ(1, native_modules_.count(native_module));
+      native_module->SetDebugState(kDebugging);
+      // Existing code keeps running; functions get recompiled for debugging
+      // when breakpoints are set in them.
+      if (isolates_[isolate]->keep_non_debug_code) continue;
+      if (auto shared_ptr = native_modules_[native_module]->weak_ptr.lock()) {
+        native_modules.emplace_back(std::move(shared_ptr));
+      }
+    }
+  }
+  for (auto& native_module : native_modules) {
+    native_module->RemoveCompiledCode(
+        NativeModule::RemoveFilter::kRemoveNonDebugCode);
+  }
+}
+
+void WasmEngine::TierDownForStepping(Isolate* isolate) {
+  std::vector<std::shared_ptr<NativeModule>> native_modules;
+  // As in {EnterDebuggingForIsolate}, {RemoveCompiledCode} has to be called
+  // outside the lock.
+  {
+    base::MutexGuard lock(&mutex_);
+    DCHECK_EQ(1, isolates_.count(isolate));
+    IsolateInfo* isolate_info = isolates_[isolate].get();
+    if (!isolate_info->keep_non_debug_code) return;
+    isolate_info->keep_non_debug_code = false;
+    for (auto* native_module : isolate_info->native_modules) {
       DCHECK_EQ(1, native_modules_.count(native_module));
       if (auto shared_ptr = native_modules_[native_module]->weak_ptr.lock()) {
         native_modules.emplace_back(std::move(shared_ptr));
       }
-      native_module->SetDebugState(kDebugging);
     }
   }
   for (auto& native_module : native_modules) {
@@ -758,6 +790,7 @@ void WasmEngine::LeaveDebuggingForIsolate(Isolate* isolate) {
   {
     base::MutexGuard lock(&mutex_);
     isolates_[isolate]->keep_in_debug_state = false;
+    isolates_[isolate]->keep_non_debug_code = false;
     auto can_remove_debug_code = [this](NativeModule* native_module) {
       DCHECK_EQ(1, native_modules_.count(native_module));
       for (auto* isolate : native_modules_[native_module]->isolates) {
@@ -1274,7 +1307,7 @@ std::shared_ptr<NativeModule> WasmEngine::MaybeGetNativeModule(
     isolates_[isolate]->native_modules.insert(native_module.get());
     if (isolates_[isolate]->keep_in_debug_state &&
         !native_module->IsInDebugState()) {
-      remove_all_code = true;
+      remove_all_code = !isolates_[isolate]->keep_non_debug_code;
       native_module->SetDebugState(kDebugging);
     }
   }
@@ -1303,7 +1336,7 @@ std::shared_ptr<NativeModule> WasmEngine::UpdateNativeModuleCache(
     isolates_[isolate]->native_modules.insert(native_module.get());
     if (isolates_[isolate]->keep_in_debug_state &&
         !native_module->IsInDebugState()) {
-      remove_all_code = true;
+      remove_all_code = !isolates_[isolate]->keep_non_debug_code;
       native_module->SetDebugState(kDebugging);
     }
   }
@@ -205,6 +205,10 @@ class V8_EXPORT_PRIVATE WasmEngine {
 
   void EnterDebuggingForIsolate(Isolate* isolate);
 
+  // Removes non-debug code that --wasm-lazy-debug-tier-down kept when entering
+  // debugging, so that stepping into calls reaches debuggable code.
+  void TierDownForStepping(Isolate* isolate);
+
   void LeaveDebuggingForIsolate(Isolate* isolate);
 
   // Exports the sharable parts of the given module object so that they can be
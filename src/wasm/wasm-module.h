@@ -485,9 +485,10 @@ struct FunctionTypeFeedback {
   // feedback vector by {TransitiveTypeFeedbackProcessor}.
   std::vector<CallSiteFeedback> feedback_vector;
 
-  // {call_targets} has one entry per "call" and "call_ref" in the function.
-  // For "call", it holds the index of the called function, for "call_ref" the
-  // value will be {kNonDirectCall}.
+  // {call_targets} has one entry per "call" and "call_ref" in the function,
+  // and per "call_indirect" if {wasm_speculative_inlining_call_indirect} is
+  // enabled. For "call", it holds the index of the called function, for the
+  // others the value will be {kNonDirectCall}.
   base::OwnedVector<uint32_t> call_targets;
 
   // {tierup_priority} is updated and used when triggering tier-up.
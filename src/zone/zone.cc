@@ -4,6 +4,7 @@
 
 #include "src/zone/zone.h"
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
 
@@ -137,7 +138,10 @@ void Zone::Expand(size_t size) {
   // Compute the new segment size. We use a 'high water mark'
   // strategy, where we increase the segment size every time we expand
   // except that we employ a maximum segment size when we delete. This
-  // is to avoid excessive malloc() and free() overhead.
+  // is to avoid excessive malloc() and free() overhead. The maximum is
+  // raised in proportion to the memory the zone already holds, so that
+  // quickly growing zones need fewer segments while the unused tail of the
+  // last segment stays small relative to the zone.
   Segment* head = segment_head_;
   const size_t old_size = head ? head->total_size() : 0;
   static const size_t kSegmentOverhead = sizeof(Segment) + kAlignmentInBytes;
@@ -150,12 +154,18 @@ void Zone::Expand(size_t size) {
   }
   if (new_size < kMinimumSegmentSize) {
     new_size = kMinimumSegmentSize;
-  } else if (new_size >= kMaximumSegmentSize) {
+  } else {
     // Limit the size of new segments to avoid growing the segment size
     // exponentially, thus putting pressure on contiguous virtual address space.
     // All the while making sure to allocate a segment large enough to hold the
     // requested size.
-    new_size = std::max({min_new_size, kMaximumSegmentSize});
+    const size_t max_segment_size = std::clamp(
+        segment_bytes_allocated_.load(std::memory_order_relaxed) /
+            kLargeZoneSegmentRatio,
+        kMaximumSegmentSize, kMaximumLargeZoneSegmentSize);
+    if (new_size >= max_segment_size) {
+      new_size = std::max({min_new_size, max_segment_size});
+    }
   }
   if (new_size > INT_MAX) {
     V8::FatalProcessOutOfMemory(nullptr, "Zone");
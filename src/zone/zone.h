@@ -220,10 +220,17 @@ class V8_EXPORT_PRIVATE Zone final {
   static const size_t kAlignmentInBytes = 8;
 
   // Never allocate segments smaller than this size in bytes.
-  static const size_t kMinimumSegmentSize = 8 * KB;
+  static constexpr size_t kMinimumSegmentSize = 8 * KB;
 
-  // Never allocate segments larger than this size in bytes.
-  static const size_t kMaximumSegmentSize = 32 * KB;
+  // Never allocate segments larger than this size in bytes, unless the zone
+  // has already grown large (see below).
+  static constexpr size_t kMaximumSegmentSize = 32 * KB;
+
+  // Zones that already hold many segments (e.g. the graph zone of a large
+  // TurboFan compile) may use segments of up to 1/kLargeZoneSegmentRatio of
+  // their current size, but never larger than this size in bytes.
+  static constexpr size_t kMaximumLargeZoneSegmentSize = 256 * KB;
+  static constexpr size_t kLargeZoneSegmentRatio = 8;
 
   // The number of bytes allocated in this zone so far.
   std::atomic<size_t> allocation_size_ = {0};
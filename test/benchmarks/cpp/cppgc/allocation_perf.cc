@@ -5,6 +5,7 @@
 #include "include/cppgc/allocation.h"
 #include "include/cppgc/garbage-collected.h"
 #include "include/cppgc/heap-consistency.h"
+#include "include/cppgc/heap.h"
 #include "src/base/macros.h"
 #include "src/heap/cppgc/globals.h"
 #include "src/heap/cppgc/heap.h"
@@ -48,6 +49,49 @@ BENCHMARK_F(Allocate, Large)(benchmark::State& st) {
   st.SetBytesProcessed(st.iterations() * sizeof(LargeObject));
 }
 
+template <size_t kSize>
+class SizedObject final : public GarbageCollected<SizedObject<kSize>> {
+ public:
+  void Trace(cppgc::Visitor*) const {}
+  char padding[kSize];
+};
+
+// Allocates small objects of different size classes from several threads at
+// once. cppgc heaps are bound to a single thread, so every benchmark thread
+// creates its own heap; this measures how well allocation scales when
+// multiple heaps share the process-wide page allocator.
+void MultiThreadedSmallAllocation(benchmark::State& st) {
+  static constexpr size_t kAllocationsPerIteration = 64;
+  static constexpr size_t kIterationsPerGC = 1024;
+  auto heap = cppgc::Heap::Create(testing::BenchmarkWithHeap::GetPlatform());
+  cppgc::AllocationHandle& handle = heap->GetAllocationHandle();
+  size_t iterations_since_gc = 0;
+  for (auto _ : st) {
+    USE(_);
+    for (size_t i = 0; i < kAllocationsPerIteration; i += 4) {
+      benchmark::DoNotOptimize(MakeGarbageCollected<SizedObject<8>>(handle));
+      benchmark::DoNotOptimize(MakeGarbageCollected<SizedObject<40>>(handle));
+      benchmark::DoNotOptimize(MakeGarbageCollected<SizedObject<96>>(handle));
+      benchmark::DoNotOptimize(MakeGarbageCollected<SizedObject<200>>(handle));
+    }
+    if (++iterations_since_gc == kIterationsPerGC) {
+      // Reclaim the unreachable objects outside of the measured time to keep
+      // the memory footprint bounded.
+      st.PauseTiming();
+      heap->ForceGarbageCollectionSlow(
+          "MultiThreadedSmallAllocation", "Bounding memory",
+          cppgc::Heap::StackState::kNoHeapPointers);
+      iterations_since_gc = 0;
+      st.ResumeTiming();
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * kAllocationsPerIteration);
+  st.SetBytesProcessed(st.iterations() * (kAllocationsPerIteration / 4) *
+                       (8 + 40 + 96 + 200));
+}
+
+BENCHMARK(MultiThreadedSmallAllocation)->ThreadRange(1, 8)->UseRealTime();
+
 }  // namespace
 }  // namespace internal
 }  // namespace cppgc
@@ -18,6 +18,10 @@ class BenchmarkWithHeap : public benchmark::Fixture {
   static void InitializeProcess();
   static void ShutdownProcess();
 
+  static std::shared_ptr<testing::TestPlatform> GetPlatform() {
+    return platform_;
+  }
+
  protected:
   void SetUp(::benchmark::State& state) override {
     heap_ = cppgc::Heap::Create(GetPlatform());
@@ -28,10 +32,6 @@ class BenchmarkWithHeap : public benchmark::Fixture {
   cppgc::Heap& heap() const { return *heap_.get(); }
 
  private:
-  static std::shared_ptr<testing::TestPlatform> GetPlatform() {
-    return platform_;
-  }
-
   static std::shared_ptr<testing::TestPlatform> platform_;
 
   std::unique_ptr<cppgc::Heap> heap_;
@@ -0,0 +1,198 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-array-buffer.h"
+#include "include/v8-container.h"
+#include "include/v8-context.h"
+#include "include/v8-initialization.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-object.h"
+#include "include/v8-primitive.h"
+#include "include/v8-value-serializer.h"
+#include "src/base/logging.h"
+#include "src/heap/base/basic-slot-set.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace {
+
+// Set up in main() next to the platform, for the cases that need a heap.
+v8::Isolate* g_isolate = nullptr;
+
+// A scope that enters the benchmark isolate and a fresh context.
+class IsolateScope final {
+ public:
+  IsolateScope()
+      : isolate_scope_(g_isolate),
+        handle_scope_(g_isolate),
+        context_(v8::Context::New(g_isolate)),
+        context_scope_(context_) {}
+
+  v8::Local<v8::Context> context() const { return context_; }
+
+ private:
+  v8::Isolate::Scope isolate_scope_;
+  v8::HandleScope handle_scope_;
+  v8::Local<v8::Context> context_;
+  v8::Context::Scope context_scope_;
+};
+
+// Same layout as the OLD_TO_NEW and OLD_TO_OLD sets of a regular page.
+constexpr size_t kSlotGranularity = sizeof(void*);
+using SlotSet = ::heap::base::BasicSlotSet<kSlotGranularity>;
+constexpr size_t kPageSize = 256 * 1024;
+constexpr size_t kBuckets = SlotSet::BucketsForSize(kPageSize);
+
+// Records every {state.range(0)}-th slot of a page, from dense (every slot)
+// to sparse sets that mostly hit empty buckets.
+void BM_SlotSetInsert(benchmark::State& state) {
+  const size_t stride = static_cast<size_t>(state.range(0)) * kSlotGranularity;
+  size_t inserted = 0;
+  for (auto _ : state) {
+    SlotSet* set = SlotSet::Allocate(kBuckets);
+    for (size_t offset = 0; offset < kPageSize; offset += stride) {
+      set->Insert<SlotSet::AccessMode::NON_ATOMIC>(offset);
+    }
+    benchmark::DoNotOptimize(set);
+    SlotSet::Delete(set, kBuckets);
+    inserted += kPageSize / stride;
+  }
+  state.SetItemsProcessed(inserted);
+}
+BENCHMARK(BM_SlotSetInsert)->Arg(1)->Arg(8)->Arg(64)->Arg(1024);
+
+// Visits a set filled with every {state.range(0)}-th slot of a page, keeping
+// all slots as the scavenger does for slots that still point to new space.
+void BM_SlotSetIterate(benchmark::State& state) {
+  const size_t stride = static_cast<size_t>(state.range(0)) * kSlotGranularity;
+  SlotSet* set = SlotSet::Allocate(kBuckets);
+  for (size_t offset = 0; offset < kPageSize; offset += stride) {
+    set->Insert<SlotSet::AccessMode::NON_ATOMIC>(offset);
+  }
+  size_t visited = 0;
+  for (auto _ : state) {
+    visited += set->Iterate(
+        0, 0, kBuckets,
+        [](SlotSet::Address slot) {
+          benchmark::DoNotOptimize(slot);
+          return ::heap::base::KEEP_SLOT;
+        },
+        SlotSet::KEEP_EMPTY_BUCKETS);
+  }
+  SlotSet::Delete(set, kBuckets);
+  state.SetItemsProcessed(visited);
+}
+BENCHMARK(BM_SlotSetIterate)->Arg(1)->Arg(8)->Arg(64)->Arg(1024);
+
+// Internalizes {state.range(0)} distinct strings. Every iteration after the
+// first only looks them up in the string table.
+void BM_StringTableInternalize(benchmark::State& state) {
+  IsolateScope scope;
+  const int count = static_cast<int>(state.range(0));
+  std::vector<std::string> names;
+  names.reserve(count);
+  for (int i = 0; i < count; ++i) names.push_back("name" + std::to_string(i));
+  for (auto _ : state) {
+    v8::HandleScope handle_scope(g_isolate);
+    for (const std::string& name : names) {
+      benchmark::DoNotOptimize(
+          v8::String::NewFromUtf8(g_isolate, name.c_str(),
+                                  v8::NewStringType::kInternalized,
+                                  static_cast<int>(name.size()))
+              .ToLocalChecked());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_StringTableInternalize)->Range(1 << 8, 1 << 16);
+
+// Scavenges a new space that holds {state.range(0)} freshly allocated live
+// objects, reachable from a single array. The objects are allocated anew for
+// every iteration, so that each scavenge copies them once.
+void BM_Scavenge(benchmark::State& state) {
+  IsolateScope scope;
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    v8::HandleScope handle_scope(g_isolate);
+    v8::Local<v8::Array> live = v8::Array::New(g_isolate, count);
+    for (int i = 0; i < count; ++i) {
+      CHECK(live->Set(scope.context(), i, v8::Object::New(g_isolate))
+                .FromJust());
+    }
+    state.ResumeTiming();
+    g_isolate->RequestGarbageCollectionForTesting(
+        v8::Isolate::kMinorGarbageCollection);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_Scavenge)->Range(1 << 6, 1 << 14);
+
+// Serializes and deserializes an array of {state.range(0)} small objects.
+void BM_ValueSerializerRoundTrip(benchmark::State& state) {
+  IsolateScope scope;
+  v8::Local<v8::Context> context = scope.context();
+  const int count = static_cast<int>(state.range(0));
+  v8::Local<v8::Array> array = v8::Array::New(g_isolate, count);
+  for (int i = 0; i < count; ++i) {
+    v8::Local<v8::Object> object = v8::Object::New(g_isolate);
+    CHECK(object
+              ->Set(context, v8::String::NewFromUtf8Literal(g_isolate, "x"),
+                    v8::Integer::New(g_isolate, i))
+              .FromJust());
+    CHECK(array->Set(context, i, object).FromJust());
+  }
+  size_t bytes = 0;
+  for (auto _ : state) {
+    v8::HandleScope handle_scope(g_isolate);
+    v8::ValueSerializer serializer(g_isolate);
+    serializer.WriteHeader();
+    CHECK(serializer.WriteValue(context, array).FromJust());
+    std::pair<uint8_t*, size_t> buffer = serializer.Release();
+    v8::ValueDeserializer deserializer(g_isolate, buffer.first, buffer.second);
+    CHECK(deserializer.ReadHeader(context).FromJust());
+    benchmark::DoNotOptimize(deserializer.ReadValue(context).ToLocalChecked());
+    bytes += buffer.second;
+    free(buffer.first);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+  state.SetBytesProcessed(bytes);
+}
+BENCHMARK(BM_ValueSerializerRoundTrip)->Range(1 << 4, 1 << 12);
+
+}  // namespace
+
+// Expanded macro BENCHMARK_MAIN() to allow per-process setup.
+int main(int argc, char** argv) {
+  // Needed for RequestGarbageCollectionForTesting().
+  v8::V8::SetFlagsFromString("--expose-gc");
+  v8::V8::InitializeICUDefaultLocation(argv[0]);
+  v8::V8::InitializeExternalStartupData(argv[0]);
+  std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform();
+  v8::V8::InitializePlatform(platform.get());
+  v8::V8::Initialize();
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator(
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = allocator.get();
+  g_isolate = v8::Isolate::New(create_params);
+  // Contents of BENCHMARK_MAIN().
+  {
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+  }
+  g_isolate->Dispose();
+  v8::V8::Dispose();
+  v8::V8::DisposePlatform();
+  return 0;
+}
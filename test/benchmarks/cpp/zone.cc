@@ -0,0 +1,75 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-initialization.h"
+#include "src/zone/accounting-allocator.h"
+#include "src/zone/zone-containers.h"
+#include "src/zone/zone.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace {
+
+using v8::internal::AccountingAllocator;
+using v8::internal::Zone;
+using v8::internal::ZoneVector;
+
+struct ZoneBenchmarkTag {};
+
+// Allocates {state.range(0)} objects of {state.range(1)} bytes each in a
+// fresh zone, which exercises both the bump-pointer fast path and segment
+// expansion.
+void BM_ZoneAllocate(benchmark::State& state) {
+  AccountingAllocator allocator;
+  const size_t count = static_cast<size_t>(state.range(0));
+  const size_t size = static_cast<size_t>(state.range(1));
+  for (auto _ : state) {
+    Zone zone(&allocator, ZONE_NAME);
+    for (size_t i = 0; i < count; ++i) {
+      benchmark::DoNotOptimize(zone.Allocate<ZoneBenchmarkTag>(size));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+  state.SetBytesProcessed(state.iterations() * count * size);
+}
+BENCHMARK(BM_ZoneAllocate)
+    ->Args({1 << 10, 32})
+    ->Args({1 << 16, 32})
+    ->Args({1 << 16, 256})
+    ->Args({1 << 20, 32});
+
+// Grows a ZoneVector one element at a time, as the compiler does for most of
+// its side tables.
+void BM_ZoneVectorPushBack(benchmark::State& state) {
+  AccountingAllocator allocator;
+  const int count = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Zone zone(&allocator, ZONE_NAME);
+    ZoneVector<int> vector(&zone);
+    for (int i = 0; i < count; ++i) vector.push_back(i);
+    benchmark::DoNotOptimize(vector.data());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ZoneVectorPushBack)->Range(1 << 8, 1 << 18);
+
+}  // namespace
+
+// Expanded macro BENCHMARK_MAIN() to allow per-process setup.
+int main(int argc, char** argv) {
+  // AccountingAllocator obtains its backing allocator from the platform.
+  std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform();
+  v8::V8::InitializePlatform(platform.get());
+  // Contents of BENCHMARK_MAIN().
+  {
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+  }
+  v8::V8::DisposePlatform();
+  return 0;
+}
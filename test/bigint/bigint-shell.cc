@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <chrono>
 #include <cmath>
 #include <memory>
 #include <string>
@@ -25,19 +26,22 @@ int PrintHelp(char** argv) {
             << "--random-seed R\n"
             << "    Initialize the random number generator with this seed.\n"
             << "--runs N\n"
-            << "    Repeat the test N times.\n";
+            << "    Repeat the test N times.\n"
+            << "--benchmark\n"
+            << "    Report how long the runs took.\n";
   return 1;
 }
 
-#define TESTS(V)                     \
-  V(kBarrett, "barrett")             \
-  V(kBurnikel, "burnikel")           \
-  V(kFFT, "fft")                     \
-  V(kFromString, "fromstring")       \
-  V(kFromStringBase2, "fromstring2") \
-  V(kKaratsuba, "karatsuba")         \
-  V(kToom, "toom")                   \
-  V(kToString, "tostring")
+#define TESTS(V)                       \
+  V(kBarrett, "barrett")               \
+  V(kBurnikel, "burnikel")             \
+  V(kFFT, "fft")                       \
+  V(kFromString, "fromstring")         \
+  V(kFromStringBase2, "fromstring2")   \
+  V(kKaratsuba, "karatsuba")           \
+  V(kToom, "toom")                     \
+  V(kToString, "tostring")             \
+  V(kToStringCached, "tostringcached")
 
 enum Operation { kNoOp, kList, kTest };
 
@@ -188,6 +192,7 @@ class Runner {
 
   int RunTest() {
     int count = 0;
+    auto start = std::chrono::steady_clock::now();
     if (test_ == kBarrett) {
       for (int i = 0; i < runs_; i++) {
         TestBarrett(&count);
@@ -212,6 +217,10 @@ class Runner {
       for (int i = 0; i < runs_; i++) {
         TestToString(&count);
       }
+    } else if (test_ == kToStringCached) {
+      for (int i = 0; i < runs_; i++) {
+        TestToStringCached(&count);
+      }
     } else if (test_ == kFromString) {
       for (int i = 0; i < runs_; i++) {
         TestFromString(&count);
@@ -225,6 +234,12 @@ class Runner {
     }
     if (error_) return 1;
     std::cout << count << " tests run, no error reported.\n";
+    if (benchmark_) {
+      std::chrono::duration<double, std::milli> elapsed =
+          std::chrono::steady_clock::now() - start;
+      std::cout << runs_ << " runs took " << elapsed.count() << " ms, "
+                << elapsed.count() / runs_ << " ms per run.\n";
+    }
     return 0;
   }
 
@@ -412,6 +427,38 @@ class Runner {
     }
   }
 
+  // Converts numbers of random sizes in random order, so that the radix powers
+  // that {ProcessorImpl} caches for fast conversion are reused for smaller
+  // inputs, grown for larger ones, and bypassed for too large ones.
+  void TestToStringCached(int* count) {
+    constexpr int kMin = kToStringFastThreshold;
+    constexpr int kMax = kToStringFastThreshold * 16;
+    constexpr int kUncachedSize = kToStringCacheMaxBitLength / kDigitBits + 1;
+    constexpr uint8_t radixes[] = {3, 7, 10, 10, 10, 10, 16, 36};
+    for (int i = 0; i < 50; i++) {
+      uint64_t random_bits = rng_.NextUint64();
+      int radix = radixes[random_bits & 7];
+      random_bits >>= 3;
+      int size = i == 0 ? kUncachedSize
+                        : kMin + static_cast<int>(random_bits % (kMax - kMin));
+      ScratchDigits X(size);
+      GenerateRandom(X);
+      int chars_required = ToStringResultLength(X, radix, false);
+      int result_len = chars_required;
+      int reference_len = chars_required;
+      std::unique_ptr<char[]> result(new char[result_len]);
+      std::unique_ptr<char[]> reference(new char[reference_len]);
+      processor()->ToStringImpl(result.get(), &result_len, X, radix, false,
+                                true);
+      processor()->ToStringImpl(reference.get(), &reference_len, X, radix,
+                                false, false);
+      AssertEquals(X, radix, reference.get(), reference_len, result.get(),
+                   result_len);
+      if (error_) return;
+      (*count)++;
+    }
+  }
+
   void TestFromString(int* count) {
     constexpr int kMaxDigits = 1 << 20;  // Any large-enough value will do.
     constexpr int kMin = kFromStringLargeThreshold / 2;
@@ -514,6 +561,8 @@ class Runner {
         if (++i == argc || !ParseInt(argv[i], &runs_)) return PrintHelp(argv);
       } else if (strncmp(argv[i], "--runs=", 7) == 0) {
         if (!ParseInt(argv[i] + 7, &runs_)) return PrintHelp(argv);
+      } else if (strcmp(argv[i], "--benchmark") == 0) {
+        benchmark_ = true;
       }
 #define TEST(kName, name)                \
   else if (strcmp(argv[i], name) == 0) { \
@@ -613,6 +662,7 @@ class Runner {
   Operation op_{kNoOp};
   Test test_;
   bool error_{false};
+  bool benchmark_{false};
   int runs_ = 1;
   int64_t random_seed_{314159265359};
   RNG rng_;
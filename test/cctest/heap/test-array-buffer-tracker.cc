@@ -2,7 +2,11 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <atomic>
+
 #include "src/api/api-inl.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/heap/array-buffer-sweeper.h"
@@ -440,6 +444,51 @@ TEST(ArrayBuffer_ExternalBackingStoreSizeDecreases) {
   CHECK_EQ(0, backing_store_after - backing_store_before);
 }
 
+namespace {
+std::atomic<int> freed_backing_stores{0};
+
+void CountingDeleter(void* data, size_t length, void* deleter_data) {
+  freed_backing_stores++;
+}
+}  // namespace
+
+TEST(ArrayBuffer_ConcurrentFreeing) {
+  v8_flags.concurrent_array_buffer_sweeping = false;
+  v8_flags.concurrent_array_buffer_freeing = true;
+
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  Heap* heap = reinterpret_cast<Isolate*>(isolate)->heap();
+  i::DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+      CcTest::heap());
+
+  static char data[100];
+  freed_backing_stores = 0;
+  ArrayBufferExtension* extension;
+  {
+    v8::HandleScope handle_scope(isolate);
+    std::unique_ptr<v8::BackingStore> backing_store =
+        v8::ArrayBuffer::NewBackingStore(data, sizeof(data), CountingDeleter,
+                                         nullptr);
+    Local<v8::ArrayBuffer> ab =
+        v8::ArrayBuffer::New(isolate, std::move(backing_store));
+    extension = v8::Utils::OpenHandle(*ab)->extension();
+    CHECK(IsTracked(heap, extension));
+  }
+  heap::GcAndSweep(heap, OLD_SPACE);
+  CHECK(!IsTracked(heap, extension));
+  // The backing store is freed by a background task. Give up after a while
+  // instead of hanging if the task never runs.
+  const base::TimeTicks deadline =
+      base::TimeTicks::Now() + base::TimeDelta::FromSeconds(10);
+  while (freed_backing_stores == 0 && base::TimeTicks::Now() < deadline) {
+    base::OS::Sleep(base::TimeDelta::FromMilliseconds(1));
+  }
+  CHECK_EQ(1, freed_backing_stores);
+}
+
 TEST(ArrayBuffer_ExternalBackingStoreSizeIncreasesMarkCompact) {
   if (!v8_flags.compact) return;
   ManualGCScope manual_gc_scope;
@@ -44,15 +44,18 @@
 #include "src/flags/flags.h"
 #include "src/handles/global-handles-inl.h"
 #include "src/heap/combined-heap.h"
+#include "src/heap/concurrent-marking.h"
 #include "src/heap/factory.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-verifier.h"
 #include "src/heap/incremental-marking.h"
 #include "src/heap/large-spaces.h"
+#include "src/heap/mark-compact-inl.h"
 #include "src/heap/mark-compact.h"
 #include "src/heap/marking-barrier.h"
 #include "src/heap/marking-state-inl.h"
+#include "src/heap/marking-visitor-inl.h"
 #include "src/heap/memory-chunk.h"
 #include "src/heap/memory-reducer.h"
 #include "src/heap/parked-scope.h"
@@ -1151,6 +1154,58 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+TEST(TestDeepIdleBytecodeFlushing) {
+#if !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+  v8_flags.turbofan = false;
+  v8_flags.always_turbofan = false;
+  i::v8_flags.optimize_for_size = false;
+#endif  // !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+#if ENABLE_SPARKPLUG
+  v8_flags.always_sparkplug = false;
+#endif  // ENABLE_SPARKPLUG
+  i::v8_flags.flush_bytecode = true;
+  i::v8_flags.lazy_feedback_allocation = false;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Factory* factory = i_isolate->factory();
+  DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+      CcTest::heap());
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  return x + 1;"
+        "};"
+        "foo()";
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+    {
+      v8::HandleScope new_scope(isolate);
+      CompileRun(source);
+    }
+    Handle<Object> func_value =
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked();
+    CHECK(func_value->IsJSFunction());
+    Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+    CHECK(function->shared().is_compiled());
+    CHECK(function->has_feedback_vector());
+
+    // Young bytecode is flushed without waiting for it to age.
+    CcTest::heap()->CollectGarbageForDeepIdle();
+    CHECK(!function->shared().is_compiled());
+    CHECK(!function->is_compiled());
+    CHECK(!function->has_feedback_vector());
+
+    CompileRun("foo()");
+    CHECK(function->shared().is_compiled());
+  }
+}
+
 static void TestMultiReferencedBytecodeFlushing(bool sparkplug_compile) {
 #if !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
   v8_flags.turbofan = false;
@@ -2267,6 +2322,56 @@ TEST(TestAlignedOverAllocation) {
   }
 }
 
+UNINITIALIZED_TEST(PersistedPretenuringDecisions) {
+  if (!v8_flags.allocation_site_pretenuring || v8_flags.single_generation) {
+    return;
+  }
+  v8_flags.allow_natives_syntax = true;
+  // Literal allocation sites live in feedback vectors.
+  v8_flags.lazy_feedback_allocation = false;
+  ManualGCScope manual_gc_scope;
+  const char* source =
+      "function f() { return [[1], [2]]; }"
+      "f();";
+  std::vector<uint8_t> decisions;
+  {
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Context::New(isolate)->Enter();
+      CompileRunChecked(isolate, source);
+      CompileRunChecked(isolate, "%PretenureAllocationSite(f());");
+      CcTest::CollectAllGarbage(reinterpret_cast<Isolate*>(isolate));
+      decisions = isolate->GetPretenuringDecisions();
+      isolate->GetCurrentContext()->Exit();
+    }
+    isolate->Dispose();
+  }
+  CHECK(!decisions.empty());
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    CHECK(!isolate->SeedPretenuringDecisions(decisions.data(), 3));
+    CHECK(
+        isolate->SeedPretenuringDecisions(decisions.data(), decisions.size()));
+    CompileRunChecked(isolate, source);
+    v8::Local<v8::Value> result = CompileRunChecked(isolate, "f();");
+    Handle<JSObject> array =
+        Handle<JSObject>::cast(v8::Utils::OpenHandle(*result));
+    CHECK(reinterpret_cast<Isolate*>(isolate)->heap()->InOldSpace(*array));
+    isolate->GetCurrentContext()->Exit();
+  }
+  isolate->Dispose();
+}
+
 TEST(HeapNumberAlignment) {
   if (!v8_flags.allocation_site_pretenuring) return;
   CcTest::InitializeVM();
@@ -5836,6 +5941,129 @@ TEST(Regress598319) {
   }
 }
 
+TEST(ParallelLargeArrayMarking) {
+  if (!v8_flags.incremental_marking) return;
+  if (!v8_flags.concurrent_marking) return;
+  // No ManualGCScope, as it would turn concurrent and parallel marking off.
+  v8_flags.parallel_large_array_marking = true;
+  v8_flags.parallel_marking = true;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Heap* heap = CcTest::heap();
+  Isolate* isolate = heap->isolate();
+
+  // Spans several progress bar chunks, so that the array is split between
+  // markers.
+  const int kNumberOfObjects = 4 * FixedArray::kMaxRegularLength;
+  Handle<FixedArray> arr =
+      isolate->factory()->NewFixedArray(kNumberOfObjects, AllocationType::kOld);
+  CHECK(heap->lo_space()->Contains(*arr));
+  {
+    v8::HandleScope new_scope(CcTest::isolate());
+    for (int i = 0; i < kNumberOfObjects; i++) {
+      Handle<HeapNumber> number =
+          isolate->factory()->NewHeapNumber<AllocationType::kOld>(i);
+      arr->set(i, *number);
+    }
+  }
+  CcTest::CollectAllGarbage();
+  CHECK(heap->incremental_marking()->IsStopped());
+
+  // The main thread does not step, so the array is only visited by the
+  // concurrent markers.
+  heap::SimulateIncrementalMarking(heap, false);
+  heap->concurrent_marking()->Join();
+  CHECK_GE(heap->concurrent_marking()->TotalMarkedBytes(), arr->Size());
+
+  // Whatever is left is finished by the parallel markers in the atomic pause.
+  CcTest::CollectAllGarbage();
+  for (int i = 0; i < kNumberOfObjects; i++) {
+    CHECK_EQ(i, HeapNumber::cast(arr->get(i)).value());
+  }
+}
+
+TEST(ParallelLargeArrayMarkingSharesRemainingRange) {
+  if (!v8_flags.incremental_marking) return;
+  ManualGCScope manual_gc_scope;
+  v8_flags.parallel_large_array_marking = true;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Heap* heap = CcTest::heap();
+  Isolate* isolate = heap->isolate();
+
+  // Smis only, so that visiting the array does not mark anything else.
+  const int kNumberOfObjects = 4 * FixedArray::kMaxRegularLength;
+  Handle<FixedArray> arr =
+      isolate->factory()->NewFixedArray(kNumberOfObjects, AllocationType::kOld);
+  CHECK(heap->lo_space()->Contains(*arr));
+  for (int i = 0; i < kNumberOfObjects; i++) {
+    arr->set(i, Smi::FromInt(i));
+  }
+  heap->EnsureSweepingCompleted(Heap::SweepingForcedFinalizationMode::kV8Only);
+  MemoryChunk* chunk = MemoryChunk::FromHeapObject(*arr);
+  CHECK(chunk->ProgressBar().IsEnabled());
+  CHECK_EQ(0, chunk->ProgressBar().Value());
+
+  // Two markers on the main thread that share the global marking worklists,
+  // like concurrent marking tasks do.
+  MarkingWorklists worklists;
+  MarkingWorklists::Local owner_worklists(&worklists);
+  MarkingWorklists::Local thief_worklists(&worklists);
+  WeakObjects weak_objects;
+  WeakObjects::Local owner_weak_objects(&weak_objects);
+  WeakObjects::Local thief_weak_objects(&weak_objects);
+  MarkingState* marking_state = heap->marking_state();
+  MainMarkingVisitor<MarkingState> owner(
+      marking_state, &owner_worklists, &owner_weak_objects, heap, 0, {},
+      false, true);
+  MainMarkingVisitor<MarkingState> thief(
+      marking_state, &thief_worklists, &thief_weak_objects, heap, 0, {},
+      false, true);
+
+  CHECK(marking_state->WhiteToGrey(*arr));
+  Map map = arr->map();
+  int size = arr->Size();
+  owner.Visit(map, *arr);
+  CHECK_EQ(1u, owner.large_array_chunks_claimed_for_testing());
+
+  // The owner already shared the remaining range, so another marker can take
+  // it over while the owner is still busy.
+  CHECK(owner_worklists.IsEmpty());
+  HeapObject object;
+  CHECK(thief_worklists.Pop(&object));
+  CHECK_EQ(*arr, object);
+  thief.Visit(map, object);
+  CHECK_EQ(1u, thief.large_array_chunks_claimed_for_testing());
+
+  // Both markers keep taking turns until the whole array is scanned.
+  while (true) {
+    if (owner_worklists.Pop(&object)) {
+      owner.Visit(map, object);
+    } else if (thief_worklists.Pop(&object)) {
+      thief.Visit(map, object);
+    } else {
+      break;
+    }
+  }
+  CHECK_EQ(static_cast<size_t>(size), chunk->ProgressBar().Value());
+  const int kChunk = kMaxRegularHeapObjectSize;
+  const size_t expected_chunks =
+      (size - FixedArray::BodyDescriptor::kStartOffset + kChunk - 1) / kChunk;
+  CHECK_EQ(expected_chunks, owner.large_array_chunks_claimed_for_testing() +
+                                thief.large_array_chunks_claimed_for_testing());
+  CHECK(marking_state->IsBlack(*arr));
+  CHECK(owner_worklists.IsEmpty());
+  CHECK(thief_worklists.IsEmpty());
+
+  // Leave the heap as if no marking had happened.
+  marking_state->ClearLiveness(chunk);
+  chunk->ProgressBar().ResetIfEnabled();
+  CcTest::CollectAllGarbage();
+  for (int i = 0; i < kNumberOfObjects; i++) {
+    CHECK_EQ(Smi::FromInt(i), arr->get(i));
+  }
+}
+
 Handle<FixedArray> ShrinkArrayAndCheckSize(Heap* heap, int length) {
   // Make sure there is no garbage and the compilation cache is empty.
   for (int i = 0; i < 5; i++) {
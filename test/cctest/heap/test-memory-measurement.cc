@@ -277,6 +277,33 @@ TEST(PartiallyInitializedContext) {
   isolate->RegisterDeserializerFinished();
 }
 
+TEST(ContextMemorySampling) {
+  v8_flags.sampling_heap_profiler_suppress_randomness = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Context> other_context = v8::Context::New(isolate);
+
+  isolate->StartContextMemorySampling(1024);
+  CompileRun(
+      "var retained = [];"
+      "for (var i = 0; i < 1000; i++) retained.push(new Array(32));");
+  size_t sampled = isolate->GetSampledContextMemoryUsage(env.local());
+  CHECK_GT(sampled, 0u);
+  CHECK_EQ(0u, isolate->GetSampledContextMemoryUsage(other_context));
+
+  CompileRun("retained = null;");
+  {
+    DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+        CcTest::heap());
+    CcTest::CollectAllAvailableGarbage();
+  }
+  CHECK_LT(isolate->GetSampledContextMemoryUsage(env.local()), sampled);
+
+  isolate->StopContextMemorySampling();
+  CHECK_EQ(0u, isolate->GetSampledContextMemoryUsage(env.local()));
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
@@ -574,6 +574,32 @@ void testAllocationObserver(Isolate* i_isolate, T* space) {
   CHECK_EQ(observer2.count(), 4);
 }
 
+UNINITIALIZED_TEST(SharedPagePoolAcrossIsolates) {
+  // Semi-space pages are pooled when the new space is torn down.
+  if (COMPRESS_POINTERS_IN_ISOLATE_CAGE_BOOL || v8_flags.single_generation ||
+      v8_flags.minor_mc) {
+    return;
+  }
+  v8_flags.shared_page_pool_max_pages = 64;
+  const size_t initial_pool_size =
+      MemoryAllocator::GetSharedPagePoolSizeForTesting();
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  isolate->Dispose();
+  const size_t pool_size_after_dispose =
+      MemoryAllocator::GetSharedPagePoolSizeForTesting();
+  CHECK_GT(pool_size_after_dispose, initial_pool_size);
+
+  // A new isolate in the same cage takes its initial semi-space pages from
+  // the process-wide pool.
+  isolate = v8::Isolate::New(create_params);
+  CHECK_LT(MemoryAllocator::GetSharedPagePoolSizeForTesting(),
+           pool_size_after_dispose);
+  isolate->Dispose();
+}
+
 UNINITIALIZED_TEST(AllocationObserver) {
   if (v8_flags.single_generation) return;
   v8::Isolate::CreateParams create_params;
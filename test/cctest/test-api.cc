@@ -8714,6 +8714,80 @@ THREADED_TEST(Utf16Trailing3Byte) {
 }
 
 
+THREADED_TEST(Utf8AsciiRuns) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  // ASCII runs are copied in bulk, so place non-ASCII characters within,
+  // at the start, and at the end of every vector.
+  struct {
+    std::vector<uint16_t> utf16;
+    std::vector<uint8_t> utf8;
+  } separators[] = {
+      {{0xE9}, {0xC3, 0xA9}},
+      {{0x20AC}, {0xE2, 0x82, 0xAC}},
+      {{0xD83D, 0xDE00}, {0xF0, 0x9F, 0x98, 0x80}},
+  };
+  const int kRunLengths[] = {0, 1, 7, 8, 9, 15, 16, 17, 31, 33, 100};
+  for (const auto& separator : separators) {
+    std::vector<uint16_t> utf16;
+    std::vector<char> utf8;
+    for (int run_length : kRunLengths) {
+      for (int i = 0; i < run_length; i++) {
+        utf16.push_back('a' + i % 26);
+        utf8.push_back('a' + i % 26);
+      }
+      utf16.insert(utf16.end(), separator.utf16.begin(),
+                   separator.utf16.end());
+      utf8.insert(utf8.end(), separator.utf8.begin(), separator.utf8.end());
+    }
+    utf16.insert(utf16.end(), 20, 'z');
+    utf8.insert(utf8.end(), 20, 'z');
+    int utf8_length = static_cast<int>(utf8.size());
+    int utf16_length = static_cast<int>(utf16.size());
+
+    std::vector<v8::Local<String>> strings = {
+        v8::String::NewFromTwoByte(isolate, utf16.data(),
+                                   v8::NewStringType::kNormal, utf16_length)
+            .ToLocalChecked()};
+    if (separator.utf16[0] <= 0xFF) {
+      // Also write out a one-byte string with the same contents.
+      std::vector<uint8_t> latin1(utf16.begin(), utf16.end());
+      strings.push_back(
+          v8::String::NewFromOneByte(isolate, latin1.data(),
+                                     v8::NewStringType::kNormal, utf16_length)
+              .ToLocalChecked());
+    }
+    v8::Local<String> decoded =
+        v8::String::NewFromUtf8(isolate, utf8.data(),
+                                v8::NewStringType::kNormal, utf8_length)
+            .ToLocalChecked();
+
+    for (v8::Local<String> str : strings) {
+      CHECK(str->StrictEquals(decoded));
+      CHECK_EQ(utf8_length, str->Utf8Length(isolate));
+
+      std::vector<char> buffer(utf8_length + 1);
+      int nchars = -1;
+      CHECK_EQ(utf8_length + 1,
+               str->WriteUtf8(isolate, buffer.data(), -1, &nchars));
+      CHECK_EQ(utf16_length, nchars);
+      CHECK_EQ(0, memcmp(utf8.data(), buffer.data(), utf8_length));
+      CHECK_EQ('\0', buffer[utf8_length]);
+
+      // A buffer without space for the null terminator.
+      std::fill(buffer.begin(), buffer.end(), 'x');
+      CHECK_EQ(utf8_length,
+               str->WriteUtf8(isolate, buffer.data(), utf8_length, &nchars));
+      CHECK_EQ(utf16_length, nchars);
+      CHECK_EQ(0, memcmp(utf8.data(), buffer.data(), utf8_length));
+      CHECK_EQ('x', buffer[utf8_length]);
+    }
+  }
+}
+
+
 THREADED_TEST(ToArrayIndex) {
   LocalContext context;
   v8::Isolate* isolate = context->GetIsolate();
@@ -29053,6 +29127,83 @@ TEST(TriggerThreadSafeMetricsEvent) {
   CHECK_EQ(recorder->module_count_, 42);
 }
 
+namespace {
+
+class JitMetricsRecorder : public v8::metrics::Recorder {
+ public:
+  std::vector<v8::metrics::Deoptimization> deopts_;
+  std::vector<v8::metrics::OptimizedCompilation> compilations_;
+
+  void AddMainThreadEvent(const v8::metrics::Deoptimization& event,
+                          v8::metrics::Recorder::ContextId id) override {
+    deopts_.push_back(event);
+  }
+
+  void AddMainThreadEvent(const v8::metrics::OptimizedCompilation& event,
+                          v8::metrics::Recorder::ContextId id) override {
+    compilations_.push_back(event);
+  }
+};
+
+}  // namespace
+
+TEST(TriggerJitMetricsEvents) {
+  if (!i::v8_flags.turbofan || i::v8_flags.always_turbofan) return;
+  i::v8_flags.allow_natives_syntax = true;
+  i::v8_flags.concurrent_recompilation = false;
+  i::v8_flags.stress_concurrent_allocation = false;
+  i::v8_flags.metrics_jit_sampling_rate = 1;
+
+  LocalContext env;
+  v8::Isolate* iso = env->GetIsolate();
+  v8::HandleScope scope(iso);
+  std::shared_ptr<JitMetricsRecorder> recorder =
+      std::make_shared<JitMetricsRecorder>();
+  iso->SetMetricsRecorder(recorder);
+
+  v8::Local<v8::Script> script = v8_compile(
+      "function f(x) { return x + 1; }\n"
+      "%PrepareFunctionForOptimization(f);\n"
+      "f(1);\n"
+      "f(2);\n"
+      "%OptimizeFunctionOnNextCall(f);\n"
+      "f(3);\n"
+      "f('a');\n");
+  int script_id = script->GetUnboundScript()->GetId();
+  script->Run(env.local()).ToLocalChecked();
+
+  // Both events are delayed and reach the recorder from a task.
+  CHECK(recorder->compilations_.empty());
+  CHECK(recorder->deopts_.empty());
+  v8::base::OS::Sleep(v8::base::TimeDelta::FromMilliseconds(1100));
+  while (v8::platform::PumpMessageLoop(i::V8::GetCurrentPlatform(), iso)) {
+  }
+
+  CHECK_EQ(1, recorder->compilations_.size());
+  const v8::metrics::OptimizedCompilation& compilation =
+      recorder->compilations_[0];
+  CHECK_EQ(0, strcmp("TURBOFAN", compilation.tier));
+  CHECK(!compilation.concurrent);
+  CHECK(!compilation.osr);
+  CHECK_EQ(script_id, compilation.script_id);
+  CHECK_LE(0, compilation.function_start_position);
+  CHECK_LE(0, compilation.prepare_duration_in_us);
+  CHECK_LE(0, compilation.execute_duration_in_us);
+  CHECK_LE(0, compilation.finalize_duration_in_us);
+  CHECK_LE(0, compilation.wall_clock_duration_in_us);
+
+  // Passing a string to the Smi-specialized code is an eager deopt.
+  CHECK_EQ(1, recorder->deopts_.size());
+  const v8::metrics::Deoptimization& deopt = recorder->deopts_[0];
+  CHECK_NOT_NULL(deopt.reason);
+  CHECK(!deopt.lazy);
+  CHECK(!deopt.osr);
+  CHECK_EQ(script_id, deopt.script_id);
+  CHECK_EQ(compilation.function_start_position,
+           deopt.function_start_position);
+  CHECK_LE(0, deopt.bytecode_offset);
+}
+
 void SetupCodeLike(LocalContext* env, const char* name,
                    v8::Local<v8::FunctionTemplate> to_string,
                    bool is_code_like) {
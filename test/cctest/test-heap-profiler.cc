@@ -1180,6 +1180,91 @@ TEST(HeapSnapshotJSONSerialization) {
 }
 
 
+TEST(HeapSnapshotJSONSerializationConcurrentStrings) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  CompileRun(
+      "function A(s) { this.s = s; }\n"
+      "var a = [new A('\\u0101\\n'), new A('plain'), new A('\\u8001')];");
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+
+  // Escaping the string table on a background thread must not change the
+  // serialized output.
+  auto serialize = [snapshot](bool concurrent) {
+    i::v8_flags.heap_snapshot_concurrent_string_serialization = concurrent;
+    v8::internal::TestJSONStream stream;
+    snapshot->Serialize(&stream, v8::HeapSnapshot::kJSON);
+    CHECK_EQ(1, stream.eos_signaled());
+    std::string json(stream.size(), '\0');
+    stream.WriteTo(v8::base::Vector<char>(json.data(), json.size()));
+    return json;
+  };
+  std::string sequential = serialize(false);
+  std::string concurrent = serialize(true);
+  CHECK(!sequential.empty());
+  CHECK_EQ(sequential, concurrent);
+}
+
+namespace {
+
+uint64_t ReadVarint(const std::string& data, size_t* pos) {
+  uint64_t result = 0;
+  for (int shift = 0;; shift += 7) {
+    uint8_t byte = static_cast<uint8_t>(data[(*pos)++]);
+    result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) return result;
+  }
+}
+
+}  // namespace
+
+TEST(HeapSnapshotBinarySerialization) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  CompileRun("var a = {s: 'binary snapshot string'};");
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+
+  v8::internal::TestJSONStream binary_stream;
+  snapshot->Serialize(&binary_stream, v8::HeapSnapshot::kBinary);
+  CHECK_EQ(1, binary_stream.eos_signaled());
+  std::string binary(binary_stream.size(), '\0');
+  binary_stream.WriteTo(v8::base::Vector<char>(binary.data(), binary.size()));
+
+  v8::internal::TestJSONStream json_stream;
+  snapshot->Serialize(&json_stream, v8::HeapSnapshot::kJSON);
+  CHECK_LT(binary_stream.size(), json_stream.size());
+
+  const size_t magic_size = sizeof(i::HeapSnapshotBinarySerializer::kMagic);
+  CHECK_EQ(0, memcmp(binary.data(), i::HeapSnapshotBinarySerializer::kMagic,
+                     magic_size));
+  size_t pos = magic_size;
+  CHECK_EQ(i::HeapSnapshotBinarySerializer::kFormatVersion,
+           ReadVarint(binary, &pos));
+  uint64_t meta_length = ReadVarint(binary, &pos);
+  CHECK_EQ('{', binary[pos]);
+  CHECK_EQ('}', binary[pos + meta_length - 1]);
+  pos += meta_length;
+
+  const int kNodeFieldsCount = 7;
+  const int kNameOffset = 1;
+  const int kEdgeCountOffset = 4;
+  uint64_t node_count = ReadVarint(binary, &pos);
+  CHECK_EQ(static_cast<uint64_t>(snapshot->GetNodesCount()), node_count);
+  uint64_t total_edges = 0;
+  for (uint64_t i = 0; i < node_count; i++) {
+    for (int field = 0; field < kNodeFieldsCount; field++) {
+      uint64_t value = ReadVarint(binary, &pos);
+      if (field == kEdgeCountOffset) total_edges += value;
+      if (i == 0 && field == kNameOffset) CHECK_LT(0, value);
+    }
+  }
+  CHECK_EQ(total_edges, ReadVarint(binary, &pos));
+}
+
 TEST(HeapSnapshotJSONSerializationAborting) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
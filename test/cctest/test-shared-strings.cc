@@ -462,6 +462,92 @@ UNINITIALIZED_TEST(ConcurrentInternalizationHit) {
   TestConcurrentInternalization(kTestHit);
 }
 
+class ConcurrentMixedInternalizationThread final
+    : public ConcurrentStringThreadBase {
+ public:
+  ConcurrentMixedInternalizationThread(MultiClientIsolateTest* test,
+                                       Handle<FixedArray> shared_strings,
+                                       bool copy_first,
+                                       ParkingSemaphore* sema_ready,
+                                       ParkingSemaphore* sema_execute_start,
+                                       ParkingSemaphore* sema_execute_complete)
+      : ConcurrentStringThreadBase("ConcurrentMixedInternalizationThread",
+                                   test, shared_strings, sema_ready,
+                                   sema_execute_start, sema_execute_complete),
+        copy_first_(copy_first) {}
+
+  void Setup() override { factory = i_isolate->factory(); }
+
+  void RunForString(Handle<String> input_string, int counter) override {
+    // Internalizing a copy of the characters takes the concurrent insertion
+    // path, internalizing the shared string itself transitions it in place
+    // while holding the string table lock exclusively. Both must agree.
+    std::unique_ptr<char[]> chars = input_string->ToCString();
+    Handle<String> copy_interned;
+    Handle<String> in_place_interned;
+    if (copy_first_) {
+      copy_interned = factory->InternalizeUtf8String(chars.get());
+      in_place_interned = factory->InternalizeString(input_string);
+    } else {
+      in_place_interned = factory->InternalizeString(input_string);
+      copy_interned = factory->InternalizeUtf8String(chars.get());
+    }
+    CHECK(copy_interned->IsShared());
+    CHECK(copy_interned->IsInternalizedString());
+    CHECK_EQ(*copy_interned, *in_place_interned);
+  }
+
+ private:
+  bool copy_first_;
+  Factory* factory;
+};
+
+UNINITIALIZED_TEST(ConcurrentMixedInternalization) {
+  if (!V8_CAN_CREATE_SHARED_HEAP_BOOL) return;
+
+  v8_flags.shared_string_table = true;
+
+  constexpr int kThreads = 4;
+  constexpr int kStrings = 4096;
+
+  MultiClientIsolateTest test;
+  Isolate* i_isolate = test.i_main_isolate();
+  Factory* factory = i_isolate->factory();
+
+  HandleScope scope(i_isolate);
+
+  Handle<FixedArray> shared_strings =
+      CreateSharedOneByteStrings(i_isolate, factory, kStrings, 0);
+
+  ParkingSemaphore sema_ready(0);
+  ParkingSemaphore sema_execute_start(0);
+  ParkingSemaphore sema_execute_complete(0);
+  std::vector<std::unique_ptr<ConcurrentMixedInternalizationThread>> threads;
+  for (int i = 0; i < kThreads; i++) {
+    auto thread = std::make_unique<ConcurrentMixedInternalizationThread>(
+        &test, shared_strings, i % 2 == 0, &sema_ready, &sema_execute_start,
+        &sema_execute_complete);
+    CHECK(thread->Start());
+    threads.push_back(std::move(thread));
+  }
+
+  LocalIsolate* local_isolate = i_isolate->main_thread_local_isolate();
+  for (int i = 0; i < kThreads; i++) {
+    sema_ready.ParkedWait(local_isolate);
+  }
+  for (int i = 0; i < kThreads; i++) {
+    sema_execute_start.Signal();
+  }
+  for (int i = 0; i < kThreads; i++) {
+    sema_execute_complete.ParkedWait(local_isolate);
+  }
+
+  ParkedScope parked(local_isolate);
+  for (auto& thread : threads) {
+    thread->ParkedJoin(parked);
+  }
+}
+
 class ConcurrentStringTableLookupThread final
     : public ConcurrentStringThreadBase {
  public:
@@ -2405,6 +2491,96 @@ UNINITIALIZED_TEST(SharedObjectRetainedByClientRememberedSet) {
   thread.Join();
 }
 
+namespace {
+
+void CheckIncrementalMarkingOfClientHeaps(bool mark_client_heaps) {
+  v8_flags.stress_concurrent_allocation = false;
+  v8_flags.shared_string_table = true;
+  v8_flags.incremental_marking_client_heaps = mark_client_heaps;
+  v8_flags.incremental_marking_task = false;
+
+  MultiClientIsolateTest test;
+  IsolateParkOnDisposeWrapper isolate_wrapper(test.NewClientIsolate(),
+                                              test.main_isolate());
+  Isolate* i_isolate = test.i_main_isolate();
+  Isolate* i_client = reinterpret_cast<Isolate*>(isolate_wrapper.isolate);
+  Isolate* shared_isolate = i_isolate->shared_space_isolate();
+  CHECK_NE(i_client, shared_isolate);
+  Heap* shared_heap = shared_isolate->heap();
+
+  DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+      shared_heap);
+  ManualGCScope manual_gc_scope(i_isolate);
+
+  HandleScope scope(i_client);
+  Handle<FixedArray> old_object;
+  {
+    // The string is only reachable from the client's old object, and thus
+    // only through its OLD_TO_SHARED slot.
+    HandleScope inner_scope(i_client);
+    Handle<String> shared_string =
+        i_client->factory()->NewStringFromAsciiChecked(
+            "foo", AllocationType::kSharedOld);
+    CHECK(shared_heap->Contains(*shared_string));
+    Handle<FixedArray> array =
+        i_client->factory()->NewFixedArray(1, AllocationType::kOld);
+    CHECK(i_client->heap()->Contains(*array));
+    array->set(0, *shared_string);
+    old_object = inner_scope.CloseAndEscape(array);
+  }
+  MemoryChunk* chunk = MemoryChunk::FromHeapObject(*old_object);
+  CHECK(RememberedSet<OLD_TO_SHARED>::Contains(
+      chunk, old_object->GetFirstElementAddress().address()));
+
+  i::IncrementalMarking* marking = shared_heap->incremental_marking();
+  CHECK(marking->IsStopped());
+  {
+    IsolateSafepointScope safepoint_scope(shared_heap);
+    shared_heap->tracer()->StartCycle(
+        GarbageCollector::MARK_COMPACTOR, GarbageCollectionReason::kTesting,
+        "collector cctest", GCTracer::MarkingType::kIncremental);
+    marking->Start(GarbageCollector::MARK_COMPACTOR,
+                   i::GarbageCollectionReason::kTesting);
+  }
+  CHECK(marking->IsMajorMarking());
+  HeapObject shared_string = HeapObject::cast(old_object->get(0));
+  if (mark_client_heaps) {
+    CHECK(shared_heap->marking_state()->IsBlackOrGrey(shared_string));
+  } else {
+    // Without the flag client heaps are only visited in the atomic pause.
+    CHECK(shared_heap->marking_state()->IsWhite(shared_string));
+  }
+
+  {
+    // The client runs on the same thread and needs to be parked for the
+    // global safepoint.
+    ParkedScope parked(i_client->main_thread_local_isolate());
+    CcTest::CollectSharedGarbage(i_isolate);
+  }
+  CHECK(marking->IsStopped());
+
+  Object value = old_object->get(0);
+  CHECK(value.IsString());
+  CHECK(shared_heap->Contains(HeapObject::cast(value)));
+  CHECK(String::cast(value).IsOneByteEqualTo(base::StaticCharVector("foo")));
+}
+
+}  // namespace
+
+UNINITIALIZED_TEST(IncrementalMarkingMarksSharedObjectsFromClientHeaps) {
+  if (!V8_CAN_CREATE_SHARED_HEAP_BOOL) return;
+  if (!v8_flags.incremental_marking) return;
+
+  CheckIncrementalMarkingOfClientHeaps(true);
+}
+
+UNINITIALIZED_TEST(IncrementalMarkingLeavesClientHeapsToAtomicPause) {
+  if (!V8_CAN_CREATE_SHARED_HEAP_BOOL) return;
+  if (!v8_flags.incremental_marking) return;
+
+  CheckIncrementalMarkingOfClientHeaps(false);
+}
+
 }  // namespace test_shared_strings
 }  // namespace internal
 }  // namespace v8
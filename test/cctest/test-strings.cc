@@ -39,7 +39,9 @@
 #include "src/execution/messages.h"
 #include "src/heap/factory.h"
 #include "src/heap/heap-inl.h"
+#include "src/numbers/hash-seed-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/strings/string-hasher-inl.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
 
@@ -1861,6 +1863,41 @@ TEST(HashArrayIndexStrings) {
   }
 }
 
+TEST(HashLongStrings) {
+  CcTest::InitializeVM();
+  const uint64_t seed = HashSeed(CcTest::i_isolate());
+  // Long strings are hashed in blocks of characters. Check that the hash
+  // only depends on the character values, around the block boundaries.
+  const int kMaxLength = 3 * StringHasher::kMinBlockHashLength;
+  uint8_t one_byte[kMaxLength];
+  base::uc16 two_byte[kMaxLength];
+  for (int i = 0; i < kMaxLength; i++) {
+    one_byte[i] = static_cast<uint8_t>('a' + i % 26);
+    two_byte[i] = one_byte[i];
+  }
+  one_byte[kMaxLength - 1] = two_byte[kMaxLength - 1] = 0xFF;
+  for (int length = StringHasher::kMinBlockHashLength - 1;
+       length <= kMaxLength; length++) {
+    const uint8_t* one_byte_chars = one_byte + kMaxLength - length;
+    const base::uc16* two_byte_chars = two_byte + kMaxLength - length;
+    uint32_t hash =
+        StringHasher::HashSequentialString(one_byte_chars, length, seed);
+    CHECK(String::IsHash(hash));
+    CHECK_NE(0, String::HashBits::decode(hash));
+    CHECK_EQ(hash,
+             StringHasher::HashSequentialString(two_byte_chars, length, seed));
+    // All characters contribute, and so does the seed.
+    for (int i = 0; i < length; i += 7) {
+      uint8_t copy[kMaxLength];
+      std::copy(one_byte_chars, one_byte_chars + length, copy);
+      copy[i] ^= 1;
+      CHECK_NE(hash, StringHasher::HashSequentialString(copy, length, seed));
+    }
+    CHECK_NE(hash,
+             StringHasher::HashSequentialString(one_byte_chars, length, ~seed));
+  }
+}
+
 TEST(StringEquals) {
   v8::Isolate* isolate = CcTest::isolate();
   v8::HandleScope scope(isolate);
@@ -0,0 +1,66 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-lazy-debug-tier-down --allow-natives-syntax
+
+d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
+
+const builder = new WasmModuleBuilder();
+const callee = builder.addFunction('callee', kSig_i_i)
+    .addBody([kExprLocalGet, 0, kExprI32Const, 1, kExprI32Add])
+    .exportFunc();
+builder.addFunction('caller', kSig_i_i)
+    .addBody([kExprLocalGet, 0, kExprCallFunction, callee.index])
+    .exportFunc();
+builder.addFunction('other', kSig_i_v)
+    .addBody([kExprI32Const, 42])
+    .exportFunc();
+const instance = builder.instantiate();
+const exports = instance.exports;
+
+// Compile all functions before the debugger attaches.
+assertEquals(4, exports.caller(3));
+assertEquals(42, exports.other());
+%WasmTierUpFunction(exports.other);
+
+const Debug = new DebugWrapper();
+Debug.enable();
+
+// Existing code is kept, and nothing gets recompiled for debugging without a
+// breakpoint or stepping.
+assertFalse(%IsWasmDebugFunction(exports.caller));
+assertFalse(%IsWasmDebugFunction(exports.callee));
+assertFalse(%IsWasmDebugFunction(exports.other));
+assertEquals(4, exports.caller(3));
+assertEquals(42, exports.other());
+assertFalse(%IsWasmDebugFunction(exports.caller));
+assertFalse(%IsWasmDebugFunction(exports.other));
+
+let break_count = 0;
+let wasm_functions = [];
+Debug.setListener(function(event, exec_state, event_data, data) {
+  if (event != Debug.DebugEvent.Break) return;
+  break_count++;
+  if (event_data.functionName().startsWith('$')) {
+    wasm_functions.push(event_data.functionName());
+  }
+  exec_state.prepareStep(Debug.StepAction.StepInto);
+});
+
+function f() {
+  return exports.caller(3);  // Break here.
+}
+f();
+Debug.setBreakPoint(f, 1);
+
+// Stepping into the call from JS tiers down all functions of the module.
+assertEquals(4, f());
+Debug.setListener(null);
+assertTrue(break_count > 1);
+assertTrue(wasm_functions.includes('$caller'));
+assertTrue(wasm_functions.includes('$callee'));
+assertEquals(42, exports.other());
+assertTrue(%IsWasmDebugFunction(exports.other));
+
+Debug.disable();
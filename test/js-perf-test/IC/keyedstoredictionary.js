@@ -0,0 +1,26 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('KeyedStoreDictionary', [1000], [
+  new Benchmark('KeyedStoreDictionary', false, false, 0,
+                KeyedStoreDictionary, KeyedStoreDictionarySetup)
+]);
+
+let dictionaryKeys;
+
+function KeyedStoreDictionarySetup() {
+  dictionaryKeys = [];
+  for (let i = 0; i < 200; ++i) dictionaryKeys.push('key' + i);
+}
+
+// Objects used as dictionaries grow their property dictionary as new keys
+// are added.
+function KeyedStoreDictionary() {
+  const dictionary = {a: 1, b: 2};
+  delete dictionary.a;
+  for (let i = 0; i < dictionaryKeys.length; ++i) {
+    dictionary[dictionaryKeys[i]] = i;
+  }
+  return dictionary;
+}
@@ -5,6 +5,7 @@
 d8.file.execute('../base.js');
 
 d8.file.execute('loadconstantfromprototype.js');
+d8.file.execute('keyedstoredictionary.js');
 
 function PrintResult(name, result) {
   print(name + '-IC(Score): ' + result);
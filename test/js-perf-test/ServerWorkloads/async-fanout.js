@@ -0,0 +1,45 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Fans a request out to several simulated backends with async functions and
+// Promise.all, then merges the results.
+
+new BenchmarkSuite('AsyncFanout', [1000], [
+  new Benchmark('AsyncFanout', false, false, 0, AsyncFanout,
+                AsyncFanoutSetup, AsyncFanoutTearDown),
+]);
+
+var asyncFanoutResult;
+
+async function FetchBackend(index, key) {
+  await null;
+  return {backend: index, key: key, value: key.length * index};
+}
+
+async function HandleFanoutRequest(key) {
+  var calls = [];
+  for (var i = 0; i < 8; i++) calls.push(FetchBackend(i, key));
+  var responses = await Promise.all(calls);
+  var sum = 0;
+  for (var response of responses) sum += response.value;
+  return sum;
+}
+
+function AsyncFanoutSetup() {
+  asyncFanoutResult = 0;
+  %PerformMicrotaskCheckpoint();
+}
+
+function AsyncFanout() {
+  for (var i = 0; i < 10; i++) {
+    HandleFanoutRequest('key-' + i).then(function(sum) {
+      asyncFanoutResult = sum;
+    });
+  }
+  %PerformMicrotaskCheckpoint();
+}
+
+function AsyncFanoutTearDown() {
+  return asyncFanoutResult === 'key-9'.length * 28;
+}
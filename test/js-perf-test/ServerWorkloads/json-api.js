@@ -0,0 +1,63 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Parses a JSON request, validates and transforms it, and serializes a JSON
+// response, as a typical REST handler does.
+
+new BenchmarkSuite('JsonApi', [1000], [
+  new Benchmark('JsonApi', false, false, 0, JsonApi, JsonApiSetup,
+                JsonApiTearDown),
+]);
+
+var jsonApiRequests;
+var jsonApiResult;
+
+function JsonApiSetup() {
+  jsonApiRequests = [];
+  for (var i = 0; i < 16; i++) {
+    var items = [];
+    for (var j = 0; j < 20; j++) {
+      items.push({
+        sku: 'SKU-' + i + '-' + j,
+        quantity: (i + j) % 7 + 1,
+        price: 9.99 + j,
+        tags: ['tag' + (j % 3), 'tag' + (j % 5)],
+      });
+    }
+    jsonApiRequests.push(JSON.stringify({
+      requestId: 'req-' + i,
+      user: {id: i, name: 'user' + i, locale: i % 2 ? 'en-US' : 'de-DE'},
+      items: items,
+      coupon: i % 4 == 0 ? 'SAVE10' : null,
+    }));
+  }
+}
+
+function HandleJsonRequest(body) {
+  var request = JSON.parse(body);
+  var total = 0;
+  var lines = request.items.map(function(item) {
+    var amount = item.quantity * item.price;
+    total += amount;
+    return {sku: item.sku, amount: Math.round(amount * 100) / 100};
+  });
+  if (request.coupon === 'SAVE10') total *= 0.9;
+  return JSON.stringify({
+    requestId: request.requestId,
+    userId: request.user.id,
+    lines: lines,
+    total: Math.round(total * 100) / 100,
+  });
+}
+
+function JsonApi() {
+  for (var i = 0; i < jsonApiRequests.length; i++) {
+    jsonApiResult = HandleJsonRequest(jsonApiRequests[i]);
+  }
+}
+
+function JsonApiTearDown() {
+  var response = JSON.parse(jsonApiResult);
+  return response.requestId === 'req-15' && response.lines.length === 20;
+}
@@ -0,0 +1,65 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A Map-based LRU cache that relies on Map's insertion order, as commonly
+// used for server-side response and session caches.
+
+new BenchmarkSuite('LruCache', [1000], [
+  new Benchmark('LruCache', false, false, 0, LruCache, LruCacheSetup,
+                LruCacheTearDown),
+]);
+
+class LRU {
+  constructor(capacity) {
+    this.capacity = capacity;
+    this.map = new Map();
+  }
+
+  get(key) {
+    var value = this.map.get(key);
+    if (value === undefined) return undefined;
+    this.map.delete(key);
+    this.map.set(key, value);
+    return value;
+  }
+
+  set(key, value) {
+    if (this.map.has(key)) {
+      this.map.delete(key);
+    } else if (this.map.size >= this.capacity) {
+      this.map.delete(this.map.keys().next().value);
+    }
+    this.map.set(key, value);
+  }
+}
+
+var lruCache;
+var lruCacheKeys;
+var lruCacheHits;
+
+function LruCacheSetup() {
+  lruCache = new LRU(256);
+  lruCacheKeys = [];
+  // A skewed key distribution: a hot set that mostly hits and a long tail
+  // that keeps evicting.
+  for (var i = 0; i < 1000; i++) {
+    lruCacheKeys.push('/api/item/' + (i % 5 == 0 ? i : i % 128));
+  }
+  lruCacheHits = 0;
+}
+
+function LruCache() {
+  for (var i = 0; i < lruCacheKeys.length; i++) {
+    var key = lruCacheKeys[i];
+    if (lruCache.get(key) !== undefined) {
+      lruCacheHits++;
+    } else {
+      lruCache.set(key, {key: key, body: 'payload ' + i});
+    }
+  }
+}
+
+function LruCacheTearDown() {
+  return lruCacheHits > 0 && lruCache.map.size <= 256;
+}
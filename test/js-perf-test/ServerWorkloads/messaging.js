@@ -0,0 +1,42 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Round-trips structured messages through the ValueSerializer, which backs
+// postMessage and structuredClone in embedders.
+
+new BenchmarkSuite('Messaging', [1000], [
+  new Benchmark('Messaging', false, false, 0, Messaging, MessagingSetup,
+                MessagingTearDown),
+]);
+
+var messagingMessage;
+var messagingResult;
+
+function MessagingSetup() {
+  var entries = [];
+  for (var i = 0; i < 32; i++) {
+    entries.push({
+      id: i,
+      name: 'entry' + i,
+      createdAt: new Date(1700000000000 + i),
+      scores: [i, i * 2, i * 3],
+    });
+  }
+  messagingMessage = {
+    type: 'update',
+    entries: entries,
+    index: new Map(entries.map(function(e) { return [e.name, e.id]; })),
+    payload: new Uint8Array(256),
+  };
+}
+
+function Messaging() {
+  var data = d8.serializer.serialize(messagingMessage);
+  messagingResult = d8.serializer.deserialize(data);
+}
+
+function MessagingTearDown() {
+  return messagingResult.entries.length === 32 &&
+      messagingResult.index.get('entry31') === 31;
+}
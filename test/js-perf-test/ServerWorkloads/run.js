@@ -0,0 +1,30 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+
+d8.file.execute('../base.js');
+d8.file.execute('json-api.js');
+d8.file.execute('templating.js');
+d8.file.execute('async-fanout.js');
+d8.file.execute('lru-cache.js');
+d8.file.execute('messaging.js');
+
+var success = true;
+
+function PrintResult(name, result) {
+  print(name + '-ServerWorkloads(Score): ' + result);
+}
+
+
+function PrintError(name, error) {
+  PrintResult(name, error);
+  success = false;
+}
+
+
+BenchmarkSuite.config.doWarmup = undefined;
+BenchmarkSuite.config.doDeterministic = undefined;
+
+BenchmarkSuite.RunSuites({ NotifyResult: PrintResult,
+                           NotifyError: PrintError });
@@ -0,0 +1,55 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Renders an HTML page from a data model with template literals, escaping
+// and string concatenation, as server-side rendering does.
+
+new BenchmarkSuite('Templating', [1000], [
+  new Benchmark('Templating', false, false, 0, Templating, TemplatingSetup,
+                TemplatingTearDown),
+]);
+
+var templatingModel;
+var templatingResult;
+
+function TemplatingSetup() {
+  var rows = [];
+  for (var i = 0; i < 50; i++) {
+    rows.push({
+      id: i,
+      title: 'Item <' + i + '> & "friends"',
+      price: (i * 1.25).toFixed(2),
+      inStock: i % 3 != 0,
+    });
+  }
+  templatingModel = {title: 'Catalog', user: 'alice', rows: rows};
+}
+
+var kHtmlEscapes = {'&': '&amp;', '<': '&lt;', '>': '&gt;', '"': '&quot;'};
+
+function EscapeHtml(value) {
+  return String(value).replace(/[&<>"]/g, function(c) {
+    return kHtmlEscapes[c];
+  });
+}
+
+function RenderRow(row) {
+  return `<tr data-id="${row.id}"><td>${EscapeHtml(row.title)}</td>` +
+      `<td>${row.price}</td>` +
+      `<td>${row.inStock ? 'yes' : 'no'}</td></tr>`;
+}
+
+function RenderPage(model) {
+  return `<html><head><title>${EscapeHtml(model.title)}</title></head>` +
+      `<body><h1>Hello, ${EscapeHtml(model.user)}</h1><table>` +
+      model.rows.map(RenderRow).join('') + '</table></body></html>';
+}
+
+function Templating() {
+  templatingResult = RenderPage(templatingModel);
+}
+
+function TemplatingTearDown() {
+  return templatingResult.indexOf('&lt;49&gt;') > 0;
+}
@@ -0,0 +1,32 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Arrays that go from dictionary to fast elements copy their entries over,
+// keeping the holes between them. Filling an array backwards makes it sparse
+// enough to start out with dictionary elements.
+
+function test(value, hasKind) {
+  const length = 2000;
+  const a = [];
+  const expected = [];
+  for (let i = length - 1; i >= 0; i--) {
+    if (i % 3 == 2) continue;
+    a[i] = value(i);
+    expected[i] = value(i);
+    if (i == length - 1) assertTrue(%HasDictionaryElements(a));
+  }
+  assertFalse(%HasDictionaryElements(a));
+  assertTrue(hasKind(a));
+  assertEquals(length, a.length);
+  for (let i = 0; i < length; i++) {
+    assertEquals(i in expected, i in a, `${i}`);
+    assertEquals(expected[i], a[i], `${i}`);
+  }
+}
+
+test(i => i, a => %HasSmiElements(a));
+test(i => i + 0.5, a => %HasDoubleElements(a));
+test(i => ({i}), a => %HasObjectElements(a));
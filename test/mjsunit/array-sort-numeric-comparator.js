@@ -0,0 +1,52 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Array.prototype.sort compares Numbers directly for the comparators
+// (a, b) => a - b and (a, b) => b - a. Check that the results match those of
+// equivalent comparators that are actually called.
+
+const ascending = (a, b) => a - b;
+const descending = function(a, b) { return b - a; };
+const referenceAscending = (a, b) => a - b + 0;
+const referenceDescending = (a, b) => b - a + 0;
+
+let valueOfCalls = 0;
+function Boxed(value) { this.value = value; }
+Boxed.prototype.valueOf = function() { valueOfCalls++; return this.value; };
+
+const inputs = [];
+const smis = [];
+const doubles = [];
+for (let i = 0; i < 100; i++) {
+  smis.push((i * 7919) % 101 - 50);
+  doubles.push(((i * 7919) % 101) / 7 - 5);
+}
+inputs.push(smis, doubles);
+inputs.push(smis.concat(doubles, [NaN, -0, 0, Infinity, -Infinity, NaN]));
+inputs.push(smis.concat(['7', '-3', '1e2', 'abc']));
+inputs.push(smis.concat([undefined, , , undefined]));
+inputs.push(doubles.map(x => new Boxed(x)).concat(smis));
+
+for (const input of inputs) {
+  for (const [cmp, reference] of [[ascending, referenceAscending],
+                                  [descending, referenceDescending]]) {
+    const expected = input.slice().sort(reference);
+    assertEquals(expected, input.slice().sort(cmp));
+    assertEquals(Array.from(expected), input.toSorted(cmp));
+  }
+}
+// Non-Number elements still go through the comparator.
+assertTrue(valueOfCalls > 0);
+
+// Equal elements keep their order.
+const pairs = [];
+for (let i = 0; i < 50; i++) pairs.push(i % 3 == 0 ? -0 : 0);
+const sorted = pairs.slice().sort(ascending);
+for (let i = 0; i < 50; i++) assertEquals(pairs[i], sorted[i]);
+assertEquals([1, 2, 3, 10, 20, 100],
+             [100, 20, 10, 3, 2, 1].sort((a, b) => a - b));
+
+// Other comparators are unaffected.
+const other = (a, b) => a * b - b * a + (b - a);
+assertEquals(smis.slice().sort(referenceDescending), smis.slice().sort(other));
@@ -0,0 +1,23 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-escape
+
+// The function context holding {offset} is only used by the inlined
+// callback, including its function entry stack check. It must still be
+// materialized correctly when the optimized code deoptimizes.
+function sum(array, offset) {
+  let total = 0;
+  array.forEach(el => { total += el + offset; });
+  return total;
+}
+
+%PrepareFunctionForOptimization(sum);
+assertEquals(9, sum([1, 2, 3], 1));
+assertEquals(9, sum([1, 2, 3], 1));
+%OptimizeFunctionOnNextCall(sum);
+assertEquals(9, sum([1, 2, 3], 1));
+assertOptimized(sum);
+// A non-number element deoptimizes inside the inlined callback.
+assertEquals("2a1", sum([1, "a"], 1));
@@ -333,3 +333,49 @@ for (let i = 0; i < 100; i++) {
   }
   assertThrows(() => invalid_value());
 })();
+
+// ----------- add_all_float64_array -----------
+// `add_all_float64_array` takes a `FastApiTypedArray<double>` that is declared
+// with kAllowJSArrayBit, so it also accepts packed double arrays in place.
+
+// Float64Array still hits the fast path.
+(function () {
+  function float64_array_test() {
+    return fast_c_api.add_all_float64_array(false /* should_fallback */,
+      new Float64Array([1.1, 2.2, 3.3]));
+  }
+  if (fast_c_api.supports_fp_params) {
+    ExpectFastCall(float64_array_test, 6.6);
+  } else {
+    ExpectSlowCall(float64_array_test, 6.6);
+  }
+})();
+
+// Packed double array hits the fast path.
+(function () {
+  function packed_double_test() {
+    return fast_c_api.add_all_float64_array(false /* should_fallback */,
+      [1.1, 2.2, 3.3]);
+  }
+  if (fast_c_api.supports_fp_params) {
+    ExpectFastCall(packed_double_test, 6.6);
+  } else {
+    ExpectSlowCall(packed_double_test, 6.6);
+  }
+})();
+
+// Holey and Smi arrays take the slow path.
+(function () {
+  function holey_double_test() {
+    const arr = [1.1, , 3.3];
+    arr[1] = 2.2;
+    return fast_c_api.add_all_float64_array(false /* should_fallback */, arr);
+  }
+  ExpectSlowCall(holey_double_test, 6.6);
+
+  function smi_test() {
+    return fast_c_api.add_all_float64_array(false /* should_fallback */,
+      [1, 2, 3]);
+  }
+  ExpectSlowCall(smi_test, 6);
+})();
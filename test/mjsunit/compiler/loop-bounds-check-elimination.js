@@ -0,0 +1,50 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-loop-bounds-check-elimination
+
+(function TestStrictBound() {
+  function sum(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; i++) s += a[i];
+    return s;
+  }
+
+  const a = new Float64Array([1, 2, 3, 4]);
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(10, sum(a));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(10, sum(a));
+  assertEquals(3, sum(new Float64Array([1, 2])));
+})();
+
+(function TestNonStrictBound() {
+  // The last iteration is out of bounds, so the check has to stay.
+  function sum(a) {
+    let s = 0;
+    for (let i = 0; i <= a.length; i++) s += a[i];
+    return s;
+  }
+
+  const a = new Int32Array([1, 2, 3]);
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(NaN, sum(a));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(NaN, sum(a));
+})();
+
+(function TestNegativeStart() {
+  function sum(a, start) {
+    let s = 0;
+    for (let i = start; i < a.length; i++) s += a[i];
+    return s;
+  }
+
+  const a = new Int32Array([1, 2, 3]);
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(6, sum(a, 0));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(6, sum(a, 0));
+  assertEquals(NaN, sum(a, -1));
+})();
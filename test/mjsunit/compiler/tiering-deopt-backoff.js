@@ -0,0 +1,34 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --no-always-turbofan --no-maglev
+// Flags: --no-concurrent-recompilation --tiering-deopt-backoff
+// Flags: --max-tiering-deopt-backoff=16 --ticks-before-optimization=100000
+
+// Every branch loads a property it has no feedback for, so taking it for the
+// first time in optimized code is an eager deopt that throws the code away.
+const kDeopts = 16;
+const branches = [];
+for (let i = 0; i < kDeopts; i++) {
+  branches.push(`if (i === ${i}) return o.p${i};`);
+}
+const f = new Function('i', 'o', branches.join('\n') + '\nreturn -1;');
+const o = {};
+for (let i = 0; i < kDeopts; i++) o['p' + i] = i;
+
+for (let i = 0; i < kDeopts; i++) {
+  %PrepareFunctionForOptimization(f);
+  assertEquals(-1, f(-1, o));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(-1, f(-1, o));
+  assertOptimized(f);
+  assertEquals(i, f(i, o));
+  assertUnoptimized(f);
+}
+
+// After 16 deopts the ticks required for optimization are shifted by 16,
+// which does not fit in an int. They must saturate instead of wrapping around
+// to a negative number that lets the function tier up immediately.
+for (let i = 0; i < 100000; i++) f(-1, o);
+assertUnoptimized(f);
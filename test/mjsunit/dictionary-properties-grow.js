@@ -0,0 +1,64 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Adding properties to dictionary mode objects grows their property
+// dictionary in the store ICs. Growing keeps insertion order, deleted
+// entries and the identity hash of the object.
+
+function makeDictionary() {
+  const o = {a: 1, b: 2};
+  delete o.a;
+  delete o.b;
+  assertFalse(%HasFastProperties(o));
+  return o;
+}
+
+function keyedStore(o, key, value) {
+  o[key] = value;
+}
+
+function namedStore(o, value) {
+  o.named = value;
+}
+
+(function TestKeyedAdditions() {
+  const o = makeDictionary();
+  const map = new WeakMap([[o, 'hash']]);
+  const keys = [];
+  const symbol = Symbol('symbol');
+  for (let i = 0; i < 600; i++) {
+    const key = 'key' + i;
+    keyedStore(o, key, i);
+    keys.push(key);
+    if (i % 7 == 0) {
+      delete o['key' + (i >> 1)];
+      keys.splice(keys.indexOf('key' + (i >> 1)), 1);
+    }
+    if (i == 100) keyedStore(o, symbol, 'symbol');
+  }
+  assertFalse(%HasFastProperties(o));
+  assertEquals(keys, Object.keys(o));
+  for (const key of keys) assertEquals(+key.substring(3), o[key]);
+  assertEquals('symbol', o[symbol]);
+  assertEquals([symbol], Object.getOwnPropertySymbols(o));
+  assertEquals('hash', map.get(o));
+})();
+
+(function TestNamedAdditions() {
+  const objects = [];
+  for (let i = 0; i < 50; i++) {
+    const o = makeDictionary();
+    for (let j = 0; j < i; j++) o['key' + j] = j;
+    namedStore(o, i);
+    objects.push(o);
+  }
+  for (let i = 0; i < objects.length; i++) {
+    const o = objects[i];
+    assertEquals(i, o.named);
+    assertEquals(i + 1, Object.keys(o).length);
+    assertEquals('named', Object.keys(o)[i]);
+  }
+})();
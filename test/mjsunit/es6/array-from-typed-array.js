@@ -0,0 +1,86 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+const kCtors = [
+  Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array,
+  Int32Array, Uint32Array, Float32Array, Float64Array
+];
+
+(function TestValues() {
+  for (const ctor of kCtors) {
+    const ta = new ctor([0, 1, 2, 127, 255]);
+    const result = Array.from(ta);
+    assertEquals(Array.prototype.slice.call(ta), result);
+    assertEquals(Array.prototype, Object.getPrototypeOf(result));
+  }
+  assertEquals([], Array.from(new Int32Array(0)));
+})();
+
+(function TestElementsKinds() {
+  const smis = Array.from(new Int32Array([1, 2, 3]));
+  assertTrue(%HasSmiElements(smis));
+  assertEquals([1, 2, 3], smis);
+
+  const doubles = Array.from(new Float64Array([1.5, NaN, -0, 3]));
+  assertTrue(%HasDoubleElements(doubles));
+  assertEquals(1.5, doubles[0]);
+  assertTrue(Number.isNaN(doubles[1]));
+  assertEquals(-Infinity, 1 / doubles[2]);
+  assertEquals(3, doubles[3]);
+
+  const large = Array.from(new Uint32Array([0xffffffff, 1]));
+  assertEquals([0xffffffff, 1], large);
+})();
+
+(function TestBigInt() {
+  assertEquals([1n, -2n], Array.from(new BigInt64Array([1n, -2n])));
+  assertEquals([3n], Array.from(new BigUint64Array([3n])));
+})();
+
+(function TestDetached() {
+  const ta = new Uint8Array(4);
+  %ArrayBufferDetach(ta.buffer);
+  assertThrows(() => Array.from(ta), TypeError);
+})();
+
+(function TestOwnIterator() {
+  const ta = new Int8Array([1, 2, 3]);
+  ta[Symbol.iterator] = function*() { yield 42; };
+  assertEquals([42], Array.from(ta));
+})();
+
+(function TestSubclass() {
+  class MyArray extends Array {}
+  const result = MyArray.from(new Int16Array([4, 5]));
+  assertInstanceof(result, MyArray);
+  assertEquals([4, 5], Array.from(result));
+})();
+
+(function TestHoleNaNBitPattern() {
+  // The bit pattern V8 uses for holes in double arrays must not turn into a
+  // hole in the resulting packed array.
+  const ta = new Float64Array(2);
+  const bits = new Uint32Array(ta.buffer);
+  bits[0] = 0xfff7ffff;
+  bits[1] = 0xfff7ffff;
+  ta[1] = 2.5;
+  const result = Array.from(ta);
+  assertTrue(%HasDoubleElements(result));
+  assertEquals(2, result.length);
+  assertTrue(0 in result);
+  assertTrue(Number.isNaN(result[0]));
+  assertEquals(2.5, result[1]);
+  assertEquals([0, 1], Object.keys(result).map(Number));
+})();
+
+(function TestModifiedNext() {
+  const ArrayIteratorPrototype =
+      Object.getPrototypeOf([][Symbol.iterator]());
+  ArrayIteratorPrototype.next = function() {
+    return {done: true};
+  };
+  assertEquals([], Array.from(new Float32Array([1, 2])));
+})();
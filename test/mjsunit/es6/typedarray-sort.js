@@ -149,3 +149,36 @@ for (let constructor of constructorsWithArrays) {
   assertArrayLikeEquals(array, constructor.array.reverse(), constructor.ctor);
   assertEquals(array.length, constructor.array.length);
 }
+
+// The default order of NaN and -0, as a compare function.
+function defaultOrder(a, b) {
+  if (a < b) return -1;
+  if (b < a) return 1;
+  if (a !== a) return b !== b ? 0 : 1;
+  if (b !== b) return -1;
+  return Object.is(b, -0) - Object.is(a, -0);
+}
+
+// Long arrays, which are sorted by counting for 8- and 16-bit elements, and
+// with the NaNs and -0s set aside for floats.
+for (let constructor of typedArrayConstructors) {
+  for (let length of [100, 4095, 4096, 5000]) {
+    for (let shared of [false, true]) {
+      const bytes = length * constructor.BYTES_PER_ELEMENT;
+      const buffer = shared ? new SharedArrayBuffer(bytes)
+                            : new ArrayBuffer(bytes);
+      const array = new constructor(buffer);
+      for (let i = 0; i < length; ++i) {
+        const choice = (i * 7919) % 13;
+        array[i] = choice == 0 ? NaN :
+                   choice == 1 ? -0 :
+                   choice == 2 ? 0 :
+                   choice == 3 ? -Infinity :
+                   (i * 104729) % 70001 - 35000 + (choice - 9) / 4;
+      }
+      const expected = Array.from(array).sort(defaultOrder);
+      array.sort();
+      assertArrayLikeEquals(array, expected, constructor);
+    }
+  }
+}
@@ -0,0 +1,57 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Awaiting primitives and fulfilled native promises resumes without a
+// wrapper promise. The order of microtasks must stay the same.
+(function TestOrder() {
+  const log = [];
+  async function awaitValue(name, value) {
+    log.push(name + ':' + (await value));
+  }
+  const fulfilled = Promise.resolve('fulfilled');
+  const rejected = Promise.reject('rejected');
+  const thenable = {then(resolve) { resolve('thenable'); }};
+  class SubPromise extends Promise {}
+  const sub = SubPromise.resolve('sub');
+
+  awaitValue('thenable', thenable);
+  awaitValue('smi', 1);
+  awaitValue('string', 'str');
+  awaitValue('object', {toString() { return 'obj'; }});
+  awaitValue('sub', sub);
+  awaitValue('fulfilled', fulfilled);
+  awaitValue('rejected', rejected).catch(e => log.push('caught:' + e));
+  Promise.resolve().then(() => log.push('tick'));
+  awaitValue('undefined', undefined);
+  %PerformMicrotaskCheckpoint();
+
+  assertEquals([
+    'smi:1', 'string:str', 'object:obj', 'fulfilled:fulfilled', 'tick',
+    'undefined:undefined', 'thenable:thenable', 'caught:rejected', 'sub:sub'
+  ], log);
+})();
+
+(function TestPendingPromise() {
+  let resolve;
+  const pending = new Promise(r => resolve = r);
+  let result;
+  (async () => { result = await pending; })();
+  %PerformMicrotaskCheckpoint();
+  assertEquals(undefined, result);
+  resolve(42);
+  %PerformMicrotaskCheckpoint();
+  assertEquals(42, result);
+})();
+
+(function TestLoop() {
+  let sum = 0;
+  (async () => {
+    for (let i = 0; i < 100; i++) sum += await i;
+    for (let i = 0; i < 100; i++) sum += await Promise.resolve(i);
+  })();
+  %PerformMicrotaskCheckpoint();
+  assertEquals(2 * 4950, sum);
+})();
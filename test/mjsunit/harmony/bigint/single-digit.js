@@ -0,0 +1,41 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Multiplication, division and modulus of single-digit BigInts are computed
+// inline. Compare them with the same operations on shifted, multi-digit
+// operands, around the digit and half-digit boundaries.
+
+const kShift = 128n;
+const magnitudes = [1n, 2n, 3n, 7n, 0xFFFFn, 0x10000n];
+for (const bits of [31n, 32n, 33n, 52n, 62n, 63n, 64n]) {
+  const power = 2n ** bits;
+  magnitudes.push(power - 1n, power, power + 1n);
+}
+
+const values = [];
+for (const magnitude of magnitudes) values.push(magnitude, -magnitude);
+
+for (const x of values) {
+  for (const y of values) {
+    const shifted_x = x << kShift;
+    const shifted_y = y << kShift;
+    assertEquals((shifted_x * y) >> kShift, x * y, `${x} * ${y}`);
+    assertEquals(shifted_x / shifted_y, x / y, `${x} / ${y}`);
+    assertEquals((shifted_x % shifted_y) >> kShift, x % y, `${x} % ${y}`);
+  }
+  assertEquals(0n, 0n * x);
+  assertEquals(0n, x * 0n);
+  assertEquals(0n, 0n / x);
+  assertEquals(0n, 0n % x);
+  assertThrows(() => x / 0n, RangeError);
+  assertThrows(() => x % 0n, RangeError);
+}
+
+// Zero results are never negative.
+assertEquals('0', (-1n / 2n).toString());
+assertEquals('0', (-4n % 2n).toString());
+assertEquals(0n, -3n % 3n);
+assertEquals(-1n, -7n % 3n);
+assertEquals(-2n, -7n / 3n);
+assertEquals(2n ** 64n - 2n ** 33n + 1n, (2n ** 32n - 1n) ** 2n);
@@ -0,0 +1,61 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-sparkplug --no-maglev --no-turbofan
+
+// Comparisons followed by JumpIfTrue or JumpIfFalse take the jump inside the
+// comparison's handler. Check both outcomes of every such comparison.
+
+function compare(a, b) {
+  let result = '';
+  if (a == b) result += 'eq,'; else result += 'ne,';
+  if (a === b) result += 'seq,'; else result += 'sne,';
+  if (a < b) result += 'lt,'; else result += 'nlt,';
+  if (a > b) result += 'gt,'; else result += 'ngt,';
+  if (a <= b) result += 'le,'; else result += 'nle,';
+  if (a >= b) result += 'ge'; else result += 'nge';
+  return result;
+}
+
+assertEquals('ne,sne,lt,ngt,le,nge', compare(1, 2));
+assertEquals('eq,seq,nlt,ngt,le,ge', compare(2, 2));
+assertEquals('ne,sne,nlt,gt,nle,ge', compare(3, 2));
+assertEquals('eq,sne,nlt,ngt,le,ge', compare('2', 2));
+assertEquals('ne,sne,nlt,ngt,nle,nge', compare(NaN, NaN));
+
+function literals(x) {
+  let result = '';
+  if (x === null) result += 'null,'; else result += 'not-null,';
+  if (x === undefined) result += 'undefined,'; else result += 'defined,';
+  if (x == null) result += 'nullish,'; else result += 'not-nullish,';
+  if (typeof x === 'number') result += 'number'; else result += 'other';
+  return result;
+}
+
+assertEquals('null,defined,nullish,other', literals(null));
+assertEquals('not-null,undefined,nullish,other', literals(undefined));
+assertEquals('not-null,defined,not-nullish,number', literals(0));
+assertEquals('not-null,defined,not-nullish,other', literals('0'));
+
+function countDown(n) {
+  let steps = 0;
+  while (n > 0) {
+    n--;
+    steps++;
+  }
+  return steps;
+}
+
+assertEquals(0, countDown(0));
+assertEquals(10, countDown(10));
+
+// The result of the comparison is still visible when it is not followed by a
+// jump.
+function materialize(a, b) {
+  const lt = a < b;
+  return [lt, a === b];
+}
+
+assertEquals([true, false], materialize(1, 2));
+assertEquals([false, true], materialize(2, 2));
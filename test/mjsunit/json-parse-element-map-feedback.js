@@ -0,0 +1,59 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc
+
+// The first object in an array uses the map of the last object built as an
+// array element, possibly by an earlier JSON.parse call, as a shape
+// prediction. Check that mispredictions still produce the right objects.
+
+const first = JSON.parse('[{"a":1,"b":"x"},{"a":2,"b":"y"}]');
+const second = JSON.parse('[{"a":3,"b":"z"}]');
+assertTrue(%HaveSameMap(first[0], second[0]));
+assertTrue(%HaveSameMap(first[1], second[0]));
+assertEquals({a: 3, b: 'z'}, second[0]);
+
+const payloads = [
+  '[{"a":1,"b":"x"}]',
+  // Same keys, different representations.
+  '[{"a":1.5,"b":"x"}]',
+  '[{"a":"s","b":{}}]',
+  '[{"a":null,"b":2}]',
+  // Fewer, more and reordered keys.
+  '[{"a":1}]',
+  '[{"a":1,"b":"x","c":true}]',
+  '[{"b":"x","a":1}]',
+  '[{"x":1,"y":2}]',
+  // Elements and nested arrays.
+  '[{"0":1,"a":2,"b":3}]',
+  '[{"a":[{"a":1,"b":2}],"b":[{"c":3}]}]',
+  '[{}]',
+  '[1,{"a":1,"b":"x"}]',
+  // Objects that aren't array elements don't use the prediction.
+  '{"a":1,"b":"x"}',
+];
+
+for (let round = 0; round < 3; round++) {
+  for (const payload of payloads) {
+    const value = JSON.parse(payload);
+    assertEquals(payload, JSON.stringify(value));
+    %HeapObjectVerify(value);
+  }
+}
+
+// Deprecated maps are updated before they are used.
+const before = JSON.parse('[{"p":1,"q":2}]')[0];
+const transitioned = JSON.parse('[{"p":1,"q":2}]')[0];
+transitioned.p = 1.5;
+const after = JSON.parse('[{"p":1,"q":2}]')[0];
+assertEquals({p: 1, q: 2}, after);
+assertEquals({p: 1, q: 2}, before);
+assertTrue(%HaveSameMap(transitioned, after));
+
+// The cached map is only held weakly. Parsing keeps working once the map of
+// an unreachable object has been collected.
+JSON.parse('[{"only_used_once":1}]');
+gc();
+gc();
+assertEquals([{a: 1, b: 'x'}], JSON.parse('[{"a":1,"b":"x"}]'));
@@ -0,0 +1,34 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// One-byte JSON strings are scanned for quotes, backslashes and control
+// characters 16 characters at a time where supported. Check strings with
+// those at every position within and across vectors.
+
+for (const filler of ['a', '\xe9']) {
+  for (const length of [0, 1, 15, 16, 17, 31, 32, 33, 70]) {
+    const base = filler.repeat(length);
+    assertEquals(base, JSON.parse(`"${base}"`));
+    assertEquals([base, base], JSON.parse(`["${base}","${base}"]`));
+    for (let pos = 0; pos <= length; pos++) {
+      const before = base.substring(0, pos);
+      const after = base.substring(pos);
+      assertEquals(before + '"' + after,
+                   JSON.parse(`"${before}\\"${after}"`));
+      assertEquals(before + '\\' + after,
+                   JSON.parse(`"${before}\\\\${after}"`));
+      assertEquals(before + '\nሴ' + after,
+                   JSON.parse(`"${before}\\n\\u1234${after}"`));
+      assertEquals({[before]: after}, JSON.parse(`{"${before}":"${after}"}`));
+      for (const control of ['\x00', '\x1f', '\n']) {
+        assertThrows(() => JSON.parse(`"${before}${control}${after}"`),
+                     SyntaxError);
+      }
+      assertThrows(() => JSON.parse(`"${before}`), SyntaxError);
+    }
+    // Characters just above the control character range are fine.
+    assertEquals(' !' + base + '\x7f\x80',
+                 JSON.parse(`" !${base}\x7f\x80"`));
+  }
+}
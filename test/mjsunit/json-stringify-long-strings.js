@@ -0,0 +1,49 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Runs of characters that don't need escaping are copied in bulk, found 16
+// bytes at a time where supported. Check escapes and surrogates at every
+// position within and across vectors, in one-byte and two-byte strings.
+
+function naiveQuote(string) {
+  let result = '"';
+  for (let i = 0; i < string.length; i++) {
+    const c = string.charCodeAt(i);
+    if (c == 0x22) {
+      result += '\\"';
+    } else if (c == 0x5c) {
+      result += '\\\\';
+    } else if (c < 0x20) {
+      const short = {8: 'b', 9: 't', 10: 'n', 12: 'f', 13: 'r'}[c];
+      result += short ? '\\' + short :
+                        '\\u' + c.toString(16).padStart(4, '0');
+    } else if (c >= 0xd800 && c <= 0xdbff && i + 1 < string.length &&
+               string.charCodeAt(i + 1) >= 0xdc00 &&
+               string.charCodeAt(i + 1) <= 0xdfff) {
+      result += string[i] + string[i + 1];
+      i++;
+    } else if (c >= 0xd800 && c <= 0xdfff) {
+      result += '\\u' + c.toString(16);
+    } else {
+      result += string[i];
+    }
+  }
+  return result + '"';
+}
+
+const inserts = ['"', '\\', '\n', '\x00', '\x1f', ' ', '\x7f', '\xff',
+                 '😀', '\ud83d', '\ude00', 'ሴ'];
+
+for (const filler of ['a', '\xe9', 'ሴ']) {
+  for (const length of [0, 1, 7, 8, 9, 15, 16, 17, 31, 32, 33, 70]) {
+    const base = filler.repeat(length);
+    for (let pos = 0; pos <= length; pos++) {
+      for (const insert of inserts) {
+        const string = base.substring(0, pos) + insert + base.substring(pos);
+        assertEquals(naiveQuote(string), JSON.stringify(string));
+        assertEquals(`[${naiveQuote(string)}]`, JSON.stringify([string]));
+      }
+    }
+  }
+}
@@ -0,0 +1,40 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Comment bodies are skipped several characters at a time. Check that every
+// terminator is found at every position within a run.
+
+const filler = 'abcdefghijklmnopqrstuvwxyz0123456789 ';
+
+function padded(n) {
+  return filler.repeat(3).substring(0, n);
+}
+
+for (let i = 0; i < 40; i++) {
+  const pad = padded(i);
+
+  // Single-line comments end at any line terminator.
+  for (const terminator of ['\n', '\r', '\r\n', '\u2028', '\u2029']) {
+    assertEquals(i, eval(`//${pad}${terminator}${i}`));
+  }
+  // Other non-ASCII characters don't end the comment.
+  assertEquals(undefined, eval(`//${pad}ä‧${pad}`));
+  assertEquals(i, eval(`//${pad}ä${pad}\n${i}`));
+
+  // Multi-line comments, on a single line or spanning lines.
+  assertEquals(i, eval(`/*${pad}*/${i}`));
+  assertEquals(i, eval(`/*${pad}**${pad}***/${i}`));
+  assertEquals(i, eval(`/*${pad}ä*${pad}*/${i}`));
+  assertEquals(i, eval(`/*${pad}\n${pad}*${pad}*/${i}`));
+  assertEquals(i, eval(`/*${pad}\u2028${pad}ä*/${i}`));
+
+  // A line terminator in a multi-line comment allows an HTML close comment.
+  assertEquals(i, eval(`/*${pad}\n*/--> ${pad}\n${i}`));
+  assertEquals(i, eval(`/*${pad}\u2029*/--> ${pad}\n${i}`));
+
+  // Unterminated multi-line comments.
+  assertThrows(() => eval(`/*${pad}`), SyntaxError);
+  assertThrows(() => eval(`/*${pad}*`), SyntaxError);
+  assertThrows(() => eval(`/*${pad}\n${pad}*`), SyntaxError);
+}
@@ -0,0 +1,36 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --concurrent-recompilation
+// Flags: --maglev-finalization-budget-ms=1 --no-always-turbofan
+
+// A burst of finished concurrent jobs may take more than one install
+// interrupt to finalize. The jobs left over must still be installed by the
+// following interrupts.
+
+const kFunctions = 100;
+const fs = [];
+for (let i = 0; i < kFunctions; i++) {
+  fs.push(new Function('a', `return a + ${i};`));
+}
+
+for (const f of fs) {
+  %PrepareFunctionForOptimization(f);
+  f(1);
+  %OptimizeMaglevOnNextCall(f, 'concurrent');
+  f(1);
+}
+%WaitForBackgroundOptimization();
+
+let keep_going = 100000;  // A counter to avoid test hangs on failure.
+function AllOptimized() {
+  return fs.every(f => isOptimized(f));
+}
+if (%IsMaglevEnabled()) {
+  // Every call checks for interrupts on entry.
+  while (!AllOptimized() && --keep_going) {
+    for (let i = 0; i < kFunctions; i++) assertEquals(i + 1, fs[i](1));
+  }
+  assertTrue(AllOptimized());
+}
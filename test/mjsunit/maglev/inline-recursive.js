@@ -0,0 +1,26 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --maglev-inlining
+
+// A small recursive callee is inlined once, but not into itself.
+function fact(n) {
+  return n <= 1 ? 1 : n * fact(n - 1);
+}
+
+function foo(n) {
+  return fact(n) + 1;
+}
+
+%PrepareFunctionForOptimization(fact);
+%PrepareFunctionForOptimization(foo);
+assertEquals(121, foo(5));
+assertEquals(121, foo(5));
+%OptimizeMaglevOnNextCall(foo);
+assertEquals(121, foo(5));
+assertEquals(3628801, foo(10));
+assertTrue(isMaglevved(foo));
+
+// Deoptimizing inside the inlined callee still rebuilds the right frames.
+assertEquals(2.5, foo(1.5));
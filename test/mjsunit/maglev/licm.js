@@ -0,0 +1,53 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --maglev-licm
+
+// Loop invariant float arithmetic is computed once before the loop.
+function float_sum(a, b, n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    sum += a * b;
+  }
+  return sum;
+}
+
+%PrepareFunctionForOptimization(float_sum);
+assertEquals(15, float_sum(1.5, 2, 5));
+%OptimizeMaglevOnNextCall(float_sum);
+assertEquals(15, float_sum(1.5, 2, 5));
+assertEquals(0, float_sum(1.5, 2, 0));
+assertTrue(isMaglevved(float_sum));
+
+// The load of the length in the loop header can be hoisted, since nothing in
+// the loop writes to memory.
+function count(a) {
+  let n = 0;
+  for (let i = 0; i < a.length; i++) {
+    n = (n + 1) | 0;
+  }
+  return n;
+}
+
+%PrepareFunctionForOptimization(count);
+assertEquals(3, count([1, 2, 3]));
+%OptimizeMaglevOnNextCall(count);
+assertEquals(3, count([1, 2, 3]));
+assertEquals(0, count([]));
+
+// The length changes in the loop, so its load must stay inside of the loop.
+function shrink(a) {
+  let n = 0;
+  for (let i = 0; i < a.length; i++) {
+    a.pop();
+    n++;
+  }
+  return n;
+}
+
+%PrepareFunctionForOptimization(shrink);
+assertEquals(2, shrink([1, 2, 3, 4]));
+%OptimizeMaglevOnNextCall(shrink);
+assertEquals(2, shrink([1, 2, 3, 4]));
+assertEquals(3, shrink([1, 2, 3, 4, 5, 6]));
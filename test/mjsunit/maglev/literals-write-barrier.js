@@ -0,0 +1,37 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --stress-incremental-marking
+// Flags: --expose-gc
+
+// Stores into a freshly allocated literal skip the write barrier only while
+// the literal is young. In single generation builds "young" allocations go to
+// old space and are black-allocated during incremental marking, so the
+// barrier must be kept there.
+
+function f(s) {
+  return {a: {x: 1, y: 'str'}, b: [s, {z: 2.5}], c: 'constant'};
+}
+
+%PrepareFunctionForOptimization(f);
+f('warmup');
+f('warmup');
+%OptimizeMaglevOnNextCall(f);
+f('warmup');
+
+const results = [];
+for (let i = 0; i < 2000; i++) {
+  // Pass a fresh heap value that the marker has not seen yet.
+  results.push(f('s' + i));
+}
+gc();
+
+for (let i = 0; i < results.length; i++) {
+  const o = results[i];
+  assertEquals(1, o.a.x);
+  assertEquals('str', o.a.y);
+  assertEquals('s' + i, o.b[0]);
+  assertEquals(2.5, o.b[1].z);
+  assertEquals('constant', o.c);
+}
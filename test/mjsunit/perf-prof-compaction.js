@@ -0,0 +1,29 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --perf-prof --perf-prof-delete-file --stress-compaction --expose-gc
+// Flags: --allow-natives-syntax --turbofan --no-always-turbofan
+
+// Code space compaction moves optimized code while --perf-prof is writing a
+// jitdump file, which goes through LinuxPerfJitLogger::CodeMoveEvent.
+
+const fns = [];
+for (let i = 0; i < 100; i++) {
+  const f = new Function('x', `return x + ${i};`);
+  %PrepareFunctionForOptimization(f);
+  f(1);
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(1 + i, f(1));
+  fns.push(f);
+}
+
+// Drop every other function, so that the remaining code is evacuated from
+// fragmented pages.
+for (let i = 0; i < fns.length; i += 2) fns[i] = null;
+gc();
+gc();
+
+for (let i = 1; i < fns.length; i += 2) {
+  assertEquals(1 + i, fns[i](1));
+}
@@ -0,0 +1,55 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --max-valid-polymorphic-map-count-same-handler=8
+
+// Objects of different shapes that keep a property at the same location share
+// the IC handler for it, which lets the IC track more of them.
+
+function makeObjects() {
+  const objects = [];
+  for (let i = 0; i < 8; i++) {
+    const o = {x: i};
+    o['y' + i] = -i;
+    objects.push(o);
+  }
+  return objects;
+}
+
+function loadX(o) {
+  return o.x;
+}
+
+function storeX(o, v) {
+  o.x = v;
+}
+
+const objects = makeObjects();
+%PrepareFunctionForOptimization(loadX);
+%PrepareFunctionForOptimization(storeX);
+for (let round = 0; round < 3; round++) {
+  for (let i = 0; i < objects.length; i++) {
+    assertEquals(i, loadX(objects[i]));
+    storeX(objects[i], i);
+  }
+}
+%OptimizeFunctionOnNextCall(loadX);
+%OptimizeFunctionOnNextCall(storeX);
+for (let i = 0; i < objects.length; i++) {
+  storeX(objects[i], i + 1);
+  assertEquals(i + 1, loadX(objects[i]));
+}
+// All eight maps are covered by the polymorphic feedback, so none of them
+// deopts the optimized code.
+assertOptimized(loadX);
+assertOptimized(storeX);
+
+// A shape with the property elsewhere gets its own handler.
+const other = {a: 1, x: 'other'};
+assertEquals('other', loadX(other));
+storeX(other, 'stored');
+assertEquals('stored', loadX(other));
+for (let i = 0; i < objects.length; i++) {
+  assertEquals(i + 1, loadX(objects[i]));
+}
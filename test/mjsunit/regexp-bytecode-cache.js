@@ -0,0 +1,35 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-bytecode-cache-size=65536 --regexp-tier-up
+
+// Regexp bytecode compiled on the main thread is reused by workers, which
+// run in their own isolates. Results must not depend on who compiled first.
+
+function run() {
+  const subject = 'xxaaabcaac-ABC';
+  return JSON.stringify([
+    /(a+)(b)?c/.exec(subject),
+    /(a+)(b)?c/g.exec(subject),
+    /(a+)(b)?c/i.exec(subject),
+    /(?<as>a+)c/.exec(subject).groups,
+    subject.replace(/a|c/g, '.'),
+    /(?:x|a)+$/.test(subject),
+  ]);
+}
+
+const expected = run();
+// Interpret the same regexps again in fresh regexp objects.
+assertEquals(expected, run());
+
+function workerCode() {
+  onmessage = function({data}) {
+    postMessage(eval(`(${data})`)());
+  };
+}
+
+const worker = new Worker(workerCode, {type: 'function'});
+worker.postMessage(run.toString());
+assertEquals(expected, worker.getMessage());
+worker.terminate();
@@ -0,0 +1,35 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --enable-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-dfa-cache-size=2000
+
+// The experimental engine rules out subjects without a match with a lazily
+// built DFA. Its cache is small here, so that it gets flushed and eventually
+// given up on for some of the patterns. Check that the results agree with
+// irregexp either way.
+
+const patterns = [
+  [/a(b|c)*d/, "g"],
+  [/^x?[a-c]+$/, "m"],
+  [/\bfoo\b/, "gi"],
+  [/(?:a|b)*a(?:a|b){8}$/, ""],
+  [/[^ab]{3}|(ab)+c/, "gs"],
+  [/(?:)/, "g"],
+];
+
+const subjects = [
+  "", "ad", "abcbcbd", "abcbcbe", "x\nabc\nxd", "foo", "a foo", "foobar",
+  "ab".repeat(40) + "c", "ab".repeat(40) + "b", "ba".repeat(100),
+  "abbaabbabaa".repeat(20), "ሴabሴሴ", "Foo Bar",
+];
+
+for (const [pattern, flags] of patterns) {
+  const backtracking = new RegExp(pattern.source, flags);
+  const linear = new RegExp(pattern.source, flags + "l");
+  for (const subject of subjects) {
+    assertEquals(subject.match(backtracking), subject.match(linear),
+                 `${linear} on ${subject}`);
+  }
+}
@@ -96,3 +96,13 @@ Test(/x$/m, "x\na", ["x"], 0);
 
 // The dotall flag.
 Test(/asdf.xyz/s,  "asdf\nxyz", ["asdf\nxyz"], 0);
+
+// The ignore case flag.
+Test(/asdf/i, "xyzASdF", ["ASdF"], 0);
+Test(/[a-c]x/i, "dxBX", ["BX"], 0);
+Test(/[^a]/i, "aAb", ["b"], 0);
+Test(/\w+/i, "?aB1_", ["aB1_"], 0);
+Test(/σ+/i, "Σσς", ["Σσς"], 0);
+// Only simple uppercase mappings count in non-unicode mode.
+Test(/\u212a/i, "kK", null, 0);
+Test(/\u017f/i, "sS", null, 0);
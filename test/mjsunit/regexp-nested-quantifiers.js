@@ -0,0 +1,31 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+// Flags: --enable-experimental-regexp-engine-on-nested-quantifiers
+// Flags: --no-default-to-experimental-regexp-engine
+
+// Regexps with an unbounded quantifier around a subpattern that can match
+// unboundedly many characters run on the linear-time engine.
+assertEquals("EXPERIMENTAL", %RegexpTypeTag(/(a*)*x/));
+assertEquals("EXPERIMENTAL", %RegexpTypeTag(/(?:a+b?)+$/));
+assertEquals("EXPERIMENTAL", %RegexpTypeTag(/^(\w+\s?)*$/i));
+assertEquals("EXPERIMENTAL", %RegexpTypeTag(/(x|a+){2,}y/));
+
+// Other regexps don't.
+assertNotEquals("EXPERIMENTAL", %RegexpTypeTag(/asdf/));
+assertNotEquals("EXPERIMENTAL", %RegexpTypeTag(/a*b+/));
+assertNotEquals("EXPERIMENTAL", %RegexpTypeTag(/(ab)*/));
+assertNotEquals("EXPERIMENTAL", %RegexpTypeTag(/(a+){2,3}/));
+// Nor do the ones the experimental engine can't handle.
+assertNotEquals("EXPERIMENTAL", %RegexpTypeTag(/(a*)*\1/));
+assertNotEquals("EXPERIMENTAL", %RegexpTypeTag(/(a+)*(?=b)/));
+assertNotEquals("EXPERIMENTAL", %RegexpTypeTag(/(a+)*/u));
+
+// Subjects that would backtrack exponentially finish quickly.
+const subject = "a".repeat(50);
+assertNull(/(a*)*x/.exec(subject));
+assertNull(/^(\w+\s?)*$/i.exec(subject + "!"));
+assertEquals(["A".repeat(50) + "b", "A"],
+             /(?:(a)+)*b/i.exec("A".repeat(50) + "b"));
@@ -0,0 +1,41 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-simd --no-regexp-tier-up
+
+// Unanchored regexps skip ahead to candidate starts, 16 one-byte characters at
+// a time where supported. Check them against a naive search, for matches
+// within and at the end of vectors, and close to the end of the subject.
+
+function naiveSearch(subject, accepts) {
+  for (let i = 0; i < subject.length; i++) {
+    if (accepts(subject, i)) return i;
+  }
+  return -1;
+}
+
+const cases = [
+  [/[x-z]/, (s, i) => 'xyz'.includes(s[i])],
+  [/[$%]\d/, (s, i) => '$%'.includes(s[i]) && /\d/.test(s[i + 1] ?? '')],
+  // Characters >= 0x80 share table entries with the ones below.
+  [/[\xe9\x69]/, (s, i) => s[i] == '\xe9' || s[i] == 'i'],
+  [/[^a]/, (s, i) => s[i] != 'a'],
+];
+
+for (const length of [0, 1, 15, 16, 17, 31, 32, 33, 100]) {
+  for (let pos = -1; pos < length; pos += (pos < 40 ? 1 : 13)) {
+    for (const filler of ['a', '\xe1']) {
+      const chars = new Array(length).fill(filler);
+      for (const insert of ['y', '$5', '%', '\xe9', 'i']) {
+        const subject_chars = chars.slice();
+        if (pos >= 0) subject_chars.splice(pos, insert.length, ...insert);
+        const subject = subject_chars.join('').substring(0, length);
+        for (const [re, accepts] of cases) {
+          assertEquals(naiveSearch(subject, accepts), subject.search(re),
+                       `${re} in ${escape(subject)}`);
+        }
+      }
+    }
+  }
+}
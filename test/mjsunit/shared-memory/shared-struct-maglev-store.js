@@ -0,0 +1,36 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --harmony-struct --allow-natives-syntax --maglev
+
+// Maglev compiles stores into shared structs through the IC, which applies the
+// shared value barrier to the RHS.
+
+const Box = new SharedStructType(['payload']);
+const box = new Box();
+function store(o, v) {
+  o.payload = v;
+}
+function load(o) {
+  return o.payload;
+}
+%PrepareFunctionForOptimization(store);
+%PrepareFunctionForOptimization(load);
+for (let i = 0; i < 10; i++) {
+  store(box, 2000000000);
+  assertEquals(2000000000, load(box));
+}
+%OptimizeMaglevOnNextCall(store);
+%OptimizeMaglevOnNextCall(load);
+store(box, 2000000000);
+assertEquals(2000000000, load(box));
+store(box, 'a string');
+assertEquals('a string', load(box));
+const inner = new Box();
+store(box, inner);
+assertSame(inner, load(box));
+assertThrows(() => store(box, {}), TypeError);
+assertSame(inner, load(box));
+// SharedGC will verify there are no shared->local edges.
+%SharedGC();
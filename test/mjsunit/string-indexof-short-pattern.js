@@ -0,0 +1,57 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Patterns of up to 16 characters are searched for by comparing their first
+// and last character with many subject positions at once. Check indexOf,
+// split and replaceAll against a naive search, for matches within and across
+// vectors, and close to the end of one-byte and two-byte subjects.
+
+function naiveIndexOf(subject, pattern, start) {
+  for (let i = start; i + pattern.length <= subject.length; i++) {
+    if (subject.substring(i, i + pattern.length) == pattern) return i;
+  }
+  return -1;
+}
+
+function naiveSplit(subject, pattern) {
+  const result = [];
+  let last = 0;
+  let i;
+  while ((i = naiveIndexOf(subject, pattern, last)) != -1) {
+    result.push(subject.substring(last, i));
+    last = i + pattern.length;
+  }
+  result.push(subject.substring(last));
+  return result;
+}
+
+const patterns = ['ab', 'aab', 'abcb', 'abcdefg', 'abcdefghijklmnop',
+                  'aሴ', 'ሴb', 'bb'];
+
+for (const filler of ['b', 'c', 'ሴ']) {
+  for (const length of [0, 1, 2, 8, 15, 16, 17, 31, 32, 33, 70]) {
+    for (const pattern of patterns) {
+      for (let pos = -1; pos < length; pos += (pos < 34 ? 1 : 11)) {
+        const chars = new Array(length).fill(filler);
+        if (pos >= 0) chars.splice(pos, pattern.length, ...pattern);
+        // A near miss that only gets the first and last character right.
+        if (pattern.length > 2 && pos + 2 * pattern.length < length) {
+          const miss = pattern.substring(0, 1) +
+              'x'.repeat(pattern.length - 2) + pattern.substring(1).slice(-1);
+          chars.splice(pos + pattern.length, pattern.length, ...miss);
+        }
+        const subject = chars.join('').substring(0, length);
+        const message = `${escape(pattern)} in ${escape(subject)}`;
+        for (const start of [0, 1, pos + 1]) {
+          assertEquals(naiveIndexOf(subject, pattern, start),
+                       subject.indexOf(pattern, start), message);
+        }
+        assertEquals(naiveSplit(subject, pattern), subject.split(pattern),
+                     message);
+        assertEquals(naiveSplit(subject, pattern).join('-'),
+                     subject.replaceAll(pattern, '-'), message);
+      }
+    }
+  }
+}
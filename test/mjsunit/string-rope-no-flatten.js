@@ -0,0 +1,56 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Comparing ropes and serializing one-byte ropes to JSON walk their leaves
+// instead of flattening them first.
+
+function rope(...parts) {
+  let result = parts[0];
+  for (let i = 1; i < parts.length; i++) {
+    result = %ConstructConsString(result, parts[i]);
+  }
+  return result;
+}
+
+const a = 'abcdefghijklm';
+const b = 'nopqrstuvwxyz';
+const escapes = '"\\\n\x01 !\x7f\xff';
+
+(function TestEquals() {
+  const flat = %FlattenString(a + b + a + b);
+  assertTrue(rope(a, b, a, b) == flat);
+  assertTrue(flat == rope(a, b, a, b));
+  assertTrue(rope(a, b + a, b) == rope(a + b, a + b));
+  assertFalse(rope(a, b, a, b) == rope(a, b, b, a));
+  assertFalse(rope(a, b, a, a) == flat);
+  // Two-byte leaves.
+  const two_byte = 'ሴ' + a;
+  const flat_two_byte = %FlattenString(two_byte + b + two_byte);
+  assertTrue(two_byte + b + two_byte == flat_two_byte);
+  assertFalse(two_byte + b + two_byte == two_byte + b + 'ሴ' + b);
+  assertTrue(new Map([[rope(a, b), 1]]).has(a + b));
+})();
+
+(function TestStringify() {
+  const parts = [a, escapes, b, escapes + a, b];
+  const string = rope(...parts);
+  const expected = JSON.stringify(%FlattenString(parts.join('')));
+  assertEquals(expected, JSON.stringify(rope(...parts)));
+  assertEquals(`[${expected},${expected}]`,
+               JSON.stringify([rope(...parts), rope(...parts)]));
+  assertEquals(`{${expected}:${expected}}`,
+               JSON.stringify({[string]: rope(...parts)}));
+  // After a two-byte string, the output is two-byte.
+  assertEquals(`["ሴ",${expected}]`, JSON.stringify(['ሴ', rope(...parts)]));
+  // A surrogate pair split across leaves of a two-byte rope.
+  const pair = (a + '\ud83d') + ('\ude00' + b);
+  assertEquals(`"${a}😀${b}"`, JSON.stringify(pair));
+  // Deep ropes.
+  let deep = a;
+  for (let i = 0; i < 1000; i++) deep = rope(deep, escapes);
+  assertEquals(JSON.stringify(%FlattenString(a + escapes.repeat(1000))),
+               JSON.stringify(deep));
+})();
@@ -0,0 +1,46 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --turboshaft --turboshaft-load-elimination --allow-natives-syntax
+
+// Repeated loads of the same field.
+function repeated(o) {
+  return o.a + o.a + o.b;
+}
+
+%PrepareFunctionForOptimization(repeated);
+assertEquals(5, repeated({a: 2, b: 1}));
+%OptimizeFunctionOnNextCall(repeated);
+assertEquals(5, repeated({a: 2, b: 1}));
+assertEquals(11, repeated({a: 3, b: 5}));
+
+// A store through a possibly aliasing object has to invalidate the field.
+function aliased(o, p, v) {
+  let x = o.a;
+  p.a = v;
+  return x + o.a;
+}
+
+%PrepareFunctionForOptimization(aliased);
+let obj = {a: 1};
+assertEquals(2, aliased(obj, {a: 0}, 5));
+assertEquals(6, aliased(obj, obj, 5));
+%OptimizeFunctionOnNextCall(aliased);
+obj = {a: 1};
+assertEquals(2, aliased(obj, {a: 0}, 5));
+assertEquals(6, aliased(obj, obj, 5));
+
+// Store-to-load forwarding and invalidation by calls.
+function forwarded(o, g) {
+  o.a = 7;
+  let x = o.a;
+  g(o);
+  return x + o.a;
+}
+
+function setA(o) { o.a = 1; }
+%PrepareFunctionForOptimization(forwarded);
+assertEquals(8, forwarded({a: 0}, setA));
+%OptimizeFunctionOnNextCall(forwarded);
+assertEquals(8, forwarded({a: 0}, setA));
@@ -0,0 +1,121 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --experimental-wasm-gc --no-liftoff
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// TurboFan copies short ranges with a loop, and longer ones with a call.
+// Check both against a model, including overlapping copies within one array.
+
+const kLength = 40;
+
+function build(kind) {
+  const builder = new WasmModuleBuilder();
+  const struct = builder.addStruct([makeField(kWasmI32, false)]);
+  const element = kind == 'i8' ? kWasmI8
+                : kind == 'i32' ? kWasmI32
+                : wasmRefNullType(struct);
+  const array = builder.addArray(element, true);
+  const a = builder.addGlobal(wasmRefNullType(array), true);
+  const b = builder.addGlobal(wasmRefNullType(array), true);
+
+  const wrap = kind == 'ref' ? [kGCPrefix, kExprStructNew, struct] : [];
+  const unwrap = kind == 'ref' ? [kGCPrefix, kExprStructGet, struct, 0]
+                               : [];
+  const get = kind == 'i8' ? kExprArrayGetS : kExprArrayGet;
+
+  for (const global of [a, b]) {
+    builder.addFunction('init_' + global.index, kSig_v_v)
+        .addLocals(kWasmI32, 1)
+        .addBody([
+          ...wasmI32Const(kLength),
+          kGCPrefix, kExprArrayNewDefault, array,
+          kExprGlobalSet, global.index,
+          kExprLoop, kWasmVoid,
+            kExprGlobalGet, global.index,
+            kExprLocalGet, 0,
+            kExprLocalGet, 0,
+            ...wasmI32Const(global.index * 1000 - 20),
+            kExprI32Add,
+            ...wrap,
+            kGCPrefix, kExprArraySet, array,
+            kExprLocalGet, 0,
+            kExprI32Const, 1,
+            kExprI32Add,
+            kExprLocalTee, 0,
+            ...wasmI32Const(kLength),
+            kExprI32LtU,
+            kExprBrIf, 0,
+          kExprEnd,
+        ])
+        .exportFunc();
+    builder.addFunction('get_' + global.index, kSig_i_i)
+        .addBody([
+          kExprGlobalGet, global.index,
+          kExprLocalGet, 0,
+          kGCPrefix, get, array,
+          ...unwrap,
+        ])
+        .exportFunc();
+  }
+
+  const sig_v_iii = makeSig([kWasmI32, kWasmI32, kWasmI32], []);
+  for (const [name, dst, src] of [['aa', a, a], ['ab', a, b]]) {
+    builder.addFunction('copy_' + name, sig_v_iii)
+        .addBody([
+          kExprGlobalGet, dst.index,
+          kExprLocalGet, 0,
+          kExprGlobalGet, src.index,
+          kExprLocalGet, 1,
+          kExprLocalGet, 2,
+          kGCPrefix, kExprArrayCopy, array, array,
+        ])
+        .exportFunc();
+  }
+  return [builder.instantiate().exports, a.index, b.index];
+}
+
+for (const kind of ['i8', 'i32', 'ref']) {
+  const [exports, a, b] = build(kind);
+  const normalize = kind == 'i8' ? (x => (x << 24) >> 24) : (x => x);
+
+  function reset() {
+    exports['init_' + a]();
+    exports['init_' + b]();
+    const model_a = [];
+    const model_b = [];
+    for (let i = 0; i < kLength; i++) {
+      model_a.push(normalize(i + a * 1000 - 20));
+      model_b.push(normalize(i + b * 1000 - 20));
+    }
+    return [model_a, model_b];
+  }
+
+  function check(model_a) {
+    for (let i = 0; i < kLength; i++) {
+      assertEquals(model_a[i], exports['get_' + a](i));
+    }
+  }
+
+  for (const length of [0, 1, 2, 7, 15, 16, 17, 30]) {
+    for (const [dst, src] of [[0, 0], [0, 3], [3, 0], [5, 9], [9, 5],
+                              [0, kLength - length], [kLength - length, 0]]) {
+      if (dst + length > kLength || src + length > kLength) continue;
+
+      let [model_a, model_b] = reset();
+      exports.copy_aa(dst, src, length);
+      model_a.copyWithin(dst, src, src + length);
+      check(model_a);
+
+      [model_a, model_b] = reset();
+      exports.copy_ab(dst, src, length);
+      for (let i = 0; i < length; i++) model_a[dst + i] = model_b[src + i];
+      check(model_a);
+    }
+  }
+
+  assertTraps(kTrapArrayOutOfBounds, () => exports.copy_aa(kLength - 2, 0, 3));
+  assertTraps(kTrapArrayOutOfBounds, () => exports.copy_ab(0, kLength - 2, 3));
+}
@@ -0,0 +1,69 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-lazy-compilation --wasm-lazy-compilation-prefetch=2
+// Flags: --experimental-wasm-return-call
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Callees of lazily compiled functions get compiled in the background, racing
+// with lazy compilation of the same functions on the main thread.
+
+(function testPrefetchCallees() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const imp = builder.addImport('m', 'imp', kSig_i_i);
+
+  const leaves = [];
+  for (let i = 0; i < 6; i++) {
+    leaves.push(builder.addFunction('leaf' + i, kSig_i_i).addBody([
+      kExprLocalGet, 0, ...wasmI32Const(i), kExprI32Add
+    ]));
+  }
+
+  // Calls the import, the same leaf twice, and more leaves than get
+  // prefetched.
+  const mid = builder.addFunction('mid', kSig_i_i).addBody([
+    kExprLocalGet, 0, kExprCallFunction, imp,
+    kExprCallFunction, leaves[0].index,
+    kExprCallFunction, leaves[0].index,
+    kExprCallFunction, leaves[1].index,
+    kExprCallFunction, leaves[2].index,
+    kExprCallFunction, leaves[3].index,
+  ]);
+
+  const tail = builder.addFunction('tail', kSig_i_i).addBody([
+    kExprLocalGet, 0, kExprReturnCall, leaves[4].index
+  ]);
+
+  const fact = builder.addFunction('fact', kSig_i_i);
+  fact.addBody([
+    kExprLocalGet, 0, kExprI32Eqz,
+    kExprIf, kWasmI32,
+      kExprI32Const, 1,
+    kExprElse,
+      kExprLocalGet, 0,
+      kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub,
+      kExprCallFunction, fact.index,
+      kExprI32Mul,
+    kExprEnd
+  ]);
+
+  builder.addFunction('main', kSig_i_i).addBody([
+    kExprLocalGet, 0, kExprCallFunction, mid.index,
+    kExprCallFunction, tail.index,
+    kExprCallFunction, leaves[5].index,
+  ]).exportFunc();
+  builder.addFunction('fact', kSig_i_i).addBody([
+    kExprLocalGet, 0, kExprCallFunction, fact.index
+  ]).exportFunc();
+
+  const instance =
+      builder.instantiate({m: {imp: x => x * 2}});
+  for (let i = 0; i < 10; i++) {
+    assertEquals(2 * i + 15, instance.exports.main(i));
+    assertEquals([1, 1, 2, 6, 24, 120, 720, 5040, 40320, 362880][i],
+                 instance.exports.fact(i));
+  }
+})();
@@ -0,0 +1,110 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --liftoff --no-wasm-tier-up --liftoff-keep-loop-invariant-locals
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const builder = new WasmModuleBuilder();
+const sig_i_iii = makeSig([kWasmI32, kWasmI32, kWasmI32], [kWasmI32]);
+
+const id = builder.addFunction('id', kSig_i_i).addBody([kExprLocalGet, 0]);
+
+// Sums a * b + i for i in [0, n). a and b are not assigned in the loop.
+function addLoop(name, with_call) {
+  builder.addFunction(name, sig_i_iii)
+      .addLocals(kWasmI32, 2)  // acc = 3, i = 4
+      .addBody([
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 3,
+          kExprLocalGet, 0,
+          kExprLocalGet, 1,
+          kExprI32Mul,
+          ...(with_call ? [kExprCallFunction, id.index] : []),
+          kExprI32Add,
+          kExprLocalGet, 4,
+          kExprI32Add,
+          kExprLocalSet, 3,
+          kExprLocalGet, 4,
+          kExprI32Const, 1,
+          kExprI32Add,
+          kExprLocalTee, 4,
+          kExprLocalGet, 2,
+          kExprI32LtS,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 3,
+      ])
+      .exportFunc();
+}
+addLoop('loop', false);
+// The call spills every register inside of the loop, so the invariant locals
+// have to be reloaded on the back edge.
+addLoop('loop_with_call', true);
+
+// Nested loops, where the outer loop assigns a local the inner one doesn't.
+builder.addFunction('nested', sig_i_iii)
+    .addLocals(kWasmI32, 3)  // acc = 3, i = 4, j = 5
+    .addBody([
+      kExprLoop, kWasmVoid,
+        kExprI32Const, 0,
+        kExprLocalSet, 5,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 3,
+          kExprLocalGet, 4,
+          kExprLocalGet, 0,
+          kExprI32Mul,
+          kExprI32Add,
+          kExprLocalSet, 3,
+          kExprLocalGet, 5,
+          kExprI32Const, 1,
+          kExprI32Add,
+          kExprLocalTee, 5,
+          kExprLocalGet, 1,
+          kExprI32LtS,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 4,
+        kExprI32Const, 1,
+        kExprI32Add,
+        kExprLocalTee, 4,
+        kExprLocalGet, 2,
+        kExprI32LtS,
+        kExprBrIf, 0,
+      kExprEnd,
+      kExprLocalGet, 3,
+    ])
+    .exportFunc();
+
+const instance = builder.instantiate();
+
+function expectedLoop(a, b, n) {
+  let acc = 0;
+  let i = 0;
+  do {
+    acc = (acc + Math.imul(a, b) + i) | 0;
+    i++;
+  } while (i < n);
+  return acc;
+}
+
+function expectedNested(a, b, n) {
+  let acc = 0;
+  let i = 0;
+  do {
+    let j = 0;
+    do {
+      acc = (acc + Math.imul(i, a)) | 0;
+      j++;
+    } while (j < b);
+    i++;
+  } while (i < n);
+  return acc;
+}
+
+for (const [a, b, n] of [[3, 4, 10], [-7, 11, 1], [12345, 6789, 100]]) {
+  assertEquals(expectedLoop(a, b, n), instance.exports.loop(a, b, n));
+  assertEquals(expectedLoop(a, b, n), instance.exports.loop_with_call(a, b, n));
+  assertEquals(expectedNested(a, b, n), instance.exports.nested(a, b, n));
+}
@@ -613,6 +613,10 @@ d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
               kExprCallIndirect, sub_sig, table.index,
               kGCPrefix, kExprStructGet, sub_struct, 0])
     .exportFunc();
+  builder.addFunction("clear", kSig_v_i)
+    .addBody([kExprLocalGet, 0, kExprRefNull, super_sig,
+              kExprTableSet, table.index])
+    .exportFunc();
 
   let instance = builder.instantiate();
 
@@ -627,4 +631,12 @@ d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
               () => instance.exports.call_indirect_sub(0, 10));
   assertTraps(kTrapFuncSigMismatch,
               () => instance.exports.call_indirect_sub(2, 10));
+
+  // Entries that get cleared at runtime are null as well.
+  instance.exports.clear(1);
+  assertTraps(kTrapFuncSigMismatch,
+              () => instance.exports.call_indirect_super(1, 10));
+  assertTraps(kTrapFuncSigMismatch,
+              () => instance.exports.call_indirect_sub(1, 10));
+  assertEquals(10, instance.exports.call_indirect_super(0, 10));
 })();
@@ -0,0 +1,121 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-speculative-inlining-call-indirect
+// Flags: --experimental-wasm-return-call --no-wasm-tier-up
+// Flags: --wasm-dynamic-tiering --allow-natives-syntax
+
+// These tests check that call_indirect targets are speculatively inlined
+// correctly. To see which functions are inlined, run with
+// --trace-wasm-speculative-inlining.
+
+d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
+
+function buildModule() {
+  let builder = new WasmModuleBuilder();
+  let sig_index = builder.addType(kSig_i_i);
+  let other_sig_index = builder.addType(kSig_i_ii);
+
+  let add1 = builder.addFunction("add1", sig_index)
+    .addBody([kExprLocalGet, 0, kExprI32Const, 1, kExprI32Add])
+    .exportFunc();
+  let add2 = builder.addFunction("add2", sig_index)
+    .addBody([kExprLocalGet, 0, kExprI32Const, 2, kExprI32Add])
+    .exportFunc();
+  let mul3 = builder.addFunction("mul3", sig_index)
+    .addBody([kExprLocalGet, 0, kExprI32Const, 3, kExprI32Mul])
+    .exportFunc();
+  let sub = builder.addFunction("sub", other_sig_index)
+    .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprI32Sub]);
+
+  let table = builder.addTable(kWasmFuncRef, 8, 8).exportAs("table");
+  // Entry 1 is the same function as entry 0, and entry 5 stays null.
+  builder.addActiveElementSegment(
+      table.index, wasmI32Const(0),
+      [add1.index, add1.index, add2.index, mul3.index, sub.index]);
+
+  // main(x, i) = table[i](x)
+  builder.addFunction("main", kSig_i_ii)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprLocalGet, 1,
+      kExprCallIndirect, sig_index, table.index])
+    .exportFunc();
+
+  // tail(x, i) = return_call table[i](x + 10)
+  builder.addFunction("tail", kSig_i_ii)
+    .addBody([
+      kExprLocalGet, 0, kExprI32Const, 10, kExprI32Add,
+      kExprLocalGet, 1,
+      kExprReturnCallIndirect, sig_index, table.index])
+    .exportFunc();
+
+  return builder.instantiate();
+}
+
+function checkCalls(exports, expected) {
+  for (let [i, f] of expected.entries()) {
+    assertEquals(f(7), exports.main(7, i));
+    assertEquals(f(17), exports.tail(7, i));
+  }
+  assertTraps(kTrapFuncSigMismatch, () => exports.main(7, 4));
+  assertTraps(kTrapFuncSigMismatch, () => exports.tail(7, 4));
+  assertTraps(kTrapFuncSigMismatch, () => exports.main(7, 5));
+  assertTraps(kTrapTableOutOfBounds, () => exports.main(7, 8));
+  assertTraps(kTrapTableOutOfBounds, () => exports.tail(7, -1));
+}
+
+(function CallIndirectMonomorphicTest() {
+  print(arguments.callee.name);
+  let exports = buildModule().exports;
+  for (let i = 0; i < 20; i++) {
+    assertEquals(8, exports.main(7, 0));
+    assertEquals(18, exports.tail(7, 0));
+  }
+  %WasmTierUpFunction(exports.main);
+  %WasmTierUpFunction(exports.tail);
+  checkCalls(exports, [x => x + 1, x => x + 1, x => x + 2, x => x * 3]);
+})();
+
+(function CallIndirectPolymorphicTest() {
+  print(arguments.callee.name);
+  let exports = buildModule().exports;
+  for (let i = 0; i < 20; i++) {
+    for (let entry = 0; entry < 4; entry++) {
+      exports.main(7, entry);
+      exports.tail(7, entry);
+    }
+    // Feedback for the entries the call traps for must not be used.
+    assertTraps(kTrapFuncSigMismatch, () => exports.main(7, 4));
+  }
+  %WasmTierUpFunction(exports.main);
+  %WasmTierUpFunction(exports.tail);
+  checkCalls(exports, [x => x + 1, x => x + 1, x => x + 2, x => x * 3]);
+})();
+
+(function CallIndirectTableChangedTest() {
+  print(arguments.callee.name);
+  let instance = buildModule();
+  let exports = instance.exports;
+  for (let i = 0; i < 20; i++) {
+    exports.main(7, 2);
+    exports.tail(7, 2);
+    // Exposing an entry as a funcref turns its feedback from a placeholder
+    // into the function itself.
+    if (i == 10) exports.table.get(2);
+  }
+  %WasmTierUpFunction(exports.main);
+  %WasmTierUpFunction(exports.tail);
+  checkCalls(exports, [x => x + 1, x => x + 1, x => x + 2, x => x * 3]);
+
+  // The inlined target is no longer in the table.
+  exports.table.set(2, exports.mul3);
+  exports.table.set(3, exports.add2);
+  checkCalls(exports, [x => x + 1, x => x + 1, x => x * 3, x => x + 2]);
+
+  // Functions of another instance don't match either.
+  let other = buildModule().exports;
+  exports.table.set(0, other.add2);
+  checkCalls(exports, [x => x + 2, x => x + 1, x => x * 3, x => x + 2]);
+})();
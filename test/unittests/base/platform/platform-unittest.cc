@@ -56,6 +56,15 @@ TEST(OS, GetCurrentProcessId) {
 #endif
 }
 
+TEST(OS, GetCurrentNumaNode) {
+  const int node = OS::GetCurrentNumaNode();
+  EXPECT_LE(-1, node);
+#if V8_OS_LINUX
+  // Every Linux thread runs on some node, even on non-NUMA machines.
+  EXPECT_LE(0, node);
+#endif
+}
+
 TEST(OS, RemapPages) {
   if constexpr (OS::IsRemapPageSupported()) {
     const size_t size = base::OS::AllocatePageSize();
@@ -4,6 +4,7 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include "include/v8-platform.h"
 #include "src/api/api-inl.h"
 #include "src/base/atomic-utils.h"
 #include "src/base/platform/semaphore.h"
@@ -11,10 +12,14 @@
 #include "src/codegen/optimized-compilation-info.h"
 #include "src/execution/isolate.h"
 #include "src/execution/local-isolate.h"
+#include "src/flags/flags.h"
 #include "src/handles/handles.h"
 #include "src/heap/local-heap.h"
+#include "src/init/v8.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/parsing/parse-info.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-helpers.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -63,6 +68,22 @@ class BlockingCompilationJob : public TurbofanCompilationJob {
   base::Semaphore semaphore_;
 };
 
+// Occupies a worker thread until it is released.
+class BlockingTask : public v8::Task {
+ public:
+  BlockingTask(base::Semaphore* started, base::Semaphore* release)
+      : started_(started), release_(release) {}
+
+  void Run() override {
+    started_->Signal();
+    release_->Wait();
+  }
+
+ private:
+  base::Semaphore* started_;
+  base::Semaphore* release_;
+};
+
 }  // namespace
 
 TEST_F(OptimizingCompileDispatcherTest, Construct) {
@@ -96,5 +117,61 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   dispatcher.Stop();
 }
 
+TEST_F(OptimizingCompileDispatcherTest, PriorityQueue) {
+  FlagScope<bool> priority_queue(
+      &v8_flags.concurrent_recompilation_priority_queue, true);
+  Handle<JSFunction> cold =
+      RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+  Handle<JSFunction> hot =
+      RunJS<JSFunction>("function h() { function k() {}; return k;}; h();");
+  IsCompiledScope cold_compiled_scope;
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), cold, Compiler::CLEAR_EXCEPTION,
+                                &cold_compiled_scope));
+  IsCompiledScope hot_compiled_scope;
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), hot, Compiler::CLEAR_EXCEPTION,
+                                &hot_compiled_scope));
+  JSFunction::EnsureFeedbackVector(i_isolate(), cold, &cold_compiled_scope);
+  JSFunction::EnsureFeedbackVector(i_isolate(), hot, &hot_compiled_scope);
+  cold->feedback_vector().set_profiler_ticks(1);
+  hot->feedback_vector().set_profiler_ticks(10);
+
+  // Occupy every worker thread, so that the compile tasks only start once the
+  // queue holds both jobs.
+  const int worker_count = V8::GetCurrentPlatform()->NumberOfWorkerThreads();
+  base::Semaphore started(0);
+  base::Semaphore release(0);
+  for (int i = 0; i < worker_count; i++) {
+    V8::GetCurrentPlatform()->CallOnWorkerThread(
+        std::make_unique<BlockingTask>(&started, &release));
+  }
+  for (int i = 0; i < worker_count; i++) started.Wait();
+
+  BlockingCompilationJob* cold_job =
+      new BlockingCompilationJob(i_isolate(), cold);
+  BlockingCompilationJob* hot_job =
+      new BlockingCompilationJob(i_isolate(), hot);
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  ASSERT_TRUE(dispatcher.IsQueueAvailableFor(*cold));
+  dispatcher.QueueForOptimization(cold_job);
+  ASSERT_TRUE(dispatcher.IsQueueAvailableFor(*hot));
+  dispatcher.QueueForOptimization(hot_job);
+
+  // Free a single worker. The first compile task has to dequeue the job that
+  // was queued last, because its function is hotter.
+  release.Signal();
+  while (!cold_job->IsBlocking() && !hot_job->IsBlocking()) {
+  }
+  EXPECT_TRUE(hot_job->IsBlocking());
+  EXPECT_FALSE(cold_job->IsBlocking());
+
+  // The cold job runs once another worker is free.
+  for (int i = 1; i < worker_count; i++) release.Signal();
+  hot_job->Signal();
+  while (!cold_job->IsBlocking()) {
+  }
+  cold_job->Signal();
+  dispatcher.Stop();
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,93 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/js-inlining-profile.h"
+
+#include <sstream>
+
+#include "src/api/api-inl.h"
+#include "src/codegen/compilation-cache.h"
+#include "src/objects/js-function-inl.h"
+#include "test/unittests/compiler/graph-unittest.h"
+#include "test/unittests/test-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+namespace js_inlining_profile_unittest {
+
+using JSInliningProfileTest = GraphTest;
+
+TEST_F(JSInliningProfileTest, ReadsProfileLines) {
+  std::istringstream input(
+      "some other output\n"
+      "inlining_frequency,3,10,4,2.5\n"
+      "inlining_frequency,3,10,4,7\n"
+      "inlining_frequency,3,10,4,1\r\n"
+      "inlining_frequency,5,0,12,0.25\n");
+  JSInliningProfile profile(input);
+  EXPECT_EQ(7.0f, profile.Lookup("3,10,4"));
+  EXPECT_EQ(0.25f, profile.Lookup("5,0,12"));
+  EXPECT_FALSE(profile.Lookup("3,10,5").has_value());
+}
+
+TEST_F(JSInliningProfileTest, SkipsMalformedLines) {
+  std::istringstream input(
+      "inlining_frequency,\n"
+      "inlining_frequency,1,2,3,\n"
+      "inlining_frequency,1,2,3,abc\n"
+      "inlining_frequency,1,2,3,4x\n"
+      "inlining_frequency,1,2,3,-1\n"
+      "inlining_frequency,1,2,3,1e99\n"
+      "inlining_frequency,4,5,6,3\n");
+  JSInliningProfile profile(input);
+  EXPECT_FALSE(profile.Lookup("1,2,3").has_value());
+  EXPECT_EQ(3.0f, profile.Lookup("4,5,6"));
+}
+
+TEST_F(JSInliningProfileTest, CallSiteKeyDistinguishesScripts) {
+  // Two functions with the same name at the same position, but in scripts
+  // with different sources.
+  Handle<JSFunction> f1 = Handle<JSFunction>::cast(
+      Utils::OpenHandle(*RunJS("(function f() { return 1; })")));
+  Handle<JSFunction> f2 = Handle<JSFunction>::cast(
+      Utils::OpenHandle(*RunJS("(function f() { return 2; })")));
+  SharedFunctionInfoRef shared1 =
+      MakeRef(broker(), handle(f1->shared(), isolate()));
+  SharedFunctionInfoRef shared2 =
+      MakeRef(broker(), handle(f2->shared(), isolate()));
+  ASSERT_EQ(shared1.StartPosition(), shared2.StartPosition());
+
+  EXPECT_NE(JSInliningProfile::CallSiteKey(broker(), shared1, 0),
+            JSInliningProfile::CallSiteKey(broker(), shared2, 0));
+  EXPECT_EQ(JSInliningProfile::CallSiteKey(broker(), shared1, 0),
+            JSInliningProfile::CallSiteKey(broker(), shared1, 0));
+  EXPECT_NE(JSInliningProfile::CallSiteKey(broker(), shared1, 0),
+            JSInliningProfile::CallSiteKey(broker(), shared1, 2));
+}
+
+TEST_F(JSInliningProfileTest, CallSiteKeyIgnoresScriptId) {
+  // A script loaded again, e.g. in a later run or in a different order, gets
+  // a new script id but must still find its profile.
+  isolate()->compilation_cache()->DisableScriptAndEval();
+  const char* source = "(function g() { return 3; })";
+  Handle<JSFunction> g1 =
+      Handle<JSFunction>::cast(Utils::OpenHandle(*RunJS(source)));
+  Handle<JSFunction> g2 =
+      Handle<JSFunction>::cast(Utils::OpenHandle(*RunJS(source)));
+  SharedFunctionInfoRef shared1 =
+      MakeRef(broker(), handle(g1->shared(), isolate()));
+  SharedFunctionInfoRef shared2 =
+      MakeRef(broker(), handle(g2->shared(), isolate()));
+  ASSERT_NE(shared1.script_id(), shared2.script_id());
+
+  EXPECT_EQ(JSInliningProfile::CallSiteKey(broker(), shared1, 0),
+            JSInliningProfile::CallSiteKey(broker(), shared2, 0));
+  isolate()->compilation_cache()->EnableScriptAndEval();
+}
+
+}  // namespace js_inlining_profile_unittest
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -192,6 +192,30 @@ TEST_P(MicrotaskQueueTest, BufferGrowth) {
   EXPECT_EQ(MicrotaskQueue::kMinimumCapacity + 2, count);
 }
 
+// The ring buffer shrinks by at most half per root iteration, and keeps its
+// capacity while a quarter of it or more is in use.
+TEST_P(MicrotaskQueueTest, BufferShrink) {
+  const intptr_t kTaskCount = 8 * MicrotaskQueue::kMinimumCapacity;
+  for (intptr_t i = 0; i < kTaskCount; ++i) {
+    microtask_queue()->EnqueueMicrotask(*NewMicrotask([] {}));
+  }
+  intptr_t capacity = microtask_queue()->capacity();
+  EXPECT_LE(kTaskCount, capacity);
+
+  RecordingVisitor visitor;
+  microtask_queue()->IterateMicrotasks(&visitor);
+  EXPECT_EQ(capacity, microtask_queue()->capacity());
+
+  EXPECT_EQ(kTaskCount, microtask_queue()->RunMicrotasks(isolate()));
+  while (capacity > MicrotaskQueue::kMinimumCapacity) {
+    microtask_queue()->IterateMicrotasks(&visitor);
+    EXPECT_EQ(capacity / 2, microtask_queue()->capacity());
+    capacity /= 2;
+  }
+  microtask_queue()->IterateMicrotasks(&visitor);
+  EXPECT_EQ(MicrotaskQueue::kMinimumCapacity, microtask_queue()->capacity());
+}
+
 // MicrotaskQueue instances form a doubly linked list.
 TEST_P(MicrotaskQueueTest, InstanceChain) {
   ClearTestMicrotaskQueue();
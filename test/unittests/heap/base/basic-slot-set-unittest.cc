@@ -194,5 +194,86 @@ TEST(BasicSlotSet, RemoveRange) {
   TestSlotSet::Delete(set, kBucketsTestPage);
 }
 
+TEST(BasicSlotSet, InsertCompactAndLookup) {
+  TestSlotSet* set = TestSlotSet::Allocate(kBucketsTestPage);
+  // Sparse and dense buckets alternate, so that both inline and promoted
+  // buckets are exercised.
+  for (size_t i = 0; i < kTestPageSize; i += kTestGranularity) {
+    const size_t bucket = TestSlotSet::BucketForSlot(i);
+    if ((bucket % 2 == 0 && i % 997 == 0) || (bucket % 2 == 1 && i % 7 == 0)) {
+      set->InsertCompact<TestSlotSet::AccessMode::ATOMIC>(i);
+      set->InsertCompact<TestSlotSet::AccessMode::ATOMIC>(i);
+    }
+  }
+  for (size_t i = 0; i < kTestPageSize; i += kTestGranularity) {
+    const size_t bucket = TestSlotSet::BucketForSlot(i);
+    EXPECT_EQ(
+        (bucket % 2 == 0 && i % 997 == 0) || (bucket % 2 == 1 && i % 7 == 0),
+        set->Lookup(i));
+  }
+  TestSlotSet::Delete(set, kBucketsTestPage);
+}
+
+TEST(BasicSlotSet, InsertCompactPromotesFullBucket) {
+  TestSlotSet* set = TestSlotSet::Allocate(kBucketsTestPage);
+  const size_t kSlots = TestSlotSet::kMaxInlineSlots + 1;
+  for (size_t i = 0; i < kSlots; i++) {
+    set->InsertCompact<TestSlotSet::AccessMode::NON_ATOMIC>(
+        (kSlots - i) * 3 * kTestGranularity);
+  }
+  set->Insert<TestSlotSet::AccessMode::ATOMIC>(kTestGranularity);
+  for (size_t i = 0; i <= kSlots * 3; i++) {
+    EXPECT_EQ((i > 0 && i % 3 == 0) || i == 1,
+              set->Lookup(i * kTestGranularity));
+  }
+  TestSlotSet::Delete(set, kBucketsTestPage);
+}
+
+TEST(BasicSlotSet, IterateAndRemoveCompact) {
+  TestSlotSet* set = TestSlotSet::Allocate(kBucketsTestPage);
+  for (size_t i = 0; i < kTestPageSize; i += 1024 * kTestGranularity) {
+    set->InsertCompact<TestSlotSet::AccessMode::ATOMIC>(i);
+    set->InsertCompact<TestSlotSet::AccessMode::ATOMIC>(i + kTestGranularity);
+    set->InsertCompact<TestSlotSet::AccessMode::ATOMIC>(
+        i + 2 * kTestGranularity);
+  }
+  size_t count = set->Iterate(
+      0, 0, kBucketsTestPage,
+      [](uintptr_t slot) {
+        return slot % (1024 * kTestGranularity) == kTestGranularity
+                   ? REMOVE_SLOT
+                   : KEEP_SLOT;
+      },
+      TestSlotSet::FREE_EMPTY_BUCKETS);
+  EXPECT_EQ(2 * kBucketsTestPage, count);
+  for (size_t i = 0; i < kTestPageSize; i += 1024 * kTestGranularity) {
+    EXPECT_TRUE(set->Lookup(i));
+    EXPECT_FALSE(set->Lookup(i + kTestGranularity));
+    EXPECT_TRUE(set->Lookup(i + 2 * kTestGranularity));
+    set->Remove(i);
+    EXPECT_FALSE(set->Lookup(i));
+  }
+  set->RemoveRange(0, kTestPageSize, kBucketsTestPage,
+                   TestSlotSet::KEEP_EMPTY_BUCKETS);
+  for (size_t i = 0; i < kTestPageSize; i += kTestGranularity) {
+    EXPECT_FALSE(set->Lookup(i));
+  }
+  EXPECT_TRUE(set->FreeEmptyBuckets(kBucketsTestPage));
+  TestSlotSet::Delete(set, kBucketsTestPage);
+}
+
+TEST(BasicSlotSet, RemoveRangeCompact) {
+  TestSlotSet* set = TestSlotSet::Allocate(kBucketsTestPage);
+  for (uint32_t i = 1020; i < 1030; i++) {
+    set->InsertCompact<TestSlotSet::AccessMode::ATOMIC>(i * kTestGranularity);
+  }
+  set->RemoveRange(1022 * kTestGranularity, 1027 * kTestGranularity,
+                   kBucketsTestPage, TestSlotSet::FREE_EMPTY_BUCKETS);
+  for (uint32_t i = 1020; i < 1030; i++) {
+    EXPECT_EQ(i < 1022 || i >= 1027, set->Lookup(i * kTestGranularity));
+  }
+  TestSlotSet::Delete(set, kBucketsTestPage);
+}
+
 }  // namespace base
 }  // namespace heap
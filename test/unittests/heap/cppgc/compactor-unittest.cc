@@ -23,6 +23,13 @@ class CompactableCustomSpace : public CustomSpace<CompactableCustomSpace> {
   static constexpr bool kSupportsCompaction = true;
 };
 
+class OtherCompactableCustomSpace
+    : public CustomSpace<OtherCompactableCustomSpace> {
+ public:
+  static constexpr size_t kSpaceIndex = 1;
+  static constexpr bool kSupportsCompaction = true;
+};
+
 namespace internal {
 
 namespace {
@@ -43,6 +50,36 @@ struct CompactableGCed : public GarbageCollected<CompactableGCed> {
 // static
 size_t CompactableGCed::g_destructor_callcount = 0;
 
+struct OtherCompactableGCed : public GarbageCollected<OtherCompactableGCed> {
+ public:
+  ~OtherCompactableGCed() { ++g_destructor_callcount; }
+  void Trace(Visitor* visitor) const {}
+  static size_t g_destructor_callcount;
+};
+// static
+size_t OtherCompactableGCed::g_destructor_callcount = 0;
+
+template <int kNumObjects>
+struct OtherCompactableHolder
+    : public GarbageCollected<OtherCompactableHolder<kNumObjects>> {
+ public:
+  explicit OtherCompactableHolder(cppgc::AllocationHandle& allocation_handle) {
+    for (int i = 0; i < kNumObjects; ++i)
+      objects[i] =
+          MakeGarbageCollected<OtherCompactableGCed>(allocation_handle);
+  }
+
+  void Trace(Visitor* visitor) const {
+    for (int i = 0; i < kNumObjects; ++i) {
+      VisitorBase::TraceRawForTesting(
+          visitor, const_cast<const OtherCompactableGCed*>(objects[i]));
+      visitor->RegisterMovableReference(
+          const_cast<const OtherCompactableGCed**>(&objects[i]));
+    }
+  }
+  OtherCompactableGCed* objects[kNumObjects]{};
+};
+
 template <int kNumObjects>
 struct CompactableHolder
     : public GarbageCollected<CompactableHolder<kNumObjects>> {
@@ -69,6 +106,8 @@ class CompactorTest : public testing::TestWithPlatform {
     Heap::HeapOptions options;
     options.custom_spaces.emplace_back(
         std::make_unique<CompactableCustomSpace>());
+    options.custom_spaces.emplace_back(
+        std::make_unique<OtherCompactableCustomSpace>());
     heap_ = Heap::Create(platform_, std::move(options));
   }
 
@@ -83,6 +122,7 @@ class CompactorTest : public testing::TestWithPlatform {
 
   void StartGC() {
     CompactableGCed::g_destructor_callcount = 0u;
+    OtherCompactableGCed::g_destructor_callcount = 0u;
     StartCompaction();
     heap()->StartIncrementalGarbageCollection(
         GCConfig::PreciseIncrementalConfig());
@@ -118,6 +158,11 @@ struct SpaceTrait<internal::CompactableGCed> {
   using Space = CompactableCustomSpace;
 };
 
+template <>
+struct SpaceTrait<internal::OtherCompactableGCed> {
+  using Space = OtherCompactableCustomSpace;
+};
+
 namespace internal {
 
 TEST_F(CompactorTest, NothingToCompact) {
@@ -244,5 +289,44 @@ TEST_F(CompactorTest, InteriorSlotToNextObject) {
   EXPECT_EQ(references[1], holder->objects[1]->other);
 }
 
+TEST_F(CompactorTest, CompactionBudgetCompactsSingleSpace) {
+  static constexpr int kNumObjects = 10;
+  Persistent<CompactableHolder<kNumObjects>> holder =
+      MakeGarbageCollected<CompactableHolder<kNumObjects>>(
+          GetAllocationHandle(), GetAllocationHandle());
+  Persistent<OtherCompactableHolder<kNumObjects>> other_holder =
+      MakeGarbageCollected<OtherCompactableHolder<kNumObjects>>(
+          GetAllocationHandle(), GetAllocationHandle());
+  CompactableGCed* references[kNumObjects] = {nullptr};
+  OtherCompactableGCed* other_references[kNumObjects] = {nullptr};
+  for (int i = 0; i < kNumObjects; ++i) {
+    references[i] = holder->objects[i];
+    other_references[i] = other_holder->objects[i];
+  }
+  // Any space exceeds the budget, so only the most fragmented one is
+  // compacted.
+  compactor().set_compaction_budget(1);
+  StartGC();
+  for (int i = 0; i < kNumObjects; i += 2) {
+    holder->objects[i] = nullptr;
+    other_holder->objects[i] = nullptr;
+  }
+  EndGC();
+  // Dead objects are reclaimed in both spaces, either by compaction or by
+  // sweeping.
+  EXPECT_EQ(5u, CompactableGCed::g_destructor_callcount);
+  EXPECT_EQ(5u, OtherCompactableGCed::g_destructor_callcount);
+  const bool compacted = compactor().WasCompacted(NormalPageSpace::From(
+      *heap()->raw_heap().CustomSpace(CustomSpaceIndex(0))));
+  const bool other_compacted = compactor().WasCompacted(NormalPageSpace::From(
+      *heap()->raw_heap().CustomSpace(CustomSpaceIndex(1))));
+  EXPECT_NE(compacted, other_compacted);
+  for (int i = 1; i < kNumObjects; i += 2) {
+    EXPECT_EQ(holder->objects[i], references[compacted ? i / 2 : i]);
+    EXPECT_EQ(other_holder->objects[i],
+              other_references[other_compacted ? i / 2 : i]);
+  }
+}
+
 }  // namespace internal
 }  // namespace cppgc
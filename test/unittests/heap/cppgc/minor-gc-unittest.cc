@@ -449,6 +449,36 @@ TYPED_TEST(MinorGCTestForType, OmitGenerationalBarrierForSentinels) {
   }
 }
 
+TYPED_TEST(MinorGCTestForType, OmitGenerationalBarrierForOldValue) {
+  using Type = typename TestFixture::Type;
+  using Other = typename OtherType<Type>::Type;
+
+  Persistent<Type> old =
+      MakeGarbageCollected<Type>(this->GetAllocationHandle());
+  Persistent<Type> old_value_same_type =
+      MakeGarbageCollected<Type>(this->GetAllocationHandle());
+  Persistent<Other> old_value_other_type =
+      MakeGarbageCollected<Other>(this->GetAllocationHandle());
+  RunGCAndExpectObjectsPromoted<GCType::kMinor, StackType::kWithout>(
+      *this, old.Get(), old_value_same_type.Get(), old_value_other_type.Get());
+
+  {
+    ExpectNoRememberedSlotsAdded _(*this);
+    old->next = old_value_same_type.Get();
+  }
+  {
+    ExpectNoRememberedSlotsAdded _(*this);
+    old->next = old_value_other_type.Get();
+  }
+
+  // Old-to-young stores still reach the slow path.
+  auto* young = MakeGarbageCollected<Type>(this->GetAllocationHandle());
+  {
+    ExpectRememberedSlotsAdded _(*this, {old->next.GetSlotForTesting()});
+    old->next = young;
+  }
+}
+
 template <typename From, typename To>
 void TestRememberedSetInvalidation(MinorGCTest& test) {
   Persistent<From> old = MakeGarbageCollected<From>(test.GetAllocationHandle());
@@ -27,9 +27,13 @@
 
 #include "src/handles/global-handles.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "include/v8-embedder-heap.h"
 #include "include/v8-function.h"
 #include "src/api/api-inl.h"
+#include "src/base/platform/platform.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
 #include "src/heap/factory.h"
@@ -555,6 +559,58 @@ TEST_F(GlobalHandlesTest, SecondPassPhantomCallbacks) {
   CHECK(fp.flag);
 }
 
+namespace {
+
+void SlowSecondPassCallback(const v8::WeakCallbackInfo<FlagAndGlobal>& data) {
+  base::OS::Sleep(base::TimeDelta::FromMicroseconds(100));
+  data.GetParameter()->flag = true;
+}
+
+void SlowFirstPassCallback(const v8::WeakCallbackInfo<FlagAndGlobal>& data) {
+  data.GetParameter()->handle.Reset();
+  data.SetSecondPassCallback(SlowSecondPassCallback);
+}
+
+size_t CountFlags(const std::vector<FlagAndGlobal>& fps) {
+  return std::count_if(fps.begin(), fps.end(),
+                       [](const FlagAndGlobal& fp) { return fp.flag; });
+}
+
+}  // namespace
+
+TEST_F(GlobalHandlesTest, SecondPassPhantomCallbacksAreTimeSliced) {
+  if (v8_flags.optimize_for_size || v8_flags.predictable) return;
+  v8::Isolate* isolate = v8_isolate();
+  DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+      i_isolate()->heap());
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(isolate);
+  v8::Context::Scope context_scope(context);
+  // Enough slow callbacks to take several time slices.
+  const size_t kNumberOfHandles = 256;
+  std::vector<FlagAndGlobal> fps(kNumberOfHandles);
+  for (FlagAndGlobal& fp : fps) {
+    ConstructJSApiObject(isolate, context, &fp);
+    fp.flag = false;
+    fp.handle.SetWeak(&fp, SlowFirstPassCallback,
+                      v8::WeakCallbackType::kParameter);
+  }
+  // A non-forced GC defers the second pass callbacks to a task.
+  CollectGarbage(i::OLD_SPACE);
+  EXPECT_EQ(0u, CountFlags(fps));
+
+  // Other tasks may be queued before the one running the callbacks.
+  while (CountFlags(fps) == 0) {
+    ASSERT_TRUE(v8::platform::PumpMessageLoop(
+        internal::V8::GetCurrentPlatform(), isolate));
+  }
+  // The first task stopped at its deadline and reposted itself.
+  EXPECT_LT(CountFlags(fps), kNumberOfHandles);
+
+  EmptyMessageQueues();
+  EXPECT_EQ(kNumberOfHandles, CountFlags(fps));
+}
+
 TEST_F(GlobalHandlesTest, MoveStrongGlobal) {
   v8::Isolate* isolate = v8_isolate();
   v8::HandleScope scope(isolate);
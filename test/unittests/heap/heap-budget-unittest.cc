@@ -0,0 +1,80 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/heap-budget.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// The budget only uses heaps as keys, so no real heaps are needed.
+Heap* FakeHeap(uintptr_t id) { return reinterpret_cast<Heap*>(id); }
+
+constexpr size_t kMB = MB;
+
+}  // namespace
+
+TEST(SharedHeapBudgetTest, SingleHeapGetsAllHeadroom) {
+  SharedHeapBudget budget(100 * kMB);
+  budget.AddHeap(FakeHeap(1));
+  EXPECT_EQ(100 * kMB,
+            budget.UpdateAndComputeLimit(FakeHeap(1), 40 * kMB, 1.0));
+  EXPECT_EQ(40 * kMB, budget.GetUsedBytes());
+  budget.RemoveHeap(FakeHeap(1));
+  EXPECT_EQ(0u, budget.GetUsedBytes());
+}
+
+TEST(SharedHeapBudgetTest, HeadroomIsSplitByAllocationRate) {
+  SharedHeapBudget budget(100 * kMB);
+  budget.AddHeap(FakeHeap(1));
+  budget.AddHeap(FakeHeap(2));
+  budget.UpdateAndComputeLimit(FakeHeap(1), 10 * kMB, 1.0);
+  // 80 MB headroom, heap 2 allocates three times as fast as heap 1.
+  EXPECT_EQ(10 * kMB + 60 * kMB,
+            budget.UpdateAndComputeLimit(FakeHeap(2), 10 * kMB, 3.0));
+  EXPECT_EQ(10 * kMB + 20 * kMB,
+            budget.UpdateAndComputeLimit(FakeHeap(1), 10 * kMB, 1.0));
+  budget.RemoveHeap(FakeHeap(1));
+  budget.RemoveHeap(FakeHeap(2));
+}
+
+TEST(SharedHeapBudgetTest, HeadroomIsSplitEquallyWithoutAllocationRates) {
+  SharedHeapBudget budget(100 * kMB);
+  budget.AddHeap(FakeHeap(1));
+  budget.AddHeap(FakeHeap(2));
+  EXPECT_EQ(50 * kMB, budget.UpdateAndComputeLimit(FakeHeap(1), 0, 0.0));
+  budget.RemoveHeap(FakeHeap(1));
+  budget.RemoveHeap(FakeHeap(2));
+}
+
+TEST(SharedHeapBudgetTest, AllocationRateIsSmoothed) {
+  SharedHeapBudget budget(100 * kMB);
+  budget.AddHeap(FakeHeap(1));
+  budget.AddHeap(FakeHeap(2));
+  budget.UpdateAndComputeLimit(FakeHeap(2), 0, 2.0);
+  budget.UpdateAndComputeLimit(FakeHeap(1), 0, 4.0);
+  // The forecast for heap 1 is now 0.5 * 0.0 + 0.5 * 4.0 = 2.0, the same as
+  // for heap 2.
+  EXPECT_EQ(50 * kMB, budget.UpdateAndComputeLimit(FakeHeap(1), 0, 0.0));
+  budget.RemoveHeap(FakeHeap(1));
+  budget.RemoveHeap(FakeHeap(2));
+}
+
+TEST(SharedHeapBudgetTest, ExhaustedBudgetAllowsNoGrowth) {
+  SharedHeapBudget budget(100 * kMB);
+  budget.AddHeap(FakeHeap(1));
+  EXPECT_EQ(120 * kMB,
+            budget.UpdateAndComputeLimit(FakeHeap(1), 120 * kMB, 1.0));
+  budget.SetBudgetInBytes(200 * kMB);
+  EXPECT_EQ(200 * kMB, budget.GetBudgetInBytes());
+  EXPECT_EQ(200 * kMB,
+            budget.UpdateAndComputeLimit(FakeHeap(1), 120 * kMB, 1.0));
+  budget.RemoveHeap(FakeHeap(1));
+}
+
+}  // namespace internal
+}  // namespace v8
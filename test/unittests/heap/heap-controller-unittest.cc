@@ -35,6 +35,7 @@ void CheckEqualRounded(double expected, double actual) {
 namespace {
 
 using V8Controller = MemoryController<V8HeapTrait>;
+using GlobalController = MemoryController<GlobalMemoryTrait>;
 
 }  // namespace
 
@@ -63,6 +64,19 @@ TEST_F(MemoryControllerTest, MaxHeapGrowingFactor) {
                              static_cast<size_t>(V8HeapTrait::kMaxSize)));
 }
 
+TEST_F(MemoryControllerTest, CombinedGcSpeed) {
+  CheckEqualRounded(100,
+                    GlobalController::CombinedGcSpeed(100 * MB, 100, 0, 300));
+  CheckEqualRounded(300,
+                    GlobalController::CombinedGcSpeed(0, 100, 100 * MB, 300));
+  CheckEqualRounded(100, GlobalController::CombinedGcSpeed(100 * MB, 100,
+                                                           100 * MB, 100));
+  // The slower heap takes 3/4 of the marking time.
+  CheckEqualRounded(150, GlobalController::CombinedGcSpeed(100 * MB, 100,
+                                                           100 * MB, 300));
+  CheckEqualRounded(0, GlobalController::CombinedGcSpeed(0, 100, 0, 300));
+}
+
 TEST_F(MemoryControllerTest, OldGenerationAllocationLimit) {
   Heap* heap = i_isolate()->heap();
   size_t old_gen_size = 128 * MB;
@@ -10,6 +10,7 @@
 
 #include "include/v8-isolate.h"
 #include "include/v8-object.h"
+#include "src/base/ring-buffer.h"
 #include "src/flags/flags.h"
 #include "src/handles/handles-inl.h"
 #include "src/heap/gc-tracer.h"
@@ -284,6 +285,135 @@ TEST_F(HeapTest, GrowAndShrinkNewSpace) {
   CHECK_EQ(old_capacity, new_capacity);
 }
 
+TEST_F(HeapTest, ConcurrentMinorMCSweepingOfEmptyPages) {
+  if (!v8_flags.minor_mc) return;
+  {
+    ManualGCScope manual_gc_scope(i_isolate());
+    v8_flags.concurrent_minor_mc_sweeping = true;
+    v8_flags.stress_concurrent_allocation = false;  // For SimulateFullSpace.
+  }
+  PagedNewSpace* new_space = PagedNewSpace::From(heap()->new_space());
+  CollectAllGarbage();
+  heap()->EnsureSweepingCompleted(
+      Heap::SweepingForcedFinalizationMode::kV8Only);
+
+  // Fill new space with garbage, so that the young GC leaves empty pages.
+  {
+    v8::HandleScope temporary_scope(reinterpret_cast<v8::Isolate*>(isolate()));
+    SimulateFullSpace(new_space);
+  }
+  CollectGarbage(NEW_SPACE);
+
+  // Empty pages are no longer swept in the atomic pause.
+  CHECK(heap()->sweeping_in_progress());
+  bool has_unswept_page = false;
+  for (Page* page : *new_space) {
+    if (!page->SweepingDone()) has_unswept_page = true;
+  }
+  CHECK(has_unswept_page);
+
+  heap()->EnsureSweepingCompleted(
+      Heap::SweepingForcedFinalizationMode::kV8Only);
+  for (Page* page : *new_space) {
+    CHECK(page->SweepingDone());
+  }
+
+  // The swept pages can be allocated into again.
+  {
+    v8::HandleScope temporary_scope(reinterpret_cast<v8::Isolate*>(isolate()));
+    SimulateFullSpace(new_space);
+  }
+  CollectGarbage(NEW_SPACE);
+}
+
+TEST_F(HeapTest, SurvivalBasedSizingGrowsNewSpaceOnHighSurvival) {
+  if (v8_flags.single_generation || v8_flags.minor_mc) return;
+  {
+    ManualGCScope manual_gc_scope(i_isolate());
+    v8_flags.survival_based_new_space_sizing = true;
+    v8_flags.stress_concurrent_allocation = false;  // For SimulateFullSpace.
+  }
+  NewSpace* new_space = heap()->new_space();
+  if (heap()->MaxSemiSpaceSize() == heap()->InitialSemiSpaceSize()) {
+    return;
+  }
+
+  CollectAllGarbage();
+  ShrinkNewSpace(new_space);
+  size_t old_capacity = new_space->TotalCapacity();
+
+  v8::HandleScope scope(reinterpret_cast<v8::Isolate*>(isolate()));
+  // Everything allocated here stays alive, so the first scavenge records a
+  // survival rate close to 100% and the next one grows the new space.
+  SimulateFullSpace(new_space);
+  CollectGarbage(NEW_SPACE);
+  CollectGarbage(NEW_SPACE);
+  CHECK_LT(old_capacity, new_space->TotalCapacity());
+}
+
+TEST_F(HeapTest, SurvivalBasedSizingShrinksNewSpaceOnLowSurvival) {
+  if (v8_flags.single_generation || v8_flags.minor_mc) return;
+  {
+    ManualGCScope manual_gc_scope(i_isolate());
+    v8_flags.survival_based_new_space_sizing = true;
+    v8_flags.stress_concurrent_allocation = false;  // For SimulateFullSpace.
+  }
+  NewSpace* new_space = heap()->new_space();
+  if (heap()->MaxSemiSpaceSize() == heap()->InitialSemiSpaceSize()) {
+    return;
+  }
+
+  CollectAllGarbage();
+  GrowNewSpace();
+  size_t grown_capacity = new_space->TotalCapacity();
+
+  // Only garbage is allocated between the scavenges, so hardly anything
+  // survives them. Run enough of them to replace every survival event that
+  // GCTracer averages over.
+  for (int i = 0; i <= base::RingBuffer<double>::kSize; i++) {
+    {
+      v8::HandleScope temporary_scope(
+          reinterpret_cast<v8::Isolate*>(isolate()));
+      SimulateFullSpace(new_space);
+    }
+    CollectGarbage(NEW_SPACE);
+  }
+  CHECK_GT(grown_capacity, new_space->TotalCapacity());
+}
+
+TEST_F(HeapTest, SurvivalBasedSizingIgnoresSurvivalOfFreshlyTenuredSites) {
+  if (v8_flags.single_generation || v8_flags.minor_mc ||
+      !v8_flags.allocation_site_pretenuring) {
+    return;
+  }
+  {
+    ManualGCScope manual_gc_scope(i_isolate());
+    v8_flags.survival_based_new_space_sizing = true;
+    v8_flags.stress_concurrent_allocation = false;  // For SimulateFullSpace.
+  }
+  NewSpace* new_space = heap()->new_space();
+  if (heap()->MaxSemiSpaceSize() == heap()->InitialSemiSpaceSize()) {
+    return;
+  }
+
+  CollectAllGarbage();
+  ShrinkNewSpace(new_space);
+
+  v8::HandleScope scope(reinterpret_cast<v8::Isolate*>(isolate()));
+  // The same high survival as in the test above, but the scavenge also
+  // switches an allocation site to old space allocation. The next scavenge
+  // must not grow the new space from that survival rate.
+  Handle<AllocationSite> site =
+      isolate()->factory()->NewAllocationSite(/*with_weak_next*/ true);
+  SimulateFullSpace(new_space);
+  heap()->pretenuring_handler()->PretenureAllocationSiteOnNextCollection(*site);
+  CollectGarbage(NEW_SPACE);
+  CHECK(heap()->pretenuring_handler()->MadeTenureDecisionsInLastGC());
+  size_t old_capacity = new_space->TotalCapacity();
+  CollectGarbage(NEW_SPACE);
+  CHECK_GE(old_capacity, new_space->TotalCapacity());
+}
+
 TEST_F(HeapTest, CollectingAllAvailableGarbageShrinksNewSpace) {
   if (v8_flags.single_generation) return;
   v8_flags.stress_concurrent_allocation = false;  // For SimulateFullSpace.
@@ -4,11 +4,16 @@
 
 #include "src/heap/local-heap.h"
 
+#include <vector>
+
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
+#include "src/heap/concurrent-allocator.h"
 #include "src/heap/heap.h"
+#include "src/heap/local-heap-inl.h"
 #include "src/heap/parked-scope.h"
 #include "src/heap/safepoint.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -81,6 +86,61 @@ TEST_F(LocalHeapTest, CurrentBackground) {
 
 namespace {
 
+// Allocates `bytes` in small objects and returns the maximum LAB sizes seen
+// along the way, without repetitions.
+std::vector<size_t> AllocateAndRecordMaxLabSizes(LocalHeap* local_heap,
+                                                 size_t bytes) {
+  ConcurrentAllocator* allocator = local_heap->old_space_allocator();
+  std::vector<size_t> max_lab_sizes = {allocator->max_lab_size_for_testing()};
+  const int kObjectSize = KB;
+  for (size_t allocated = 0; allocated < bytes; allocated += kObjectSize) {
+    Address address =
+        local_heap->AllocateRawOrFail(kObjectSize, AllocationType::kOld);
+    local_heap->heap()->CreateFillerObjectAtBackground(address, kObjectSize);
+    if (allocator->max_lab_size_for_testing() != max_lab_sizes.back()) {
+      max_lab_sizes.push_back(allocator->max_lab_size_for_testing());
+    }
+  }
+  return max_lab_sizes;
+}
+
+}  // namespace
+
+TEST_F(LocalHeapTest, AdaptiveLabsGrowAndReset) {
+  FlagScope<bool> adaptive_labs(&v8_flags.concurrent_allocator_adaptive_labs,
+                                true);
+  LocalHeap local_heap(i_isolate()->heap(), ThreadKind::kBackground);
+  UnparkedScope unparked_scope(&local_heap);
+
+  // Every refill doubles the next LAB until the adaptive maximum is reached.
+  const size_t kMaxLabSize = ConcurrentAllocator::kMaxLabSize;
+  const size_t kMaxAdaptiveLabSize = ConcurrentAllocator::kMaxAdaptiveLabSize;
+  std::vector<size_t> expected;
+  for (size_t size = kMaxLabSize; size < kMaxAdaptiveLabSize; size *= 2) {
+    expected.push_back(size);
+  }
+  expected.push_back(kMaxAdaptiveLabSize);
+  EXPECT_EQ(expected,
+            AllocateAndRecordMaxLabSizes(&local_heap, 4 * kMaxAdaptiveLabSize));
+
+  // Giving up the LAB, e.g. for a GC, starts over with small LABs.
+  ConcurrentAllocator* allocator = local_heap.old_space_allocator();
+  allocator->FreeLinearAllocationArea();
+  EXPECT_EQ(kMaxLabSize, allocator->max_lab_size_for_testing());
+}
+
+TEST_F(LocalHeapTest, LabsDoNotGrowByDefault) {
+  FlagScope<bool> adaptive_labs(&v8_flags.concurrent_allocator_adaptive_labs,
+                                false);
+  LocalHeap local_heap(i_isolate()->heap(), ThreadKind::kBackground);
+  UnparkedScope unparked_scope(&local_heap);
+  const size_t kMaxLabSize = ConcurrentAllocator::kMaxLabSize;
+  EXPECT_EQ(std::vector<size_t>{kMaxLabSize},
+            AllocateAndRecordMaxLabSizes(&local_heap, 4 * kMaxLabSize));
+}
+
+namespace {
+
 class GCEpilogue {
  public:
   static void Callback(LocalIsolate*, GCType, GCCallbackFlags, void* data) {
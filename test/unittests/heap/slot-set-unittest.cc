@@ -155,5 +155,36 @@ TEST(TypedSlotSet, Merge) {
       TypedSlotSet::KEEP_EMPTY_CHUNKS);
 }
 
+TEST(SlotSet, MergeCompact) {
+  const size_t kBuckets = SlotSet::kBucketsRegularPage;
+  SlotSet* set0 = SlotSet::Allocate(kBuckets);
+  SlotSet* set1 = SlotSet::Allocate(kBuckets);
+  const size_t kBucketSize = SlotSet::OffsetForBucket(1);
+  // Bucket 0 is inline in both sets, bucket 1 only in set0 and bucket 2 only
+  // in set1. Bucket 3 is empty in set0.
+  set0->InsertCompact<SlotSet::AccessMode::NON_ATOMIC>(0);
+  set1->InsertCompact<SlotSet::AccessMode::NON_ATOMIC>(kTaggedSize);
+  set0->InsertCompact<SlotSet::AccessMode::NON_ATOMIC>(kBucketSize);
+  set1->Insert<SlotSet::AccessMode::NON_ATOMIC>(kBucketSize + kTaggedSize);
+  set0->Insert<SlotSet::AccessMode::NON_ATOMIC>(2 * kBucketSize);
+  set1->InsertCompact<SlotSet::AccessMode::NON_ATOMIC>(2 * kBucketSize +
+                                                      kTaggedSize);
+  set1->InsertCompact<SlotSet::AccessMode::NON_ATOMIC>(3 * kBucketSize);
+  set0->Merge(set1, kBuckets);
+  SlotSet::Delete(set1, kBuckets);
+
+  for (size_t bucket = 0; bucket < 3; bucket++) {
+    EXPECT_TRUE(set0->Lookup(bucket * kBucketSize));
+    EXPECT_TRUE(set0->Lookup(bucket * kBucketSize + kTaggedSize));
+    EXPECT_FALSE(set0->Lookup(bucket * kBucketSize + 2 * kTaggedSize));
+  }
+  EXPECT_TRUE(set0->Lookup(3 * kBucketSize));
+  size_t count = set0->Iterate(
+      0, 0, kBuckets, [](MaybeObjectSlot slot) { return KEEP_SLOT; },
+      SlotSet::KEEP_EMPTY_BUCKETS);
+  EXPECT_EQ(7u, count);
+  SlotSet::Delete(set0, kBuckets);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -8,12 +8,14 @@
 
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
+#include "src/heap/code-range.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-write-barrier-inl.h"
 #include "src/heap/heap.h"
 #include "src/heap/large-spaces.h"
 #include "src/heap/memory-chunk.h"
 #include "src/heap/spaces-inl.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 
 namespace v8 {
@@ -298,5 +300,18 @@ TEST_F(SpacesTest,
   }
 }
 
+TEST_F(SpacesTest, CodeRangeHugePagesAlignment) {
+  FlagScope<bool> huge_pages(&v8_flags.code_range_huge_pages, true);
+  // Not a multiple of the huge page size.
+  const size_t kRequestedSize = 5 * MB;
+  CodeRange code_range;
+  ASSERT_TRUE(
+      code_range.InitReservation(GetPlatformPageAllocator(), kRequestedSize));
+  EXPECT_TRUE(IsAligned(code_range.base(), 2 * MB));
+  EXPECT_TRUE(IsAligned(code_range.size(), 2 * MB));
+  EXPECT_LE(kRequestedSize, code_range.size());
+  code_range.Free();
+}
+
 }  // namespace internal
 }  // namespace v8
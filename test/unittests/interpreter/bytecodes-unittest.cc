@@ -319,6 +319,29 @@ TEST(Bytecodes, IsJumpIfToBoolean) {
 #undef TEST_BYTECODE
 }
 
+TEST(Bytecodes, IsJumpIfBooleanLookahead) {
+  // The lookahead only makes sense after bytecodes that always leave a
+  // boolean in the accumulator.
+  EXPECT_TRUE(Bytecodes::IsJumpIfBooleanLookahead(Bytecode::kTestEqual,
+                                                  OperandScale::kSingle));
+  EXPECT_TRUE(Bytecodes::IsJumpIfBooleanLookahead(Bytecode::kTestLessThan,
+                                                  OperandScale::kSingle));
+  EXPECT_TRUE(Bytecodes::IsJumpIfBooleanLookahead(Bytecode::kTestNull,
+                                                  OperandScale::kSingle));
+  EXPECT_TRUE(Bytecodes::IsJumpIfBooleanLookahead(Bytecode::kTestTypeOf,
+                                                  OperandScale::kSingle));
+  EXPECT_FALSE(Bytecodes::IsJumpIfBooleanLookahead(Bytecode::kTestEqual,
+                                                   OperandScale::kDouble));
+  EXPECT_FALSE(Bytecodes::IsJumpIfBooleanLookahead(Bytecode::kTestEqual,
+                                                   OperandScale::kQuadruple));
+  EXPECT_FALSE(Bytecodes::IsJumpIfBooleanLookahead(Bytecode::kAdd,
+                                                   OperandScale::kSingle));
+  EXPECT_FALSE(Bytecodes::IsJumpIfBooleanLookahead(Bytecode::kLdaTrue,
+                                                   OperandScale::kSingle));
+  EXPECT_FALSE(Bytecodes::IsJumpIfBooleanLookahead(Bytecode::kJumpIfTrue,
+                                                   OperandScale::kSingle));
+}
+
 #undef OR_IS_BYTECODE
 #undef IN_BYTECODE_LIST
 
@@ -252,6 +252,58 @@ TEST(CustomDefaultPlatformTest, RunBackgroundTask) {
   EXPECT_TRUE(task_executed);
 }
 
+namespace {
+
+class BlockingBackgroundTask : public Task {
+ public:
+  BlockingBackgroundTask(base::Semaphore* started, base::Semaphore* release)
+      : started_(started), release_(release) {}
+
+  void Run() override {
+    started_->Signal();
+    release_->Wait();
+  }
+
+ private:
+  base::Semaphore* started_;
+  base::Semaphore* release_;
+};
+
+}  // namespace
+
+TEST(CustomDefaultPlatformTest, RunBackgroundTaskWithPriorityMode) {
+  DefaultPlatform platform(1, IdleTaskSupport::kDisabled, nullptr,
+                           PriorityMode::kApply);
+
+  // Occupy the only best effort worker thread.
+  base::Semaphore started(0);
+  base::Semaphore release(0);
+  platform.CallLowPriorityTaskOnWorkerThread(
+      std::make_unique<BlockingBackgroundTask>(&started, &release));
+  EXPECT_TRUE(started.WaitFor(base::TimeDelta::FromSeconds(1)));
+
+  // Tasks of higher priority still run on their own worker threads.
+  base::Semaphore sem(0);
+  bool blocking_task_executed = false;
+  StrictMock<TestBackgroundTask>* blocking_task =
+      new StrictMock<TestBackgroundTask>(&sem, &blocking_task_executed);
+  EXPECT_CALL(*blocking_task, Die());
+  platform.CallBlockingTaskOnWorkerThread(
+      std::unique_ptr<Task>(blocking_task));
+  EXPECT_TRUE(sem.WaitFor(base::TimeDelta::FromSeconds(1)));
+  EXPECT_TRUE(blocking_task_executed);
+
+  bool task_executed = false;
+  StrictMock<TestBackgroundTask>* task =
+      new StrictMock<TestBackgroundTask>(&sem, &task_executed);
+  EXPECT_CALL(*task, Die());
+  platform.CallOnWorkerThread(std::unique_ptr<Task>(task));
+  EXPECT_TRUE(sem.WaitFor(base::TimeDelta::FromSeconds(1)));
+  EXPECT_TRUE(task_executed);
+
+  release.Signal();
+}
+
 TEST(CustomDefaultPlatformTest, PostForegroundTaskAfterPlatformTermination) {
   std::shared_ptr<TaskRunner> foreground_taskrunner;
   {
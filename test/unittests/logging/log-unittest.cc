@@ -29,6 +29,10 @@
 
 #include "src/logging/log.h"
 
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -47,6 +51,10 @@
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
+#if V8_OS_LINUX
+#include <unistd.h>
+#endif  // V8_OS_LINUX
+
 using v8::base::EmbeddedVector;
 using v8::internal::Address;
 using v8::internal::V8FileLogger;
@@ -1232,4 +1240,153 @@ TEST_F(LogTest, BuiltinsNotLoggedAsLazyCompile) {
         {"code-creation,JS,2,", std::string(buffer.begin())}));
   }
 }
+
+#if V8_OS_LINUX
+class LogPerfJitTest : public TestWithPlatform {
+ public:
+  LogPerfJitTest()
+      : array_buffer_allocator_(
+            v8::ArrayBuffer::Allocator::NewDefaultAllocator()) {}
+  static void SetUpTestSuite() {
+    i::v8_flags.perf_prof = true;
+    // Keep the jitdump file around so that the test can read it back.
+    i::v8_flags.perf_prof_delete_file = false;
+    i::v8_flags.stress_compaction = true;
+    i::v8_flags.allow_natives_syntax = true;
+    TestWithPlatform::SetUpTestSuite();
+  }
+  static void TearDownTestSuite() {
+    TestWithPlatform::TearDownTestSuite();
+    i::v8_flags.perf_prof = false;
+    i::v8_flags.perf_prof_delete_file = true;
+    i::v8_flags.stress_compaction = false;
+    i::v8_flags.allow_natives_syntax = false;
+  }
+
+  v8::ArrayBuffer::Allocator* array_buffer_allocator() {
+    return array_buffer_allocator_.get();
+  }
+  void RunJS(v8::Isolate* isolate, const char* source) {
+    v8::Local<v8::Context> context = isolate->GetCurrentContext();
+    v8::Local<v8::String> source_string =
+        v8::String::NewFromUtf8(isolate, source).ToLocalChecked();
+    v8::Script::Compile(context, source_string)
+        .ToLocalChecked()
+        ->Run(context)
+        .ToLocalChecked();
+  }
+
+ private:
+  std::unique_ptr<v8::ArrayBuffer::Allocator> array_buffer_allocator_;
+};
+
+// The layout of the jitdump records read by the test, see perf-jit.cc.
+struct JitDumpRecord {
+  uint32_t event;
+  uint32_t size;
+  uint64_t time_stamp;
+  uint32_t process_id;
+  uint32_t thread_id;
+  uint64_t vma;
+};
+
+struct JitDumpCodeLoad : JitDumpRecord {
+  uint64_t code_address;
+  uint64_t code_size;
+  uint64_t code_id;
+};
+
+struct JitDumpCodeMove : JitDumpRecord {
+  uint64_t old_code_address;
+  uint64_t new_code_address;
+  uint64_t code_size;
+  uint64_t code_id;
+};
+
+TEST_F(LogPerfJitTest, MoveRecordsReferToLoadRecords) {
+  if (!i::v8_flags.turbofan || i::v8_flags.jitless) {
+    GTEST_SKIP() << "Needs optimized code to move";
+  }
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+
+    // Drop every other optimized function, so that the remaining code is
+    // evacuated from fragmented pages. Code of the dropped functions dies,
+    // and new code may be allocated at its addresses.
+    const char* source =
+        "const fns = [];"
+        "for (let i = 0; i < 100; i++) {"
+        "  const f = new Function('x', `return x + ${i};`);"
+        "  %PrepareFunctionForOptimization(f);"
+        "  f(1);"
+        "  %OptimizeFunctionOnNextCall(f);"
+        "  f(1);"
+        "  fns.push(f);"
+        "}"
+        "for (let i = 0; i < fns.length; i += 2) fns[i] = null;";
+    RunJS(isolate, source);
+    i::Heap* heap = reinterpret_cast<i::Isolate*>(isolate)->heap();
+    heap->PreciseCollectAllGarbage(i::Heap::kNoGCFlags,
+                                   i::GarbageCollectionReason::kTesting);
+    RunJS(isolate, "for (let i = 1; i < fns.length; i += 2) fns[i](1);");
+    heap->PreciseCollectAllGarbage(i::Heap::kNoGCFlags,
+                                   i::GarbageCollectionReason::kTesting);
+  }
+  // Disposing the last isolate closes the jitdump file.
+  isolate->Dispose();
+
+  std::string file_name = "./jit-" + std::to_string(getpid()) + ".dump";
+  std::ifstream file(file_name, std::ios::binary);
+  CHECK(file.good());
+  std::vector<char> contents((std::istreambuf_iterator<char>(file)),
+                             std::istreambuf_iterator<char>());
+  file.close();
+  std::remove(file_name.c_str());
+
+  // The header starts with its magic, version and size.
+  CHECK_GE(contents.size(), 3 * sizeof(uint32_t));
+  uint32_t header_size;
+  memcpy(&header_size, contents.data() + 2 * sizeof(uint32_t),
+         sizeof(header_size));
+
+  // The current address of the code of every load record.
+  std::unordered_map<uint64_t, uint64_t> code_addresses;
+  int moves = 0;
+  for (size_t offset = header_size; offset < contents.size();) {
+    JitDumpRecord record;
+    CHECK_LE(offset + offsetof(JitDumpRecord, process_id), contents.size());
+    memcpy(&record, contents.data() + offset,
+           offsetof(JitDumpRecord, process_id));
+    CHECK_GE(record.size, offsetof(JitDumpRecord, process_id));
+    CHECK_LE(offset + record.size, contents.size());
+    if (record.event == 0) {
+      JitDumpCodeLoad load;
+      CHECK_GE(record.size, sizeof(load));
+      memcpy(&load, contents.data() + offset, sizeof(load));
+      code_addresses[load.code_id] = load.code_address;
+    } else if (record.event == 1) {
+      JitDumpCodeMove move;
+      CHECK_EQ(record.size, sizeof(move));
+      memcpy(&move, contents.data() + offset, sizeof(move));
+      // A move refers to an earlier load record, at the address the code was
+      // last loaded at or moved to.
+      auto it = code_addresses.find(move.code_id);
+      CHECK(it != code_addresses.end());
+      CHECK_EQ(it->second, move.old_code_address);
+      it->second = move.new_code_address;
+      moves++;
+    }
+    offset += record.size;
+  }
+  CHECK_GT(moves, 0);
+}
+#endif  // V8_OS_LINUX
+
 }  // namespace v8
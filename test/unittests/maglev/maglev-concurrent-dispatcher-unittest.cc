@@ -0,0 +1,105 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifdef V8_ENABLE_MAGLEV
+
+#include "src/maglev/maglev-concurrent-dispatcher.h"
+
+#include <vector>
+
+#include "src/codegen/compiler.h"
+#include "src/execution/isolate.h"
+#include "src/execution/stack-guard.h"
+#include "src/flags/flags.h"
+#include "src/objects/js-function-inl.h"
+#include "src/objects/objects-inl.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+namespace maglev {
+
+class MaglevConcurrentDispatcherTest : public TestWithNativeContext {
+ public:
+  static void SetUpTestSuite() {
+    saved_maglev_ = v8_flags.maglev;
+    saved_concurrent_recompilation_ = v8_flags.concurrent_recompilation;
+    saved_allow_natives_syntax_ = v8_flags.allow_natives_syntax;
+    v8_flags.maglev = true;
+    v8_flags.concurrent_recompilation = true;
+    v8_flags.allow_natives_syntax = true;
+    TestWithNativeContext::SetUpTestSuite();
+  }
+  static void TearDownTestSuite() {
+    TestWithNativeContext::TearDownTestSuite();
+    v8_flags.maglev = saved_maglev_;
+    v8_flags.concurrent_recompilation = saved_concurrent_recompilation_;
+    v8_flags.allow_natives_syntax = saved_allow_natives_syntax_;
+  }
+
+ private:
+  static bool saved_maglev_;
+  static bool saved_concurrent_recompilation_;
+  static bool saved_allow_natives_syntax_;
+};
+
+bool MaglevConcurrentDispatcherTest::saved_maglev_;
+bool MaglevConcurrentDispatcherTest::saved_concurrent_recompilation_;
+bool MaglevConcurrentDispatcherTest::saved_allow_natives_syntax_;
+
+TEST_F(MaglevConcurrentDispatcherTest, FinalizationBudgetDefersJobs) {
+  MaglevConcurrentDispatcher* dispatcher =
+      i_isolate()->maglev_concurrent_dispatcher();
+  ASSERT_TRUE(dispatcher->is_enabled());
+
+  // Queue the jobs from C++, so that no install interrupt is handled before
+  // the test finalizes them.
+  constexpr int kFunctions = 3;
+  std::vector<Handle<JSFunction>> functions;
+  for (int i = 0; i < kFunctions; i++) {
+    Handle<JSFunction> function = RunJS<JSFunction>(
+        "(function() {"
+        "  const f = new Function('a', 'return a + 1;');"
+        "  %PrepareFunctionForOptimization(f);"
+        "  f(1);"
+        "  return f;"
+        "})()");
+    Compiler::CompileOptimized(i_isolate(), function,
+                               ConcurrencyMode::kConcurrent, CodeKind::MAGLEV);
+    functions.push_back(function);
+  }
+  dispatcher->AwaitCompileJobs();
+  ASSERT_EQ(static_cast<size_t>(kFunctions),
+            dispatcher->finished_jobs_for_testing());
+  i_isolate()->stack_guard()->ClearInstallMaglevCode();
+
+  // The budget is used up before the first job, so all jobs stay queued for
+  // the next interrupt.
+  dispatcher->set_finalization_budget_for_testing(base::TimeDelta());
+  dispatcher->FinalizeFinishedJobs(/*use_time_budget*/ true);
+  EXPECT_EQ(static_cast<size_t>(kFunctions),
+            dispatcher->finished_jobs_for_testing());
+  EXPECT_TRUE(i_isolate()->stack_guard()->CheckInstallMaglevCode());
+  i_isolate()->stack_guard()->ClearInstallMaglevCode();
+  for (Handle<JSFunction> function : functions) {
+    EXPECT_FALSE(function->HasAttachedCodeKind(CodeKind::MAGLEV));
+  }
+
+  // With enough budget, the next interrupt drains the queue.
+  dispatcher->set_finalization_budget_for_testing(
+      base::TimeDelta::FromSeconds(60));
+  dispatcher->FinalizeFinishedJobs(/*use_time_budget*/ true);
+  EXPECT_EQ(0u, dispatcher->finished_jobs_for_testing());
+  EXPECT_FALSE(i_isolate()->stack_guard()->CheckInstallMaglevCode());
+  for (Handle<JSFunction> function : functions) {
+    EXPECT_TRUE(function->HasAttachedCodeKind(CodeKind::MAGLEV));
+  }
+}
+
+}  // namespace maglev
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_ENABLE_MAGLEV
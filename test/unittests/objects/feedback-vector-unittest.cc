@@ -7,6 +7,7 @@
 #include "src/heap/factory.h"
 #include "src/objects/feedback-cell-inl.h"
 #include "src/objects/objects-inl.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 
 namespace v8 {
@@ -488,6 +489,51 @@ TEST_F(FeedbackVectorTest, VectorLoadICStates) {
   CHECK_EQ(InlineCacheState::MEGAMORPHIC, nexus.ic_state());
 }
 
+TEST_F(FeedbackVectorTest, VectorLoadICStatesSameHandler) {
+  if (!i::v8_flags.use_ic) return;
+  if (i::v8_flags.always_turbofan) return;
+  v8_flags.allow_natives_syntax = true;
+  FlagScope<int> same_handler_map_count(
+      &v8_flags.max_valid_polymorphic_map_count_same_handler, 8);
+
+  v8::HandleScope scope(v8_isolate());
+  Isolate* isolate = i_isolate();
+
+  // All these objects have foo in the same in-object field, so they share
+  // the load handler.
+  TryRunJS(
+      "function make(i) { var o = { foo: i }; o['bar' + i] = i; return o; }"
+      "%EnsureFeedbackVectorForFunction(f);"
+      "function f(a) { return a.foo; }"
+      "for (var i = 0; i < 8; i++) f(make(i));");
+  Handle<JSFunction> f = GetFunction("f");
+  FeedbackNexus nexus(handle(f->feedback_vector(), isolate), FeedbackSlot(0));
+  CHECK_EQ(InlineCacheState::POLYMORPHIC, nexus.ic_state());
+  MapHandles maps;
+  nexus.ExtractMaps(&maps);
+  CHECK_EQ(8, maps.size());
+
+  TryRunJS("f(make(8))");
+  CHECK_EQ(InlineCacheState::MEGAMORPHIC, nexus.ic_state());
+
+  // Different field locations need different handlers, which keeps the
+  // default limit.
+  TryRunJS(
+      "%EnsureFeedbackVectorForFunction(g);"
+      "function g(a) { return a.foo; }"
+      "g({ foo: 0 });"
+      "g({ a: 0, foo: 0 });"
+      "g({ a: 0, b: 0, foo: 0 });"
+      "g({ a: 0, b: 0, c: 0, foo: 0 });");
+  Handle<JSFunction> g = GetFunction("g");
+  FeedbackNexus g_nexus(handle(g->feedback_vector(), isolate),
+                        FeedbackSlot(0));
+  CHECK_EQ(InlineCacheState::POLYMORPHIC, g_nexus.ic_state());
+
+  TryRunJS("g({ a: 0, b: 0, c: 0, d: 0, foo: 0 })");
+  CHECK_EQ(InlineCacheState::MEGAMORPHIC, g_nexus.ic_state());
+}
+
 TEST_F(FeedbackVectorTest, VectorLoadGlobalICSlotSharing) {
   if (!i::v8_flags.use_ic) return;
   if (i::v8_flags.always_turbofan) return;
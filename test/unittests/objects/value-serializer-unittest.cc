@@ -985,6 +985,32 @@ TEST_F(ValueSerializerTest, RoundTripDictionaryObjectForTransitions) {
       ",{\"\xF0\x9F\x91\x8A\":5,\"\xF0\x9F\x91\x9B\":6}]");
 }
 
+TEST_F(ValueSerializerTest, RoundTripObjectsWithShapeHint) {
+  // The root map has several transitions, so keys are guessed from the shape
+  // of the previous object. The hint must also cope with objects that diverge
+  // from it part way through, or that have more properties than it.
+  RoundTripJSON(
+      "[{\"a\":1},{\"b\":2},{\"c\":3}"
+      ",{\"id\":1,\"name\":\"x\",\"tags\":[]}"
+      ",{\"id\":2,\"name\":\"y\",\"tags\":[1]}"
+      ",{\"id\":3,\"label\":\"z\",\"tags\":[2]}"
+      ",{\"id\":4,\"name\":\"w\",\"tags\":[3],\"extra\":true}"
+      ",{\"name\":\"v\",\"id\":5}"
+      ",{\"id\":6,\"name\":7.5,\"tags\":null}]");
+}
+
+TEST_F(ValueSerializerTest, RoundTripNestedObjectsWithShapeHint) {
+  // Inner objects finish before the outer object that holds them. Each
+  // nesting depth keeps its own hint, so records with nested objects still
+  // guess the outer keys from the previous record.
+  RoundTripJSON(
+      "[{\"id\":1,\"pos\":{\"x\":1,\"y\":2},\"name\":\"a\"}"
+      ",{\"id\":2,\"pos\":{\"x\":3,\"y\":4},\"name\":\"b\"}"
+      ",{\"id\":3,\"pos\":{\"y\":5,\"x\":6},\"name\":\"c\"}"
+      ",{\"id\":4,\"pos\":{\"x\":{\"id\":5}},\"name\":\"d\"}"
+      ",{\"x\":7,\"id\":8}]");
+}
+
 TEST_F(ValueSerializerTest, DecodeDictionaryObjectVersion0) {
   // Empty object.
   Local<Value> value = DecodeTestForVersion0({0x7B, 0x00});
@@ -3374,6 +3400,14 @@ TEST_F(ValueSerializerTestWithLimitedMemory, FailIfNoMemoryInWriteHostObject) {
   EXPECT_TRUE(EvaluateScriptForInput("gotA")->IsFalse());
 }
 
+TEST_F(ValueSerializerTestWithLimitedMemory, LargeArrayBufferView) {
+  // The buffer grows to fit the contents of a large ArrayBuffer, and the view
+  // that's written after them fits in without doubling it.
+  constexpr size_t kByteLength = 1 << 20;
+  serializer_delegate_.SetMemoryLimit(kByteLength + kByteLength / 4);
+  EncodeTest("new Uint8Array(1 << 20)");
+}
+
 // We only have basic tests and tests for .stack here, because we have more
 // comprehensive tests as web platform tests.
 TEST_F(ValueSerializerTest, RoundTripError) {
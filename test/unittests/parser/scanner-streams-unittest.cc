@@ -412,6 +412,32 @@ TEST_F(ScannerStreamsTest, Utf8SingleByteChunks) {
   }
 }
 
+TEST_F(ScannerStreamsTest, Utf8AsciiRuns) {
+  // ASCII runs are copied in blocks. Put a two-byte character after runs of
+  // every length up to a few blocks, at every alignment.
+  std::string data;
+  std::vector<uint16_t> expected;
+  for (int run = 0; run < 70; run++) {
+    for (int i = 0; i < run; i++) {
+      char c = static_cast<char>('a' + (run + i) % 26);
+      data.push_back(c);
+      expected.push_back(c);
+    }
+    data.append("\xc3\xa4");
+    expected.push_back(0xE4);
+  }
+  const char* chunks[] = {data.c_str(), ""};
+  ChunkSource chunk_source(chunks);
+  std::unique_ptr<v8::internal::Utf16CharacterStream> stream(
+      v8::internal::ScannerStream::For(
+          &chunk_source, v8::ScriptCompiler::StreamedSource::UTF8));
+
+  for (uint16_t c : expected) {
+    CHECK_EQ(c, stream->Advance());
+  }
+  CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput, stream->Advance());
+}
+
 #define CHECK_EQU(v1, v2) CHECK_EQ(static_cast<int>(v1), static_cast<int>(v2))
 
 void TestCharacterStream(const char* reference, i::Utf16CharacterStream* stream,
@@ -2145,6 +2145,63 @@ TEST_F(RegExpTest, PeepholeSkipUntilGtOrNotBitInTable) {
                           BC_SKIP_UNTIL_GT_OR_NOT_BIT_IN_TABLE)));
 }
 
+void CreatePeepholeLoadCurrentCharAndCheckCharInRangeBytecode(
+    RegExpMacroAssembler* m) {
+  Label match;
+  m->LoadCurrentCharacter(0, nullptr, true);
+  m->CheckCharacterInRange('a', 'z', &match);
+  m->Fail();
+  m->Bind(&match);
+  m->AdvanceCurrentPosition(1);
+}
+
+TEST_F(RegExpTest, PeepholeLoadCurrentCharAndCheckCharInRange) {
+  Zone zone(i_isolate()->allocator(), ZONE_NAME);
+  Factory* factory = i_isolate()->factory();
+  HandleScope scope(i_isolate());
+
+  RegExpBytecodeGenerator orig(i_isolate(), &zone);
+  RegExpBytecodeGenerator opt(i_isolate(), &zone);
+
+  CreatePeepholeLoadCurrentCharAndCheckCharInRangeBytecode(&orig);
+  CreatePeepholeLoadCurrentCharAndCheckCharInRangeBytecode(&opt);
+
+  Handle<String> source = factory->NewStringFromStaticChars("dummy");
+
+  v8_flags.regexp_peephole_optimization = false;
+  Handle<ByteArray> array = Handle<ByteArray>::cast(orig.GetCode(source));
+  int length = array->length();
+
+  v8_flags.regexp_peephole_optimization = true;
+  Handle<ByteArray> array_optimized =
+      Handle<ByteArray>::cast(opt.GetCode(source));
+  int length_optimized = array_optimized->length();
+
+  int length_expected = RegExpBytecodeLength(BC_LOAD_CURRENT_CHAR) +
+                        RegExpBytecodeLength(BC_CHECK_CHAR_IN_RANGE) +
+                        RegExpBytecodeLength(BC_FAIL) +
+                        RegExpBytecodeLength(BC_ADVANCE_CP) +
+                        RegExpBytecodeLength(BC_POP_BT);
+  const int fused_length =
+      RegExpBytecodeLength(BC_LOAD_CURRENT_CHAR_AND_CHECK_CHAR_IN_RANGE);
+  const int advance_pc = fused_length + RegExpBytecodeLength(BC_FAIL);
+  const int backtrack_pc = advance_pc + RegExpBytecodeLength(BC_ADVANCE_CP);
+  int length_optimized_expected =
+      backtrack_pc + RegExpBytecodeLength(BC_POP_BT);
+
+  CHECK_EQ(length, length_expected);
+  CHECK_EQ(length_optimized, length_optimized_expected);
+
+  CHECK_EQ(BC_LOAD_CURRENT_CHAR_AND_CHECK_CHAR_IN_RANGE,
+           array_optimized->get(0));
+  CHECK_EQ(backtrack_pc, array_optimized->get_int(4));
+  CHECK_EQ('a' | ('z' << 16), array_optimized->get_int(8));
+  CHECK_EQ(advance_pc, array_optimized->get_int(12));
+  CHECK_EQ(BC_FAIL, array_optimized->get(fused_length));
+  CHECK_EQ(BC_ADVANCE_CP, array_optimized->get(advance_pc));
+  CHECK_EQ(BC_POP_BT, array_optimized->get(backtrack_pc));
+}
+
 void CreatePeepholeLabelFixupsInsideBytecode(RegExpMacroAssembler* m,
                                              Label* dummy_before,
                                              Label* dummy_after,
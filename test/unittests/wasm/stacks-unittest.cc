@@ -0,0 +1,55 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/wasm/stacks.h"
+
+#include "test/common/flag-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8::internal::wasm {
+namespace stacks_unittest {
+
+// The pool never touches the segments, so any distinct addresses do.
+TEST(StackPool, ReusesSegmentsOfTheSameSize) {
+  FlagScope<int> pool_size(&v8_flags.wasm_stack_switching_pool_size, 4);
+  byte segments[2];
+  StackPool pool;
+  EXPECT_EQ(nullptr, pool.Get(64 * KB));
+
+  EXPECT_TRUE(pool.Add(&segments[0], 64 * KB));
+  EXPECT_TRUE(pool.Add(&segments[1], 128 * KB));
+  EXPECT_EQ(2u, pool.size());
+
+  EXPECT_EQ(nullptr, pool.Get(32 * KB));
+  EXPECT_EQ(&segments[1], pool.Get(128 * KB));
+  EXPECT_EQ(&segments[0], pool.Get(64 * KB));
+  EXPECT_EQ(nullptr, pool.Get(64 * KB));
+  EXPECT_EQ(0u, pool.size());
+}
+
+TEST(StackPool, KeepsAtMostPoolSizeSegments) {
+  FlagScope<int> pool_size(&v8_flags.wasm_stack_switching_pool_size, 2);
+  byte segments[3];
+  StackPool pool;
+  EXPECT_TRUE(pool.Add(&segments[0], 64 * KB));
+  EXPECT_TRUE(pool.Add(&segments[1], 64 * KB));
+  EXPECT_FALSE(pool.Add(&segments[2], 64 * KB));
+  EXPECT_EQ(2u, pool.size());
+
+  // Taking a segment out makes room for another one.
+  EXPECT_NE(nullptr, pool.Get(64 * KB));
+  EXPECT_TRUE(pool.Add(&segments[2], 64 * KB));
+  EXPECT_EQ(2u, pool.size());
+}
+
+TEST(StackPool, ZeroPoolSizeDisablesPooling) {
+  FlagScope<int> pool_size(&v8_flags.wasm_stack_switching_pool_size, 0);
+  byte segment;
+  StackPool pool;
+  EXPECT_FALSE(pool.Add(&segment, 64 * KB));
+  EXPECT_EQ(nullptr, pool.Get(64 * KB));
+}
+
+}  // namespace stacks_unittest
+}  // namespace v8::internal::wasm
@@ -328,6 +328,53 @@ TEST_F(WasmCapiTest, DirectCallCapiFunctionWithManyArgs) {
   EXPECT_EQ(a3 + 1, results[12].f64());
   EXPECT_EQ(a0 + 1, results[13].i32());
 }
+
+namespace {
+
+own<Trap> SumOfManyArgs(const Val args[], Val results[]) {
+  int32_t sum = 0;
+  for (int i = 0; i < 10; ++i) sum += args[i].i32();
+  results[0] = Val::i32(sum);
+  return nullptr;
+}
+
+}  // namespace
+
+TEST_F(WasmCapiTest, CallbackWithManyArgs) {
+  // Call a host function from Wasm with more parameters than the callback
+  // keeps inline, so that its Val storage falls back to the heap.
+  ownvec<ValType> cpp_params = ownvec<ValType>::make_uninitialized(10);
+  for (size_t i = 0; i < cpp_params.size(); ++i) {
+    cpp_params[i] = ValType::make(::wasm::I32);
+  }
+  own<FuncType> cpp_sig =
+      FuncType::make(std::move(cpp_params),
+                     ownvec<ValType>::make(ValType::make(::wasm::I32)));
+  own<Func> sum = Func::make(store(), cpp_sig.get(), SumOfManyArgs);
+
+  ValueType wasm_types[] = {kWasmI32, kWasmI32, kWasmI32, kWasmI32,
+                            kWasmI32, kWasmI32, kWasmI32, kWasmI32,
+                            kWasmI32, kWasmI32, kWasmI32};
+  FunctionSig wasm_sig(1, 10, wasm_types);
+  uint32_t sum_index = builder()->AddImport(base::CStrVector("sum"), &wasm_sig);
+  byte code[] = {WASM_CALL_FUNCTION(
+      sum_index, WASM_LOCAL_GET(0), WASM_LOCAL_GET(1), WASM_LOCAL_GET(2),
+      WASM_LOCAL_GET(3), WASM_LOCAL_GET(4), WASM_LOCAL_GET(5),
+      WASM_LOCAL_GET(6), WASM_LOCAL_GET(7), WASM_LOCAL_GET(8),
+      WASM_LOCAL_GET(9))};
+  AddExportedFunction(base::CStrVector("call_sum"), code, sizeof(code),
+                      &wasm_sig);
+  Extern* imports[] = {sum.get()};
+  Instantiate(imports);
+
+  Val args[10];
+  for (int i = 0; i < 10; ++i) args[i] = Val::i32(i + 1);
+  Val results[1];
+  own<Trap> trap = GetExportedFunction(0)->call(args, results);
+  EXPECT_EQ(nullptr, trap);
+  EXPECT_EQ(55, results[0].i32());
+}
+
 }  // namespace wasm
 }  // namespace internal
 }  // namespace v8
@@ -17,12 +17,15 @@ destination block only has a single predecessor, and thus guaranteeing that the
 execution counts of these basic blocks are equal to how many times the branch
 condition is true or false.
 
-Usage: get_hints.py [--min MIN] [--ratio RATIO] log_file output_file
+Usage: get_hints.py [--min MIN] [--ratio RATIO] log_file [log_file ...] output_file
 
 where:
     1. log_file is the file produced after running v8 with the
        --turbo-profiling-output=log_file flag after building with
-       v8_enable_builtins_profiling = true.
+       v8_enable_builtins_profiling = true. If several log files are given,
+       e.g. collected from different machines running the same binary, their
+       block counts are summed before any hints are derived. All files must
+       come from the same build, which is checked via the builtin hashes.
     2. output_file is the file which the hints and builtin hashes are written
        to.
     3. --min MIN provides the minimum count at which a basic block will be taken
@@ -38,7 +41,7 @@ import sys
 PARSER = argparse.ArgumentParser(
     description="A script that generates the branch hints for profile-guided \
                 optimization"                             ,
-    epilog="Example:\n\tget_hints.py --min n1 --ratio n2 branches_file log_file output_file\""
+    epilog="Example:\n\tget_hints.py --min n1 --ratio n2 log_file_1 log_file_2 output_file\""
 )
 PARSER.add_argument(
     '--min',
@@ -54,8 +57,9 @@ PARSER.add_argument(
           count,a branch destination's count is considered sufficient to \
           require a branch hint to be produced"                                               )
 PARSER.add_argument(
-    'log_file',
-    help="The v8.log file produced after running v8 with the \
+    'log_files',
+    nargs='+',
+    help="The v8.log files produced after running v8 with the \
           --turbo-profiling-output=log_file flag after building with \
           v8_enable_builtins_profiling = true")
 PARSER.add_argument(
@@ -69,10 +73,7 @@ BRANCH_HINT_MARKER = "block_hint"
 BUILTIN_HASH_MARKER = "builtin_hash"
 
 
-def parse_log_file(log_file):
-  block_counts = {}
-  branches = []
-  builtin_hashes = {}
+def parse_log_file(log_file, block_counts, branches, builtin_hashes):
   try:
     with open(log_file, "r") as f:
       for line in f.readlines():
@@ -93,18 +94,27 @@ def parse_log_file(log_file):
             old_hash = builtin_hashes[builtin_name]
             assert old_hash == builtin_hash, (
                 "Merged PGO file contains multiple incompatible builtin "
-                "versions: {old_hash} != {builtin_hash}")
+                f"versions: {old_hash} != {builtin_hash}")
           else:
             builtin_hashes[builtin_name] = builtin_hash
         elif fields[0] == BRANCH_HINT_MARKER:
           builtin_name = fields[1]
           true_block_id = int(fields[2])
           false_block_id = int(fields[3])
-          branches.append((builtin_name, true_block_id, false_block_id))
+          # The same branch is listed once per log, so deduplicate it.
+          branches[(builtin_name, true_block_id, false_block_id)] = True
   except IOError as e:
     print(f"Cannot read from {log_file}. {e.strerror}.")
     sys.exit(1)
-  return [block_counts, branches, builtin_hashes]
+
+
+def parse_log_files(log_files):
+  block_counts = {}
+  branches = {}
+  builtin_hashes = {}
+  for log_file in log_files:
+    parse_log_file(log_file, block_counts, branches, builtin_hashes)
+  return [block_counts, list(branches), builtin_hashes]
 
 
 def get_branch_hints(block_counts, branches, min_count, threshold_ratio):
@@ -144,7 +154,7 @@ def write_hints_to_output(output_file, branch_hints, builtin_hashes):
     sys.exit(1)
 
 
-[block_counts, branches, builtin_hashes] = parse_log_file(ARGS['log_file'])
+[block_counts, branches, builtin_hashes] = parse_log_files(ARGS['log_files'])
 branch_hints = get_branch_hints(block_counts, branches, ARGS['min'],
                                 ARGS['ratio'])
 
@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+
+# Copyright 2023 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can
+# be found in the LICENSE file.
+"""
+Converts a heap snapshot serialized with v8::HeapSnapshot::kBinary into the
+JSON format that DevTools and v8::HeapSnapshot::kJSON use.
+
+Usage:
+  heap-snapshot-binary-to-json.py snapshot.bin > snapshot.heapsnapshot
+
+See HeapSnapshotBinarySerializer in src/profiler/heap-snapshot-generator.h
+for a description of the binary format.
+"""
+
+import argparse
+import json
+import sys
+
+MAGIC = b"V8HSNAP\0"
+FORMAT_VERSION = 1
+
+
+class Reader(object):
+
+  def __init__(self, data):
+    self.data = data
+    self.pos = 0
+
+  def varint(self):
+    result = 0
+    shift = 0
+    while True:
+      byte = self.data[self.pos]
+      self.pos += 1
+      result |= (byte & 0x7F) << shift
+      if not byte & 0x80:
+        return result
+      shift += 7
+
+  def varints(self, count):
+    return [self.varint() for _ in range(count)]
+
+  def string(self):
+    length = self.varint()
+    value = self.data[self.pos:self.pos + length]
+    self.pos += length
+    return value.decode("utf-8", errors="replace")
+
+
+def read_trace_node(reader, out):
+  out.extend(reader.varints(4))
+  children = []
+  for _ in range(reader.varint()):
+    read_trace_node(reader, children)
+  out.append(children)
+
+
+def convert(data):
+  if not data.startswith(MAGIC):
+    raise ValueError("not a binary V8 heap snapshot")
+  reader = Reader(data)
+  reader.pos = len(MAGIC)
+  version = reader.varint()
+  if version != FORMAT_VERSION:
+    raise ValueError("unsupported binary heap snapshot version %d" % version)
+  meta = json.loads(reader.string())
+  node_fields = len(meta["node_fields"])
+  edge_fields = len(meta["edge_fields"])
+  to_node = meta["edge_fields"].index("to_node")
+
+  node_count = reader.varint()
+  nodes = reader.varints(node_count * node_fields)
+  edge_count = reader.varint()
+  edges = reader.varints(edge_count * edge_fields)
+  # The binary format stores node ordinals, JSON stores offsets into "nodes".
+  for i in range(to_node, len(edges), edge_fields):
+    edges[i] *= node_fields
+
+  trace_function_count = reader.varint()
+  trace_function_infos = reader.varints(
+      trace_function_count * len(meta["trace_function_info_fields"]))
+  trace_tree = []
+  if reader.varint():
+    read_trace_node(reader, trace_tree)
+  samples = reader.varints(reader.varint() * len(meta["sample_fields"]))
+  location_fields = len(meta["location_fields"])
+  locations = reader.varints(reader.varint() * location_fields)
+  for i in range(0, len(locations), location_fields):
+    locations[i] *= node_fields
+  strings = [reader.string() for _ in range(reader.varint())]
+
+  return {
+      "snapshot": {
+          "meta": meta,
+          "node_count": node_count,
+          "edge_count": edge_count,
+          "trace_function_count": trace_function_count,
+      },
+      "nodes": nodes,
+      "edges": edges,
+      "trace_function_infos": trace_function_infos,
+      "trace_tree": trace_tree,
+      "samples": samples,
+      "locations": locations,
+      "strings": strings,
+  }
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__,
+      formatter_class=argparse.RawDescriptionHelpFormatter)
+  parser.add_argument("input", help="binary heap snapshot")
+  parser.add_argument("-o", "--output", help="output file (default: stdout)")
+  args = parser.parse_args()
+  with open(args.input, "rb") as f:
+    snapshot = convert(f.read())
+  out = open(args.output, "w") if args.output else sys.stdout
+  json.dump(snapshot, out, separators=(",", ":"))
+  if args.output:
+    out.close()
+  return 0
+
+
+if __name__ == "__main__":
+  sys.exit(main())